@@ -41,11 +41,15 @@ int main( int argc, char** argv )
   // STEP 5: Generate suite execution reports
   executor.outputRunData();
 
+  // STEP 6: Exit with failure status if a comparison to a previous run
+  //         (--compare-to) found regressions
+  int status = executor.comparePassed() ? 0 : 1;
+
   rajaperf::getCout() << "\n\nDONE!!!...." << std::endl;
 
 #ifdef RAJA_PERFSUITE_ENABLE_MPI
   MPI_Finalize();
 #endif
 
-  return 0;
+  return status;
 }
@@ -0,0 +1,59 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+///
+/// Host compare-and-swap shared by the algorithm kernels that claim
+/// entries of an array concurrently (HASH_BUILD, BFS).
+///
+
+#ifndef RAJAPerf_Algorithm_AtomicUtils_HPP
+#define RAJAPerf_Algorithm_AtomicUtils_HPP
+
+#include "common/RPTypes.hpp"
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+//
+// Compare-and-swap of *addr with val when it equals compare; returns the
+// old value of *addr. seqCompareAndSwap is for sequential code;
+// atomicCompareAndSwap uses compiler atomics, or a critical section with
+// compilers that have none.
+//
+inline Int_type seqCompareAndSwap(Int_type* addr, Int_type compare,
+                                  Int_type val)
+{
+  Int_type old = *addr;
+  if ( old == compare ) {
+    *addr = val;
+  }
+  return old;
+}
+
+inline Int_type atomicCompareAndSwap(Int_type* addr, Int_type compare,
+                                     Int_type val)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  __atomic_compare_exchange_n(addr, &compare, val, false,
+                              __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+  return compare;
+#else
+  Int_type old;
+  #pragma omp critical (algorithm_cas)
+  {
+    old = seqCompareAndSwap(addr, compare, val);
+  }
+  return old;
+#endif
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
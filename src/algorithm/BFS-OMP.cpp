@@ -0,0 +1,280 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "BFS.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "GraphData.hpp"
+
+#include <iostream>
+#include <vector>
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+#include <omp.h>
+#endif
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+//
+// Exclusive scan of cnt into pos: each thread scans a block of the
+// array, then adds the sum of the blocks before it.
+//
+static void exclusiveScanOMP(const Int_type* cnt, Int_ptr pos, Index_type n)
+{
+  std::vector<Int_type> block_sum(omp_get_max_threads() + 1, 0);
+
+  #pragma omp parallel
+  {
+    const Index_type t = omp_get_thread_num();
+    const Index_type nt = omp_get_num_threads();
+    const Index_type ibegin = n * t / nt;
+    const Index_type iend = n * (t+1) / nt;
+
+    Int_type sum = 0;
+    for (Index_type i = ibegin; i < iend; ++i) {
+      pos[i] = sum;
+      sum += cnt[i];
+    }
+    block_sum[t+1] = sum;
+
+    #pragma omp barrier
+
+    Int_type offset = 0;
+    for (Index_type b = 0; b <= t; ++b) {
+      offset += block_sum[b];
+    }
+    for (Index_type i = ibegin; i < iend; ++i) {
+      pos[i] += offset;
+    }
+  }
+}
+
+#endif
+
+void BFS::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  BFS_DATA_SETUP;
+
+  auto bfs_init_lam = [=](Index_type v) {
+                        BFS_INIT_BODY;
+                      };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type v = 0; v < nv; ++v ) {
+          BFS_INIT_BODY;
+        }
+
+        frontiers[0] = source;
+        Index_type nfront = 1;
+        for (Int_type depth = 0; nfront > 0; ++depth) {
+
+          BFS_FRONTIER_SETUP;
+
+          Index_type ncnt;
+          if ( BFS_BOTTOM_UP_TEST ) {
+
+            #pragma omp parallel for
+            for (Index_type v = 0; v < nv; ++v ) {
+              BFS_BOTTOM_UP_BODY;
+            }
+
+            ncnt = nv;
+            exclusiveScanOMP(cnt, pos, ncnt);
+
+            #pragma omp parallel for
+            for (Index_type v = 0; v < nv; ++v ) {
+              BFS_BOTTOM_UP_COMPACT_BODY;
+            }
+
+          } else {
+
+            #pragma omp parallel for
+            for (Index_type i = 0; i < nfront; ++i ) {
+              BFS_TOP_DOWN_BODY(atomicCompareAndSwap);
+            }
+
+            ncnt = nfront;
+            exclusiveScanOMP(cnt, pos, ncnt);
+
+            #pragma omp parallel for
+            for (Index_type i = 0; i < nfront; ++i ) {
+              BFS_TOP_DOWN_COMPACT_BODY;
+            }
+
+          }
+          nfront = pos[ncnt-1] + cnt[ncnt-1];
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type v = 0; v < nv; ++v ) {
+          bfs_init_lam(v);
+        }
+
+        frontiers[0] = source;
+        Index_type nfront = 1;
+        for (Int_type depth = 0; nfront > 0; ++depth) {
+
+          BFS_FRONTIER_SETUP;
+
+          Index_type ncnt;
+          if ( BFS_BOTTOM_UP_TEST ) {
+
+            auto bfs_bottom_up_lam = [=](Index_type v) {
+                                       BFS_BOTTOM_UP_BODY;
+                                     };
+            auto bfs_bottom_up_compact_lam = [=](Index_type v) {
+                                               BFS_BOTTOM_UP_COMPACT_BODY;
+                                             };
+
+            #pragma omp parallel for
+            for (Index_type v = 0; v < nv; ++v ) {
+              bfs_bottom_up_lam(v);
+            }
+
+            ncnt = nv;
+            exclusiveScanOMP(cnt, pos, ncnt);
+
+            #pragma omp parallel for
+            for (Index_type v = 0; v < nv; ++v ) {
+              bfs_bottom_up_compact_lam(v);
+            }
+
+          } else {
+
+            auto bfs_top_down_lam = [=](Index_type i) {
+                                      BFS_TOP_DOWN_BODY(atomicCompareAndSwap);
+                                    };
+            auto bfs_top_down_compact_lam = [=](Index_type i) {
+                                              BFS_TOP_DOWN_COMPACT_BODY;
+                                            };
+
+            #pragma omp parallel for
+            for (Index_type i = 0; i < nfront; ++i ) {
+              bfs_top_down_lam(i);
+            }
+
+            ncnt = nfront;
+            exclusiveScanOMP(cnt, pos, ncnt);
+
+            #pragma omp parallel for
+            for (Index_type i = 0; i < nfront; ++i ) {
+              bfs_top_down_compact_lam(i);
+            }
+
+          }
+          nfront = pos[ncnt-1] + cnt[ncnt-1];
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nv), bfs_init_lam);
+
+        frontiers[0] = source;
+        Index_type nfront = 1;
+        for (Int_type depth = 0; nfront > 0; ++depth) {
+
+          BFS_FRONTIER_SETUP;
+
+          Index_type ncnt;
+          if ( BFS_BOTTOM_UP_TEST ) {
+
+            RAJA::forall<RAJA::omp_parallel_for_exec>(
+              RAJA::RangeSegment(0, nv), [=](Index_type v) {
+              BFS_BOTTOM_UP_BODY;
+            });
+
+            ncnt = nv;
+            RAJA::exclusive_scan<RAJA::omp_parallel_for_exec>(
+              RAJA::make_span(cnt, ncnt), RAJA::make_span(pos, ncnt));
+
+            RAJA::forall<RAJA::omp_parallel_for_exec>(
+              RAJA::RangeSegment(0, nv), [=](Index_type v) {
+              BFS_BOTTOM_UP_COMPACT_BODY;
+            });
+
+          } else {
+
+            RAJA::forall<RAJA::omp_parallel_for_exec>(
+              RAJA::RangeSegment(0, nfront), [=](Index_type i) {
+              BFS_TOP_DOWN_BODY(RAJA::atomicCAS<RAJA::omp_atomic>);
+            });
+
+            ncnt = nfront;
+            RAJA::exclusive_scan<RAJA::omp_parallel_for_exec>(
+              RAJA::make_span(cnt, ncnt), RAJA::make_span(pos, ncnt));
+
+            RAJA::forall<RAJA::omp_parallel_for_exec>(
+              RAJA::RangeSegment(0, nfront), [=](Index_type i) {
+              BFS_TOP_DOWN_COMPACT_BODY;
+            });
+
+          }
+          nfront = pos[ncnt-1] + cnt[ncnt-1];
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  BFS : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,223 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "BFS.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "GraphData.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void BFS::runSeqVariant(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  BFS_DATA_SETUP;
+
+  auto bfs_init_lam = [=](Index_type v) {
+                        BFS_INIT_BODY;
+                      };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type v = 0; v < nv; ++v ) {
+          BFS_INIT_BODY;
+        }
+
+        frontiers[0] = source;
+        Index_type nfront = 1;
+        for (Int_type depth = 0; nfront > 0; ++depth) {
+
+          BFS_FRONTIER_SETUP;
+
+          Index_type ncnt;
+          if ( BFS_BOTTOM_UP_TEST ) {
+
+            for (Index_type v = 0; v < nv; ++v ) {
+              BFS_BOTTOM_UP_BODY;
+            }
+
+            ncnt = nv;
+            BFS_SCAN_BODY;
+
+            for (Index_type v = 0; v < nv; ++v ) {
+              BFS_BOTTOM_UP_COMPACT_BODY;
+            }
+
+          } else {
+
+            for (Index_type i = 0; i < nfront; ++i ) {
+              BFS_TOP_DOWN_BODY(seqCompareAndSwap);
+            }
+
+            ncnt = nfront;
+            BFS_SCAN_BODY;
+
+            for (Index_type i = 0; i < nfront; ++i ) {
+              BFS_TOP_DOWN_COMPACT_BODY;
+            }
+
+          }
+          nfront = pos[ncnt-1] + cnt[ncnt-1];
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type v = 0; v < nv; ++v ) {
+          bfs_init_lam(v);
+        }
+
+        frontiers[0] = source;
+        Index_type nfront = 1;
+        for (Int_type depth = 0; nfront > 0; ++depth) {
+
+          BFS_FRONTIER_SETUP;
+
+          Index_type ncnt;
+          if ( BFS_BOTTOM_UP_TEST ) {
+
+            auto bfs_bottom_up_lam = [=](Index_type v) {
+                                       BFS_BOTTOM_UP_BODY;
+                                     };
+            auto bfs_bottom_up_compact_lam = [=](Index_type v) {
+                                               BFS_BOTTOM_UP_COMPACT_BODY;
+                                             };
+
+            for (Index_type v = 0; v < nv; ++v ) {
+              bfs_bottom_up_lam(v);
+            }
+
+            ncnt = nv;
+            BFS_SCAN_BODY;
+
+            for (Index_type v = 0; v < nv; ++v ) {
+              bfs_bottom_up_compact_lam(v);
+            }
+
+          } else {
+
+            auto bfs_top_down_lam = [=](Index_type i) {
+                                      BFS_TOP_DOWN_BODY(seqCompareAndSwap);
+                                    };
+            auto bfs_top_down_compact_lam = [=](Index_type i) {
+                                              BFS_TOP_DOWN_COMPACT_BODY;
+                                            };
+
+            for (Index_type i = 0; i < nfront; ++i ) {
+              bfs_top_down_lam(i);
+            }
+
+            ncnt = nfront;
+            BFS_SCAN_BODY;
+
+            for (Index_type i = 0; i < nfront; ++i ) {
+              bfs_top_down_compact_lam(i);
+            }
+
+          }
+          nfront = pos[ncnt-1] + cnt[ncnt-1];
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nv), bfs_init_lam);
+
+        frontiers[0] = source;
+        Index_type nfront = 1;
+        for (Int_type depth = 0; nfront > 0; ++depth) {
+
+          BFS_FRONTIER_SETUP;
+
+          Index_type ncnt;
+          if ( BFS_BOTTOM_UP_TEST ) {
+
+            RAJA::forall<RAJA::loop_exec>(
+              RAJA::RangeSegment(0, nv), [=](Index_type v) {
+              BFS_BOTTOM_UP_BODY;
+            });
+
+            ncnt = nv;
+            RAJA::exclusive_scan<RAJA::loop_exec>(
+              RAJA::make_span(cnt, ncnt), RAJA::make_span(pos, ncnt));
+
+            RAJA::forall<RAJA::loop_exec>(
+              RAJA::RangeSegment(0, nv), [=](Index_type v) {
+              BFS_BOTTOM_UP_COMPACT_BODY;
+            });
+
+          } else {
+
+            RAJA::forall<RAJA::loop_exec>(
+              RAJA::RangeSegment(0, nfront), [=](Index_type i) {
+              BFS_TOP_DOWN_BODY(RAJA::atomicCAS<RAJA::seq_atomic>);
+            });
+
+            ncnt = nfront;
+            RAJA::exclusive_scan<RAJA::loop_exec>(
+              RAJA::make_span(cnt, ncnt), RAJA::make_span(pos, ncnt));
+
+            RAJA::forall<RAJA::loop_exec>(
+              RAJA::RangeSegment(0, nfront), [=](Index_type i) {
+              BFS_TOP_DOWN_COMPACT_BODY;
+            });
+
+          }
+          nfront = pos[ncnt-1] + cnt[ncnt-1];
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  BFS : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,110 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+#include "BFS.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "GraphData.hpp"
+#include "common/DataUtils.hpp"
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+BFS::BFS(const RunParams& params)
+  : KernelBase(rajaperf::Algorithm_BFS, params)
+{
+  setDefaultProblemSize(1000000);  // vertices
+  setDefaultReps(10);
+
+  m_nv = getGraphNumVertices(Graph_Grid, getTargetProblemSize());
+  m_direction_optimizing = false;
+
+  setActualProblemSize( m_nv );
+
+  setItsPerRep( m_nv );
+  setKernelsPerRep(1);
+  setFLOPsPerRep(0);
+
+  std::vector<std::string> tunings{ "top_down_grid",
+                                    "top_down_rmat",
+                                    "direction_optimizing_grid",
+                                    "direction_optimizing_rmat" };
+  for (size_t t = 0; t < tunings.size(); ++t) {
+    const GraphKind kind = ( t % 2 == 0 ) ? Graph_Grid : Graph_RMAT;
+    const Index_type nv = getGraphNumVertices(kind, getTargetProblemSize());
+    const Index_type nadj = getGraphNumAdjacencies(kind, getTargetProblemSize());
+    // touched data size, not actual number of stores and loads
+    setBytesPerRep( tunings[t],
+                    (0*sizeof(Int_type) + 1*sizeof(Int_type)) * (nv+1 + nadj) +
+                    (2*sizeof(Int_type) + 2*sizeof(Int_type)) * nv );
+    // traversed edges per second
+    setDOFsPerRep( tunings[t], nadj / 2 );
+  }
+  setBytesPerRep( getBytesPerRep(tunings[0]) );
+
+  setUsesFeature(Forall);
+  setUsesFeature(Atomic);
+  setUsesFeature(Scan);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  for (size_t vid = 0; vid < NumVariants; ++vid) {
+    setVariantTuningNames(static_cast<VariantID>(vid), tunings);
+  }
+}
+
+BFS::~BFS()
+{
+}
+
+void BFS::setUp(VariantID vid)
+{
+  const GraphKind kind = ( getRunningTuning() % 2 == 0 ) ? Graph_Grid
+                                                          : Graph_RMAT;
+  m_direction_optimizing = ( getRunningTuning() >= 2 );
+
+  allocAndInitGraph(m_offsets, m_adj, kind, getTargetProblemSize(), vid);
+  m_nv = getGraphNumVertices(kind, getTargetProblemSize());
+  m_source = getGraphMaxDegreeVertex(m_offsets, m_nv);
+
+  allocAndInitDataConst(m_parent, m_nv, -1, vid);
+  allocAndInitDataConst(m_level, m_nv, -1, vid);
+  allocAndInitDataConst(m_frontier, 2*m_nv, 0, vid);
+  allocAndInitDataConst(m_cnt, m_nv, 0, vid);
+  allocAndInitDataConst(m_pos, m_nv, 0, vid);
+}
+
+void BFS::updateChecksum(VariantID vid)
+{
+  // parents depend on the order of concurrent updates; levels do not
+  checksum[vid] += calcChecksum(m_level, m_nv);
+}
+
+void BFS::tearDown(VariantID vid)
+{
+  (void) vid;
+  deallocData(m_offsets);
+  deallocData(m_adj);
+  deallocData(m_parent);
+  deallocData(m_level);
+  deallocData(m_frontier);
+  deallocData(m_cnt);
+  deallocData(m_pos);
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,180 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+///
+/// BFS kernel reference implementation:
+///
+/// parent[v] = level[v] = -1 for all v;
+/// parent[source] = source; level[source] = 0;
+/// frontier = { source };
+///
+/// for (Int_type depth = 0; frontier is not empty; ++depth ) {
+///
+///   if ( top down step ) {
+///     // frontier vertices claim unvisited neighbors
+///     for (v in frontier) {
+///       for (u in neighbors of v) {
+///         if ( atomicCAS(&parent[u], -1, v) == -1 ) level[u] = depth+1;
+///       }
+///     }
+///   } else {
+///     // unvisited vertices look for a neighbor in the frontier
+///     for (v with parent[v] == -1) {
+///       for (u in neighbors of v) {
+///         if ( level[u] == depth ) {
+///           parent[v] = u; level[v] = depth+1; break;
+///         }
+///       }
+///     }
+///   }
+///
+///   frontier = { v : level[v] == depth+1 };
+/// }
+///
+/// Breadth first search from the vertex of largest degree of a graph
+/// described in GraphData.hpp. The next frontier is compacted with an
+/// exclusive scan of the number of vertices claimed by each frontier
+/// vertex (top down) or of flags of the vertices visited (bottom up).
+/// Tunings choose the graph and whether steps are all top down, or
+/// direction optimizing: bottom up while the frontier has more than
+/// nv / BFS_BOTTOM_UP_FRACTION vertices.
+///
+
+#ifndef RAJAPerf_Algorithm_BFS_HPP
+#define RAJAPerf_Algorithm_BFS_HPP
+
+#define BFS_BOTTOM_UP_FRACTION 20
+
+#define BFS_DATA_SETUP \
+  Int_ptr offsets = m_offsets; \
+  Int_ptr adj = m_adj; \
+  Int_ptr parent = m_parent; \
+  Int_ptr level = m_level; \
+  Int_ptr frontiers = m_frontier; \
+  Int_ptr cnt = m_cnt; \
+  Int_ptr pos = m_pos; \
+  \
+  const Index_type nv = m_nv; \
+  const Int_type source = m_source; \
+  const bool direction_optimizing = m_direction_optimizing;
+
+// frontiers holds two buffers; current and next frontier swap each level
+#define BFS_FRONTIER_SETUP \
+  Int_ptr frontier = frontiers + ( depth % 2 ) * nv; \
+  Int_ptr next = frontiers + ( (depth + 1) % 2 ) * nv;
+
+#define BFS_INIT_BODY \
+  parent[v] = ( v == source ) ? source : -1; \
+  level[v] = ( v == source ) ? 0 : -1;
+
+#define BFS_TOP_DOWN_BODY(cas) \
+  const Int_type v = frontier[i]; \
+  Int_type c = 0; \
+  for (Int_type e = offsets[v]; e < offsets[v+1]; ++e) { \
+    const Int_type u = adj[e]; \
+    if ( parent[u] == -1 && cas(&parent[u], -1, v) == -1 ) { \
+      ++c; \
+    } \
+  } \
+  cnt[i] = c;
+
+#define BFS_TOP_DOWN_COMPACT_BODY \
+  const Int_type v = frontier[i]; \
+  Int_type k = pos[i]; \
+  for (Int_type e = offsets[v]; e < offsets[v+1]; ++e) { \
+    const Int_type u = adj[e]; \
+    if ( parent[u] == v && level[u] == -1 ) { \
+      level[u] = depth + 1; \
+      next[k++] = u; \
+    } \
+  }
+
+#define BFS_BOTTOM_UP_BODY \
+  Int_type c = 0; \
+  if ( parent[v] == -1 ) { \
+    for (Int_type e = offsets[v]; e < offsets[v+1]; ++e) { \
+      const Int_type u = adj[e]; \
+      if ( level[u] == depth ) { \
+        parent[v] = u; \
+        level[v] = depth + 1; \
+        c = 1; \
+        break; \
+      } \
+    } \
+  } \
+  cnt[v] = c;
+
+#define BFS_BOTTOM_UP_COMPACT_BODY \
+  if ( cnt[v] ) { \
+    next[pos[v]] = v; \
+  }
+
+#define BFS_SCAN_BODY \
+  Int_type sum = 0; \
+  for (Index_type i = 0; i < ncnt; ++i) { \
+    pos[i] = sum; \
+    sum += cnt[i]; \
+  }
+
+#define BFS_BOTTOM_UP_TEST \
+  ( direction_optimizing && nfront > nv / BFS_BOTTOM_UP_FRACTION )
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class BFS : public KernelBase
+{
+public:
+
+  BFS(const RunParams& params);
+
+  ~BFS();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  BFS : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  BFS : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  BFS : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  Int_ptr m_offsets;
+  Int_ptr m_adj;
+  Int_ptr m_parent;
+  Int_ptr m_level;
+  Int_ptr m_frontier;
+  Int_ptr m_cnt;
+  Int_ptr m_pos;
+
+  Index_type m_nv;
+  Int_type m_source;
+  bool m_direction_optimizing;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,129 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "CC.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "GraphData.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void CC::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  CC_DATA_SETUP;
+
+  auto cc_init_lam = [=](Index_type v) {
+                       CC_INIT_BODY;
+                     };
+
+  auto cc_lam = [=](Index_type v) -> Index_type {
+                  Index_type nchanged_v = 0;
+                  CC_BODY(graphAtomicMin, nchanged_v);
+                  return nchanged_v;
+                };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type v = 0; v < nv; ++v ) {
+          CC_INIT_BODY;
+        }
+
+        Index_type nchanged;
+        do {
+          nchanged = 0;
+          #pragma omp parallel for reduction(+:nchanged)
+          for (Index_type v = 0; v < nv; ++v ) {
+            CC_BODY(graphAtomicMin, nchanged);
+          }
+        } while ( nchanged > 0 );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type v = 0; v < nv; ++v ) {
+          cc_init_lam(v);
+        }
+
+        Index_type nchanged;
+        do {
+          nchanged = 0;
+          #pragma omp parallel for reduction(+:nchanged)
+          for (Index_type v = 0; v < nv; ++v ) {
+            nchanged += cc_lam(v);
+          }
+        } while ( nchanged > 0 );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nv), cc_init_lam);
+
+        bool done = false;
+        while ( !done ) {
+          RAJA::ReduceSum<RAJA::omp_reduce, Index_type> nchanged(0);
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(0, nv), [=](Index_type v) {
+            CC_BODY(RAJA::atomicMin<RAJA::omp_atomic>, nchanged);
+          });
+          done = ( nchanged.get() == 0 );
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  CC : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
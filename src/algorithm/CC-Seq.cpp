@@ -0,0 +1,121 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "CC.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "GraphData.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void CC::runSeqVariant(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  CC_DATA_SETUP;
+
+  auto cc_init_lam = [=](Index_type v) {
+                       CC_INIT_BODY;
+                     };
+
+  auto cc_lam = [=](Index_type v) -> Index_type {
+                  Index_type nchanged_v = 0;
+                  CC_BODY(graphSeqMin, nchanged_v);
+                  return nchanged_v;
+                };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type v = 0; v < nv; ++v ) {
+          CC_INIT_BODY;
+        }
+
+        Index_type nchanged;
+        do {
+          nchanged = 0;
+            for (Index_type v = 0; v < nv; ++v ) {
+            CC_BODY(graphSeqMin, nchanged);
+          }
+        } while ( nchanged > 0 );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type v = 0; v < nv; ++v ) {
+          cc_init_lam(v);
+        }
+
+        Index_type nchanged;
+        do {
+          nchanged = 0;
+            for (Index_type v = 0; v < nv; ++v ) {
+            nchanged += cc_lam(v);
+          }
+        } while ( nchanged > 0 );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nv), cc_init_lam);
+
+        bool done = false;
+        while ( !done ) {
+          RAJA::ReduceSum<RAJA::seq_reduce, Index_type> nchanged(0);
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(0, nv), [=](Index_type v) {
+            CC_BODY(RAJA::atomicMin<RAJA::seq_atomic>, nchanged);
+          });
+          done = ( nchanged.get() == 0 );
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  CC : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
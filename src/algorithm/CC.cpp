@@ -0,0 +1,94 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+#include "CC.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "GraphData.hpp"
+#include "common/DataUtils.hpp"
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+CC::CC(const RunParams& params)
+  : KernelBase(rajaperf::Algorithm_CC, params)
+{
+  setDefaultProblemSize(1000000);  // vertices
+  setDefaultReps(5);
+
+  m_nv = getGraphNumVertices(Graph_Grid, getTargetProblemSize());
+
+  setActualProblemSize( m_nv );
+
+  setItsPerRep( m_nv );
+  setKernelsPerRep(1);
+  setFLOPsPerRep(0);
+
+  std::vector<std::string> tunings{ "grid", "rmat" };
+  for (size_t t = 0; t < tunings.size(); ++t) {
+    const GraphKind kind = static_cast<GraphKind>(t);
+    const Index_type nv = getGraphNumVertices(kind, getTargetProblemSize());
+    const Index_type nadj = getGraphNumAdjacencies(kind, getTargetProblemSize());
+    // touched data size of one sweep, not actual number of stores and loads
+    setBytesPerRep( tunings[t],
+                    (0*sizeof(Int_type) + 1*sizeof(Int_type)) * (nv+1 + nadj) +
+                    (1*sizeof(Int_type) + 1*sizeof(Int_type)) * nv );
+    // graph edges per second
+    setDOFsPerRep( tunings[t], nadj / 2 );
+  }
+  setBytesPerRep( getBytesPerRep(tunings[0]) );
+
+  setUsesFeature(Forall);
+  setUsesFeature(Atomic);
+  setUsesFeature(Reduction);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  for (size_t vid = 0; vid < NumVariants; ++vid) {
+    setVariantTuningNames(static_cast<VariantID>(vid), tunings);
+  }
+}
+
+CC::~CC()
+{
+}
+
+void CC::setUp(VariantID vid)
+{
+  const GraphKind kind = static_cast<GraphKind>(getRunningTuning());
+
+  allocAndInitGraph(m_offsets, m_adj, kind, getTargetProblemSize(), vid);
+  m_nv = getGraphNumVertices(kind, getTargetProblemSize());
+
+  allocAndInitDataConst(m_labels, m_nv, -1, vid);
+}
+
+void CC::updateChecksum(VariantID vid)
+{
+  checksum[vid] += calcChecksum(m_labels, m_nv);
+}
+
+void CC::tearDown(VariantID vid)
+{
+  (void) vid;
+  deallocData(m_offsets);
+  deallocData(m_adj);
+  deallocData(m_labels);
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,103 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+///
+/// CC kernel reference implementation:
+///
+/// labels[v] = v for all v;
+///
+/// do {
+///   nchanged = 0;
+///   for (Index_type v = 0; v < nv; ++v ) {
+///     for (u in neighbors of v) {
+///       if ( labels[v] < labels[u] ) {
+///         atomicMin(&labels[u], labels[v]);
+///         ++nchanged;
+///       }
+///     }
+///   }
+/// } while ( nchanged > 0 );
+///
+/// Connected components by label propagation on a graph described in
+/// GraphData.hpp, chosen by the tuning: each vertex pushes its label to
+/// its neighbors until every vertex is labeled with the lowest numbered
+/// vertex of its component. Updates are made in place, so the number of
+/// sweeps depends on the order vertices are processed in.
+///
+
+#ifndef RAJAPerf_Algorithm_CC_HPP
+#define RAJAPerf_Algorithm_CC_HPP
+
+#define CC_DATA_SETUP \
+  Int_ptr offsets = m_offsets; \
+  Int_ptr adj = m_adj; \
+  Int_ptr labels = m_labels; \
+  \
+  const Index_type nv = m_nv;
+
+#define CC_INIT_BODY \
+  labels[v] = v;
+
+#define CC_BODY(amin, changed) \
+  const Int_type lv = labels[v]; \
+  for (Int_type e = offsets[v]; e < offsets[v+1]; ++e) { \
+    const Int_type u = adj[e]; \
+    if ( lv < labels[u] ) { \
+      amin(&labels[u], lv); \
+      changed += 1; \
+    } \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class CC : public KernelBase
+{
+public:
+
+  CC(const RunParams& params);
+
+  ~CC();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  CC : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  CC : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  CC : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  Int_ptr m_offsets;
+  Int_ptr m_adj;
+  Int_ptr m_labels;
+
+  Index_type m_nv;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,163 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+#include "GraphData.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+static Index_type getGridSide(Index_type target_size)
+{
+  Index_type n = std::cbrt(target_size);
+  while ( (n+1)*(n+1)*(n+1) <= target_size ) {
+    ++n;
+  }
+  return ( n > 1 ) ? n : 2;
+}
+
+static Index_type getRMATScale(Index_type target_size)
+{
+  Index_type scale = 1;
+  while ( (Index_type(1) << (scale+1)) <= target_size ) {
+    ++scale;
+  }
+  return scale;
+}
+
+Index_type getGraphNumVertices(GraphKind kind, Index_type target_size)
+{
+  if ( kind == Graph_RMAT ) {
+    return Index_type(1) << getRMATScale(target_size);
+  }
+  Index_type n = getGridSide(target_size);
+  return n*n*n;
+}
+
+Index_type getGraphNumAdjacencies(GraphKind kind, Index_type target_size)
+{
+  if ( kind == Graph_RMAT ) {
+    return 2 * GRAPH_RMAT_EDGE_FACTOR * getGraphNumVertices(kind, target_size);
+  }
+  Index_type n = getGridSide(target_size);
+  return 6 * (n-1)*n*n;
+}
+
+/*
+ * CSR arrays of symmetric graph with given edges, in edge order.
+ */
+static void buildCSR(Int_ptr offsets, Int_ptr adj, Index_type nv,
+                     const std::vector< std::pair<Int_type, Int_type> >& edges)
+{
+  for (Index_type v = 0; v <= nv; ++v) {
+    offsets[v] = 0;
+  }
+  for (size_t e = 0; e < edges.size(); ++e) {
+    ++offsets[edges[e].first + 1];
+    ++offsets[edges[e].second + 1];
+  }
+  for (Index_type v = 0; v < nv; ++v) {
+    offsets[v+1] += offsets[v];
+  }
+
+  std::vector<Int_type> next(offsets, offsets + nv);
+  for (size_t e = 0; e < edges.size(); ++e) {
+    adj[next[edges[e].first]++] = edges[e].second;
+    adj[next[edges[e].second]++] = edges[e].first;
+  }
+}
+
+void allocAndInitGraph(Int_ptr& offsets, Int_ptr& adj,
+                       GraphKind kind, Index_type target_size,
+                       VariantID vid)
+{
+  const Index_type nv = getGraphNumVertices(kind, target_size);
+  const Index_type nadj = getGraphNumAdjacencies(kind, target_size);
+
+  allocAndInitDataConst(offsets, nv+1, 0, vid);
+  allocAndInitDataConst(adj, nadj, 0, vid);
+
+  std::vector< std::pair<Int_type, Int_type> > edges;
+  edges.reserve(nadj / 2);
+
+  if ( kind == Graph_Grid ) {
+
+    const Index_type n = getGridSide(target_size);
+    for (Index_type k = 0; k < n; ++k) {
+      for (Index_type j = 0; j < n; ++j) {
+        for (Index_type i = 0; i < n; ++i) {
+          Int_type v = i + n*(j + n*k);
+          if ( i+1 < n ) edges.push_back( std::make_pair(v, v + 1) );
+          if ( j+1 < n ) edges.push_back( std::make_pair(v, v + n) );
+          if ( k+1 < n ) edges.push_back( std::make_pair(v, v + n*n) );
+        }
+      }
+    }
+
+  } else {
+
+    const Index_type scale = getRMATScale(target_size);
+    const Real_type a = 0.57;
+    const Real_type b = 0.19;
+    const Real_type c = 0.19;
+
+    std::mt19937 gen(4793);
+    std::uniform_real_distribution<Real_type> dist(0.0, 1.0);
+
+    for (Index_type e = 0; e < nadj / 2; ++e) {
+      Int_type src = 0;
+      Int_type dst = 0;
+      for (Index_type bit = 0; bit < scale; ++bit) {
+        Real_type r = dist(gen);
+        Int_type sbit = ( r >= a + b ) ? 1 : 0;
+        Int_type dbit = ( (r >= a && r < a + b) || r >= a + b + c ) ? 1 : 0;
+        src |= sbit << bit;
+        dst |= dbit << bit;
+      }
+      edges.push_back( std::make_pair(src, dst) );
+    }
+
+    // permute vertex numbers so high degree vertices are not clustered
+    std::vector<Int_type> perm(nv);
+    for (Index_type v = 0; v < nv; ++v) {
+      perm[v] = v;
+    }
+    for (Index_type v = nv-1; v > 0; --v) {
+      Index_type u = static_cast<Index_type>(gen() % (v+1));
+      std::swap(perm[v], perm[u]);
+    }
+    for (size_t e = 0; e < edges.size(); ++e) {
+      edges[e].first = perm[edges[e].first];
+      edges[e].second = perm[edges[e].second];
+    }
+
+  }
+
+  buildCSR(offsets, adj, nv, edges);
+}
+
+Index_type getGraphMaxDegreeVertex(const Int_type* offsets, Index_type nv)
+{
+  Index_type vmax = 0;
+  for (Index_type v = 1; v < nv; ++v) {
+    if ( offsets[v+1] - offsets[v] > offsets[vmax+1] - offsets[vmax] ) {
+      vmax = v;
+    }
+  }
+  return vmax;
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
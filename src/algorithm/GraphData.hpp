@@ -0,0 +1,105 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+///
+/// Synthetic graphs shared by the graph kernels (BFS, CC).
+///
+/// Graphs are undirected and stored in CSR form: the neighbors of vertex
+/// v are adj[offsets[v]], ..., adj[offsets[v+1]-1], and each edge appears
+/// once in the list of each of its ends. Two graphs are generated:
+///
+///   grid -- n x n x n grid with 6-point connectivity, vertex
+///           i + n*(j + n*k); the largest n with n^3 <= target size
+///   rmat -- R-MAT graph (a, b, c, d = 0.57, 0.19, 0.19, 0.05) with
+///           2^scale <= target size vertices and GRAPH_RMAT_EDGE_FACTOR
+///           edges per vertex, vertex numbers randomly permuted;
+///           duplicate edges and self loops are kept, as in Graph500
+///
+/// A fixed seed makes the graphs, and so the checksums, the same on every
+/// run.
+///
+
+#ifndef RAJAPerf_Algorithm_GraphData_HPP
+#define RAJAPerf_Algorithm_GraphData_HPP
+
+#include "common/RPTypes.hpp"
+#include "common/RAJAPerfSuite.hpp"
+#include "algorithm/AtomicUtils.hpp"
+
+#define GRAPH_RMAT_EDGE_FACTOR 8
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+enum GraphKind {
+  Graph_Grid = 0,
+  Graph_RMAT
+};
+
+/*!
+ * \brief Number of vertices and of adjacency list entries (twice the
+ *        number of edges) of graph of given kind for target size.
+ */
+Index_type getGraphNumVertices(GraphKind kind, Index_type target_size);
+Index_type getGraphNumAdjacencies(GraphKind kind, Index_type target_size);
+
+/*!
+ * \brief Allocate and generate CSR offsets and adjacency arrays of graph
+ *        of given kind for target size.
+ */
+void allocAndInitGraph(Int_ptr& offsets, Int_ptr& adj,
+                       GraphKind kind, Index_type target_size,
+                       VariantID vid);
+
+/*!
+ * \brief Vertex of largest degree (lowest numbered one if several); it is
+ *        in the largest connected component of an R-MAT graph.
+ */
+Index_type getGraphMaxDegreeVertex(const Int_type* offsets, Index_type nv);
+
+//
+// Min of *addr and val for sequential code; returns the old value of
+// *addr.
+//
+inline Int_type graphSeqMin(Int_type* addr, Int_type val)
+{
+  Int_type old = *addr;
+  if ( val < old ) {
+    *addr = val;
+  }
+  return old;
+}
+
+//
+// Atomic min of *addr and val; returns the old value of *addr. Uses
+// compiler atomics, or a critical section with compilers that have none.
+//
+inline Int_type graphAtomicMin(Int_type* addr, Int_type val)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  Int_type old = __atomic_load_n(addr, __ATOMIC_RELAXED);
+  while ( val < old &&
+          !__atomic_compare_exchange_n(addr, &old, val, true,
+                                       __ATOMIC_RELAXED, __ATOMIC_RELAXED) ) {
+  }
+  return old;
+#else
+  Int_type old;
+  #pragma omp critical (graph_atomic_min)
+  {
+    old = graphSeqMin(addr, val);
+  }
+  return old;
+#endif
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,116 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HASH_BUILD.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "HashData.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void HASH_BUILD::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  HASH_BUILD_DATA_SETUP;
+
+  auto hash_build_clear_lam = [=](Index_type slot) {
+                                 HASH_BUILD_CLEAR_BODY;
+                               };
+
+  auto hash_build_lam = [=](Index_type i) {
+                          HASH_BUILD_BODY(atomicCompareAndSwap);
+                        };
+
+  auto hash_build_raja_lam = [=](Index_type i) {
+                               HASH_BUILD_BODY(RAJA::atomicCAS<RAJA::omp_atomic>);
+                             };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type slot = 0; slot < capacity; ++slot ) {
+          HASH_BUILD_CLEAR_BODY;
+        }
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < nkeys; ++i ) {
+          HASH_BUILD_BODY(atomicCompareAndSwap);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type slot = 0; slot < capacity; ++slot ) {
+          hash_build_clear_lam(slot);
+        }
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < nkeys; ++i ) {
+          hash_build_lam(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, capacity), hash_build_clear_lam);
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nkeys), hash_build_raja_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  HASH_BUILD : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,103 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+#include "HASH_BUILD.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "HashData.hpp"
+#include "common/DataUtils.hpp"
+
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+HASH_BUILD::HASH_BUILD(const RunParams& params)
+  : KernelBase(rajaperf::Algorithm_HASH_BUILD, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(50);
+
+  m_nkeys = getTargetProblemSize();
+  m_capacity = getHashCapacity(m_nkeys, getHashBuildLoadPercent(0));
+
+  setActualProblemSize( m_nkeys );
+
+  setItsPerRep( m_nkeys );
+  setKernelsPerRep(2);
+  setFLOPsPerRep(0);
+
+  const std::vector<std::string>& tunings = getHashBuildTuningNames();
+  for (size_t t = 0; t < tunings.size(); ++t) {
+    const Index_type capacity =
+      getHashCapacity(m_nkeys, getHashBuildLoadPercent(t));
+    // touched data size, not actual number of stores and loads
+    setBytesPerRep( tunings[t],
+                    (1*sizeof(Int_type) + 0*sizeof(Int_type)) * capacity +
+                    (2*sizeof(Int_type) + 1*sizeof(Int_type)) * m_nkeys );
+    // inserts per second
+    setDOFsPerRep( tunings[t], m_nkeys );
+  }
+  setBytesPerRep( getBytesPerRep(tunings[0]) );
+
+  setUsesFeature(Forall);
+  setUsesFeature(Atomic);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  for (size_t vid = 0; vid < NumVariants; ++vid) {
+    setVariantTuningNames(static_cast<VariantID>(vid), tunings);
+  }
+}
+
+HASH_BUILD::~HASH_BUILD()
+{
+}
+
+void HASH_BUILD::setUp(VariantID vid)
+{
+  m_capacity = getHashCapacity(m_nkeys,
+                               getHashBuildLoadPercent(getRunningTuning()));
+
+  allocAndInitHashKeys(m_keys, m_nkeys, 0, vid);
+  allocAndInitDataConst(m_tkeys, m_capacity, HASH_EMPTY, vid);
+  allocAndInitDataConst(m_tvals, m_capacity, HASH_EMPTY, vid);
+}
+
+void HASH_BUILD::updateChecksum(VariantID vid)
+{
+  //
+  // Where keys land depends on the order of concurrent inserts, so
+  // checksum the value found for each key instead of the table.
+  //
+  std::vector<Int_type> found(m_nkeys);
+  for (Index_type i = 0; i < m_nkeys; ++i) {
+    found[i] = findHashKey(m_tkeys, m_tvals, m_capacity, m_keys[i]);
+  }
+  checksum[vid] += calcChecksum(found.data(), m_nkeys);
+}
+
+void HASH_BUILD::tearDown(VariantID vid)
+{
+  (void) vid;
+  deallocData(m_keys);
+  deallocData(m_tkeys);
+  deallocData(m_tvals);
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,97 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+///
+/// HASH_BUILD kernel reference implementation:
+///
+/// for (Index_type slot = 0; slot < capacity; ++slot ) {
+///   tkeys[slot] = HASH_EMPTY;
+/// }
+///
+/// for (Index_type i = 0; i < nkeys; ++i ) {
+///   Index_type slot = HASH_SLOT(keys[i], capacity);
+///   while ( atomicCAS(&tkeys[slot], HASH_EMPTY, keys[i]) != HASH_EMPTY ) {
+///     slot = ( slot + 1 < capacity ) ? slot + 1 : 0;
+///   }
+///   tvals[slot] = i;
+/// }
+///
+/// The table is described in HashData.hpp; the tuning gives the load
+/// factor nkeys / capacity.
+///
+
+#ifndef RAJAPerf_Algorithm_HASH_BUILD_HPP
+#define RAJAPerf_Algorithm_HASH_BUILD_HPP
+
+#define HASH_BUILD_DATA_SETUP \
+  Int_ptr keys = m_keys; \
+  Int_ptr tkeys = m_tkeys; \
+  Int_ptr tvals = m_tvals; \
+  \
+  const Index_type nkeys = m_nkeys; \
+  const Index_type capacity = m_capacity;
+
+#define HASH_BUILD_CLEAR_BODY \
+  tkeys[slot] = HASH_EMPTY;
+
+#define HASH_BUILD_BODY(cas) \
+  Index_type slot = HASH_SLOT(keys[i], capacity); \
+  while ( cas(&tkeys[slot], HASH_EMPTY, keys[i]) != HASH_EMPTY ) { \
+    slot = ( slot + 1 < capacity ) ? slot + 1 : 0; \
+  } \
+  tvals[slot] = i;
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class HASH_BUILD : public KernelBase
+{
+public:
+
+  HASH_BUILD(const RunParams& params);
+
+  ~HASH_BUILD();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  HASH_BUILD : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  HASH_BUILD : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  HASH_BUILD : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  Int_ptr m_keys;
+  Int_ptr m_tkeys;
+  Int_ptr m_tvals;
+
+  Index_type m_nkeys;
+  Index_type m_capacity;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
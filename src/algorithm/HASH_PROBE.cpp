@@ -0,0 +1,107 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+#include "HASH_PROBE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "HashData.hpp"
+#include "common/DataUtils.hpp"
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+HASH_PROBE::HASH_PROBE(const RunParams& params)
+  : KernelBase(rajaperf::Algorithm_HASH_PROBE, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(50);
+
+  // the table holds as many keys as are probed
+  m_nprobes = getTargetProblemSize();
+  m_capacity = getHashCapacity(m_nprobes, getHashProbeLoadPercent(0));
+
+  setActualProblemSize( m_nprobes );
+
+  setItsPerRep( m_nprobes );
+  setKernelsPerRep(1);
+  setFLOPsPerRep(0);
+
+  const std::vector<std::string>& tunings = getHashProbeTuningNames();
+  for (size_t t = 0; t < tunings.size(); ++t) {
+    const Index_type capacity =
+      getHashCapacity(m_nprobes, getHashProbeLoadPercent(t));
+    // touched data size, not actual number of stores and loads
+    setBytesPerRep( tunings[t],
+                    (1*sizeof(Int_type) + 1*sizeof(Int_type)) * m_nprobes +
+                    (0*sizeof(Int_type) + 2*sizeof(Int_type)) * capacity );
+    // probes per second
+    setDOFsPerRep( tunings[t], m_nprobes );
+  }
+  setBytesPerRep( getBytesPerRep(tunings[0]) );
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  for (size_t vid = 0; vid < NumVariants; ++vid) {
+    setVariantTuningNames(static_cast<VariantID>(vid), tunings);
+  }
+}
+
+HASH_PROBE::~HASH_PROBE()
+{
+}
+
+void HASH_PROBE::setUp(VariantID vid)
+{
+  const Index_type nkeys = m_nprobes;
+  const Index_type nhits =
+    m_nprobes * getHashProbeHitPercent(getRunningTuning()) / 100;
+
+  m_capacity = getHashCapacity(nkeys,
+                               getHashProbeLoadPercent(getRunningTuning()));
+
+  Int_ptr keys;
+  allocAndInitHashKeys(keys, nkeys, 0, vid);
+  allocAndInitDataConst(m_tkeys, m_capacity, HASH_EMPTY, vid);
+  allocAndInitDataConst(m_tvals, m_capacity, HASH_EMPTY, vid);
+  buildHashTable(m_tkeys, m_tvals, m_capacity, keys, nkeys);
+  deallocData(keys);
+
+  // the last nhits keys in the table followed by keys not in it
+  allocAndInitHashKeys(m_pkeys, m_nprobes, nkeys - nhits, vid);
+  shuffleHashKeys(m_pkeys, m_nprobes);
+
+  allocAndInitDataConst(m_vals, m_nprobes, HASH_EMPTY, vid);
+}
+
+void HASH_PROBE::updateChecksum(VariantID vid)
+{
+  checksum[vid] += calcChecksum(m_vals, m_nprobes);
+}
+
+void HASH_PROBE::tearDown(VariantID vid)
+{
+  (void) vid;
+  deallocData(m_pkeys);
+  deallocData(m_vals);
+  deallocData(m_tkeys);
+  deallocData(m_tvals);
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
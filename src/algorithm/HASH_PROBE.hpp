@@ -0,0 +1,104 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+///
+/// HASH_PROBE kernel reference implementation:
+///
+/// for (Index_type i = 0; i < nprobes; ++i ) {
+///   Index_type slot = HASH_SLOT(pkeys[i], capacity);
+///   Int_type val = HASH_EMPTY;
+///   while ( tkeys[slot] != HASH_EMPTY ) {
+///     if ( tkeys[slot] == pkeys[i] ) {
+///       val = tvals[slot];
+///       break;
+///     }
+///     slot = ( slot + 1 < capacity ) ? slot + 1 : 0;
+///   }
+///   vals[i] = val;
+/// }
+///
+/// The table, described in HashData.hpp, is built in setUp(). The tuning
+/// gives its load factor and the percentage of probed keys in the table;
+/// the probed keys are in random order.
+///
+
+#ifndef RAJAPerf_Algorithm_HASH_PROBE_HPP
+#define RAJAPerf_Algorithm_HASH_PROBE_HPP
+
+#define HASH_PROBE_DATA_SETUP \
+  Int_ptr pkeys = m_pkeys; \
+  Int_ptr vals = m_vals; \
+  Int_ptr tkeys = m_tkeys; \
+  Int_ptr tvals = m_tvals; \
+  \
+  const Index_type nprobes = m_nprobes; \
+  const Index_type capacity = m_capacity;
+
+#define HASH_PROBE_BODY \
+  const Int_type key = pkeys[i]; \
+  Index_type slot = HASH_SLOT(key, capacity); \
+  Int_type val = HASH_EMPTY; \
+  while ( tkeys[slot] != HASH_EMPTY ) { \
+    if ( tkeys[slot] == key ) { \
+      val = tvals[slot]; \
+      break; \
+    } \
+    slot = ( slot + 1 < capacity ) ? slot + 1 : 0; \
+  } \
+  vals[i] = val;
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace algorithm
+{
+
+class HASH_PROBE : public KernelBase
+{
+public:
+
+  HASH_PROBE(const RunParams& params);
+
+  ~HASH_PROBE();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  HASH_PROBE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  HASH_PROBE : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  HASH_PROBE : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  Int_ptr m_pkeys;
+  Int_ptr m_vals;
+  Int_ptr m_tkeys;
+  Int_ptr m_tvals;
+
+  Index_type m_nprobes;
+  Index_type m_capacity;
+};
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,114 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+#include "HashData.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <random>
+#include <utility>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+const std::vector<std::string>& getHashBuildTuningNames()
+{
+  static const std::vector<std::string> names {
+    "load_50",
+    "load_75",
+    "load_90"
+  };
+  return names;
+}
+
+Index_type getHashBuildLoadPercent(size_t tune_idx)
+{
+  switch ( tune_idx ) {
+    case 1 : return 75;
+    case 2 : return 90;
+    default : return 50;
+  }
+}
+
+const std::vector<std::string>& getHashProbeTuningNames()
+{
+  static const std::vector<std::string> names {
+    "load_50_hit_0",
+    "load_50_hit_50",
+    "load_50_hit_100",
+    "load_90_hit_0",
+    "load_90_hit_50",
+    "load_90_hit_100"
+  };
+  return names;
+}
+
+Index_type getHashProbeLoadPercent(size_t tune_idx)
+{
+  return ( tune_idx < 3 ) ? 50 : 90;
+}
+
+Index_type getHashProbeHitPercent(size_t tune_idx)
+{
+  return 50 * static_cast<Index_type>(tune_idx % 3);
+}
+
+Index_type getHashCapacity(Index_type nkeys, Index_type load_percent)
+{
+  Index_type capacity = (nkeys * 100 + load_percent - 1) / load_percent;
+  return ( capacity > nkeys ) ? capacity : nkeys + 1;
+}
+
+void allocAndInitHashKeys(Int_ptr& keys, Index_type len, Index_type first,
+                          VariantID vid)
+{
+  allocAndInitDataConst(keys, len, HASH_EMPTY, vid);
+  for (Index_type i = 0; i < len; ++i) {
+    // multiplication by an odd number is one to one modulo 2^31
+    unsigned long long k = static_cast<unsigned long long>(first + i);
+    keys[i] = static_cast<Int_type>( (k * 2654435761ull) & 0x7fffffffull );
+  }
+}
+
+void buildHashTable(Int_ptr tkeys, Int_ptr tvals, Index_type capacity,
+                    const Int_type* keys, Index_type nkeys)
+{
+  for (Index_type i = 0; i < nkeys; ++i) {
+    Index_type slot = HASH_SLOT(keys[i], capacity);
+    while ( seqCompareAndSwap(&tkeys[slot], HASH_EMPTY, keys[i]) != HASH_EMPTY ) {
+      slot = ( slot + 1 < capacity ) ? slot + 1 : 0;
+    }
+    tvals[slot] = i;
+  }
+}
+
+Int_type findHashKey(const Int_type* tkeys, const Int_type* tvals,
+                     Index_type capacity, Int_type key)
+{
+  Index_type slot = HASH_SLOT(key, capacity);
+  while ( tkeys[slot] != key ) {
+    if ( tkeys[slot] == HASH_EMPTY ) {
+      return HASH_EMPTY;
+    }
+    slot = ( slot + 1 < capacity ) ? slot + 1 : 0;
+  }
+  return tvals[slot];
+}
+
+void shuffleHashKeys(Int_ptr keys, Index_type len)
+{
+  std::mt19937 gen(4793);
+  for (Index_type i = len-1; i > 0; --i) {
+    Index_type j = static_cast<Index_type>(gen() % (i+1));
+    std::swap(keys[i], keys[j]);
+  }
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
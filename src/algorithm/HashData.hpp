@@ -0,0 +1,93 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+///
+/// Open addressing hash table and tunings shared by the hash table kernels
+/// (HASH_BUILD, HASH_PROBE).
+///
+/// The table has capacity slots, each a key and a value; empty slots
+/// have key HASH_EMPTY. A key goes in the first empty slot at or after
+/// HASH_SLOT(key, capacity), wrapping at the end (linear probing).
+/// Concurrent inserts claim a slot with an atomic compare-and-swap of
+/// its key. Keys are distinct nonnegative integers scattered over the
+/// Int_type range; the value stored with key number i is i.
+///
+/// Tunings set the load factor (keys / capacity) in percent and, for
+/// probes, the percentage of probed keys that are in the table.
+///
+
+#ifndef RAJAPerf_Algorithm_HashData_HPP
+#define RAJAPerf_Algorithm_HashData_HPP
+
+#include "common/RPTypes.hpp"
+#include "common/RAJAPerfSuite.hpp"
+#include "algorithm/AtomicUtils.hpp"
+
+#include <string>
+#include <vector>
+
+#define HASH_EMPTY -1
+
+#define HASH_SLOT(key, capacity) \
+  static_cast<Index_type>( \
+    ( static_cast<unsigned long long>(key) * 0x9E3779B97F4A7C15ull >> 32 ) % \
+    static_cast<unsigned long long>(capacity) )
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+/*!
+ * \brief Names of the tunings of HASH_BUILD and their load factors in
+ *        percent.
+ */
+const std::vector<std::string>& getHashBuildTuningNames();
+Index_type getHashBuildLoadPercent(size_t tune_idx);
+
+/*!
+ * \brief Names of the tunings of HASH_PROBE and their load factors and
+ *        hit ratios in percent.
+ */
+const std::vector<std::string>& getHashProbeTuningNames();
+Index_type getHashProbeLoadPercent(size_t tune_idx);
+Index_type getHashProbeHitPercent(size_t tune_idx);
+
+/*!
+ * \brief Number of table slots for nkeys keys at the given load factor.
+ */
+Index_type getHashCapacity(Index_type nkeys, Index_type load_percent);
+
+/*!
+ * \brief Allocate and initialize array with keys number first, ...,
+ *        first+len-1.
+ */
+void allocAndInitHashKeys(Int_ptr& keys, Index_type len, Index_type first,
+                          VariantID vid);
+
+/*!
+ * \brief Insert keys[i] with value i for i < nkeys into an empty table.
+ */
+void buildHashTable(Int_ptr tkeys, Int_ptr tvals, Index_type capacity,
+                    const Int_type* keys, Index_type nkeys);
+
+/*!
+ * \brief Value stored with key in table, or HASH_EMPTY if it is absent.
+ */
+Int_type findHashKey(const Int_type* tkeys, const Int_type* tvals,
+                     Index_type capacity, Int_type key);
+
+/*!
+ * \brief Shuffle entries of array with a fixed seed, so the order is the
+ *        same on every run.
+ */
+void shuffleHashKeys(Int_ptr keys, Index_type len);
+
+} // end namespace algorithm
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,195 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "BATCHED_GEMM.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "BatchedData.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+template < Index_type M >
+void BATCHED_GEMM::runSeqVariantAoM(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  BATCHED_GEMM_DATA_SETUP;
+
+  auto batched_gemm_aom_lam = [=](Index_type e) {
+                                BATCHED_GEMM_BODY_AOM;
+                              };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type e = 0; e < nbatch; ++e ) {
+          BATCHED_GEMM_BODY_AOM;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type e = 0; e < nbatch; ++e ) {
+          batched_gemm_aom_lam(e);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      using launch_policy = RAJA::expt::LaunchPolicy<RAJA::expt::seq_launch_t>;
+
+      using outer_x = RAJA::expt::LoopPolicy<RAJA::loop_exec>;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::expt::launch<launch_policy>(
+          RAJA::expt::HOST, RAJA::expt::Grid(),
+          [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+
+            RAJA::expt::loop<outer_x>(ctx, RAJA::RangeSegment(0, nbatch),
+              [&](Index_type e) {
+                BATCHED_GEMM_BODY_AOM;
+              }
+            );
+
+          }
+        );
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  BATCHED_GEMM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+template < Index_type M >
+void BATCHED_GEMM::runSeqVariantInterleaved(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  BATCHED_GEMM_DATA_SETUP;
+
+  const Index_type nchunks = (nbatch + BATCHED_CHUNK - 1) / BATCHED_CHUNK;
+
+  auto batched_gemm_interleaved_lam = [=](Index_type ic) {
+                                        BATCHED_CHUNK_SETUP;
+                                        BATCHED_GEMM_BODY_INTERLEAVED;
+                                      };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type ic = 0; ic < nchunks; ++ic ) {
+          BATCHED_CHUNK_SETUP;
+          BATCHED_GEMM_BODY_INTERLEAVED;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type ic = 0; ic < nchunks; ++ic ) {
+          batched_gemm_interleaved_lam(ic);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      using launch_policy = RAJA::expt::LaunchPolicy<RAJA::expt::seq_launch_t>;
+
+      using outer_x = RAJA::expt::LoopPolicy<RAJA::loop_exec>;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::expt::launch<launch_policy>(
+          RAJA::expt::HOST, RAJA::expt::Grid(),
+          [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+
+            RAJA::expt::loop<outer_x>(ctx, RAJA::RangeSegment(0, nchunks),
+              [&](Index_type ic) {
+                BATCHED_CHUNK_SETUP;
+                BATCHED_GEMM_BODY_INTERLEAVED;
+              }
+            );
+
+          }
+        );
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  BATCHED_GEMM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void BATCHED_GEMM::runSeqVariant(VariantID vid)
+{
+  BATCHED_TUNING_DISPATCH(getRunningTuning(), runSeqVariantAoM,
+                          runSeqVariantInterleaved, vid)
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,131 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// BATCHED_GEMM kernel reference implementation:
+///
+/// for (Index_type e = 0; e < nbatch; ++e ) {
+///   for (Index_type i = 0; i < M; ++i ) {
+///     for (Index_type j = 0; j < M; ++j ) {
+///       C_e[i][j] = 0.0;
+///       for (Index_type k = 0; k < M; ++k ) {
+///         C_e[i][j] += A_e[i][k] * B_e[k][j];
+///       }
+///     }
+///   }
+/// }
+///
+/// C_e = A_e * B_e for each of the nbatch M x M matrices A_e, B_e.
+/// The matrix size M and the layout are given by the tuning; see
+/// BatchedData.hpp.
+///
+
+#ifndef RAJAPerf_Apps_BATCHED_GEMM_HPP
+#define RAJAPerf_Apps_BATCHED_GEMM_HPP
+
+#define BATCHED_GEMM_DATA_SETUP \
+  Real_ptr A = m_A; \
+  Real_ptr B = m_B; \
+  Real_ptr C = m_C; \
+  const Index_type nbatch = m_nbatch;
+
+// matrix e in array of matrices layout
+#define BATCHED_GEMM_BODY_AOM \
+  const Real_type* a = A + e*M*M; \
+  const Real_type* b = B + e*M*M; \
+  Real_ptr c = C + e*M*M; \
+  for (Index_type i = 0; i < M; ++i) { \
+    for (Index_type j = 0; j < M; ++j) { \
+      c[i*M + j] = 0.0; \
+    } \
+    for (Index_type k = 0; k < M; ++k) { \
+      const Real_type a_ik = a[i*M + k]; \
+      for (Index_type j = 0; j < M; ++j) { \
+        c[i*M + j] += a_ik * b[k*M + j]; \
+      } \
+    } \
+  }
+
+// matrices [ebegin, eend) in interleaved layout
+#define BATCHED_GEMM_BODY_INTERLEAVED \
+  for (Index_type i = 0; i < M; ++i) { \
+    for (Index_type j = 0; j < M; ++j) { \
+      Real_ptr c_ij = C + (i*M + j)*nbatch; \
+      for (Index_type e = ebegin; e < eend; ++e) { \
+        c_ij[e] = 0.0; \
+      } \
+      for (Index_type k = 0; k < M; ++k) { \
+        const Real_type* a_ik = A + (i*M + k)*nbatch; \
+        const Real_type* b_kj = B + (k*M + j)*nbatch; \
+        for (Index_type e = ebegin; e < eend; ++e) { \
+          c_ij[e] += a_ik[e] * b_kj[e]; \
+        } \
+      } \
+    } \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+class BATCHED_GEMM : public KernelBase
+{
+public:
+
+  BATCHED_GEMM(const RunParams& params);
+
+  ~BATCHED_GEMM();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  BATCHED_GEMM : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  BATCHED_GEMM : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  BATCHED_GEMM : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  template < Index_type M >
+  void runSeqVariantAoM(VariantID vid);
+  template < Index_type M >
+  void runSeqVariantInterleaved(VariantID vid);
+
+  template < Index_type M >
+  void runOpenMPVariantAoM(VariantID vid);
+  template < Index_type M >
+  void runOpenMPVariantInterleaved(VariantID vid);
+
+  Real_ptr m_A;
+  Real_ptr m_B;
+  Real_ptr m_C;
+
+  Index_type m_M;
+  Index_type m_nbatch;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,205 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "BATCHED_LU.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "BatchedData.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+template < Index_type M >
+void BATCHED_LU::runOpenMPVariantAoM(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  BATCHED_LU_DATA_SETUP;
+
+  auto batched_lu_aom_lam = [=](Index_type e) {
+                              BATCHED_LU_BODY_AOM;
+                            };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type e = 0; e < nbatch; ++e ) {
+          BATCHED_LU_BODY_AOM;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type e = 0; e < nbatch; ++e ) {
+          batched_lu_aom_lam(e);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using launch_policy = RAJA::expt::LaunchPolicy<RAJA::expt::omp_launch_t>;
+
+      using outer_x = RAJA::expt::LoopPolicy<RAJA::omp_for_exec>;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::expt::launch<launch_policy>(
+          RAJA::expt::HOST, RAJA::expt::Grid(),
+          [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+
+            RAJA::expt::loop<outer_x>(ctx, RAJA::RangeSegment(0, nbatch),
+              [&](Index_type e) {
+                BATCHED_LU_BODY_AOM;
+              }
+            );
+
+          }
+        );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  BATCHED_LU : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+template < Index_type M >
+void BATCHED_LU::runOpenMPVariantInterleaved(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  BATCHED_LU_DATA_SETUP;
+
+  const Index_type nchunks = (nbatch + BATCHED_CHUNK - 1) / BATCHED_CHUNK;
+
+  auto batched_lu_interleaved_lam = [=](Index_type ic) {
+                                      BATCHED_CHUNK_SETUP;
+                                      BATCHED_LU_BODY_INTERLEAVED;
+                                    };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type ic = 0; ic < nchunks; ++ic ) {
+          BATCHED_CHUNK_SETUP;
+          BATCHED_LU_BODY_INTERLEAVED;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type ic = 0; ic < nchunks; ++ic ) {
+          batched_lu_interleaved_lam(ic);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using launch_policy = RAJA::expt::LaunchPolicy<RAJA::expt::omp_launch_t>;
+
+      using outer_x = RAJA::expt::LoopPolicy<RAJA::omp_for_exec>;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::expt::launch<launch_policy>(
+          RAJA::expt::HOST, RAJA::expt::Grid(),
+          [=] RAJA_HOST_DEVICE(RAJA::expt::LaunchContext ctx) {
+
+            RAJA::expt::loop<outer_x>(ctx, RAJA::RangeSegment(0, nchunks),
+              [&](Index_type ic) {
+                BATCHED_CHUNK_SETUP;
+                BATCHED_LU_BODY_INTERLEAVED;
+              }
+            );
+
+          }
+        );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  BATCHED_LU : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void BATCHED_LU::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  BATCHED_TUNING_DISPATCH(getRunningTuning(), runOpenMPVariantAoM,
+                          runOpenMPVariantInterleaved, vid)
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,98 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "BATCHED_LU.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "BatchedData.hpp"
+#include "common/DataUtils.hpp"
+
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+BATCHED_LU::BATCHED_LU(const RunParams& params)
+  : KernelBase(rajaperf::Apps_BATCHED_LU, params)
+{
+  setDefaultProblemSize(1024*1024);
+  setDefaultReps(20);
+
+  // Problem size, bytes, and FLOPs are given for 8 x 8 matrices; bytes
+  // and FLOPs of each tuning are also given below.
+  m_M = 8;
+  m_nbatch = getBatchedNumMatrices(getTargetProblemSize(), m_M);
+
+  setActualProblemSize( m_M * m_M * m_nbatch );
+
+  setItsPerRep( m_nbatch );
+  setKernelsPerRep(1);
+
+  const std::vector<std::string>& tunings = getBatchedTuningNames();
+  for (size_t t = 0; t < tunings.size(); ++t) {
+    const Index_type M = getBatchedMatrixSize(t);
+    const Index_type nbatch = getBatchedNumMatrices(getTargetProblemSize(), M);
+    setBytesPerRep( tunings[t],
+                    (1*sizeof(Real_type) + 1*sizeof(Real_type)) * M*M*nbatch );
+    setFLOPsPerRep( tunings[t], ( M*(M-1)/2 + (M-1)*M*(2*M-1)/3 ) * nbatch );
+    if ( M == m_M ) {
+      setBytesPerRep( getBytesPerRep(tunings[t]) );
+      setFLOPsPerRep( getFLOPsPerRep(tunings[t]) );
+    }
+  }
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Teams);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  for (size_t vid = 0; vid < NumVariants; ++vid) {
+    setVariantTuningNames(static_cast<VariantID>(vid), tunings);
+  }
+}
+
+BATCHED_LU::~BATCHED_LU()
+{
+}
+
+void BATCHED_LU::setUp(VariantID vid)
+{
+  m_M = getBatchedMatrixSize(getRunningTuning());
+  m_nbatch = getBatchedNumMatrices(getTargetProblemSize(), m_M);
+  const bool interleaved = getBatchedInterleaved(getRunningTuning());
+
+  allocAndInitBatchedMatrices(m_A, m_M, m_nbatch, interleaved, vid);
+  allocAndInitDataConst(m_LU, m_M*m_M*m_nbatch, 0.0, vid);
+}
+
+void BATCHED_LU::updateChecksum(VariantID vid)
+{
+  checksum[vid] += calcChecksum(m_LU, m_M*m_M*m_nbatch, checksum_scale_factor );
+}
+
+void BATCHED_LU::tearDown(VariantID vid)
+{
+  (void) vid;
+  deallocData(m_A);
+  deallocData(m_LU);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
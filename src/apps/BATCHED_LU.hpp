@@ -0,0 +1,135 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// BATCHED_LU kernel reference implementation:
+///
+/// for (Index_type e = 0; e < nbatch; ++e ) {
+///   LU_e = A_e;
+///   for (Index_type k = 0; k < M; ++k ) {
+///     for (Index_type i = k+1; i < M; ++i ) {
+///       LU_e[i][k] /= LU_e[k][k];
+///       for (Index_type j = k+1; j < M; ++j ) {
+///         LU_e[i][j] -= LU_e[i][k] * LU_e[k][j];
+///       }
+///     }
+///   }
+/// }
+///
+/// LU factorization without pivoting of each of the nbatch M x M matrices
+/// A_e, which are diagonally dominant. The unit lower triangular factor
+/// is stored below the diagonal of LU_e and the upper factor on and above.
+/// The matrix size M and the layout are given by the tuning; see
+/// BatchedData.hpp.
+///
+
+#ifndef RAJAPerf_Apps_BATCHED_LU_HPP
+#define RAJAPerf_Apps_BATCHED_LU_HPP
+
+#define BATCHED_LU_DATA_SETUP \
+  Real_ptr A = m_A; \
+  Real_ptr LU = m_LU; \
+  const Index_type nbatch = m_nbatch;
+
+// matrix e in array of matrices layout
+#define BATCHED_LU_BODY_AOM \
+  const Real_type* a = A + e*M*M; \
+  Real_ptr lu = LU + e*M*M; \
+  for (Index_type i = 0; i < M*M; ++i) { \
+    lu[i] = a[i]; \
+  } \
+  for (Index_type k = 0; k < M; ++k) { \
+    for (Index_type i = k+1; i < M; ++i) { \
+      lu[i*M + k] /= lu[k*M + k]; \
+      for (Index_type j = k+1; j < M; ++j) { \
+        lu[i*M + j] -= lu[i*M + k] * lu[k*M + j]; \
+      } \
+    } \
+  }
+
+// matrices [ebegin, eend) in interleaved layout
+#define BATCHED_LU_BODY_INTERLEAVED \
+  for (Index_type i = 0; i < M*M; ++i) { \
+    for (Index_type e = ebegin; e < eend; ++e) { \
+      LU[i*nbatch + e] = A[i*nbatch + e]; \
+    } \
+  } \
+  for (Index_type k = 0; k < M; ++k) { \
+    const Real_type* lu_k = LU + k*M*nbatch; \
+    for (Index_type i = k+1; i < M; ++i) { \
+      Real_ptr lu_i = LU + i*M*nbatch; \
+      for (Index_type e = ebegin; e < eend; ++e) { \
+        lu_i[k*nbatch + e] /= lu_k[k*nbatch + e]; \
+      } \
+      for (Index_type j = k+1; j < M; ++j) { \
+        for (Index_type e = ebegin; e < eend; ++e) { \
+          lu_i[j*nbatch + e] -= lu_i[k*nbatch + e] * lu_k[j*nbatch + e]; \
+        } \
+      } \
+    } \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+class BATCHED_LU : public KernelBase
+{
+public:
+
+  BATCHED_LU(const RunParams& params);
+
+  ~BATCHED_LU();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  BATCHED_LU : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  BATCHED_LU : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  BATCHED_LU : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  template < Index_type M >
+  void runSeqVariantAoM(VariantID vid);
+  template < Index_type M >
+  void runSeqVariantInterleaved(VariantID vid);
+
+  template < Index_type M >
+  void runOpenMPVariantAoM(VariantID vid);
+  template < Index_type M >
+  void runOpenMPVariantInterleaved(VariantID vid);
+
+  Real_ptr m_A;
+  Real_ptr m_LU;
+
+  Index_type m_M;
+  Index_type m_nbatch;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
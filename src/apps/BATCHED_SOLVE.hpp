@@ -0,0 +1,150 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// BATCHED_SOLVE kernel reference implementation:
+///
+/// for (Index_type e = 0; e < nbatch; ++e ) {
+///   for (Index_type i = 0; i < M; ++i ) {
+///     x_e[i] = b_e[i];
+///     for (Index_type k = 0; k < i; ++k ) {
+///       x_e[i] -= LU_e[i][k] * x_e[k];
+///     }
+///   }
+///   for (Index_type i = M-1; i >= 0; --i ) {
+///     for (Index_type k = i+1; k < M; ++k ) {
+///       x_e[i] -= LU_e[i][k] * x_e[k];
+///     }
+///     x_e[i] /= LU_e[i][i];
+///   }
+/// }
+///
+/// Solve LU_e x_e = b_e for each of the nbatch M x M matrices LU_e, which
+/// hold LU factors computed in setUp() as in BATCHED_LU, by forward and
+/// back substitution.
+/// The matrix size M and the layout are given by the tuning; see
+/// BatchedData.hpp.
+///
+
+#ifndef RAJAPerf_Apps_BATCHED_SOLVE_HPP
+#define RAJAPerf_Apps_BATCHED_SOLVE_HPP
+
+#define BATCHED_SOLVE_DATA_SETUP \
+  Real_ptr LU = m_LU; \
+  Real_ptr B = m_b; \
+  Real_ptr X = m_x; \
+  const Index_type nbatch = m_nbatch;
+
+// matrix e in array of matrices layout
+#define BATCHED_SOLVE_BODY_AOM \
+  const Real_type* lu = LU + e*M*M; \
+  const Real_type* b = B + e*M; \
+  Real_ptr x = X + e*M; \
+  for (Index_type i = 0; i < M; ++i) { \
+    x[i] = b[i]; \
+    for (Index_type k = 0; k < i; ++k) { \
+      x[i] -= lu[i*M + k] * x[k]; \
+    } \
+  } \
+  for (Index_type i = M-1; i >= 0; --i) { \
+    for (Index_type k = i+1; k < M; ++k) { \
+      x[i] -= lu[i*M + k] * x[k]; \
+    } \
+    x[i] /= lu[i*M + i]; \
+  }
+
+// matrices [ebegin, eend) in interleaved layout
+#define BATCHED_SOLVE_BODY_INTERLEAVED \
+  for (Index_type i = 0; i < M; ++i) { \
+    Real_ptr x_i = X + i*nbatch; \
+    for (Index_type e = ebegin; e < eend; ++e) { \
+      x_i[e] = B[i*nbatch + e]; \
+    } \
+    for (Index_type k = 0; k < i; ++k) { \
+      const Real_type* lu_ik = LU + (i*M + k)*nbatch; \
+      const Real_type* x_k = X + k*nbatch; \
+      for (Index_type e = ebegin; e < eend; ++e) { \
+        x_i[e] -= lu_ik[e] * x_k[e]; \
+      } \
+    } \
+  } \
+  for (Index_type i = M-1; i >= 0; --i) { \
+    Real_ptr x_i = X + i*nbatch; \
+    for (Index_type k = i+1; k < M; ++k) { \
+      const Real_type* lu_ik = LU + (i*M + k)*nbatch; \
+      const Real_type* x_k = X + k*nbatch; \
+      for (Index_type e = ebegin; e < eend; ++e) { \
+        x_i[e] -= lu_ik[e] * x_k[e]; \
+      } \
+    } \
+    const Real_type* lu_ii = LU + (i*M + i)*nbatch; \
+    for (Index_type e = ebegin; e < eend; ++e) { \
+      x_i[e] /= lu_ii[e]; \
+    } \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+class BATCHED_SOLVE : public KernelBase
+{
+public:
+
+  BATCHED_SOLVE(const RunParams& params);
+
+  ~BATCHED_SOLVE();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  BATCHED_SOLVE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  BATCHED_SOLVE : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  BATCHED_SOLVE : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  template < Index_type M >
+  void runSeqVariantAoM(VariantID vid);
+  template < Index_type M >
+  void runSeqVariantInterleaved(VariantID vid);
+
+  template < Index_type M >
+  void runOpenMPVariantAoM(VariantID vid);
+  template < Index_type M >
+  void runOpenMPVariantInterleaved(VariantID vid);
+
+  Real_ptr m_LU;
+  Real_ptr m_b;
+  Real_ptr m_x;
+
+  Index_type m_M;
+  Index_type m_nbatch;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,87 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "BatchedData.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+const std::vector<std::string>& getBatchedTuningNames()
+{
+  static const std::vector<std::string> names {
+    "aom_4",
+    "aom_8",
+    "aom_16",
+    "aom_32",
+    "interleaved_4",
+    "interleaved_8",
+    "interleaved_16",
+    "interleaved_32"
+  };
+  return names;
+}
+
+Index_type getBatchedMatrixSize(size_t tune_idx)
+{
+  return Index_type(4) << (tune_idx % 4);
+}
+
+bool getBatchedInterleaved(size_t tune_idx)
+{
+  return tune_idx >= 4;
+}
+
+Index_type getBatchedNumMatrices(Index_type target_size, Index_type M)
+{
+  return std::max(target_size / (M*M), Index_type(1));
+}
+
+void allocAndInitBatchedMatrices(Real_ptr& A, Index_type M,
+                                 Index_type nbatch, bool interleaved,
+                                 VariantID vid)
+{
+  //
+  // Entries from initData are less than one in magnitude, so adding M
+  // to the diagonal makes each matrix diagonally dominant.
+  //
+  allocAndInitData(A, M*M*nbatch, vid);
+  for (Index_type e = 0; e < nbatch; ++e) {
+    for (Index_type r = 0; r < M; ++r) {
+      Index_type idx = interleaved ? (r*M + r)*nbatch + e : e*M*M + r*M + r;
+      A[idx] += M;
+    }
+  }
+}
+
+void factorBatchedMatrices(Real_ptr A, Index_type M,
+                           Index_type nbatch, bool interleaved)
+{
+  const Index_type estride = interleaved ? 1 : M*M;
+  const Index_type stride = interleaved ? nbatch : 1;
+
+  for (Index_type e = 0; e < nbatch; ++e) {
+    Real_ptr a = A + e*estride;
+    for (Index_type k = 0; k < M; ++k) {
+      for (Index_type r = k+1; r < M; ++r) {
+        a[(r*M + k)*stride] /= a[(k*M + k)*stride];
+        for (Index_type c = k+1; c < M; ++c) {
+          a[(r*M + c)*stride] -= a[(r*M + k)*stride] * a[(k*M + c)*stride];
+        }
+      }
+    }
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
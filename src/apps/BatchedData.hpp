@@ -0,0 +1,111 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Tunings and data layouts shared by the batched small dense linear
+/// algebra kernels (BATCHED_GEMM, BATCHED_LU, BATCHED_SOLVE).
+///
+/// Each kernel works on nbatch M x M matrices, with the matrix size M a
+/// template parameter of the kernel implementation, and has a tuning for
+/// each of the sizes M = 4, 8, 16, 32 (the cases of BATCHED_TUNING_DISPATCH)
+/// and each of two layouts:
+///
+///   aom_<M>         -- array of matrices; entry (r,c) of matrix e is at
+///                      e*M*M + r*M + c and each matrix is done in turn
+///   interleaved_<M> -- entry (r,c) of matrix e is at (r*M + c)*nbatch + e;
+///                      chunks of BATCHED_CHUNK matrices are done together,
+///                      with the loop over matrices innermost so that it
+///                      may be vectorized
+///
+/// Vectors are stored the same way, with entry r of vector e at e*M + r
+/// or r*nbatch + e.
+///
+/// The number of matrices is chosen so that all sizes have about the same
+/// number of matrix entries.
+///
+
+#ifndef RAJAPerf_Apps_BatchedData_HPP
+#define RAJAPerf_Apps_BatchedData_HPP
+
+#include "common/RPTypes.hpp"
+#include "common/RAJAPerfSuite.hpp"
+
+#include <string>
+#include <vector>
+
+#define BATCHED_CHUNK 64
+
+//
+// Range of matrices [ebegin, eend) in chunk ic of the interleaved layout.
+//
+#define BATCHED_CHUNK_SETUP \
+  const Index_type ebegin = ic * BATCHED_CHUNK; \
+  const Index_type eend = (ebegin + BATCHED_CHUNK < nbatch) ? \
+                          ebegin + BATCHED_CHUNK : nbatch;
+
+//
+// Call the layout implementation of the running tuning with the matrix
+// size as template argument; the order of cases must match the names
+// returned by getBatchedTuningNames().
+//
+#define BATCHED_TUNING_DISPATCH(tune_idx, aom, interleaved, vid) \
+  switch (tune_idx) { \
+    case 0: aom<4>(vid); break; \
+    case 1: aom<8>(vid); break; \
+    case 2: aom<16>(vid); break; \
+    case 3: aom<32>(vid); break; \
+    case 4: interleaved<4>(vid); break; \
+    case 5: interleaved<8>(vid); break; \
+    case 6: interleaved<16>(vid); break; \
+    case 7: interleaved<32>(vid); break; \
+    default: \
+      getCout() << "\n  " << getName() \
+                << " : Unknown tuning = " << tune_idx << std::endl; \
+  }
+
+namespace rajaperf
+{
+namespace apps
+{
+
+/*!
+ * \brief Names of the tunings of the batched kernels.
+ */
+const std::vector<std::string>& getBatchedTuningNames();
+
+/*!
+ * \brief Matrix size and layout of the tuning with given index.
+ */
+Index_type getBatchedMatrixSize(size_t tune_idx);
+bool getBatchedInterleaved(size_t tune_idx);
+
+/*!
+ * \brief Number of M x M matrices with about target_size entries in all.
+ */
+Index_type getBatchedNumMatrices(Index_type target_size, Index_type M);
+
+/*!
+ * \brief Allocate and fill nbatch M x M matrices in given layout. The
+ *        matrices are strictly diagonally dominant, so they can be
+ *        factored without pivoting.
+ */
+void allocAndInitBatchedMatrices(Real_ptr& A, Index_type M,
+                                 Index_type nbatch, bool interleaved,
+                                 VariantID vid);
+
+/*!
+ * \brief Replace matrices in given layout with their LU factors (unit
+ *        lower triangle of L below the diagonal, U on and above it).
+ */
+void factorBatchedMatrices(Real_ptr A, Index_type M,
+                           Index_type nbatch, bool interleaved);
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,562 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "CG.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "AppsData.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+template < bool csr >
+void CG::runOpenMPVariantStandard(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  CG_DATA_SETUP;
+
+  CG_STANDARD_DATA_SETUP;
+
+  CG_CSR_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type rr = 0.0;
+        #pragma omp parallel for reduction(+:rr)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          CG_INIT_BODY;
+          CG_DOT_BODY(rr, r, r);
+        }
+
+        for (Index_type it = 0; it < CG_NUM_ITERATIONS; ++it) {
+
+          if ( csr ) {
+
+            #pragma omp parallel for
+            for (Index_type ip = ibegin; ip < iend; ++ip ) {
+              CG_CSR_BODY(Ap, p);
+            }
+
+          } else {
+
+            #pragma omp parallel for
+            for (Index_type k = kmin; k < kmax; ++k ) {
+              for (Index_type j = jmin; j < jmax; ++j ) {
+                for (Index_type i = imin; i < imax; ++i ) {
+                  CG_STENCIL_BODY(Ap, p);
+                }
+              }
+            }
+
+          }
+
+          Real_type pAp = 0.0;
+          #pragma omp parallel for reduction(+:pAp)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            CG_DOT_BODY(pAp, p, Ap);
+          }
+          const Real_type alpha = rr / pAp;
+
+          Real_type rr_new = 0.0;
+          #pragma omp parallel for reduction(+:rr_new)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            CG_UPDATE_BODY(rr_new);
+          }
+          const Real_type beta = rr_new / rr;
+          rr = rr_new;
+
+          #pragma omp parallel for
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            CG_DIRECTION_BODY;
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto cg_init_lam = [=](Index_type i, Real_type& rr) {
+                           CG_INIT_BODY;
+                           CG_DOT_BODY(rr, r, r);
+                         };
+      auto cg_csr_lam = [=](Index_type ip) {
+                          CG_CSR_BODY(Ap, p);
+                        };
+      auto cg_stencil_lam = [=](Index_type i, Index_type j, Index_type k) {
+                              CG_STENCIL_BODY(Ap, p);
+                            };
+      auto cg_dot_lam = [=](Index_type i, Real_type& pAp) {
+                          CG_DOT_BODY(pAp, p, Ap);
+                        };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type rr = 0.0;
+        #pragma omp parallel for reduction(+:rr)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          cg_init_lam(i, rr);
+        }
+
+        for (Index_type it = 0; it < CG_NUM_ITERATIONS; ++it) {
+
+          if ( csr ) {
+
+            #pragma omp parallel for
+            for (Index_type ip = ibegin; ip < iend; ++ip ) {
+              cg_csr_lam(ip);
+            }
+
+          } else {
+
+            #pragma omp parallel for
+            for (Index_type k = kmin; k < kmax; ++k ) {
+              for (Index_type j = jmin; j < jmax; ++j ) {
+                for (Index_type i = imin; i < imax; ++i ) {
+                  cg_stencil_lam(i, j, k);
+                }
+              }
+            }
+
+          }
+
+          Real_type pAp = 0.0;
+          #pragma omp parallel for reduction(+:pAp)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            cg_dot_lam(i, pAp);
+          }
+          const Real_type alpha = rr / pAp;
+
+          auto cg_update_lam = [=](Index_type i, Real_type& rr_new) {
+                                 CG_UPDATE_BODY(rr_new);
+                               };
+
+          Real_type rr_new = 0.0;
+          #pragma omp parallel for reduction(+:rr_new)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            cg_update_lam(i, rr_new);
+          }
+          const Real_type beta = rr_new / rr;
+          rr = rr_new;
+
+          auto cg_direction_lam = [=](Index_type i) {
+                                    CG_DIRECTION_BODY;
+                                  };
+
+          #pragma omp parallel for
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            cg_direction_lam(i);
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<2, RAJA::omp_parallel_for_exec,    // k
+            RAJA::statement::For<1, RAJA::loop_exec,    // j
+              RAJA::statement::For<0, RAJA::loop_exec,    // i
+                RAJA::statement::Lambda<0>
+              >
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceSum<RAJA::omp_reduce, Real_type> rr0(0.0);
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          CG_INIT_BODY;
+          CG_DOT_BODY(rr0, r, r);
+        });
+        Real_type rr = rr0.get();
+
+        for (Index_type it = 0; it < CG_NUM_ITERATIONS; ++it) {
+
+          if ( csr ) {
+
+            RAJA::forall<RAJA::omp_parallel_for_exec>(
+              RAJA::RangeSegment(ibegin, iend), [=](Index_type ip) {
+              CG_CSR_BODY(Ap, p);
+            });
+
+          } else {
+
+            RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{imin, imax},
+                                                     RAJA::RangeSegment{jmin, jmax},
+                                                     RAJA::RangeSegment{kmin, kmax}),
+              [=](Index_type i, Index_type j, Index_type k) {
+                CG_STENCIL_BODY(Ap, p);
+              }
+            );
+
+          }
+
+          RAJA::ReduceSum<RAJA::omp_reduce, Real_type> pAp(0.0);
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+            CG_DOT_BODY(pAp, p, Ap);
+          });
+          const Real_type alpha = rr / pAp.get();
+
+          RAJA::ReduceSum<RAJA::omp_reduce, Real_type> rr_new(0.0);
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+            CG_UPDATE_BODY(rr_new);
+          });
+          const Real_type beta = rr_new.get() / rr;
+          rr = rr_new.get();
+
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+            CG_DIRECTION_BODY;
+          });
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  CG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+template < bool csr >
+void CG::runOpenMPVariantPipelined(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  CG_DATA_SETUP;
+
+  CG_PIPELINED_DATA_SETUP;
+
+  CG_CSR_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          CG_PIPELINED_INIT_BODY;
+        }
+
+        if ( csr ) {
+
+          #pragma omp parallel for
+          for (Index_type ip = ibegin; ip < iend; ++ip ) {
+            CG_CSR_BODY(w, r);
+          }
+
+        } else {
+
+          #pragma omp parallel for
+          for (Index_type k = kmin; k < kmax; ++k ) {
+            for (Index_type j = jmin; j < jmax; ++j ) {
+              for (Index_type i = imin; i < imax; ++i ) {
+                CG_STENCIL_BODY(w, r);
+              }
+            }
+          }
+
+        }
+
+        Real_type alpha = 0.0;
+        Real_type beta = 0.0;
+        Real_type gamma_old = 0.0;
+
+        for (Index_type it = 0; it < CG_NUM_ITERATIONS; ++it) {
+
+          Real_type gamma = 0.0;
+          Real_type delta = 0.0;
+
+          if ( csr ) {
+
+            #pragma omp parallel for reduction(+:gamma,delta)
+            for (Index_type ip = ibegin; ip < iend; ++ip ) {
+              CG_CSR_BODY(q, w);
+              CG_PIPELINED_DOTS_BODY(gamma, delta);
+            }
+
+          } else {
+
+            #pragma omp parallel for reduction(+:gamma,delta)
+            for (Index_type k = kmin; k < kmax; ++k ) {
+              for (Index_type j = jmin; j < jmax; ++j ) {
+                for (Index_type i = imin; i < imax; ++i ) {
+                  CG_STENCIL_BODY(q, w);
+                  CG_PIPELINED_DOTS_BODY(gamma, delta);
+                }
+              }
+            }
+
+          }
+
+          CG_PIPELINED_SCALARS;
+
+          #pragma omp parallel for
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            CG_PIPELINED_UPDATE_BODY;
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto cg_pipelined_init_lam = [=](Index_type i) {
+                                     CG_PIPELINED_INIT_BODY;
+                                   };
+      auto cg_csr_init_lam = [=](Index_type ip) {
+                               CG_CSR_BODY(w, r);
+                             };
+      auto cg_stencil_init_lam = [=](Index_type i, Index_type j, Index_type k) {
+                                   CG_STENCIL_BODY(w, r);
+                                 };
+      auto cg_csr_dots_lam = [=](Index_type ip, Real_type& gamma, Real_type& delta) {
+                               CG_CSR_BODY(q, w);
+                               CG_PIPELINED_DOTS_BODY(gamma, delta);
+                             };
+      auto cg_stencil_dots_lam = [=](Index_type i, Index_type j, Index_type k,
+                                     Real_type& gamma, Real_type& delta) {
+                                   CG_STENCIL_BODY(q, w);
+                                   CG_PIPELINED_DOTS_BODY(gamma, delta);
+                                 };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          cg_pipelined_init_lam(i);
+        }
+
+        if ( csr ) {
+
+          #pragma omp parallel for
+          for (Index_type ip = ibegin; ip < iend; ++ip ) {
+            cg_csr_init_lam(ip);
+          }
+
+        } else {
+
+          #pragma omp parallel for
+          for (Index_type k = kmin; k < kmax; ++k ) {
+            for (Index_type j = jmin; j < jmax; ++j ) {
+              for (Index_type i = imin; i < imax; ++i ) {
+                cg_stencil_init_lam(i, j, k);
+              }
+            }
+          }
+
+        }
+
+        Real_type alpha = 0.0;
+        Real_type beta = 0.0;
+        Real_type gamma_old = 0.0;
+
+        for (Index_type it = 0; it < CG_NUM_ITERATIONS; ++it) {
+
+          Real_type gamma = 0.0;
+          Real_type delta = 0.0;
+
+          if ( csr ) {
+
+            #pragma omp parallel for reduction(+:gamma,delta)
+            for (Index_type ip = ibegin; ip < iend; ++ip ) {
+              cg_csr_dots_lam(ip, gamma, delta);
+            }
+
+          } else {
+
+            #pragma omp parallel for reduction(+:gamma,delta)
+            for (Index_type k = kmin; k < kmax; ++k ) {
+              for (Index_type j = jmin; j < jmax; ++j ) {
+                for (Index_type i = imin; i < imax; ++i ) {
+                  cg_stencil_dots_lam(i, j, k, gamma, delta);
+                }
+              }
+            }
+
+          }
+
+          CG_PIPELINED_SCALARS;
+
+          auto cg_pipelined_update_lam = [=](Index_type i) {
+                                           CG_PIPELINED_UPDATE_BODY;
+                                         };
+
+          #pragma omp parallel for
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            cg_pipelined_update_lam(i);
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<2, RAJA::omp_parallel_for_exec,    // k
+            RAJA::statement::For<1, RAJA::loop_exec,    // j
+              RAJA::statement::For<0, RAJA::loop_exec,    // i
+                RAJA::statement::Lambda<0>
+              >
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          CG_PIPELINED_INIT_BODY;
+        });
+
+        if ( csr ) {
+
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=](Index_type ip) {
+            CG_CSR_BODY(w, r);
+          });
+
+        } else {
+
+          RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{imin, imax},
+                                                   RAJA::RangeSegment{jmin, jmax},
+                                                   RAJA::RangeSegment{kmin, kmax}),
+            [=](Index_type i, Index_type j, Index_type k) {
+              CG_STENCIL_BODY(w, r);
+            }
+          );
+
+        }
+
+        Real_type alpha = 0.0;
+        Real_type beta = 0.0;
+        Real_type gamma_old = 0.0;
+
+        for (Index_type it = 0; it < CG_NUM_ITERATIONS; ++it) {
+
+          RAJA::ReduceSum<RAJA::omp_reduce, Real_type> gamma_sum(0.0);
+          RAJA::ReduceSum<RAJA::omp_reduce, Real_type> delta_sum(0.0);
+
+          if ( csr ) {
+
+            RAJA::forall<RAJA::omp_parallel_for_exec>(
+              RAJA::RangeSegment(ibegin, iend), [=](Index_type ip) {
+              CG_CSR_BODY(q, w);
+              CG_PIPELINED_DOTS_BODY(gamma_sum, delta_sum);
+            });
+
+          } else {
+
+            RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{imin, imax},
+                                                     RAJA::RangeSegment{jmin, jmax},
+                                                     RAJA::RangeSegment{kmin, kmax}),
+              [=](Index_type i, Index_type j, Index_type k) {
+                CG_STENCIL_BODY(q, w);
+                CG_PIPELINED_DOTS_BODY(gamma_sum, delta_sum);
+              }
+            );
+
+          }
+
+          const Real_type gamma = gamma_sum.get();
+          const Real_type delta = delta_sum.get();
+          CG_PIPELINED_SCALARS;
+
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+            CG_PIPELINED_UPDATE_BODY;
+          });
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  CG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void CG::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningTuning() ) {
+    case 1 : runOpenMPVariantStandard<true>(vid); break;
+    case 2 : runOpenMPVariantPipelined<false>(vid); break;
+    case 3 : runOpenMPVariantPipelined<true>(vid); break;
+    default : runOpenMPVariantStandard<false>(vid); break;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,216 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "CG.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "AppsData.hpp"
+#include "common/DataUtils.hpp"
+
+#include <cmath>
+#include <vector>
+
+
+namespace rajaperf
+{
+namespace apps
+{
+
+/*
+ * CSR arrays of the 27-point Laplacian for the rows of the span
+ * [domain.frn, domain.lrn); rows of ghost zones are empty and columns
+ * of ghost zones are dropped.
+ */
+static void initLaplacianCSR(Int_ptr row_offsets, Int_ptr cols, Real_ptr vals,
+                             const ADomain& domain)
+{
+  const Index_type ibegin = domain.frn;
+  const Index_type iend = domain.lrn;
+
+  std::vector<bool> real(domain.nnalls, false);
+  for (Index_type ii = 0; ii < domain.n_real_zones; ++ii) {
+    real[domain.real_zones[ii]] = true;
+  }
+
+  Index_type nnz = 0;
+  row_offsets[0] = 0;
+  for (Index_type ip = ibegin; ip < iend; ++ip) {
+    if ( real[ip] ) {
+      for (Index_type dk = -1; dk <= 1; ++dk) {
+        for (Index_type dj = -1; dj <= 1; ++dj) {
+          for (Index_type di = -1; di <= 1; ++di) {
+            const Index_type col = ip + di + dj*domain.jp + dk*domain.kp;
+            if ( real[col] ) {
+              cols[nnz] = col;
+              vals[nnz] = ( col == ip ) ? 26.0 : -1.0;
+              ++nnz;
+            }
+          }
+        }
+      }
+    }
+    row_offsets[ip-ibegin+1] = nnz;
+  }
+}
+
+/*
+ * Number of nonzeros of the 27-point Laplacian on n^3 zones.
+ */
+static Index_type getLaplacianNumNonZeros(Index_type n)
+{
+  // each direction has n-1 interior pairs of neighbors and the diagonal
+  const Index_type pairs = 3*n - 2;
+  return pairs * pairs * pairs;
+}
+
+
+CG::CG(const RunParams& params)
+  : KernelBase(rajaperf::Apps_CG, params)
+{
+  setDefaultProblemSize(100*100*100);  // See rzmax in ADomain struct
+  setDefaultReps(10);
+
+  Index_type rzmax = std::cbrt(getTargetProblemSize())+1;
+  m_domain = new ADomain(rzmax, /* ndims = */ 3);
+
+  m_span = m_domain->lrn - m_domain->frn;
+
+  const Index_type nz = m_domain->imax - m_domain->imin;
+  m_nnz = getLaplacianNumNonZeros(nz);
+
+  m_row_offsets = nullptr;
+  m_cols = nullptr;
+  m_vals = nullptr;
+
+  m_w = nullptr;
+  m_q = nullptr;
+  m_s = nullptr;
+  m_z = nullptr;
+
+  setActualProblemSize( nz * nz * nz );
+
+  const Index_type n = getActualProblemSize();
+  const Index_type niter = CG_NUM_ITERATIONS;
+
+  setItsPerRep( niter * n );
+  setKernelsPerRep( 1 + 4 * niter );
+
+  std::vector<std::string> tunings{ "stencil", "csr",
+                                    "pipelined_stencil", "pipelined_csr" };
+
+  // touched data size, not actual number of stores and loads
+  const Index_type vec = sizeof(Real_type) * n;
+  const Index_type matrix = (0*sizeof(Int_type) + 1*sizeof(Int_type)) * (m_span+1) +
+                            (0*sizeof(Int_type) + 1*sizeof(Int_type)) * m_nnz +
+                            (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nnz;
+  for (size_t t = 0; t < tunings.size(); ++t) {
+    const bool csr = ( t % 2 == 1 );
+    const Index_type matvec = 2 * vec + ( csr ? matrix : 0 );
+    if ( t < 2 ) {
+      // init; matvec, dot, update, direction
+      setBytesPerRep( tunings[t], 4 * vec +
+                      niter * ( matvec + 2 * vec + 6 * vec + 3 * vec ) );
+      setFLOPsPerRep( tunings[t], 2 * n +
+                      niter * ( ( csr ? 2 * m_nnz : 27 * n ) +
+                                2 * n + 6 * n + 2 * n ) );
+    } else {
+      // init, w = A r; matvec with dots, update
+      setBytesPerRep( tunings[t], 6 * vec + matvec +
+                      niter * ( matvec + 1 * vec + 13 * vec ) );
+      setFLOPsPerRep( tunings[t], ( csr ? 2 * m_nnz : 27 * n ) +
+                      niter * ( ( csr ? 2 * m_nnz : 27 * n ) +
+                                4 * n + 12 * n ) );
+    }
+    // unknowns times iterations
+    setDOFsPerRep( tunings[t], niter * n );
+  }
+  setBytesPerRep( getBytesPerRep(tunings[0]) );
+  setFLOPsPerRep( getFLOPsPerRep(tunings[0]) );
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+  setUsesFeature(Kernel);
+  setUsesFeature(Reduction);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  for (size_t vid = 0; vid < NumVariants; ++vid) {
+    setVariantTuningNames(static_cast<VariantID>(vid), tunings);
+  }
+}
+
+CG::~CG()
+{
+  delete m_domain;
+}
+
+void CG::setUp(VariantID vid)
+{
+  const Index_type nnalls = m_domain->nnalls;
+
+  allocAndInitDataConst(m_x, nnalls, 0.0, vid);
+  allocAndInitDataConst(m_b, nnalls, 0.0, vid);
+  allocAndInitDataConst(m_r, nnalls, 0.0, vid);
+  allocAndInitDataConst(m_p, nnalls, 0.0, vid);
+  allocAndInitDataConst(m_Ap, nnalls, 0.0, vid);
+  for (Index_type ii = 0; ii < m_domain->n_real_zones; ++ii) {
+    m_b[m_domain->real_zones[ii]] = 1.0;
+  }
+
+  const size_t tune_idx = getRunningTuning();
+
+  if ( tune_idx >= 2 ) {
+    allocAndInitDataConst(m_w, nnalls, 0.0, vid);
+    allocAndInitDataConst(m_q, nnalls, 0.0, vid);
+    allocAndInitDataConst(m_s, nnalls, 0.0, vid);
+    allocAndInitDataConst(m_z, nnalls, 0.0, vid);
+  }
+
+  if ( tune_idx % 2 == 1 ) {
+    allocAndInitDataConst(m_row_offsets, m_span+1, 0, vid);
+    allocAndInitDataConst(m_cols, m_nnz, 0, vid);
+    allocAndInitDataConst(m_vals, m_nnz, 0.0, vid);
+    initLaplacianCSR(m_row_offsets, m_cols, m_vals, *m_domain);
+  }
+}
+
+void CG::updateChecksum(VariantID vid)
+{
+  checksum[vid] += calcChecksum(m_x, m_domain->nnalls, checksum_scale_factor );
+}
+
+void CG::tearDown(VariantID vid)
+{
+  (void) vid;
+
+  deallocData(m_x);
+  deallocData(m_b);
+  deallocData(m_r);
+  deallocData(m_p);
+  deallocData(m_Ap);
+  deallocData(m_w);
+  deallocData(m_q);
+  deallocData(m_s);
+  deallocData(m_z);
+  deallocData(m_row_offsets);
+  deallocData(m_cols);
+  deallocData(m_vals);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
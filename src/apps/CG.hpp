@@ -0,0 +1,227 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// CG kernel reference implementation:
+///
+/// CG_NUM_ITERATIONS iterations of unpreconditioned conjugate gradient
+/// for A x = b, with x = 0 initially and b = 1 on the real zones of a 3D
+/// ADomain. A is the 27-point Laplacian with zero Dirichlet boundary:
+///
+///   (A v)[ip] = 26 * v[ip] - ( sum of v over the 26 neighbors of ip )
+///
+/// Vector loops run over the span [frn, lrn) of the padded mesh holding
+/// the real zones; ghost entries of the vectors stay zero.
+///
+/// Standard CG (two reductions per iteration):
+///
+/// r = b; p = r; rr = (r, r);
+/// for (Index_type it = 0; it < CG_NUM_ITERATIONS; ++it) {
+///   Ap = A p;
+///   pAp = (p, Ap);
+///   alpha = rr / pAp;
+///   x += alpha * p;
+///   r -= alpha * Ap;
+///   rr_new = (r, r);
+///   beta = rr_new / rr; rr = rr_new;
+///   p = r + beta * p;
+/// }
+///
+/// Pipelined CG (Ghysels and Vanroose); both dot products are computed in
+/// the same loop as the matrix product q = A w, so each iteration has one
+/// reduction and two loops:
+///
+/// r = b; w = A r; p = s = z = 0;
+/// for (Index_type it = 0; it < CG_NUM_ITERATIONS; ++it) {
+///   gamma = (r, r); delta = (w, r); q = A w;
+///   beta = ( it > 0 ) ? gamma / gamma_old : 0;
+///   alpha = gamma / ( delta - beta * gamma / alpha_old );
+///   z = q + beta * z; s = w + beta * s; p = r + beta * p;
+///   x += alpha * p; r -= alpha * s; w -= alpha * z;
+/// }
+///
+/// A is applied either matrix-free as a stencil or from CSR arrays.
+///
+
+#ifndef RAJAPerf_Apps_CG_HPP
+#define RAJAPerf_Apps_CG_HPP
+
+#define CG_NUM_ITERATIONS 25
+
+#define CG_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr b = m_b; \
+  Real_ptr r = m_r; \
+  Real_ptr p = m_p; \
+  \
+  const Index_type jp = m_domain->jp; \
+  const Index_type kp = m_domain->kp; \
+  \
+  const Index_type imin = m_domain->imin; \
+  const Index_type imax = m_domain->imax; \
+  const Index_type jmin = m_domain->jmin; \
+  const Index_type jmax = m_domain->jmax; \
+  const Index_type kmin = m_domain->kmin; \
+  const Index_type kmax = m_domain->kmax; \
+  \
+  const Index_type ibegin = m_domain->frn; \
+  const Index_type iend = m_domain->lrn;
+
+#define CG_STANDARD_DATA_SETUP \
+  Real_ptr Ap = m_Ap;
+
+#define CG_PIPELINED_DATA_SETUP \
+  Real_ptr w = m_w; \
+  Real_ptr q = m_q; \
+  Real_ptr s = m_s; \
+  Real_ptr z = m_z;
+
+// rows of the span [ibegin, iend) are row_offsets[ip-ibegin]:row_offsets[ip-ibegin+1]
+#define CG_CSR_DATA_SETUP \
+  Int_ptr row_offsets = m_row_offsets; \
+  Int_ptr cols = m_cols; \
+  Real_ptr vals = m_vals;
+
+// y = A v at real zone (i, j, k)
+#define CG_STENCIL_BODY(y, v) \
+  Index_type ip = i + j*jp + k*kp ; \
+  y[ip] = 26.0 * v[ip] - \
+          ( v[ip-1]  + v[ip+1]  + \
+            v[ip-jp] + v[ip+jp] + \
+            v[ip-kp] + v[ip+kp] + \
+            v[ip-1-jp]  + v[ip+1-jp]  + v[ip-1+jp]  + v[ip+1+jp]  + \
+            v[ip-1-kp]  + v[ip+1-kp]  + v[ip-1+kp]  + v[ip+1+kp]  + \
+            v[ip-jp-kp] + v[ip+jp-kp] + v[ip-jp+kp] + v[ip+jp+kp] + \
+            v[ip-1-jp-kp] + v[ip+1-jp-kp] + \
+            v[ip-1+jp-kp] + v[ip+1+jp-kp] + \
+            v[ip-1-jp+kp] + v[ip+1-jp+kp] + \
+            v[ip-1+jp+kp] + v[ip+1+jp+kp] ) ;
+
+// y = A v at row ip of the span
+#define CG_CSR_BODY(y, v) \
+  Real_type sum = 0.0; \
+  for (Index_type jj = row_offsets[ip-ibegin]; \
+       jj < row_offsets[ip-ibegin+1]; ++jj) { \
+    sum += vals[jj] * v[cols[jj]]; \
+  } \
+  y[ip] = sum;
+
+#define CG_INIT_BODY \
+  x[i] = 0.0; \
+  r[i] = b[i]; \
+  p[i] = b[i];
+
+#define CG_DOT_BODY(dot, u, v) \
+  dot += u[i] * v[i];
+
+#define CG_UPDATE_BODY(rr) \
+  x[i] += alpha * p[i]; \
+  r[i] -= alpha * Ap[i]; \
+  rr += r[i] * r[i];
+
+#define CG_DIRECTION_BODY \
+  p[i] = r[i] + beta * p[i];
+
+#define CG_PIPELINED_INIT_BODY \
+  x[i] = 0.0; \
+  r[i] = b[i]; \
+  p[i] = 0.0; \
+  s[i] = 0.0; \
+  z[i] = 0.0;
+
+#define CG_PIPELINED_DOTS_BODY(gamma, delta) \
+  gamma += r[ip] * r[ip]; \
+  delta += w[ip] * r[ip];
+
+#define CG_PIPELINED_UPDATE_BODY \
+  z[i] = q[i] + beta * z[i]; \
+  s[i] = w[i] + beta * s[i]; \
+  p[i] = r[i] + beta * p[i]; \
+  x[i] += alpha * p[i]; \
+  r[i] -= alpha * s[i]; \
+  w[i] -= alpha * z[i];
+
+// scalars of the next pipelined iteration from the reductions
+#define CG_PIPELINED_SCALARS \
+  beta = ( it > 0 ) ? gamma / gamma_old : 0.0; \
+  alpha = ( it > 0 ) ? gamma / ( delta - beta * gamma / alpha ) \
+                     : gamma / delta; \
+  gamma_old = gamma;
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+class ADomain;
+
+class CG : public KernelBase
+{
+public:
+
+  CG(const RunParams& params);
+
+  ~CG();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  CG : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  CG : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  CG : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  template < bool csr >
+  void runSeqVariantStandard(VariantID vid);
+  template < bool csr >
+  void runSeqVariantPipelined(VariantID vid);
+
+  template < bool csr >
+  void runOpenMPVariantStandard(VariantID vid);
+  template < bool csr >
+  void runOpenMPVariantPipelined(VariantID vid);
+
+  Real_ptr m_x;
+  Real_ptr m_b;
+  Real_ptr m_r;
+  Real_ptr m_p;
+  Real_ptr m_Ap;
+  Real_ptr m_w;
+  Real_ptr m_q;
+  Real_ptr m_s;
+  Real_ptr m_z;
+
+  Int_ptr m_row_offsets;
+  Int_ptr m_cols;
+  Real_ptr m_vals;
+
+  ADomain* m_domain;
+  Index_type m_span;
+  Index_type m_nnz;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -6,14 +6,14 @@
 // SPDX-License-Identifier: (BSD-3-Clause)
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
 
-#include "WIP-COUPLE.hpp"
+#include "COUPLE.hpp"
 
 #include "RAJA/RAJA.hpp"
 
 #include "AppsData.hpp"
 #include "common/DataUtils.hpp"
 
-#include <iostream>
+#include <cmath>
 
 namespace rajaperf
 {
@@ -42,14 +42,22 @@ COUPLE::COUPLE(const RunParams& params)
   setItsPerRep( getActualProblemSize() );
   setKernelsPerRep(1);
   setBytesPerRep( (3*sizeof(Complex_type) + 5*sizeof(Complex_type)) * m_domain->n_real_zones );
-  setFLOPsPerRep(0);
+  // real FLOPs per zone, counting a complex multiply as 6, a complex add or
+  // complex-real multiply as 2, and sqrt, sin, cos, and divide as 1 each
+  setFLOPsPerRep(134 * m_domain->n_real_zones);
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
 
   setUsesFeature(Forall);
 
   setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
   setVariantDefined( RAJA_Seq );
 
   setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
   setVariantDefined( RAJA_OpenMP );
 }
 
@@ -80,112 +88,13 @@ void COUPLE::setUp(VariantID vid)
   m_ireal = Complex_type(0.0, 1.0);
 }
 
-void COUPLE::runKernel(VariantID vid)
-{
-  const Index_type run_reps = getRunReps();
-
-  COUPLE_DATA_SETUP;
-
-  switch ( vid ) {
-
-    case Base_Seq : {
-
-      startTimer();
-      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
-
-        for (Index_type k = kmin ; k < kmax ; ++k ) {
-          COUPLE_BODY;
-        }
-
-      }
-      stopTimer();
-
-      break;
-    }
-
-#if defined(RUN_RAJA_SEQ)
-    case RAJA_Seq : {
-
-      startTimer();
-      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
-
-        RAJA::forall<RAJA::loop_exec>(
-          RAJA::RangeSegment(kmin, kmax), [=](Index_type k) {
-          COUPLE_BODY;
-        });
-
-      }
-      stopTimer();
-
-      break;
-    }
-#endif
-
-#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
-    case Base_OpenMP : {
-
-      startTimer();
-      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
-
-        #pragma omp parallel for
-        for (Index_type k = kmin ; k < kmax ; ++k ) {
-          COUPLE_BODY;
-        }
-
-      }
-      stopTimer();
-      break;
-    }
-
-    case RAJA_OpenMP : {
-
-      startTimer();
-      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
-
-        RAJA::forall<RAJA::omp_parallel_for_exec>(
-          RAJA::RangeSegment(kmin, kmax), [=](Index_type k) {
-          COUPLE_BODY;
-        });
-
-      }
-      stopTimer();
-
-      break;
-    }
-#endif
-
-#if defined(RAJA_ENABLE_TARGET_OPENMP) && 0
-    case Base_OpenMPTarget :
-    case RAJA_OpenMPTarget :
-    {
-      runOpenMPTargetVariant(vid);
-      break;
-    }
-#endif
-
-#if defined(RAJA_ENABLE_CUDA) && 0
-    case Base_CUDA :
-    case RAJA_CUDA :
-    {
-      runCudaVariant(vid);
-      break;
-    }
-#endif
-
-    default : {
-      getCout() << "\n  COUPLE : Unknown variant id = " << vid << std::endl;
-    }
-
-  }
-}
-
 void COUPLE::updateChecksum(VariantID vid)
 {
   Index_type max_loop_index = m_domain->lrn;
 
-  checksum[vid] += calcChecksum(m_t0, max_loop_index);
-  checksum[vid] += calcChecksum(m_t1, max_loop_index);
-  checksum[vid] += calcChecksum(m_t2, max_loop_index);
+  checksum[vid] += calcChecksum(m_t0, max_loop_index, checksum_scale_factor );
+  checksum[vid] += calcChecksum(m_t1, max_loop_index, checksum_scale_factor );
+  checksum[vid] += calcChecksum(m_t2, max_loop_index, checksum_scale_factor );
 }
 
 void COUPLE::tearDown(VariantID vid)
@@ -162,15 +162,27 @@ public:
   ~COUPLE();
 
   void setUp(VariantID vid);
-  void runKernel(VariantID vid);
   void updateChecksum(VariantID vid);
   void tearDown(VariantID vid);
 
-  void runSeqVariant(VariantID vid) {(void) vid;}
-  void runOpenMPVariant(VariantID vid) {(void) vid;}
-  void runCudaVariant(VariantID vid) {(void) vid;}
-  void runHipVariant(VariantID vid) {(void) vid;}
-  void runOpenMPTargetVariant(VariantID vid) {(void) vid;}
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  //
+  // No GPU variants until we find a reasonable way to do complex numbers
+  // in GPU code.
+  //
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  COUPLE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  COUPLE : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  COUPLE : Unknown OMP Target variant id = " << vid << std::endl;
+  }
 
 private:
   Complex_ptr m_t0;
@@ -37,6 +37,7 @@ namespace apps {
   deallocCudaDeviceData(X);                                                    \
   deallocCudaDeviceData(Y);
 
+template < int DPA_D1D, int DPA_Q1D >
 __global__ void Diffusion3DPA(Index_type NE, const Real_ptr Basis,
                               const Real_ptr dBasis, const Real_ptr D,
                               const Real_ptr X, Real_ptr Y, bool symmetric) {
@@ -118,7 +119,8 @@ __global__ void Diffusion3DPA(Index_type NE, const Real_ptr Basis,
   }
 }
 
-void DIFFUSION3DPA::runCudaVariant(VariantID vid) {
+template < int DPA_D1D, int DPA_Q1D >
+void DIFFUSION3DPA::runCudaVariantImpl(VariantID vid) {
   const Index_type run_reps = getRunReps();
 
   DIFFUSION3DPA_DATA_SETUP;
@@ -134,7 +136,7 @@ void DIFFUSION3DPA::runCudaVariant(VariantID vid) {
 
       dim3 nthreads_per_block(DPA_Q1D, DPA_Q1D, DPA_Q1D);
 
-      Diffusion3DPA<<<NE, nthreads_per_block>>>(NE, Basis, dBasis, D, X, Y,
+      Diffusion3DPA<DPA_D1D, DPA_Q1D><<<NE, nthreads_per_block>>>(NE, Basis, dBasis, D, X, Y,
                                                 symmetric);
 
       cudaErrchk(cudaGetLastError());
@@ -363,6 +365,11 @@ void DIFFUSION3DPA::runCudaVariant(VariantID vid) {
   }
 }
 
+void DIFFUSION3DPA::runCudaVariant(VariantID vid)
+{
+  FEM_ORDER_DISPATCH(m_order, runCudaVariantImpl, vid)
+}
+
 } // end namespace apps
 } // end namespace rajaperf
 
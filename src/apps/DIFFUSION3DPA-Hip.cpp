@@ -37,6 +37,7 @@ namespace apps {
   deallocHipDeviceData(X);                                                     \
   deallocHipDeviceData(Y);
 
+template < int DPA_D1D, int DPA_Q1D >
 __global__ void Diffusion3DPA(Index_type NE, const Real_ptr Basis,
                               const Real_ptr dBasis, const Real_ptr D,
                               const Real_ptr X, Real_ptr Y, bool symmetric) {
@@ -118,7 +119,8 @@ __global__ void Diffusion3DPA(Index_type NE, const Real_ptr Basis,
   }
 }
 
-void DIFFUSION3DPA::runHipVariant(VariantID vid) {
+template < int DPA_D1D, int DPA_Q1D >
+void DIFFUSION3DPA::runHipVariantImpl(VariantID vid) {
   const Index_type run_reps = getRunReps();
 
   DIFFUSION3DPA_DATA_SETUP;
@@ -135,7 +137,7 @@ void DIFFUSION3DPA::runHipVariant(VariantID vid) {
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      hipLaunchKernelGGL((Diffusion3DPA), dim3(grid_size), dim3(block_size), 0,
+      hipLaunchKernelGGL((Diffusion3DPA<DPA_D1D, DPA_Q1D>), dim3(grid_size), dim3(block_size), 0,
                          0, NE, Basis, dBasis, D, X, Y, symmetric);
 
       hipErrchk(hipGetLastError());
@@ -364,6 +366,11 @@ void DIFFUSION3DPA::runHipVariant(VariantID vid) {
   }
 }
 
+void DIFFUSION3DPA::runHipVariant(VariantID vid)
+{
+  FEM_ORDER_DISPATCH(m_order, runHipVariantImpl, vid)
+}
+
 } // end namespace apps
 } // end namespace rajaperf
 
@@ -18,7 +18,8 @@
 namespace rajaperf {
 namespace apps {
 
-void DIFFUSION3DPA::runOpenMPVariant(VariantID vid) {
+template < int DPA_D1D, int DPA_Q1D >
+void DIFFUSION3DPA::runOpenMPVariantImpl(VariantID vid) {
 
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -344,5 +345,10 @@ void DIFFUSION3DPA::runOpenMPVariant(VariantID vid) {
 #endif
 }
 
+void DIFFUSION3DPA::runOpenMPVariant(VariantID vid)
+{
+  FEM_ORDER_DISPATCH(m_order, runOpenMPVariantImpl, vid)
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -18,7 +18,8 @@
 namespace rajaperf {
 namespace apps {
 
-void DIFFUSION3DPA::runSeqVariant(VariantID vid) {
+template < int DPA_D1D, int DPA_Q1D >
+void DIFFUSION3DPA::runSeqVariantImpl(VariantID vid) {
   const Index_type run_reps = getRunReps();
 
   DIFFUSION3DPA_DATA_SETUP;
@@ -339,5 +340,10 @@ void DIFFUSION3DPA::runSeqVariant(VariantID vid) {
   }
 }
 
+void DIFFUSION3DPA::runSeqVariant(VariantID vid)
+{
+  FEM_ORDER_DISPATCH(m_order, runSeqVariantImpl, vid)
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -13,6 +13,8 @@
 #include "common/DataUtils.hpp"
 
 #include <algorithm>
+#include <string>
+#include <vector>
 
 namespace rajaperf
 {
@@ -25,31 +27,58 @@ DIFFUSION3DPA::DIFFUSION3DPA(const RunParams& params)
 {
   m_NE_default = 15625;
 
-  setDefaultProblemSize(m_NE_default*DPA_Q1D*DPA_Q1D*DPA_Q1D);
+  // Problem size is given for the default order. Each order tuning
+  // runs on as many elements as fit in the target problem size, with
+  // its own bytes, FLOPs, and DOFs.
+  constexpr Index_type Q1D_default = DPA_DEFAULT_ORDER + 2;
+
+  setDefaultProblemSize(m_NE_default*Q1D_default*Q1D_default*Q1D_default);
   setDefaultReps(50);
 
-  m_NE = std::max(getTargetProblemSize()/(DPA_Q1D*DPA_Q1D*DPA_Q1D), Index_type(1));
+  m_NE = std::max(getTargetProblemSize()/(Q1D_default*Q1D_default*Q1D_default),
+                  Index_type(1));
 
-  setActualProblemSize( m_NE*DPA_Q1D*DPA_Q1D*DPA_Q1D );
+  setActualProblemSize( m_NE*Q1D_default*Q1D_default*Q1D_default );
 
   setItsPerRep(getActualProblemSize());
   setKernelsPerRep(1);
 
-  setBytesPerRep( 2*DPA_Q1D*DPA_D1D*sizeof(Real_type)  +
-                  DPA_Q1D*DPA_Q1D*DPA_Q1D*SYM*m_NE*sizeof(Real_type) +
-                  DPA_D1D*DPA_D1D*DPA_D1D*m_NE*sizeof(Real_type) +
-                  DPA_D1D*DPA_D1D*DPA_D1D*m_NE*sizeof(Real_type) );
-
-  setFLOPsPerRep(m_NE * (DPA_Q1D * DPA_D1D +
-                         5 * DPA_D1D * DPA_D1D * DPA_Q1D * DPA_D1D +
-                         7 * DPA_D1D * DPA_D1D * DPA_Q1D * DPA_Q1D +
-                         7 * DPA_Q1D * DPA_D1D * DPA_Q1D * DPA_Q1D +
-                         15 * DPA_Q1D * DPA_Q1D * DPA_Q1D +
-                         DPA_Q1D * DPA_D1D +
-                         7 * DPA_Q1D * DPA_Q1D * DPA_D1D * DPA_Q1D +
-                         7 * DPA_Q1D * DPA_Q1D * DPA_D1D * DPA_D1D +
-                         7 * DPA_D1D * DPA_Q1D * DPA_D1D * DPA_D1D +
-                         3 * DPA_D1D * DPA_D1D * DPA_D1D));
+  std::vector<std::string> order_tunings;
+  for (Index_type p = 1; p <= FEM_MAX_ORDER; ++p) {
+    const Index_type D1D = p + 1;
+    const Index_type Q1D = p + 2;
+    const Index_type NE =
+      std::max(getTargetProblemSize()/(Q1D*Q1D*Q1D), Index_type(1));
+
+    std::string tname = "p" + std::to_string(p);
+    order_tunings.push_back(tname);
+    m_order_NE.push_back(NE);
+
+    setBytesPerRep( tname,
+                    2*Q1D*D1D*sizeof(Real_type)  +
+                    Q1D*Q1D*Q1D*SYM*NE*sizeof(Real_type) +
+                    D1D*D1D*D1D*NE*sizeof(Real_type) +
+                    D1D*D1D*D1D*NE*sizeof(Real_type) );
+
+    setFLOPsPerRep( tname,
+                    NE * (Q1D * D1D +
+                          5 * D1D * D1D * Q1D * D1D +
+                          7 * D1D * D1D * Q1D * Q1D +
+                          7 * Q1D * D1D * Q1D * Q1D +
+                          15 * Q1D * Q1D * Q1D +
+                          Q1D * D1D +
+                          7 * Q1D * Q1D * D1D * Q1D +
+                          7 * Q1D * Q1D * D1D * D1D +
+                          7 * D1D * Q1D * D1D * D1D +
+                          3 * D1D * D1D * D1D) );
+
+    setDOFsPerRep(tname, NE*D1D*D1D*D1D);
+
+    if ( p == DPA_DEFAULT_ORDER ) {
+      setBytesPerRep( getBytesPerRep(tname) );
+      setFLOPsPerRep( getFLOPsPerRep(tname) );
+    }
+  }
 
   setUsesFeature(Teams);
 
@@ -65,6 +94,13 @@ DIFFUSION3DPA::DIFFUSION3DPA(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
 
+  for (size_t vid = 0; vid < NumVariants; ++vid) {
+    setVariantTuningNames(static_cast<VariantID>(vid), order_tunings);
+  }
+
+  m_order = DPA_DEFAULT_ORDER;
+  m_D1D = m_order + 1;
+  m_Q1D = m_order + 2;
 }
 
 DIFFUSION3DPA::~DIFFUSION3DPA()
@@ -73,17 +109,21 @@ DIFFUSION3DPA::~DIFFUSION3DPA()
 
 void DIFFUSION3DPA::setUp(VariantID vid)
 {
-
-  allocAndInitDataConst(m_B, int(DPA_Q1D*DPA_D1D), Real_type(1.0), vid);
-  allocAndInitDataConst(m_G, int(DPA_Q1D*DPA_D1D), Real_type(1.0), vid);
-  allocAndInitDataConst(m_D, int(DPA_Q1D*DPA_Q1D*DPA_Q1D*SYM*m_NE), Real_type(1.0), vid);
-  allocAndInitDataConst(m_X, int(DPA_D1D*DPA_D1D*DPA_D1D*m_NE), Real_type(1.0), vid);
-  allocAndInitDataConst(m_Y, int(DPA_D1D*DPA_D1D*DPA_D1D*m_NE), Real_type(0.0), vid);
+  m_order = getRunningTuning() + 1;
+  m_NE = m_order_NE[getRunningTuning()];
+  m_D1D = m_order + 1;
+  m_Q1D = m_order + 2;
+
+  allocAndInitData(m_B, int(m_Q1D*m_D1D), vid);
+  allocAndInitData(m_G, int(m_Q1D*m_D1D), vid);
+  allocAndInitDataConst(m_D, int(m_Q1D*m_Q1D*m_Q1D*SYM*m_NE), Real_type(1.0), vid);
+  allocAndInitData(m_X, int(m_D1D*m_D1D*m_D1D*m_NE), vid);
+  allocAndInitDataConst(m_Y, int(m_D1D*m_D1D*m_D1D*m_NE), Real_type(0.0), vid);
 }
 
 void DIFFUSION3DPA::updateChecksum(VariantID vid)
 {
-  checksum[vid] += calcChecksum(m_Y, DPA_D1D*DPA_D1D*DPA_D1D*m_NE);
+  checksum[vid] += calcChecksum(m_Y, m_D1D*m_D1D*m_D1D*m_NE);
 }
 
 void DIFFUSION3DPA::tearDown(VariantID vid)
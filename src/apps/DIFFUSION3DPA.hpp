@@ -227,9 +227,11 @@ const bool symmetric = true;
 
 #include "RAJA/RAJA.hpp"
 
-//Number of Dofs/Qpts in 1D
-#define DPA_D1D 3
-#define DPA_Q1D 4
+//Number of Dofs/Qpts in 1D are the template parameters DPA_D1D and
+//DPA_Q1D of the variant implementations, which are instantiated for each
+//polynomial order (see FEM_ORDER_DISPATCH in FEM_MACROS.hpp).
+//Problem size is based on the default order below.
+#define DPA_DEFAULT_ORDER 2
 #define SYM 6
 #define b(x, y) Basis[x + DPA_Q1D * y]
 #define g(x, y) dBasis[x + DPA_Q1D * y]
@@ -498,6 +500,15 @@ public:
   void runHipVariant(VariantID vid);
   void runOpenMPTargetVariant(VariantID vid);
 
+  template < int DPA_D1D, int DPA_Q1D >
+  void runSeqVariantImpl(VariantID vid);
+  template < int DPA_D1D, int DPA_Q1D >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < int DPA_D1D, int DPA_Q1D >
+  void runCudaVariantImpl(VariantID vid);
+  template < int DPA_D1D, int DPA_Q1D >
+  void runHipVariantImpl(VariantID vid);
+
 private:
 
   Real_ptr m_B;
@@ -510,6 +521,11 @@ private:
 
   Index_type m_NE;
   Index_type m_NE_default;
+  std::vector<Index_type> m_order_NE;
+
+  Index_type m_order;
+  Index_type m_D1D;
+  Index_type m_Q1D;
 };
 
 } // end namespace apps
@@ -0,0 +1,270 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "EDGE_FLUX.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cmath>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+void EDGE_FLUX::runOpenMPVariantAtomic(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  EDGE_FLUX_DATA_SETUP;
+
+  EDGE_FLUX_ATOMIC_DATA_SETUP;
+
+  auto edge_flux_atomic_lam = [=](Index_type e) {
+                                EDGE_FLUX_FLUX;
+                                #pragma omp atomic
+                                res[n0] -= flux;
+                                #pragma omp atomic
+                                res[n1] += flux;
+                              };
+
+  auto edge_flux_raja_atomic_lam = [=](Index_type e) {
+                                     EDGE_FLUX_RAJA_ATOMIC_BODY(RAJA::omp_atomic);
+                                   };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type e = 0; e < nedges; ++e ) {
+          EDGE_FLUX_FLUX;
+          #pragma omp atomic
+          res[n0] -= flux;
+          #pragma omp atomic
+          res[n1] += flux;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type e = 0; e < nedges; ++e ) {
+          edge_flux_atomic_lam(e);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nedges), edge_flux_raja_atomic_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  EDGE_FLUX : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void EDGE_FLUX::runOpenMPVariantColoring(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  EDGE_FLUX_DATA_SETUP;
+
+  EDGE_FLUX_COLOR_DATA_SETUP;
+
+  auto edge_flux_color_lam = [=](Index_type e) {
+                               EDGE_FLUX_BODY;
+                             };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type c = 0; c < ncolors; ++c) {
+          #pragma omp parallel for
+          for (Index_type e = color_offsets[c]; e < color_offsets[c+1]; ++e ) {
+            EDGE_FLUX_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type c = 0; c < ncolors; ++c) {
+          #pragma omp parallel for
+          for (Index_type e = color_offsets[c]; e < color_offsets[c+1]; ++e ) {
+            edge_flux_color_lam(e);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      //
+      // One range segment of edges per color.
+      //
+      RAJA::TypedIndexSet<RAJA::RangeSegment> colors;
+      for (Index_type c = 0; c < ncolors; ++c) {
+        colors.push_back( RAJA::RangeSegment(color_offsets[c],
+                                             color_offsets[c+1]) );
+      }
+
+      using EXEC_POL = RAJA::ExecPolicy<RAJA::seq_segit,
+                                    RAJA::omp_parallel_for_exec>;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<EXEC_POL>(colors, edge_flux_color_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  EDGE_FLUX : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void EDGE_FLUX::runOpenMPVariantOwnerComputes(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  EDGE_FLUX_DATA_SETUP;
+
+  EDGE_FLUX_OWNER_DATA_SETUP;
+
+  auto edge_flux_owner_lam = [=](Index_type in) {
+                               EDGE_FLUX_OWNER_BODY;
+                             };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type in = 0; in < nnodes; ++in ) {
+          EDGE_FLUX_OWNER_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type in = 0; in < nnodes; ++in ) {
+          edge_flux_owner_lam(in);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nnodes), edge_flux_owner_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  EDGE_FLUX : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void EDGE_FLUX::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningTuning() ) {
+    case 1 : runOpenMPVariantColoring(vid); break;
+    case 2 : runOpenMPVariantOwnerComputes(vid); break;
+    default : runOpenMPVariantAtomic(vid); break;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,251 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "EDGE_FLUX.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cmath>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void EDGE_FLUX::runSeqVariantAtomic(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  EDGE_FLUX_DATA_SETUP;
+
+  EDGE_FLUX_ATOMIC_DATA_SETUP;
+
+  auto edge_flux_lam = [=](Index_type e) {
+                         EDGE_FLUX_BODY;
+                       };
+
+  auto edge_flux_raja_atomic_lam = [=](Index_type e) {
+                                     EDGE_FLUX_RAJA_ATOMIC_BODY(RAJA::seq_atomic);
+                                   };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type e = 0; e < nedges; ++e ) {
+          EDGE_FLUX_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type e = 0; e < nedges; ++e ) {
+          edge_flux_lam(e);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nedges), edge_flux_raja_atomic_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  EDGE_FLUX : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void EDGE_FLUX::runSeqVariantColoring(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  EDGE_FLUX_DATA_SETUP;
+
+  EDGE_FLUX_COLOR_DATA_SETUP;
+
+  auto edge_flux_color_lam = [=](Index_type e) {
+                               EDGE_FLUX_BODY;
+                             };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type c = 0; c < ncolors; ++c) {
+          for (Index_type e = color_offsets[c]; e < color_offsets[c+1]; ++e ) {
+            EDGE_FLUX_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type c = 0; c < ncolors; ++c) {
+          for (Index_type e = color_offsets[c]; e < color_offsets[c+1]; ++e ) {
+            edge_flux_color_lam(e);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      //
+      // One range segment of edges per color.
+      //
+      RAJA::TypedIndexSet<RAJA::RangeSegment> colors;
+      for (Index_type c = 0; c < ncolors; ++c) {
+        colors.push_back( RAJA::RangeSegment(color_offsets[c],
+                                             color_offsets[c+1]) );
+      }
+
+      using EXEC_POL = RAJA::ExecPolicy<RAJA::seq_segit, RAJA::loop_exec>;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<EXEC_POL>(colors, edge_flux_color_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  EDGE_FLUX : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void EDGE_FLUX::runSeqVariantOwnerComputes(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  EDGE_FLUX_DATA_SETUP;
+
+  EDGE_FLUX_OWNER_DATA_SETUP;
+
+  auto edge_flux_owner_lam = [=](Index_type in) {
+                               EDGE_FLUX_OWNER_BODY;
+                             };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type in = 0; in < nnodes; ++in ) {
+          EDGE_FLUX_OWNER_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type in = 0; in < nnodes; ++in ) {
+          edge_flux_owner_lam(in);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nnodes), edge_flux_owner_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  EDGE_FLUX : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void EDGE_FLUX::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningTuning() ) {
+    case 1 : runSeqVariantColoring(vid); break;
+    case 2 : runSeqVariantOwnerComputes(vid); break;
+    default : runSeqVariantAtomic(vid); break;
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,278 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "EDGE_FLUX.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "AppsData.hpp"
+#include "common/DataUtils.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+
+namespace rajaperf
+{
+namespace apps
+{
+
+//
+// Offsets (i, j, k) from a node to the other ends of its edges in the
+// six tetrahedra split of each hex zone.
+//
+static const Index_type edge_dirs[7][3] = { {1, 0, 0}, {0, 1, 0}, {0, 0, 1},
+                                            {1, 1, 0}, {1, 0, 1}, {0, 1, 1},
+                                            {1, 1, 1} };
+
+/*
+ * Edges of the mesh, ordered by first node, with weight 1/length.
+ */
+static void initEdges(Int_ptr edge_n0, Int_ptr edge_n1, Real_ptr w,
+                      const ADomain& domain)
+{
+  Index_type e = 0;
+  for (Index_type k = domain.kmin; k <= domain.kmax; ++k) {
+    for (Index_type j = domain.jmin; j <= domain.jmax; ++j) {
+      for (Index_type i = domain.imin; i <= domain.imax; ++i) {
+        for (Index_type d = 0; d < 7; ++d) {
+          const Index_type* dir = edge_dirs[d];
+          if ( i + dir[0] <= domain.imax &&
+               j + dir[1] <= domain.jmax &&
+               k + dir[2] <= domain.kmax ) {
+            edge_n0[e] = i + j*domain.jp + k*domain.kp;
+            edge_n1[e] = edge_n0[e] + dir[0] + dir[1]*domain.jp +
+                                      dir[2]*domain.kp;
+            w[e] = 1.0 / std::sqrt(Real_type(dir[0] + dir[1] + dir[2]));
+            ++e;
+          }
+        }
+      }
+    }
+  }
+}
+
+/*
+ * Greedy edge coloring; each edge gets the smallest color not used by
+ * another edge at either of its nodes. Edges are then reordered, keeping
+ * their relative order, so the edges of each color are contiguous.
+ */
+static void colorEdges(Int_ptr edge_n0, Int_ptr edge_n1, Real_ptr w,
+                       Index_type nedges, Index_type nnalls,
+                       std::vector<Int_type>& color_offsets)
+{
+  std::vector<uint64_t> used(nnalls, 0);
+  std::vector<Int_type> color(nedges);
+  Index_type ncolors = 0;
+  for (Index_type e = 0; e < nedges; ++e) {
+    uint64_t free_colors = ~(used[edge_n0[e]] | used[edge_n1[e]]);
+    Int_type c = 0;
+    while ( !((free_colors >> c) & 1) ) {
+      ++c;
+    }
+    color[e] = c;
+    used[edge_n0[e]] |= uint64_t(1) << c;
+    used[edge_n1[e]] |= uint64_t(1) << c;
+    if ( c + 1 > ncolors ) {
+      ncolors = c + 1;
+    }
+  }
+
+  color_offsets.assign(ncolors+1, 0);
+  for (Index_type e = 0; e < nedges; ++e) {
+    ++color_offsets[color[e] + 1];
+  }
+  for (Index_type c = 0; c < ncolors; ++c) {
+    color_offsets[c+1] += color_offsets[c];
+  }
+
+  std::vector<Int_type> n0(edge_n0, edge_n0 + nedges);
+  std::vector<Int_type> n1(edge_n1, edge_n1 + nedges);
+  std::vector<Real_type> we(w, w + nedges);
+  std::vector<Int_type> next(color_offsets.begin(), color_offsets.end() - 1);
+  for (Index_type e = 0; e < nedges; ++e) {
+    const Int_type ec = next[color[e]]++;
+    edge_n0[ec] = n0[e];
+    edge_n1[ec] = n1[e];
+    w[ec] = we[e];
+  }
+}
+
+/*
+ * Real nodes of the domain and the edges incident on each of them.
+ */
+static void initNodeEdges(Int_ptr nodes, Int_ptr node_offsets,
+                          Int_ptr node_edges,
+                          const Int_type* edge_n0, const Int_type* edge_n1,
+                          Index_type nedges, const ADomain& domain)
+{
+  std::vector<Int_type> node_index(domain.nnalls, -1);
+  Index_type nnodes = 0;
+  for (Index_type k = domain.kmin; k <= domain.kmax; ++k) {
+    for (Index_type j = domain.jmin; j <= domain.jmax; ++j) {
+      for (Index_type i = domain.imin; i <= domain.imax; ++i) {
+        nodes[nnodes] = i + j*domain.jp + k*domain.kp;
+        node_index[nodes[nnodes]] = nnodes;
+        ++nnodes;
+      }
+    }
+  }
+
+  for (Index_type in = 0; in <= nnodes; ++in) {
+    node_offsets[in] = 0;
+  }
+  for (Index_type e = 0; e < nedges; ++e) {
+    ++node_offsets[node_index[edge_n0[e]] + 1];
+    ++node_offsets[node_index[edge_n1[e]] + 1];
+  }
+  for (Index_type in = 0; in < nnodes; ++in) {
+    node_offsets[in+1] += node_offsets[in];
+  }
+
+  std::vector<Int_type> next(node_offsets, node_offsets + nnodes);
+  for (Index_type e = 0; e < nedges; ++e) {
+    node_edges[next[node_index[edge_n0[e]]]++] = e;
+    node_edges[next[node_index[edge_n1[e]]]++] = e;
+  }
+}
+
+
+EDGE_FLUX::EDGE_FLUX(const RunParams& params)
+  : KernelBase(rajaperf::Apps_EDGE_FLUX, params)
+{
+  setDefaultProblemSize(100*100*100);  // See rzmax in ADomain struct
+  setDefaultReps(50);
+
+  Index_type rzmax = std::cbrt(getTargetProblemSize())+1;
+  m_domain = new ADomain(rzmax, /* ndims = */ 3);
+
+  const Index_type ni = m_domain->imax - m_domain->imin + 1;
+  const Index_type nj = m_domain->jmax - m_domain->jmin + 1;
+  const Index_type nk = m_domain->kmax - m_domain->kmin + 1;
+
+  m_nnodes = ni*nj*nk;
+  m_nedges = 0;
+  for (Index_type d = 0; d < 7; ++d) {
+    m_nedges += (ni - edge_dirs[d][0]) * (nj - edge_dirs[d][1]) *
+                (nk - edge_dirs[d][2]);
+  }
+  m_ncolors = 0;
+
+  m_color_offsets = nullptr;
+  m_nodes = nullptr;
+  m_node_offsets = nullptr;
+  m_node_edges = nullptr;
+
+  setActualProblemSize( m_nnodes );
+
+  setItsPerRep( m_nedges );
+  setKernelsPerRep(1);
+
+  std::vector<std::string> tunings{ "atomic", "coloring", "owner_computes" };
+
+  // touched data size, not actual number of stores and loads
+  const Index_type edge_bytes =
+    (0*sizeof(Int_type) + 2*sizeof(Int_type)) * m_nedges +
+    (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nedges;
+  const Index_type node_bytes =
+    (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nnodes +
+    (1*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nnodes;
+  setBytesPerRep( tunings[0], edge_bytes + node_bytes );
+  setBytesPerRep( tunings[1], edge_bytes + node_bytes );
+  setBytesPerRep( tunings[2], edge_bytes + node_bytes +
+                  (0*sizeof(Int_type) + 2*sizeof(Int_type)) * m_nnodes +
+                  (0*sizeof(Int_type) + 1*sizeof(Int_type)) * 2*m_nedges );
+  setBytesPerRep( getBytesPerRep(tunings[0]) );
+
+  // owner_computes evaluates each flux once from each end of the edge
+  setFLOPsPerRep( tunings[0], 11 * m_nedges );
+  setFLOPsPerRep( tunings[1], 11 * m_nedges );
+  setFLOPsPerRep( tunings[2], 10 * 2*m_nedges + m_nnodes );
+  setFLOPsPerRep( getFLOPsPerRep(tunings[0]) );
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+  setUsesFeature(Atomic);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  for (size_t vid = 0; vid < NumVariants; ++vid) {
+    setVariantTuningNames(static_cast<VariantID>(vid), tunings);
+  }
+}
+
+EDGE_FLUX::~EDGE_FLUX()
+{
+  delete m_domain;
+}
+
+void EDGE_FLUX::setUp(VariantID vid)
+{
+  allocAndInitDataRandSign(m_u, m_domain->nnalls, vid);
+  allocAndInitDataConst(m_res, m_domain->nnalls, 0.0, vid);
+
+  allocAndInitDataConst(m_edge_n0, m_nedges, 0, vid);
+  allocAndInitDataConst(m_edge_n1, m_nedges, 0, vid);
+  allocAndInitDataConst(m_w, m_nedges, 0.0, vid);
+  initEdges(m_edge_n0, m_edge_n1, m_w, *m_domain);
+
+  if ( getRunningTuning() == 1 ) {
+
+    std::vector<Int_type> color_offsets;
+    colorEdges(m_edge_n0, m_edge_n1, m_w, m_nedges, m_domain->nnalls,
+               color_offsets);
+    m_ncolors = color_offsets.size() - 1;
+
+    allocAndInitDataConst(m_color_offsets, m_ncolors+1, 0, vid);
+    for (Index_type c = 0; c <= m_ncolors; ++c) {
+      m_color_offsets[c] = color_offsets[c];
+    }
+
+  } else if ( getRunningTuning() == 2 ) {
+
+    allocAndInitDataConst(m_nodes, m_nnodes, 0, vid);
+    allocAndInitDataConst(m_node_offsets, m_nnodes+1, 0, vid);
+    allocAndInitDataConst(m_node_edges, 2*m_nedges, 0, vid);
+    initNodeEdges(m_nodes, m_node_offsets, m_node_edges,
+                  m_edge_n0, m_edge_n1, m_nedges, *m_domain);
+
+  }
+}
+
+void EDGE_FLUX::updateChecksum(VariantID vid)
+{
+  checksum[vid] += calcChecksum(m_res, m_domain->nnalls, checksum_scale_factor );
+}
+
+void EDGE_FLUX::tearDown(VariantID vid)
+{
+  (void) vid;
+
+  deallocData(m_u);
+  deallocData(m_res);
+  deallocData(m_w);
+  deallocData(m_edge_n0);
+  deallocData(m_edge_n1);
+  deallocData(m_color_offsets);
+  deallocData(m_nodes);
+  deallocData(m_node_offsets);
+  deallocData(m_node_edges);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,161 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// EDGE_FLUX kernel reference implementation:
+///
+/// for (Index_type e = 0; e < nedges; ++e ) {
+///   Index_type n0 = edge_n0[e];
+///   Index_type n1 = edge_n1[e];
+///   Real_type ul = u[n0];
+///   Real_type ur = u[n1];
+///   Real_type smax = max( |ul|, |ur| );
+///   Real_type flux = w[e] * ( 0.25*(ul*ul + ur*ur) - 0.5*smax*(ur - ul) );
+///   res[n0] -= flux;
+///   res[n1] += flux;
+/// }
+///
+/// Edges are those of a tetrahedral mesh made by splitting each hex zone
+/// of a 3D ADomain into six tetrahedra, so each interior node has 14
+/// edges. Edges sharing a node update the same residual entry. Tunings
+/// resolve these conflicts by:
+///
+///   atomic         -- atomic adds to the residual
+///   coloring       -- edges are greedily colored so that edges of one
+///                     color share no node and are renumbered so each
+///                     color is a contiguous range; colors run one at a
+///                     time, edges of a color concurrently without atomics
+///   owner_computes -- each node loops over its edges and sums their
+///                     fluxes, so the flux of each edge is computed twice
+///
+
+#ifndef RAJAPerf_Apps_EDGE_FLUX_HPP
+#define RAJAPerf_Apps_EDGE_FLUX_HPP
+
+#define EDGE_FLUX_DATA_SETUP \
+  Real_ptr u = m_u; \
+  Real_ptr res = m_res; \
+  Real_ptr w = m_w; \
+  Int_ptr edge_n0 = m_edge_n0; \
+  Int_ptr edge_n1 = m_edge_n1;
+
+#define EDGE_FLUX_FLUX \
+  const Index_type n0 = edge_n0[e]; \
+  const Index_type n1 = edge_n1[e]; \
+  const Real_type ul = u[n0]; \
+  const Real_type ur = u[n1]; \
+  const Real_type smax = ( std::abs(ul) > std::abs(ur) ) ? std::abs(ul) \
+                                                         : std::abs(ur); \
+  const Real_type flux = w[e] * ( 0.25 * (ul*ul + ur*ur) - \
+                                  0.5 * smax * (ur - ul) );
+
+#define EDGE_FLUX_BODY \
+  EDGE_FLUX_FLUX \
+  res[n0] -= flux; \
+  res[n1] += flux;
+
+#define EDGE_FLUX_RAJA_ATOMIC_BODY(policy) \
+  EDGE_FLUX_FLUX \
+  RAJA::atomicAdd<policy>(&res[n0], -flux); \
+  RAJA::atomicAdd<policy>(&res[n1], flux);
+
+#define EDGE_FLUX_ATOMIC_DATA_SETUP \
+  const Index_type nedges = m_nedges;
+
+// edges of color c are e = color_offsets[c], ..., color_offsets[c+1]-1
+#define EDGE_FLUX_COLOR_DATA_SETUP \
+  Int_ptr color_offsets = m_color_offsets; \
+  const Index_type ncolors = m_ncolors;
+
+// edges of node nodes[in] are node_edges[node_offsets[in]:node_offsets[in+1]]
+#define EDGE_FLUX_OWNER_DATA_SETUP \
+  Int_ptr nodes = m_nodes; \
+  Int_ptr node_offsets = m_node_offsets; \
+  Int_ptr node_edges = m_node_edges; \
+  const Index_type nnodes = m_nnodes;
+
+#define EDGE_FLUX_OWNER_BODY \
+  const Index_type n = nodes[in]; \
+  Real_type sum = 0.0; \
+  for (Index_type j = node_offsets[in]; j < node_offsets[in+1]; ++j) { \
+    const Index_type e = node_edges[j]; \
+    EDGE_FLUX_FLUX \
+    sum += ( n0 == n ) ? -flux : flux; \
+  } \
+  res[n] += sum;
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+class ADomain;
+
+class EDGE_FLUX : public KernelBase
+{
+public:
+
+  EDGE_FLUX(const RunParams& params);
+
+  ~EDGE_FLUX();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  EDGE_FLUX : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  EDGE_FLUX : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  EDGE_FLUX : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  void runSeqVariantAtomic(VariantID vid);
+  void runSeqVariantColoring(VariantID vid);
+  void runSeqVariantOwnerComputes(VariantID vid);
+
+  void runOpenMPVariantAtomic(VariantID vid);
+  void runOpenMPVariantColoring(VariantID vid);
+  void runOpenMPVariantOwnerComputes(VariantID vid);
+
+  Real_ptr m_u;
+  Real_ptr m_res;
+  Real_ptr m_w;
+
+  Int_ptr m_edge_n0;
+  Int_ptr m_edge_n1;
+
+  Int_ptr m_color_offsets;
+
+  Int_ptr m_nodes;
+  Int_ptr m_node_offsets;
+  Int_ptr m_node_edges;
+
+  ADomain* m_domain;
+  Index_type m_nedges;
+  Index_type m_nnodes;
+  Index_type m_ncolors;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
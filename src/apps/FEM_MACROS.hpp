@@ -26,4 +26,24 @@
 
 #define CPU_FOREACH(i, k, N) for (int i = 0; i < N; i++)
 
+// Partial assembly kernels are instantiated for polynomial orders
+// 1 through FEM_MAX_ORDER, where order p uses D1D = p+1 dofs and
+// Q1D = p+2 quadrature points in 1D. Each order is a kernel tuning.
+#define FEM_MAX_ORDER 8
+
+#define FEM_ORDER_DISPATCH(order, impl, vid) \
+  switch (order) { \
+    case 1: impl<2, 3>(vid); break; \
+    case 2: impl<3, 4>(vid); break; \
+    case 3: impl<4, 5>(vid); break; \
+    case 4: impl<5, 6>(vid); break; \
+    case 5: impl<6, 7>(vid); break; \
+    case 6: impl<7, 8>(vid); break; \
+    case 7: impl<8, 9>(vid); break; \
+    case 8: impl<9, 10>(vid); break; \
+    default: \
+      getCout() << "\n  " << getName() \
+                << " : Unknown polynomial order = " << order << std::endl; \
+  }
+
 #endif // closing endif for header file include guard
@@ -0,0 +1,52 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FFTData.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <cmath>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+Index_type fftLog2(Index_type N)
+{
+  Index_type log2N = 0;
+  while ( (Index_type(1) << (log2N+1)) <= N ) {
+    ++log2N;
+  }
+  return log2N;
+}
+
+void allocAndInitFFTTables(Complex_ptr& tw, Int_ptr& rev, Index_type N,
+                           VariantID vid)
+{
+  const Index_type log2N = fftLog2(N);
+  const Real_type pi = 4.0 * std::atan(1.0);
+
+  allocAndInitData(tw, N/2 > 0 ? N/2 : 1, vid);
+  for (Index_type t = 0; t < N/2; ++t) {
+    Real_type angle = -2.0 * pi * static_cast<Real_type>(t) / N;
+    tw[t] = Complex_type(std::cos(angle), std::sin(angle));
+  }
+
+  allocAndInitDataConst(rev, N, 0, vid);
+  for (Index_type i = 0; i < N; ++i) {
+    Index_type r = 0;
+    for (Index_type b = 0; b < log2N; ++b) {
+      r |= ( (i >> b) & 1 ) << (log2N - 1 - b);
+    }
+    rev[i] = r;
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,135 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Radix-2/4 Cooley-Tukey FFT building blocks shared by the FFT kernels
+/// (FFT_1D_BATCHED, FFT_3D); no FFT library is used.
+///
+/// A forward transform, X[k] = sum_n x[n] exp(-2 pi i n k / N), of length
+/// N = 2^log2N with elements stride apart is done in two steps:
+///
+///   fftBitReverseCopy   -- copy input to output in bit reversed order
+///   (or fftBitReverse)     (or permute in place)
+///   fftButterflies      -- the log2N decimation in time radix-2 stages,
+///                          done in place and fused in pairs into radix-4
+///                          passes, plus one radix-2 pass when log2N is odd
+///
+/// The twiddle factors tw[t] = exp(-2 pi i t / N), t < N/2, and the bit
+/// reversal permutation are tabulated in setUp().
+///
+
+#ifndef RAJAPerf_Apps_FFTData_HPP
+#define RAJAPerf_Apps_FFTData_HPP
+
+#include "common/RPTypes.hpp"
+#include "common/RAJAPerfSuite.hpp"
+
+#include <utility>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+//
+// Complex product written out, so it does not go through the library
+// routine that handles infinities and NaNs.
+//
+inline Complex_type fftMul(const Complex_type& a, const Complex_type& b)
+{
+  return Complex_type(a.real()*b.real() - a.imag()*b.imag(),
+                      a.real()*b.imag() + a.imag()*b.real());
+}
+
+inline void fftBitReverseCopy(Complex_ptr out, const Complex_type* in,
+                              Index_type stride,
+                              const Int_type* rev, Index_type N)
+{
+  for (Index_type i = 0; i < N; ++i) {
+    out[rev[i]*stride] = in[i*stride];
+  }
+}
+
+inline void fftBitReverse(Complex_ptr x, Index_type stride,
+                          const Int_type* rev, Index_type N)
+{
+  for (Index_type i = 0; i < N; ++i) {
+    Index_type j = rev[i];
+    if ( i < j ) {
+      std::swap(x[i*stride], x[j*stride]);
+    }
+  }
+}
+
+inline void fftButterflies(Complex_ptr x, Index_type stride,
+                           const Complex_type* tw,
+                           Index_type N, Index_type log2N)
+{
+  //
+  // m is the length of the sub-transforms combined by the next stage.
+  //
+  Index_type m = 1;
+
+  if ( log2N % 2 == 1 ) {
+    for (Index_type k = 0; k < N; k += 2) {
+      Complex_type a0 = x[k*stride];
+      Complex_type a1 = x[(k+1)*stride];
+      x[k*stride] = a0 + a1;
+      x[(k+1)*stride] = a0 - a1;
+    }
+    m = 2;
+  }
+
+  for ( ; m < N; m *= 4) {
+    const Index_type s = m*stride;
+    const Index_type tw1_step = N / (2*m);
+    const Index_type tw2_step = N / (4*m);
+    for (Index_type k = 0; k < N; k += 4*m) {
+      for (Index_type j = 0; j < m; ++j) {
+        const Complex_type w1 = tw[j*tw1_step];
+        const Complex_type w2 = tw[j*tw2_step];
+        Complex_ptr p = x + (k+j)*stride;
+
+        // radix-2 stage combining sub-transforms of length m
+        Complex_type a0 = p[0];
+        Complex_type a1 = fftMul(w1, p[s]);
+        Complex_type a2 = p[2*s];
+        Complex_type a3 = fftMul(w1, p[3*s]);
+        Complex_type b0 = a0 + a1;
+        Complex_type b1 = a0 - a1;
+        Complex_type b2 = fftMul(w2, a2 + a3);
+        Complex_type b3 = fftMul(w2, a2 - a3);
+
+        // radix-2 stage combining sub-transforms of length 2m; the
+        // twiddle factor of the second half is w2 times -i
+        b3 = Complex_type(b3.imag(), -b3.real());
+        p[0]   = b0 + b2;
+        p[2*s] = b0 - b2;
+        p[s]   = b1 + b3;
+        p[3*s] = b1 - b3;
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Return log2 of N, which must be a power of two.
+ */
+Index_type fftLog2(Index_type N);
+
+/*!
+ * \brief Allocate and fill twiddle factor (length N/2) and bit reversal
+ *        (length N) tables for transforms of length N.
+ */
+void allocAndInitFFTTables(Complex_ptr& tw, Int_ptr& rev, Index_type N,
+                           VariantID vid);
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
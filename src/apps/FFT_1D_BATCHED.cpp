@@ -0,0 +1,89 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FFT_1D_BATCHED.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "FFTData.hpp"
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+FFT_1D_BATCHED::FFT_1D_BATCHED(const RunParams& params)
+  : KernelBase(rajaperf::Apps_FFT_1D_BATCHED, params)
+{
+  m_N = 1024;
+  m_log2N = fftLog2(m_N);
+
+  setDefaultProblemSize(m_N * 1024);
+  setDefaultReps(20);
+
+  m_nbatch = std::max(getTargetProblemSize() / m_N, static_cast<Index_type>(1));
+
+  setActualProblemSize( m_N * m_nbatch );
+
+  setItsPerRep( m_nbatch );
+  setKernelsPerRep(1);
+  // touched data size; butterfly passes after the first are assumed to
+  // hit in cache
+  setBytesPerRep( (1*sizeof(Complex_type) + 1*sizeof(Complex_type)) *
+                  getActualProblemSize() +
+                  (0*sizeof(Complex_type) + 1*sizeof(Complex_type)) * (m_N/2) +
+                  (0*sizeof(Int_type) + 1*sizeof(Int_type)) * m_N );
+  setFLOPsPerRep(5 * m_N * m_log2N * m_nbatch);
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+FFT_1D_BATCHED::~FFT_1D_BATCHED()
+{
+}
+
+void FFT_1D_BATCHED::setUp(VariantID vid)
+{
+  allocAndInitData(m_x, getActualProblemSize(), vid);
+  allocAndInitData(m_y, getActualProblemSize(), vid);
+  allocAndInitFFTTables(m_tw, m_rev, m_N, vid);
+}
+
+void FFT_1D_BATCHED::updateChecksum(VariantID vid)
+{
+  checksum[vid] += calcChecksum(m_y, getActualProblemSize(), checksum_scale_factor );
+}
+
+void FFT_1D_BATCHED::tearDown(VariantID vid)
+{
+  (void) vid;
+  deallocData(m_x);
+  deallocData(m_y);
+  deallocData(m_tw);
+  deallocData(m_rev);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,93 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// FFT_1D_BATCHED kernel reference implementation:
+///
+/// for (Index_type b = 0; b < nbatch; ++b ) {
+///   for (Index_type k = 0; k < N; ++k ) {
+///     y[k + b*N] = 0;
+///     for (Index_type n = 0; n < N; ++n ) {
+///       y[k + b*N] += x[n + b*N] * exp(-2 pi i n k / N);
+///     }
+///   }
+/// }
+///
+/// Each of the nbatch contiguous transforms of length N (a power of two)
+/// is computed with the radix-2/4 FFT in FFTData.hpp.
+///
+
+#ifndef RAJAPerf_Apps_FFT_1D_BATCHED_HPP
+#define RAJAPerf_Apps_FFT_1D_BATCHED_HPP
+
+#define FFT_1D_BATCHED_DATA_SETUP \
+  Complex_ptr x = m_x; \
+  Complex_ptr y = m_y; \
+  Complex_ptr tw = m_tw; \
+  Int_ptr rev = m_rev; \
+\
+  const Index_type N = m_N; \
+  const Index_type log2N = m_log2N; \
+  const Index_type nbatch = m_nbatch;
+
+#define FFT_1D_BATCHED_BODY \
+  fftBitReverseCopy(y + b*N, x + b*N, 1, rev, N); \
+  fftButterflies(y + b*N, 1, tw, N, log2N);
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+class FFT_1D_BATCHED : public KernelBase
+{
+public:
+
+  FFT_1D_BATCHED(const RunParams& params);
+
+  ~FFT_1D_BATCHED();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  FFT_1D_BATCHED : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  FFT_1D_BATCHED : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  FFT_1D_BATCHED : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  Complex_ptr m_x;
+  Complex_ptr m_y;
+  Complex_ptr m_tw;
+  Int_ptr m_rev;
+
+  Index_type m_N;
+  Index_type m_log2N;
+  Index_type m_nbatch;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,128 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FFT_3D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "FFTData.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void FFT_3D::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  FFT_3D_DATA_SETUP;
+
+  auto fft_3d_lam_i = [=](Index_type p) {
+                        FFT_3D_BODY_I;
+                      };
+  auto fft_3d_lam_j = [=](Index_type p) {
+                        FFT_3D_BODY_J;
+                      };
+  auto fft_3d_lam_k = [=](Index_type p) {
+                        FFT_3D_BODY_K;
+                      };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type p = 0; p < npencils; ++p ) {
+          FFT_3D_BODY_I;
+        }
+
+        #pragma omp parallel for
+        for (Index_type p = 0; p < npencils; ++p ) {
+          FFT_3D_BODY_J;
+        }
+
+        #pragma omp parallel for
+        for (Index_type p = 0; p < npencils; ++p ) {
+          FFT_3D_BODY_K;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type p = 0; p < npencils; ++p ) {
+          fft_3d_lam_i(p);
+        }
+
+        #pragma omp parallel for
+        for (Index_type p = 0; p < npencils; ++p ) {
+          fft_3d_lam_j(p);
+        }
+
+        #pragma omp parallel for
+        for (Index_type p = 0; p < npencils; ++p ) {
+          fft_3d_lam_k(p);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, npencils), fft_3d_lam_i);
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, npencils), fft_3d_lam_j);
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, npencils), fft_3d_lam_k);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FFT_3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,118 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FFT_3D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "FFTData.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void FFT_3D::runSeqVariant(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  FFT_3D_DATA_SETUP;
+
+  auto fft_3d_lam_i = [=](Index_type p) {
+                        FFT_3D_BODY_I;
+                      };
+  auto fft_3d_lam_j = [=](Index_type p) {
+                        FFT_3D_BODY_J;
+                      };
+  auto fft_3d_lam_k = [=](Index_type p) {
+                        FFT_3D_BODY_K;
+                      };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type p = 0; p < npencils; ++p ) {
+          FFT_3D_BODY_I;
+        }
+
+        for (Index_type p = 0; p < npencils; ++p ) {
+          FFT_3D_BODY_J;
+        }
+
+        for (Index_type p = 0; p < npencils; ++p ) {
+          FFT_3D_BODY_K;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type p = 0; p < npencils; ++p ) {
+          fft_3d_lam_i(p);
+        }
+
+        for (Index_type p = 0; p < npencils; ++p ) {
+          fft_3d_lam_j(p);
+        }
+
+        for (Index_type p = 0; p < npencils; ++p ) {
+          fft_3d_lam_k(p);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, npencils), fft_3d_lam_i);
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, npencils), fft_3d_lam_j);
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, npencils), fft_3d_lam_k);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  FFT_3D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+} // end namespace apps
+} // end namespace rajaperf
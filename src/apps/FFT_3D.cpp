@@ -0,0 +1,89 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FFT_3D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "FFTData.hpp"
+#include "common/DataUtils.hpp"
+
+#include <cmath>
+
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+FFT_3D::FFT_3D(const RunParams& params)
+  : KernelBase(rajaperf::Apps_FFT_3D, params)
+{
+  setDefaultProblemSize(128*128*128);
+  setDefaultReps(5);
+
+  // power of two at or below the cube root of the target size
+  m_log2N = fftLog2(
+    static_cast<Index_type>( std::cbrt( getTargetProblemSize() ) + 0.5 ) );
+  m_N = Index_type(1) << m_log2N;
+
+  setActualProblemSize( m_N * m_N * m_N );
+
+  setItsPerRep( 3 * m_N * m_N );
+  setKernelsPerRep(3);
+  // touched data size of the three passes; the pass along i reads x and
+  // writes y, the others read and write y
+  setBytesPerRep( 3 * (1*sizeof(Complex_type) + 1*sizeof(Complex_type)) *
+                  getActualProblemSize() +
+                  (0*sizeof(Complex_type) + 1*sizeof(Complex_type)) * (m_N/2) +
+                  (0*sizeof(Int_type) + 1*sizeof(Int_type)) * m_N );
+  setFLOPsPerRep(5 * getActualProblemSize() * 3 * m_log2N);
+
+  checksum_scale_factor = 0.0001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+FFT_3D::~FFT_3D()
+{
+}
+
+void FFT_3D::setUp(VariantID vid)
+{
+  allocAndInitData(m_x, getActualProblemSize(), vid);
+  allocAndInitData(m_y, getActualProblemSize(), vid);
+  allocAndInitFFTTables(m_tw, m_rev, m_N, vid);
+}
+
+void FFT_3D::updateChecksum(VariantID vid)
+{
+  checksum[vid] += calcChecksum(m_y, getActualProblemSize(), checksum_scale_factor );
+}
+
+void FFT_3D::tearDown(VariantID vid)
+{
+  (void) vid;
+  deallocData(m_x);
+  deallocData(m_y);
+  deallocData(m_tw);
+  deallocData(m_rev);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,113 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// FFT_3D kernel reference implementation:
+///
+/// for (Index_type k3 = 0; k3 < N; ++k3 ) {
+///   for (Index_type k2 = 0; k2 < N; ++k2 ) {
+///     for (Index_type k1 = 0; k1 < N; ++k1 ) {
+///       y[k1 + k2*N + k3*N*N] = 0;
+///       for (Index_type n3 = 0; n3 < N; ++n3 ) {
+///         for (Index_type n2 = 0; n2 < N; ++n2 ) {
+///           for (Index_type n1 = 0; n1 < N; ++n1 ) {
+///             y[k1 + k2*N + k3*N*N] += x[n1 + n2*N + n3*N*N] *
+///               exp(-2 pi i (n1 k1 + n2 k2 + n3 k3) / N);
+///           }
+///         }
+///       }
+///     }
+///   }
+/// }
+///
+/// The transform of the N x N x N grid (N a power of two) is done as
+/// three passes of N*N one dimensional transforms along pencils in the
+/// i, j and k directions with the radix-2/4 FFT in FFTData.hpp. The first
+/// pass reads x and writes y; the others transform y in place.
+///
+
+#ifndef RAJAPerf_Apps_FFT_3D_HPP
+#define RAJAPerf_Apps_FFT_3D_HPP
+
+#define FFT_3D_DATA_SETUP \
+  Complex_ptr x = m_x; \
+  Complex_ptr y = m_y; \
+  Complex_ptr tw = m_tw; \
+  Int_ptr rev = m_rev; \
+\
+  const Index_type N = m_N; \
+  const Index_type log2N = m_log2N; \
+  const Index_type npencils = N * N;
+
+// pencil p = j + k*N along i
+#define FFT_3D_BODY_I \
+  fftBitReverseCopy(y + p*N, x + p*N, 1, rev, N); \
+  fftButterflies(y + p*N, 1, tw, N, log2N);
+
+// pencil p = i + k*N along j
+#define FFT_3D_BODY_J \
+  Complex_ptr yp = y + (p % N) + (p / N)*N*N; \
+  fftBitReverse(yp, N, rev, N); \
+  fftButterflies(yp, N, tw, N, log2N);
+
+// pencil p = i + j*N along k
+#define FFT_3D_BODY_K \
+  fftBitReverse(y + p, N*N, rev, N); \
+  fftButterflies(y + p, N*N, tw, N, log2N);
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+class FFT_3D : public KernelBase
+{
+public:
+
+  FFT_3D(const RunParams& params);
+
+  ~FFT_3D();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  FFT_3D : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  FFT_3D : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  FFT_3D : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  Complex_ptr m_x;
+  Complex_ptr m_y;
+  Complex_ptr m_tw;
+  Int_ptr m_rev;
+
+  Index_type m_N;
+  Index_type m_log2N;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -37,6 +37,7 @@ namespace apps {
   deallocCudaDeviceData(X);                                              \
   deallocCudaDeviceData(Y);
 
+template < int MPA_D1D, int MPA_Q1D >
 __global__ void Mass3DPA(Index_type NE, const Real_ptr B, const Real_ptr Bt,
                          const Real_ptr D, const Real_ptr X, Real_ptr Y) {
 
@@ -100,7 +101,8 @@ __global__ void Mass3DPA(Index_type NE, const Real_ptr B, const Real_ptr Bt,
   }
 }
 
-void MASS3DPA::runCudaVariant(VariantID vid) {
+template < int MPA_D1D, int MPA_Q1D >
+void MASS3DPA::runCudaVariantImpl(VariantID vid) {
   const Index_type run_reps = getRunReps();
 
   MASS3DPA_DATA_SETUP;
@@ -116,7 +118,7 @@ void MASS3DPA::runCudaVariant(VariantID vid) {
 
       dim3 nthreads_per_block(MPA_Q1D, MPA_Q1D, 1);
 
-      Mass3DPA<<<NE, nthreads_per_block>>>(NE, B, Bt, D, X, Y);
+      Mass3DPA<MPA_D1D, MPA_Q1D><<<NE, nthreads_per_block>>>(NE, B, Bt, D, X, Y);
 
       cudaErrchk( cudaGetLastError() );
     }
@@ -283,6 +285,11 @@ void MASS3DPA::runCudaVariant(VariantID vid) {
   }
 }
 
+void MASS3DPA::runCudaVariant(VariantID vid)
+{
+  FEM_ORDER_DISPATCH(m_order, runCudaVariantImpl, vid)
+}
+
 } // end namespace apps
 } // end namespace rajaperf
 
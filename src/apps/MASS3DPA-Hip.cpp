@@ -37,6 +37,7 @@ namespace apps {
   deallocHipDeviceData(X);                                                \
   deallocHipDeviceData(Y);
 
+template < int MPA_D1D, int MPA_Q1D >
 __global__ void Mass3DPA(Index_type NE, const Real_ptr B, const Real_ptr Bt,
                          const Real_ptr D, const Real_ptr X, Real_ptr Y) {
 
@@ -100,7 +101,8 @@ __global__ void Mass3DPA(Index_type NE, const Real_ptr B, const Real_ptr Bt,
   }
 }
 
-void MASS3DPA::runHipVariant(VariantID vid) {
+template < int MPA_D1D, int MPA_Q1D >
+void MASS3DPA::runHipVariantImpl(VariantID vid) {
   const Index_type run_reps = getRunReps();
 
   MASS3DPA_DATA_SETUP;
@@ -117,7 +119,7 @@ void MASS3DPA::runHipVariant(VariantID vid) {
     startTimer();
     for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-      hipLaunchKernelGGL((Mass3DPA), dim3(grid_size), dim3(block_size), 0, 0,
+      hipLaunchKernelGGL((Mass3DPA<MPA_D1D, MPA_Q1D>), dim3(grid_size), dim3(block_size), 0, 0,
                          NE, B, Bt, D, X, Y);
 
       hipErrchk( hipGetLastError() );
@@ -285,6 +287,11 @@ void MASS3DPA::runHipVariant(VariantID vid) {
   }
 }
 
+void MASS3DPA::runHipVariant(VariantID vid)
+{
+  FEM_ORDER_DISPATCH(m_order, runHipVariantImpl, vid)
+}
+
 } // end namespace apps
 } // end namespace rajaperf
 
@@ -19,7 +19,8 @@ namespace rajaperf {
 namespace apps {
 
 
-void MASS3DPA::runOpenMPVariant(VariantID vid) {
+template < int MPA_D1D, int MPA_Q1D >
+void MASS3DPA::runOpenMPVariantImpl(VariantID vid) {
 
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -258,5 +259,10 @@ void MASS3DPA::runOpenMPVariant(VariantID vid) {
 #endif
 }
 
+void MASS3DPA::runOpenMPVariant(VariantID vid)
+{
+  FEM_ORDER_DISPATCH(m_order, runOpenMPVariantImpl, vid)
+}
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -19,7 +19,8 @@ namespace rajaperf {
 namespace apps {
 
 
-void MASS3DPA::runSeqVariant(VariantID vid) {
+template < int MPA_D1D, int MPA_Q1D >
+void MASS3DPA::runSeqVariantImpl(VariantID vid) {
   const Index_type run_reps = getRunReps();
 
   MASS3DPA_DATA_SETUP;
@@ -251,5 +252,10 @@ void MASS3DPA::runSeqVariant(VariantID vid) {
   }
 }
 
+void MASS3DPA::runSeqVariant(VariantID vid)
+{
+  FEM_ORDER_DISPATCH(m_order, runSeqVariantImpl, vid)
+}
+
 } // end namespace apps
 } // end namespace rajaperf
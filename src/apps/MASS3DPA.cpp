@@ -13,6 +13,8 @@
 #include "common/DataUtils.hpp"
 
 #include <algorithm>
+#include <string>
+#include <vector>
 
 namespace rajaperf
 {
@@ -25,28 +27,56 @@ MASS3DPA::MASS3DPA(const RunParams& params)
 {
   m_NE_default = 8000;
 
-  setDefaultProblemSize(m_NE_default*MPA_Q1D*MPA_Q1D*MPA_Q1D);
+  // Problem size is given for the default order. Each order tuning
+  // runs on as many elements as fit in the target problem size, with
+  // its own bytes, FLOPs, and DOFs.
+  constexpr Index_type Q1D_default = MPA_DEFAULT_ORDER + 2;
+
+  setDefaultProblemSize(m_NE_default*Q1D_default*Q1D_default*Q1D_default);
   setDefaultReps(50);
 
-  m_NE = std::max(getTargetProblemSize()/(MPA_Q1D*MPA_Q1D*MPA_Q1D), Index_type(1));
+  m_NE = std::max(getTargetProblemSize()/(Q1D_default*Q1D_default*Q1D_default),
+                  Index_type(1));
 
-  setActualProblemSize( m_NE*MPA_Q1D*MPA_Q1D*MPA_Q1D );
+  setActualProblemSize( m_NE*Q1D_default*Q1D_default*Q1D_default );
 
   setItsPerRep(getActualProblemSize());
   setKernelsPerRep(1);
 
-  setBytesPerRep( MPA_Q1D*MPA_D1D*sizeof(Real_type)  +
-                  MPA_Q1D*MPA_D1D*sizeof(Real_type)  +
-                  MPA_Q1D*MPA_Q1D*MPA_Q1D*m_NE*sizeof(Real_type) +
-                  MPA_D1D*MPA_D1D*MPA_D1D*m_NE*sizeof(Real_type) +
-                  MPA_D1D*MPA_D1D*MPA_D1D*m_NE*sizeof(Real_type) );
-
-  setFLOPsPerRep(m_NE * (2 * MPA_D1D * MPA_D1D * MPA_D1D * MPA_Q1D +
-                         2 * MPA_D1D * MPA_D1D * MPA_Q1D * MPA_Q1D +
-                         2 * MPA_D1D * MPA_Q1D * MPA_Q1D * MPA_Q1D + MPA_Q1D * MPA_Q1D * MPA_Q1D +
-                         2 * MPA_Q1D * MPA_Q1D * MPA_Q1D * MPA_D1D +
-                         2 * MPA_Q1D * MPA_Q1D * MPA_D1D * MPA_D1D +
-                         2 * MPA_Q1D * MPA_D1D * MPA_D1D * MPA_D1D + MPA_D1D * MPA_D1D * MPA_D1D));
+  std::vector<std::string> order_tunings;
+  for (Index_type p = 1; p <= FEM_MAX_ORDER; ++p) {
+    const Index_type D1D = p + 1;
+    const Index_type Q1D = p + 2;
+    const Index_type NE =
+      std::max(getTargetProblemSize()/(Q1D*Q1D*Q1D), Index_type(1));
+
+    std::string tname = "p" + std::to_string(p);
+    order_tunings.push_back(tname);
+    m_order_NE.push_back(NE);
+
+    setBytesPerRep( tname,
+                    Q1D*D1D*sizeof(Real_type)  +
+                    Q1D*D1D*sizeof(Real_type)  +
+                    Q1D*Q1D*Q1D*NE*sizeof(Real_type) +
+                    D1D*D1D*D1D*NE*sizeof(Real_type) +
+                    D1D*D1D*D1D*NE*sizeof(Real_type) );
+
+    setFLOPsPerRep( tname,
+                    NE * (2 * D1D * D1D * D1D * Q1D +
+                          2 * D1D * D1D * Q1D * Q1D +
+                          2 * D1D * Q1D * Q1D * Q1D + Q1D * Q1D * Q1D +
+                          2 * Q1D * Q1D * Q1D * D1D +
+                          2 * Q1D * Q1D * D1D * D1D +
+                          2 * Q1D * D1D * D1D * D1D + D1D * D1D * D1D) );
+
+    setDOFsPerRep(tname, NE*D1D*D1D*D1D);
+
+    if ( p == MPA_DEFAULT_ORDER ) {
+      setBytesPerRep( getBytesPerRep(tname) );
+      setFLOPsPerRep( getFLOPsPerRep(tname) );
+    }
+  }
+
   setUsesFeature(Teams);
 
   setVariantDefined( Base_Seq );
@@ -61,6 +91,13 @@ MASS3DPA::MASS3DPA(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
 
+  for (size_t vid = 0; vid < NumVariants; ++vid) {
+    setVariantTuningNames(static_cast<VariantID>(vid), order_tunings);
+  }
+
+  m_order = MPA_DEFAULT_ORDER;
+  m_D1D = m_order + 1;
+  m_Q1D = m_order + 2;
 }
 
 MASS3DPA::~MASS3DPA()
@@ -69,17 +106,21 @@ MASS3DPA::~MASS3DPA()
 
 void MASS3DPA::setUp(VariantID vid)
 {
-
-  allocAndInitDataConst(m_B, int(MPA_Q1D*MPA_D1D), Real_type(1.0), vid);
-  allocAndInitDataConst(m_Bt,int(MPA_Q1D*MPA_D1D), Real_type(1.0), vid);
-  allocAndInitDataConst(m_D, int(MPA_Q1D*MPA_Q1D*MPA_Q1D*m_NE), Real_type(1.0), vid);
-  allocAndInitDataConst(m_X, int(MPA_D1D*MPA_D1D*MPA_D1D*m_NE), Real_type(1.0), vid);
-  allocAndInitDataConst(m_Y, int(MPA_D1D*MPA_D1D*MPA_D1D*m_NE), Real_type(0.0), vid);
+  m_order = getRunningTuning() + 1;
+  m_NE = m_order_NE[getRunningTuning()];
+  m_D1D = m_order + 1;
+  m_Q1D = m_order + 2;
+
+  allocAndInitData(m_B, int(m_Q1D*m_D1D), vid);
+  allocAndInitData(m_Bt, int(m_Q1D*m_D1D), vid);
+  allocAndInitDataConst(m_D, int(m_Q1D*m_Q1D*m_Q1D*m_NE), Real_type(1.0), vid);
+  allocAndInitData(m_X, int(m_D1D*m_D1D*m_D1D*m_NE), vid);
+  allocAndInitDataConst(m_Y, int(m_D1D*m_D1D*m_D1D*m_NE), Real_type(0.0), vid);
 }
 
 void MASS3DPA::updateChecksum(VariantID vid)
 {
-  checksum[vid] += calcChecksum(m_Y, MPA_D1D*MPA_D1D*MPA_D1D*m_NE);
+  checksum[vid] += calcChecksum(m_Y, m_D1D*m_D1D*m_D1D*m_NE);
 }
 
 void MASS3DPA::tearDown(VariantID vid)
@@ -168,9 +168,11 @@ Index_type NE = m_NE;
 
 #include "RAJA/RAJA.hpp"
 
-//Number of Dofs/Qpts in 1D
-#define MPA_D1D 4
-#define MPA_Q1D 5
+//Number of Dofs/Qpts in 1D are the template parameters MPA_D1D and
+//MPA_Q1D of the variant implementations, which are instantiated for each
+//polynomial order (see FEM_ORDER_DISPATCH in FEM_MACROS.hpp).
+//Problem size is based on the default order below.
+#define MPA_DEFAULT_ORDER 3
 #define B_(x, y) B[x + MPA_Q1D * y]
 #define Bt_(x, y) Bt[x + MPA_D1D * y]
 #define X_(dx, dy, dz, e)                                                      \
@@ -378,6 +380,15 @@ public:
   void runHipVariant(VariantID vid);
   void runOpenMPTargetVariant(VariantID vid);
 
+  template < int MPA_D1D, int MPA_Q1D >
+  void runSeqVariantImpl(VariantID vid);
+  template < int MPA_D1D, int MPA_Q1D >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < int MPA_D1D, int MPA_Q1D >
+  void runCudaVariantImpl(VariantID vid);
+  template < int MPA_D1D, int MPA_Q1D >
+  void runHipVariantImpl(VariantID vid);
+
 private:
 
   Real_ptr m_B;
@@ -388,6 +399,11 @@ private:
 
   Index_type m_NE;
   Index_type m_NE_default;
+  std::vector<Index_type> m_order_NE;
+
+  Index_type m_order;
+  Index_type m_D1D;
+  Index_type m_Q1D;
 };
 
 } // end namespace apps
@@ -0,0 +1,187 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MPI_HALOEXCHANGE.hpp"
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void MPI_HALOEXCHANGE::runSeqVariant(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  MPI_HALOEXCHANGE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        postRecvs();
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = pack_buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            for (Index_type i = 0; i < len; i++) {
+              MPI_HALOEXCHANGE_PACK_BODY;
+            }
+            buffer += len;
+          }
+          sendPacked(l);
+        }
+
+        for (Index_type ll = 0; ll < num_neighbors; ++ll) {
+          Index_type l = waitRecv(ll);
+          Real_ptr buffer = unpack_buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            for (Index_type i = 0; i < len; i++) {
+              MPI_HALOEXCHANGE_UNPACK_BODY;
+            }
+            buffer += len;
+          }
+        }
+
+        waitSends();
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        postRecvs();
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = pack_buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto mpi_haloexchange_pack_base_lam = [=](Index_type i) {
+                  MPI_HALOEXCHANGE_PACK_BODY;
+                };
+            for (Index_type i = 0; i < len; i++) {
+              mpi_haloexchange_pack_base_lam(i);
+            }
+            buffer += len;
+          }
+          sendPacked(l);
+        }
+
+        for (Index_type ll = 0; ll < num_neighbors; ++ll) {
+          Index_type l = waitRecv(ll);
+          Real_ptr buffer = unpack_buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto mpi_haloexchange_unpack_base_lam = [=](Index_type i) {
+                  MPI_HALOEXCHANGE_UNPACK_BODY;
+                };
+            for (Index_type i = 0; i < len; i++) {
+              mpi_haloexchange_unpack_base_lam(i);
+            }
+            buffer += len;
+          }
+        }
+
+        waitSends();
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      using EXEC_POL = RAJA::loop_exec;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        postRecvs();
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = pack_buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto mpi_haloexchange_pack_base_lam = [=](Index_type i) {
+                  MPI_HALOEXCHANGE_PACK_BODY;
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, len),
+                mpi_haloexchange_pack_base_lam );
+            buffer += len;
+          }
+          sendPacked(l);
+        }
+
+        for (Index_type ll = 0; ll < num_neighbors; ++ll) {
+          Index_type l = waitRecv(ll);
+          Real_ptr buffer = unpack_buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto mpi_haloexchange_unpack_base_lam = [=](Index_type i) {
+                  MPI_HALOEXCHANGE_UNPACK_BODY;
+                };
+            RAJA::forall<EXEC_POL>(
+                RAJA::TypedRangeSegment<Index_type>(0, len),
+                mpi_haloexchange_unpack_base_lam );
+            buffer += len;
+          }
+        }
+
+        waitSends();
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n MPI_HALOEXCHANGE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif  // RAJA_PERFSUITE_ENABLE_MPI
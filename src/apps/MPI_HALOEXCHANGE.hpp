@@ -0,0 +1,122 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// MPI_HALOEXCHANGE kernel reference implementation:
+///
+/// // post receives for each neighbor
+/// postRecvs();
+///
+/// // pack and send message for each neighbor
+/// for (Index_type l = 0; l < num_neighbors; ++l) {
+///   Real_ptr buffer = pack_buffers[l];
+///   Int_ptr list = pack_index_lists[l];
+///   Index_type  len  = pack_index_list_lengths[l];
+///   // pack part of each variable
+///   for (Index_type v = 0; v < num_vars; ++v) {
+///     Real_ptr var = vars[v];
+///     for (Index_type i = 0; i < len; i++) {
+///       MPI_HALOEXCHANGE_PACK_BODY;
+///     }
+///     buffer += len;
+///   }
+///   // send message to neighbor
+///   sendPacked(l);
+/// }
+///
+/// // receive and unpack message from each neighbor
+/// for (Index_type ll = 0; ll < num_neighbors; ++ll) {
+///   // receive message from neighbor
+///   Index_type l = waitRecv(ll);
+///   Real_ptr buffer = unpack_buffers[l];
+///   Int_ptr list = unpack_index_lists[l];
+///   Index_type  len  = unpack_index_list_lengths[l];
+///   // unpack part of each variable
+///   for (Index_type v = 0; v < num_vars; ++v) {
+///     Real_ptr var = vars[v];
+///     for (Index_type i = 0; i < len; i++) {
+///       MPI_HALOEXCHANGE_UNPACK_BODY;
+///     }
+///     buffer += len;
+///   }
+/// }
+///
+/// // wait for sends to complete
+/// waitSends();
+///
+/// See MPI_HALOEXCHANGE_base.hpp for the communication modes run as
+/// tunings of each variant.
+///
+
+#ifndef RAJAPerf_Apps_MPI_HALOEXCHANGE_HPP
+#define RAJAPerf_Apps_MPI_HALOEXCHANGE_HPP
+
+#define MPI_HALOEXCHANGE_DATA_SETUP \
+  std::vector<Real_ptr> vars = m_vars; \
+  std::vector<Real_ptr> pack_buffers = m_pack_buffers; \
+  std::vector<Real_ptr> unpack_buffers = m_unpack_buffers; \
+\
+  Index_type num_neighbors = s_num_neighbors; \
+  Index_type num_vars = m_num_vars; \
+  std::vector<Int_ptr> pack_index_lists = m_pack_index_lists; \
+  std::vector<Index_type> pack_index_list_lengths = m_pack_index_list_lengths; \
+  std::vector<Int_ptr> unpack_index_lists = m_unpack_index_lists; \
+  std::vector<Index_type> unpack_index_list_lengths = m_unpack_index_list_lengths;
+
+#define MPI_HALOEXCHANGE_PACK_BODY \
+  buffer[i] = var[list[i]];
+
+#define MPI_HALOEXCHANGE_UNPACK_BODY \
+  var[list[i]] = buffer[i];
+
+
+#include "apps/MPI_HALOEXCHANGE_base.hpp"
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+
+#include "RAJA/RAJA.hpp"
+
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+class MPI_HALOEXCHANGE : public MPI_HALOEXCHANGE_base
+{
+public:
+
+  MPI_HALOEXCHANGE(const RunParams& params);
+
+  ~MPI_HALOEXCHANGE();
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  MPI_HALOEXCHANGE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  MPI_HALOEXCHANGE : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  MPI_HALOEXCHANGE : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif  // RAJA_PERFSUITE_ENABLE_MPI
+
+#endif // closing endif for header file include guard
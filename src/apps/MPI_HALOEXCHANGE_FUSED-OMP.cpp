@@ -0,0 +1,345 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MPI_HALOEXCHANGE_FUSED.hpp"
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void MPI_HALOEXCHANGE_FUSED::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  MPI_HALOEXCHANGE_FUSED_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      MPI_HALOEXCHANGE_FUSED_MANUAL_FUSER_SETUP;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        postRecvs();
+
+        Index_type pack_index = 0;
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = pack_buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            pack_ptr_holders[pack_index] = ptr_holder{buffer, list, var};
+            pack_lens[pack_index] = len;
+            pack_index += 1;
+            buffer += len;
+          }
+        }
+#if _OPENMP >= 200805
+        #pragma omp parallel
+        #pragma omp single nowait
+        for (Index_type j = 0; j < pack_index; j++) {
+          #pragma omp task firstprivate(j)
+          {
+            Real_ptr   buffer = pack_ptr_holders[j].buffer;
+            Int_ptr    list   = pack_ptr_holders[j].list;
+            Real_ptr   var    = pack_ptr_holders[j].var;
+            Index_type len    = pack_lens[j];
+            for (Index_type i = 0; i < len; i++) {
+              MPI_HALOEXCHANGE_FUSED_PACK_BODY;
+            }
+          }
+        }
+#else
+        #pragma omp parallel for
+        for (Index_type j = 0; j < pack_index; j++) {
+          Real_ptr   buffer = pack_ptr_holders[j].buffer;
+          Int_ptr    list   = pack_ptr_holders[j].list;
+          Real_ptr   var    = pack_ptr_holders[j].var;
+          Index_type len    = pack_lens[j];
+          for (Index_type i = 0; i < len; i++) {
+            MPI_HALOEXCHANGE_FUSED_PACK_BODY;
+          }
+        }
+#endif
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          sendPacked(l);
+        }
+
+        waitRecvs();
+
+        Index_type unpack_index = 0;
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = unpack_buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            unpack_ptr_holders[unpack_index] = ptr_holder{buffer, list, var};
+            unpack_lens[unpack_index] = len;
+            unpack_index += 1;
+            buffer += len;
+          }
+        }
+#if _OPENMP >= 200805
+        #pragma omp parallel
+        #pragma omp single nowait
+        for (Index_type j = 0; j < unpack_index; j++) {
+          #pragma omp task firstprivate(j)
+          {
+            Real_ptr   buffer = unpack_ptr_holders[j].buffer;
+            Int_ptr    list   = unpack_ptr_holders[j].list;
+            Real_ptr   var    = unpack_ptr_holders[j].var;
+            Index_type len    = unpack_lens[j];
+            for (Index_type i = 0; i < len; i++) {
+              MPI_HALOEXCHANGE_FUSED_UNPACK_BODY;
+            }
+          }
+        }
+#else
+        #pragma omp parallel for
+        for (Index_type j = 0; j < unpack_index; j++) {
+          Real_ptr   buffer = unpack_ptr_holders[j].buffer;
+          Int_ptr    list   = unpack_ptr_holders[j].list;
+          Real_ptr   var    = unpack_ptr_holders[j].var;
+          Index_type len    = unpack_lens[j];
+          for (Index_type i = 0; i < len; i++) {
+            MPI_HALOEXCHANGE_FUSED_UNPACK_BODY;
+          }
+        }
+#endif
+
+        waitSends();
+
+      }
+      stopTimer();
+
+      MPI_HALOEXCHANGE_FUSED_MANUAL_FUSER_TEARDOWN;
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      MPI_HALOEXCHANGE_FUSED_MANUAL_LAMBDA_FUSER_SETUP;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        postRecvs();
+
+        Index_type pack_index = 0;
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = pack_buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            new(&pack_lambdas[pack_index]) pack_lambda_type(make_pack_lambda(buffer, list, var));
+            pack_lens[pack_index] = len;
+            pack_index += 1;
+            buffer += len;
+          }
+        }
+#if _OPENMP >= 200805
+        #pragma omp parallel
+        #pragma omp single nowait
+        for (Index_type j = 0; j < pack_index; j++) {
+          #pragma omp task firstprivate(j)
+          {
+            auto       pack_lambda = pack_lambdas[j];
+            Index_type len         = pack_lens[j];
+            for (Index_type i = 0; i < len; i++) {
+              pack_lambda(i);
+            }
+          }
+        }
+#else
+        #pragma omp parallel for
+        for (Index_type j = 0; j < pack_index; j++) {
+          auto       pack_lambda = pack_lambdas[j];
+          Index_type len         = pack_lens[j];
+          for (Index_type i = 0; i < len; i++) {
+            pack_lambda(i);
+          }
+        }
+#endif
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          sendPacked(l);
+        }
+
+        waitRecvs();
+
+        Index_type unpack_index = 0;
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = unpack_buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            new(&unpack_lambdas[unpack_index]) unpack_lambda_type(make_unpack_lambda(buffer, list, var));
+            unpack_lens[unpack_index] = len;
+            unpack_index += 1;
+            buffer += len;
+          }
+        }
+#if _OPENMP >= 200805
+        #pragma omp parallel
+        #pragma omp single nowait
+        for (Index_type j = 0; j < unpack_index; j++) {
+          #pragma omp task firstprivate(j)
+          {
+            auto       unpack_lambda = unpack_lambdas[j];
+            Index_type len           = unpack_lens[j];
+            for (Index_type i = 0; i < len; i++) {
+              unpack_lambda(i);
+            }
+          }
+        }
+#else
+        #pragma omp parallel for
+        for (Index_type j = 0; j < unpack_index; j++) {
+          auto       unpack_lambda = unpack_lambdas[j];
+          Index_type len           = unpack_lens[j];
+          for (Index_type i = 0; i < len; i++) {
+            unpack_lambda(i);
+          }
+        }
+#endif
+
+        waitSends();
+
+      }
+      stopTimer();
+
+      MPI_HALOEXCHANGE_FUSED_MANUAL_LAMBDA_FUSER_TEARDOWN;
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using AllocatorHolder = RAJAPoolAllocatorHolder<
+        RAJA::basic_mempool::MemPool<RAJA::basic_mempool::generic_allocator>>;
+      using Allocator = AllocatorHolder::Allocator<char>;
+
+      AllocatorHolder allocatorHolder;
+
+      using workgroup_policy = RAJA::WorkGroupPolicy <
+                                   RAJA::omp_work,
+                                   RAJA::ordered,
+                                   RAJA::constant_stride_array_of_objects >;
+
+      using workpool = RAJA::WorkPool< workgroup_policy,
+                                       Index_type,
+                                       RAJA::xargs<>,
+                                       Allocator >;
+
+      using workgroup = RAJA::WorkGroup< workgroup_policy,
+                                         Index_type,
+                                         RAJA::xargs<>,
+                                         Allocator >;
+
+      using worksite = RAJA::WorkSite< workgroup_policy,
+                                       Index_type,
+                                       RAJA::xargs<>,
+                                       Allocator >;
+
+      workpool pool_pack  (allocatorHolder.template getAllocator<char>());
+      workpool pool_unpack(allocatorHolder.template getAllocator<char>());
+      pool_pack.reserve(num_neighbors * num_vars, 1024ull*1024ull);
+      pool_unpack.reserve(num_neighbors * num_vars, 1024ull*1024ull);
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        postRecvs();
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = pack_buffers[l];
+          Int_ptr list = pack_index_lists[l];
+          Index_type  len  = pack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto mpi_haloexchange_fused_pack_base_lam = [=](Index_type i) {
+                  MPI_HALOEXCHANGE_FUSED_PACK_BODY;
+                };
+            pool_pack.enqueue(
+                RAJA::TypedRangeSegment<Index_type>(0, len),
+                mpi_haloexchange_fused_pack_base_lam );
+            buffer += len;
+          }
+        }
+        workgroup group_pack = pool_pack.instantiate();
+        worksite site_pack = group_pack.run();
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          sendPacked(l);
+        }
+
+        waitRecvs();
+
+        for (Index_type l = 0; l < num_neighbors; ++l) {
+          Real_ptr buffer = unpack_buffers[l];
+          Int_ptr list = unpack_index_lists[l];
+          Index_type  len  = unpack_index_list_lengths[l];
+          for (Index_type v = 0; v < num_vars; ++v) {
+            Real_ptr var = vars[v];
+            auto mpi_haloexchange_fused_unpack_base_lam = [=](Index_type i) {
+                  MPI_HALOEXCHANGE_FUSED_UNPACK_BODY;
+                };
+            pool_unpack.enqueue(
+                RAJA::TypedRangeSegment<Index_type>(0, len),
+                mpi_haloexchange_fused_unpack_base_lam );
+            buffer += len;
+          }
+        }
+        workgroup group_unpack = pool_unpack.instantiate();
+        worksite site_unpack = group_unpack.run();
+
+        waitSends();
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n MPI_HALOEXCHANGE_FUSED : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif  // RAJA_PERFSUITE_ENABLE_MPI
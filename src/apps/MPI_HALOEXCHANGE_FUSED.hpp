@@ -0,0 +1,173 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// MPI_HALOEXCHANGE_FUSED kernel reference implementation:
+///
+/// // post receives for each neighbor
+/// postRecvs();
+///
+/// // pack message for each neighbor
+/// for (Index_type l = 0; l < num_neighbors; ++l) {
+///   Real_ptr buffer = pack_buffers[l];
+///   Int_ptr list = pack_index_lists[l];
+///   Index_type  len  = pack_index_list_lengths[l];
+///   // pack part of each variable
+///   for (Index_type v = 0; v < num_vars; ++v) {
+///     Real_ptr var = vars[v];
+///     for (Index_type i = 0; i < len; i++) {
+///       MPI_HALOEXCHANGE_FUSED_PACK_BODY;
+///     }
+///     buffer += len;
+///   }
+/// }
+///
+/// // send message to each neighbor
+/// for (Index_type l = 0; l < num_neighbors; ++l) {
+///   sendPacked(l);
+/// }
+///
+/// // receive messages from all neighbors
+/// waitRecvs();
+///
+/// // unpack messages for each neighbor
+/// for (Index_type l = 0; l < num_neighbors; ++l) {
+///   Real_ptr buffer = unpack_buffers[l];
+///   Int_ptr list = unpack_index_lists[l];
+///   Index_type  len  = unpack_index_list_lengths[l];
+///   // unpack part of each variable
+///   for (Index_type v = 0; v < num_vars; ++v) {
+///     Real_ptr var = vars[v];
+///     for (Index_type i = 0; i < len; i++) {
+///       MPI_HALOEXCHANGE_FUSED_UNPACK_BODY;
+///     }
+///     buffer += len;
+///   }
+/// }
+///
+/// // wait for sends to complete
+/// waitSends();
+///
+/// The packing loops for all neighbors and variables are fused into a
+/// single parallel region (and likewise the unpacking loops), so all
+/// messages are sent after packing completes and unpacking starts once
+/// all messages have arrived. See MPI_HALOEXCHANGE_base.hpp for the
+/// communication modes run as tunings of each variant.
+///
+
+#ifndef RAJAPerf_Apps_MPI_HALOEXCHANGE_FUSED_HPP
+#define RAJAPerf_Apps_MPI_HALOEXCHANGE_FUSED_HPP
+
+#define MPI_HALOEXCHANGE_FUSED_DATA_SETUP \
+  std::vector<Real_ptr> vars = m_vars; \
+  std::vector<Real_ptr> pack_buffers = m_pack_buffers; \
+  std::vector<Real_ptr> unpack_buffers = m_unpack_buffers; \
+\
+  Index_type num_neighbors = s_num_neighbors; \
+  Index_type num_vars = m_num_vars; \
+  std::vector<Int_ptr> pack_index_lists = m_pack_index_lists; \
+  std::vector<Index_type> pack_index_list_lengths = m_pack_index_list_lengths; \
+  std::vector<Int_ptr> unpack_index_lists = m_unpack_index_lists; \
+  std::vector<Index_type> unpack_index_list_lengths = m_unpack_index_list_lengths;
+
+#define MPI_HALOEXCHANGE_FUSED_MANUAL_FUSER_SETUP \
+  struct ptr_holder { \
+    Real_ptr buffer; \
+    Int_ptr  list; \
+    Real_ptr var; \
+  }; \
+  ptr_holder* pack_ptr_holders = new ptr_holder[num_neighbors * num_vars]; \
+  Index_type* pack_lens        = new Index_type[num_neighbors * num_vars]; \
+  ptr_holder* unpack_ptr_holders = new ptr_holder[num_neighbors * num_vars]; \
+  Index_type* unpack_lens        = new Index_type[num_neighbors * num_vars];
+
+#define MPI_HALOEXCHANGE_FUSED_MANUAL_FUSER_TEARDOWN \
+  delete[] pack_ptr_holders; \
+  delete[] pack_lens; \
+  delete[] unpack_ptr_holders; \
+  delete[] unpack_lens;
+
+#define MPI_HALOEXCHANGE_FUSED_PACK_BODY \
+  buffer[i] = var[list[i]];
+
+#define MPI_HALOEXCHANGE_FUSED_UNPACK_BODY \
+  var[list[i]] = buffer[i];
+
+
+#define MPI_HALOEXCHANGE_FUSED_MANUAL_LAMBDA_FUSER_SETUP \
+  auto make_pack_lambda = [](Real_ptr buffer, Int_ptr list, Real_ptr var) { \
+    return [=](Index_type i) { \
+      MPI_HALOEXCHANGE_FUSED_PACK_BODY; \
+    }; \
+  }; \
+  using pack_lambda_type = decltype(make_pack_lambda(Real_ptr(), Int_ptr(), Real_ptr())); \
+  pack_lambda_type* pack_lambdas = reinterpret_cast<pack_lambda_type*>( \
+      malloc(sizeof(pack_lambda_type) * (num_neighbors * num_vars))); \
+  Index_type* pack_lens = new Index_type[num_neighbors * num_vars]; \
+  auto make_unpack_lambda = [](Real_ptr buffer, Int_ptr list, Real_ptr var) { \
+    return [=](Index_type i) { \
+      MPI_HALOEXCHANGE_FUSED_UNPACK_BODY; \
+    }; \
+  }; \
+  using unpack_lambda_type = decltype(make_unpack_lambda(Real_ptr(), Int_ptr(), Real_ptr())); \
+  unpack_lambda_type* unpack_lambdas = reinterpret_cast<unpack_lambda_type*>( \
+      malloc(sizeof(unpack_lambda_type) * (num_neighbors * num_vars))); \
+  Index_type* unpack_lens = new Index_type[num_neighbors * num_vars];
+
+#define MPI_HALOEXCHANGE_FUSED_MANUAL_LAMBDA_FUSER_TEARDOWN \
+  free(pack_lambdas); \
+  delete[] pack_lens; \
+  free(unpack_lambdas); \
+  delete[] unpack_lens;
+
+
+#include "apps/MPI_HALOEXCHANGE_base.hpp"
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+
+#include "RAJA/RAJA.hpp"
+
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+class MPI_HALOEXCHANGE_FUSED : public MPI_HALOEXCHANGE_base
+{
+public:
+
+  MPI_HALOEXCHANGE_FUSED(const RunParams& params);
+
+  ~MPI_HALOEXCHANGE_FUSED();
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  MPI_HALOEXCHANGE_FUSED : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  MPI_HALOEXCHANGE_FUSED : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  MPI_HALOEXCHANGE_FUSED : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif  // RAJA_PERFSUITE_ENABLE_MPI
+
+#endif // closing endif for header file include guard
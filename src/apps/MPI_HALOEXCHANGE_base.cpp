@@ -0,0 +1,675 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MPI_HALOEXCHANGE_base.hpp"
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <cmath>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+namespace {
+
+void create_pack_lists(std::vector<Int_ptr>& pack_index_lists,
+                       std::vector<Index_type >& pack_index_list_lengths,
+                       const Index_type halo_width, const Index_type* grid_dims,
+                       const Index_type num_neighbors,
+                       VariantID vid);
+void create_unpack_lists(std::vector<Int_ptr>& unpack_index_lists,
+                         std::vector<Index_type >& unpack_index_list_lengths,
+                         const Index_type halo_width, const Index_type* grid_dims,
+                         const Index_type num_neighbors,
+                         VariantID vid);
+void destroy_pack_lists(std::vector<Int_ptr>& pack_index_lists,
+                        const Index_type num_neighbors,
+                        VariantID vid);
+void destroy_unpack_lists(std::vector<Int_ptr>& unpack_index_lists,
+                          const Index_type num_neighbors,
+                          VariantID vid);
+
+//
+// Offset of the neighbor in each direction in the Cartesian topology, in
+// the order used for the pack and unpack index lists (faces, edges, then
+// corners).
+//
+const int neighbor_offsets[26][3] = {
+  // faces
+  {-1,  0,  0}, { 1,  0,  0}, { 0, -1,  0}, { 0,  1,  0},
+  { 0,  0, -1}, { 0,  0,  1},
+  // edges
+  {-1, -1,  0}, {-1,  1,  0}, { 1, -1,  0}, { 1,  1,  0},
+  {-1,  0, -1}, {-1,  0,  1}, { 1,  0, -1}, { 1,  0,  1},
+  { 0, -1, -1}, { 0, -1,  1}, { 0,  1, -1}, { 0,  1,  1},
+  // corners
+  {-1, -1, -1}, {-1, -1,  1}, {-1,  1, -1}, {-1,  1,  1},
+  { 1, -1, -1}, { 1, -1,  1}, { 1,  1, -1}, { 1,  1,  1}
+};
+
+}
+
+
+MPI_HALOEXCHANGE_base::MPI_HALOEXCHANGE_base(KernelID kid,
+                                             const RunParams& params)
+  : KernelBase(kid, params)
+{
+  m_grid_dims_default[0] = 100;
+  m_grid_dims_default[1] = 100;
+  m_grid_dims_default[2] = 100;
+  m_halo_width_default   = 1;
+  m_num_vars_default     = 3;
+
+  setDefaultProblemSize( m_grid_dims_default[0] *
+                         m_grid_dims_default[1] *
+                         m_grid_dims_default[2] );
+  setDefaultReps(50);
+
+  double cbrt_run_size = std::cbrt(getTargetProblemSize());
+
+  m_grid_dims[0] = cbrt_run_size;
+  m_grid_dims[1] = cbrt_run_size;
+  m_grid_dims[2] = cbrt_run_size;
+  m_halo_width = m_halo_width_default;
+  m_num_vars   = m_num_vars_default;
+
+  m_grid_plus_halo_dims[0] = m_grid_dims[0] + 2*m_halo_width;
+  m_grid_plus_halo_dims[1] = m_grid_dims[1] + 2*m_halo_width;
+  m_grid_plus_halo_dims[2] = m_grid_dims[2] + 2*m_halo_width;
+  m_var_size = m_grid_plus_halo_dims[0] *
+               m_grid_plus_halo_dims[1] *
+               m_grid_plus_halo_dims[2] ;
+
+  setActualProblemSize( m_grid_dims[0] * m_grid_dims[1] * m_grid_dims[2] );
+
+  setItsPerRep( m_num_vars * (m_var_size - getActualProblemSize()) );
+  setBytesPerRep( (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * getItsPerRep() +
+                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() +
+                  (0*sizeof(Int_type)  + 1*sizeof(Int_type) ) * getItsPerRep() +
+                  (1*sizeof(Real_type) + 1*sizeof(Real_type)) * getItsPerRep() );
+  setFLOPsPerRep(0);
+
+  m_comm_mode = Blocking;
+  m_cart_comm = MPI_COMM_NULL;
+  for (int d = 0; d < 3; ++d) {
+    m_mpi_dims[d] = 0;
+  }
+  m_my_cart_rank = 0;
+}
+
+MPI_HALOEXCHANGE_base::~MPI_HALOEXCHANGE_base()
+{
+}
+
+void MPI_HALOEXCHANGE_base::setUp(VariantID vid)
+{
+  m_comm_mode = static_cast<CommMode>(getRunningTuning());
+
+  //
+  // Arrange the ranks in a periodic 3D Cartesian topology and find the
+  // rank of the neighbor in each direction.
+  //
+  int num_ranks;
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+  for (int d = 0; d < 3; ++d) {
+    m_mpi_dims[d] = 0;
+  }
+  MPI_Dims_create(num_ranks, 3, m_mpi_dims);
+
+  int periods[3] = {1, 1, 1};
+  MPI_Cart_create(MPI_COMM_WORLD, 3, m_mpi_dims, periods, 0, &m_cart_comm);
+  MPI_Comm_rank(m_cart_comm, &m_my_cart_rank);
+
+  int my_coords[3];
+  MPI_Cart_coords(m_cart_comm, m_my_cart_rank, 3, my_coords);
+
+  m_mpi_ranks.resize(s_num_neighbors, MPI_PROC_NULL);
+  m_send_tags.resize(s_num_neighbors, 0);
+  m_recv_tags.resize(s_num_neighbors, 0);
+  m_opposite.resize(s_num_neighbors, 0);
+  for (Index_type l = 0; l < s_num_neighbors; ++l) {
+    int coords[3];
+    for (int d = 0; d < 3; ++d) {
+      coords[d] = my_coords[d] + neighbor_offsets[l][d];
+    }
+    MPI_Cart_rank(m_cart_comm, coords, &m_mpi_ranks[l]);
+
+    for (Index_type o = 0; o < s_num_neighbors; ++o) {
+      if ( neighbor_offsets[o][0] == -neighbor_offsets[l][0] &&
+           neighbor_offsets[o][1] == -neighbor_offsets[l][1] &&
+           neighbor_offsets[o][2] == -neighbor_offsets[l][2] ) {
+        m_opposite[l] = o;
+      }
+    }
+  }
+
+  //
+  // The message packed for neighbor l is unpacked by that neighbor into the
+  // halo facing the opposite direction; tag messages by the unpack list on
+  // the receiving side so neighbors that appear in several directions (e.g.,
+  // with only one or two ranks along a dimension) get matched correctly.
+  //
+  for (Index_type l = 0; l < s_num_neighbors; ++l) {
+    m_send_tags[l] = m_opposite[l];
+    m_recv_tags[l] = l;
+  }
+
+  //
+  // Give every rank different data so the halo values show which rank
+  // they were received from.
+  //
+  m_vars.resize(m_num_vars, nullptr);
+  for (Index_type v = 0; v < m_num_vars; ++v) {
+    allocAndInitData(m_vars[v], m_var_size, vid);
+
+    Real_ptr var = m_vars[v];
+
+    for (Index_type i = 0; i < m_var_size; i++) {
+      var[i] = i + v + m_my_cart_rank * m_var_size;
+    }
+  }
+
+  m_pack_index_lists.resize(s_num_neighbors, nullptr);
+  m_pack_index_list_lengths.resize(s_num_neighbors, 0);
+  create_pack_lists(m_pack_index_lists, m_pack_index_list_lengths, m_halo_width, m_grid_dims, s_num_neighbors, vid);
+
+  m_unpack_index_lists.resize(s_num_neighbors, nullptr);
+  m_unpack_index_list_lengths.resize(s_num_neighbors, 0);
+  create_unpack_lists(m_unpack_index_lists, m_unpack_index_list_lengths, m_halo_width, m_grid_dims, s_num_neighbors, vid);
+
+  m_pack_buffers.resize(s_num_neighbors, nullptr);
+  m_unpack_buffers.resize(s_num_neighbors, nullptr);
+  for (Index_type l = 0; l < s_num_neighbors; ++l) {
+    Index_type pack_buffer_len = m_num_vars * m_pack_index_list_lengths[l];
+    allocAndInitData(m_pack_buffers[l], pack_buffer_len, vid);
+    Index_type unpack_buffer_len = m_num_vars * m_unpack_index_list_lengths[l];
+    allocAndInitData(m_unpack_buffers[l], unpack_buffer_len, vid);
+  }
+
+  m_pack_mpi_requests.resize(s_num_neighbors, MPI_REQUEST_NULL);
+  m_unpack_mpi_requests.resize(s_num_neighbors, MPI_REQUEST_NULL);
+  if ( m_comm_mode == Persistent ) {
+    for (Index_type l = 0; l < s_num_neighbors; ++l) {
+      MPI_Send_init(m_pack_buffers[l],
+                    m_num_vars * m_pack_index_list_lengths[l], Real_MPI_type,
+                    m_mpi_ranks[l], m_send_tags[l], m_cart_comm,
+                    &m_pack_mpi_requests[l]);
+      MPI_Recv_init(m_unpack_buffers[l],
+                    m_num_vars * m_unpack_index_list_lengths[l], Real_MPI_type,
+                    m_mpi_ranks[l], m_recv_tags[l], m_cart_comm,
+                    &m_unpack_mpi_requests[l]);
+    }
+  }
+}
+
+void MPI_HALOEXCHANGE_base::updateChecksum(VariantID vid)
+{
+  for (Real_ptr var : m_vars) {
+    checksum[vid] += calcChecksum(var, m_var_size);
+  }
+}
+
+void MPI_HALOEXCHANGE_base::tearDown(VariantID vid)
+{
+  if ( m_comm_mode == Persistent ) {
+    for (Index_type l = 0; l < s_num_neighbors; ++l) {
+      MPI_Request_free(&m_pack_mpi_requests[l]);
+      MPI_Request_free(&m_unpack_mpi_requests[l]);
+    }
+  }
+  m_pack_mpi_requests.clear();
+  m_unpack_mpi_requests.clear();
+
+  for (int l = 0; l < s_num_neighbors; ++l) {
+    deallocData(m_pack_buffers[l]);
+    deallocData(m_unpack_buffers[l]);
+  }
+  m_pack_buffers.clear();
+  m_unpack_buffers.clear();
+
+  destroy_unpack_lists(m_unpack_index_lists, s_num_neighbors, vid);
+  m_unpack_index_list_lengths.clear();
+  m_unpack_index_lists.clear();
+
+  destroy_pack_lists(m_pack_index_lists, s_num_neighbors, vid);
+  m_pack_index_list_lengths.clear();
+  m_pack_index_lists.clear();
+
+  for (int v = 0; v < m_num_vars; ++v) {
+    deallocData(m_vars[v]);
+  }
+  m_vars.clear();
+
+  m_opposite.clear();
+  m_recv_tags.clear();
+  m_send_tags.clear();
+  m_mpi_ranks.clear();
+
+  MPI_Comm_free(&m_cart_comm);
+}
+
+//
+// Start receiving messages from all neighbors.
+//
+void MPI_HALOEXCHANGE_base::postRecvs()
+{
+  switch ( m_comm_mode ) {
+
+    case Nonblocking : {
+      for (Index_type l = 0; l < s_num_neighbors; ++l) {
+        MPI_Irecv(m_unpack_buffers[l],
+                  m_num_vars * m_unpack_index_list_lengths[l], Real_MPI_type,
+                  m_mpi_ranks[l], m_recv_tags[l], m_cart_comm,
+                  &m_unpack_mpi_requests[l]);
+      }
+      break;
+    }
+
+    case Persistent : {
+      MPI_Startall(s_num_neighbors, m_unpack_mpi_requests.data());
+      break;
+    }
+
+    default : {
+      break;
+    }
+
+  }
+}
+
+//
+// Send the packed message for neighbor l. In blocking mode, this also
+// receives the message for the opposite direction, which the neighbor on
+// that side sends in the same step.
+//
+void MPI_HALOEXCHANGE_base::sendPacked(Index_type l)
+{
+  switch ( m_comm_mode ) {
+
+    case Blocking : {
+      Index_type o = m_opposite[l];
+      MPI_Sendrecv(m_pack_buffers[l],
+                   m_num_vars * m_pack_index_list_lengths[l], Real_MPI_type,
+                   m_mpi_ranks[l], m_send_tags[l],
+                   m_unpack_buffers[o],
+                   m_num_vars * m_unpack_index_list_lengths[o], Real_MPI_type,
+                   m_mpi_ranks[o], m_recv_tags[o],
+                   m_cart_comm, MPI_STATUS_IGNORE);
+      break;
+    }
+
+    case Nonblocking : {
+      MPI_Isend(m_pack_buffers[l],
+                m_num_vars * m_pack_index_list_lengths[l], Real_MPI_type,
+                m_mpi_ranks[l], m_send_tags[l], m_cart_comm,
+                &m_pack_mpi_requests[l]);
+      break;
+    }
+
+    case Persistent : {
+      MPI_Start(&m_pack_mpi_requests[l]);
+      break;
+    }
+
+    default : {
+      break;
+    }
+
+  }
+}
+
+//
+// Wait for the ll-th message to arrive and return the index of the
+// neighbor it came from. Messages are returned in arrival order, except in
+// blocking mode where all messages have been received already.
+//
+Index_type MPI_HALOEXCHANGE_base::waitRecv(Index_type ll)
+{
+  if ( m_comm_mode == Blocking ) {
+    return ll;
+  }
+
+  int l = MPI_UNDEFINED;
+  MPI_Waitany(s_num_neighbors, m_unpack_mpi_requests.data(),
+              &l, MPI_STATUS_IGNORE);
+  return l;
+}
+
+//
+// Wait for the messages from all neighbors to arrive.
+//
+void MPI_HALOEXCHANGE_base::waitRecvs()
+{
+  if ( m_comm_mode != Blocking ) {
+    MPI_Waitall(s_num_neighbors, m_unpack_mpi_requests.data(),
+                MPI_STATUSES_IGNORE);
+  }
+}
+
+//
+// Wait for the messages sent to all neighbors to complete, so the pack
+// buffers may be reused.
+//
+void MPI_HALOEXCHANGE_base::waitSends()
+{
+  if ( m_comm_mode != Blocking ) {
+    MPI_Waitall(s_num_neighbors, m_pack_mpi_requests.data(),
+                MPI_STATUSES_IGNORE);
+  }
+}
+
+namespace {
+
+struct Extent
+{
+  Index_type i_min;
+  Index_type i_max;
+  Index_type j_min;
+  Index_type j_max;
+  Index_type k_min;
+  Index_type k_max;
+};
+
+//
+// Function to generate index lists for packing.
+//
+void create_pack_lists(std::vector<Int_ptr>& pack_index_lists,
+                       std::vector<Index_type >& pack_index_list_lengths,
+                       const Index_type halo_width, const Index_type* grid_dims,
+                       const Index_type num_neighbors,
+                       VariantID vid)
+{
+  std::vector<Extent> pack_index_list_extents(num_neighbors);
+
+  // faces
+  pack_index_list_extents[0]  = Extent{halo_width  , halo_width   + halo_width,
+                                       halo_width  , grid_dims[1] + halo_width,
+                                       halo_width  , grid_dims[2] + halo_width};
+  pack_index_list_extents[1]  = Extent{grid_dims[0], grid_dims[0] + halo_width,
+                                       halo_width  , grid_dims[1] + halo_width,
+                                       halo_width  , grid_dims[2] + halo_width};
+  pack_index_list_extents[2]  = Extent{halo_width  , grid_dims[0] + halo_width,
+                                       halo_width  , halo_width   + halo_width,
+                                       halo_width  , grid_dims[2] + halo_width};
+  pack_index_list_extents[3]  = Extent{halo_width  , grid_dims[0] + halo_width,
+                                       grid_dims[1], grid_dims[1] + halo_width,
+                                       halo_width  , grid_dims[2] + halo_width};
+  pack_index_list_extents[4]  = Extent{halo_width  , grid_dims[0] + halo_width,
+                                       halo_width  , grid_dims[1] + halo_width,
+                                       halo_width  , halo_width   + halo_width};
+  pack_index_list_extents[5]  = Extent{halo_width  , grid_dims[0] + halo_width,
+                                       halo_width  , grid_dims[1] + halo_width,
+                                       grid_dims[2], grid_dims[2] + halo_width};
+
+  // edges
+  pack_index_list_extents[6]  = Extent{halo_width  , halo_width   + halo_width,
+                                       halo_width  , halo_width   + halo_width,
+                                       halo_width  , grid_dims[2] + halo_width};
+  pack_index_list_extents[7]  = Extent{halo_width  , halo_width   + halo_width,
+                                       grid_dims[1], grid_dims[1] + halo_width,
+                                       halo_width  , grid_dims[2] + halo_width};
+  pack_index_list_extents[8]  = Extent{grid_dims[0], grid_dims[0] + halo_width,
+                                       halo_width  , halo_width   + halo_width,
+                                       halo_width  , grid_dims[2] + halo_width};
+  pack_index_list_extents[9]  = Extent{grid_dims[0], grid_dims[0] + halo_width,
+                                       grid_dims[1], grid_dims[1] + halo_width,
+                                       halo_width  , grid_dims[2] + halo_width};
+  pack_index_list_extents[10] = Extent{halo_width  , halo_width   + halo_width,
+                                       halo_width  , grid_dims[1] + halo_width,
+                                       halo_width  , halo_width   + halo_width};
+  pack_index_list_extents[11] = Extent{halo_width  , halo_width   + halo_width,
+                                       halo_width  , grid_dims[1] + halo_width,
+                                       grid_dims[2], grid_dims[2] + halo_width};
+  pack_index_list_extents[12] = Extent{grid_dims[0], grid_dims[0] + halo_width,
+                                       halo_width  , grid_dims[1] + halo_width,
+                                       halo_width  , halo_width   + halo_width};
+  pack_index_list_extents[13] = Extent{grid_dims[0], grid_dims[0] + halo_width,
+                                       halo_width  , grid_dims[1] + halo_width,
+                                       grid_dims[2], grid_dims[2] + halo_width};
+  pack_index_list_extents[14] = Extent{halo_width  , grid_dims[0] + halo_width,
+                                       halo_width  , halo_width   + halo_width,
+                                       halo_width  , halo_width   + halo_width};
+  pack_index_list_extents[15] = Extent{halo_width  , grid_dims[0] + halo_width,
+                                       halo_width  , halo_width   + halo_width,
+                                       grid_dims[2], grid_dims[2] + halo_width};
+  pack_index_list_extents[16] = Extent{halo_width  , grid_dims[0] + halo_width,
+                                       grid_dims[1], grid_dims[1] + halo_width,
+                                       halo_width  , halo_width   + halo_width};
+  pack_index_list_extents[17] = Extent{halo_width  , grid_dims[0] + halo_width,
+                                       grid_dims[1], grid_dims[1] + halo_width,
+                                       grid_dims[2], grid_dims[2] + halo_width};
+
+  // corners
+  pack_index_list_extents[18] = Extent{halo_width  , halo_width   + halo_width,
+                                       halo_width  , halo_width   + halo_width,
+                                       halo_width  , halo_width   + halo_width};
+  pack_index_list_extents[19] = Extent{halo_width  , halo_width   + halo_width,
+                                       halo_width  , halo_width   + halo_width,
+                                       grid_dims[2], grid_dims[2] + halo_width};
+  pack_index_list_extents[20] = Extent{halo_width  , halo_width   + halo_width,
+                                       grid_dims[1], grid_dims[1] + halo_width,
+                                       halo_width  , halo_width   + halo_width};
+  pack_index_list_extents[21] = Extent{halo_width  , halo_width   + halo_width,
+                                       grid_dims[1], grid_dims[1] + halo_width,
+                                       grid_dims[2], grid_dims[2] + halo_width};
+  pack_index_list_extents[22] = Extent{grid_dims[0], grid_dims[0] + halo_width,
+                                       halo_width  , halo_width   + halo_width,
+                                       halo_width  , halo_width   + halo_width};
+  pack_index_list_extents[23] = Extent{grid_dims[0], grid_dims[0] + halo_width,
+                                       halo_width  , halo_width   + halo_width,
+                                       grid_dims[2], grid_dims[2] + halo_width};
+  pack_index_list_extents[24] = Extent{grid_dims[0], grid_dims[0] + halo_width,
+                                       grid_dims[1], grid_dims[1] + halo_width,
+                                       halo_width  , halo_width   + halo_width};
+  pack_index_list_extents[25] = Extent{grid_dims[0], grid_dims[0] + halo_width,
+                                       grid_dims[1], grid_dims[1] + halo_width,
+                                       grid_dims[2], grid_dims[2] + halo_width};
+
+  const Index_type grid_i_stride = 1;
+  const Index_type grid_j_stride = grid_dims[0] + 2*halo_width;
+  const Index_type grid_k_stride = grid_j_stride * (grid_dims[1] + 2*halo_width);
+
+  for (Index_type l = 0; l < num_neighbors; ++l) {
+
+    Extent extent = pack_index_list_extents[l];
+
+    pack_index_list_lengths[l] = (extent.i_max - extent.i_min) *
+                                 (extent.j_max - extent.j_min) *
+                                 (extent.k_max - extent.k_min) ;
+
+    allocAndInitData(pack_index_lists[l], pack_index_list_lengths[l], vid);
+
+    Int_ptr pack_list = pack_index_lists[l];
+
+    Index_type list_idx = 0;
+    for (Index_type kk = extent.k_min; kk < extent.k_max; ++kk) {
+      for (Index_type jj = extent.j_min; jj < extent.j_max; ++jj) {
+        for (Index_type ii = extent.i_min; ii < extent.i_max; ++ii) {
+
+          Index_type pack_idx = ii * grid_i_stride +
+                         jj * grid_j_stride +
+                         kk * grid_k_stride ;
+
+          pack_list[list_idx] = pack_idx;
+
+          list_idx += 1;
+        }
+      }
+    }
+  }
+}
+
+//
+// Function to destroy packing index lists.
+//
+void destroy_pack_lists(std::vector<Int_ptr>& pack_index_lists,
+                       const Index_type num_neighbors,
+                       VariantID vid)
+{
+  (void) vid;
+
+  for (Index_type l = 0; l < num_neighbors; ++l) {
+    deallocData(pack_index_lists[l]);
+  }
+}
+
+//
+// Function to generate index lists for unpacking.
+//
+void create_unpack_lists(std::vector<Int_ptr>& unpack_index_lists,
+                         std::vector<Index_type >& unpack_index_list_lengths,
+                         const Index_type halo_width, const Index_type* grid_dims,
+                         const Index_type num_neighbors,
+                         VariantID vid)
+{
+  std::vector<Extent> unpack_index_list_extents(num_neighbors);
+
+  // faces
+  unpack_index_list_extents[0]  = Extent{0                        ,                  halo_width,
+                                         halo_width               , grid_dims[1] +   halo_width,
+                                         halo_width               , grid_dims[2] +   halo_width};
+  unpack_index_list_extents[1]  = Extent{grid_dims[0] + halo_width, grid_dims[0] + 2*halo_width,
+                                         halo_width               , grid_dims[1] +   halo_width,
+                                         halo_width               , grid_dims[2] +   halo_width};
+  unpack_index_list_extents[2]  = Extent{halo_width               , grid_dims[0] +   halo_width,
+                                         0                        ,                  halo_width,
+                                         halo_width               , grid_dims[2] +   halo_width};
+  unpack_index_list_extents[3]  = Extent{halo_width               , grid_dims[0] +   halo_width,
+                                         grid_dims[1] + halo_width, grid_dims[1] + 2*halo_width,
+                                         halo_width               , grid_dims[2] +   halo_width};
+  unpack_index_list_extents[4]  = Extent{halo_width               , grid_dims[0] +   halo_width,
+                                         halo_width               , grid_dims[1] +   halo_width,
+                                         0                        ,                  halo_width};
+  unpack_index_list_extents[5]  = Extent{halo_width               , grid_dims[0] +   halo_width,
+                                         halo_width               , grid_dims[1] +   halo_width,
+                                         grid_dims[2] + halo_width, grid_dims[2] + 2*halo_width};
+
+  // edges
+  unpack_index_list_extents[6]  = Extent{0                        ,                  halo_width,
+                                         0                        ,                  halo_width,
+                                         halo_width               , grid_dims[2] +   halo_width};
+  unpack_index_list_extents[7]  = Extent{0                        ,                  halo_width,
+                                         grid_dims[1] + halo_width, grid_dims[1] + 2*halo_width,
+                                         halo_width               , grid_dims[2] +   halo_width};
+  unpack_index_list_extents[8]  = Extent{grid_dims[0] + halo_width, grid_dims[0] + 2*halo_width,
+                                         0                        ,                  halo_width,
+                                         halo_width               , grid_dims[2] +   halo_width};
+  unpack_index_list_extents[9]  = Extent{grid_dims[0] + halo_width, grid_dims[0] + 2*halo_width,
+                                         grid_dims[1] + halo_width, grid_dims[1] + 2*halo_width,
+                                         halo_width               , grid_dims[2] +   halo_width};
+  unpack_index_list_extents[10] = Extent{0                        ,                  halo_width,
+                                         halo_width               , grid_dims[1] +   halo_width,
+                                         0                        ,                  halo_width};
+  unpack_index_list_extents[11] = Extent{0                        ,                  halo_width,
+                                         halo_width               , grid_dims[1] +   halo_width,
+                                         grid_dims[2] + halo_width, grid_dims[2] + 2*halo_width};
+  unpack_index_list_extents[12] = Extent{grid_dims[0] + halo_width, grid_dims[0] + 2*halo_width,
+                                         halo_width               , grid_dims[1] +   halo_width,
+                                         0                        ,                  halo_width};
+  unpack_index_list_extents[13] = Extent{grid_dims[0] + halo_width, grid_dims[0] + 2*halo_width,
+                                         halo_width               , grid_dims[1] +   halo_width,
+                                         grid_dims[2] + halo_width, grid_dims[2] + 2*halo_width};
+  unpack_index_list_extents[14] = Extent{halo_width               , grid_dims[0] +   halo_width,
+                                         0                        ,                  halo_width,
+                                         0                        ,                  halo_width};
+  unpack_index_list_extents[15] = Extent{halo_width               , grid_dims[0] +   halo_width,
+                                         0                        ,                  halo_width,
+                                         grid_dims[2] + halo_width, grid_dims[2] + 2*halo_width};
+  unpack_index_list_extents[16] = Extent{halo_width               , grid_dims[0] +   halo_width,
+                                         grid_dims[1] + halo_width, grid_dims[1] + 2*halo_width,
+                                         0                        ,                  halo_width};
+  unpack_index_list_extents[17] = Extent{halo_width               , grid_dims[0] +   halo_width,
+                                         grid_dims[1] + halo_width, grid_dims[1] + 2*halo_width,
+                                         grid_dims[2] + halo_width, grid_dims[2] + 2*halo_width};
+
+  // corners
+  unpack_index_list_extents[18] = Extent{0                        ,                  halo_width,
+                                         0                        ,                  halo_width,
+                                         0                        ,                  halo_width};
+  unpack_index_list_extents[19] = Extent{0                        ,                  halo_width,
+                                         0                        ,                  halo_width,
+                                         grid_dims[2] + halo_width, grid_dims[2] + 2*halo_width};
+  unpack_index_list_extents[20] = Extent{0                        ,                  halo_width,
+                                         grid_dims[1] + halo_width, grid_dims[1] + 2*halo_width,
+                                         0                        ,                  halo_width};
+  unpack_index_list_extents[21] = Extent{0                        ,                  halo_width,
+                                         grid_dims[1] + halo_width, grid_dims[1] + 2*halo_width,
+                                         grid_dims[2] + halo_width, grid_dims[2] + 2*halo_width};
+  unpack_index_list_extents[22] = Extent{grid_dims[0] + halo_width, grid_dims[0] + 2*halo_width,
+                                         0                        ,                  halo_width,
+                                         0                        ,                  halo_width};
+  unpack_index_list_extents[23] = Extent{grid_dims[0] + halo_width, grid_dims[0] + 2*halo_width,
+                                         0                        ,                  halo_width,
+                                         grid_dims[2] + halo_width, grid_dims[2] + 2*halo_width};
+  unpack_index_list_extents[24] = Extent{grid_dims[0] + halo_width, grid_dims[0] + 2*halo_width,
+                                         grid_dims[1] + halo_width, grid_dims[1] + 2*halo_width,
+                                         0                        ,                  halo_width};
+  unpack_index_list_extents[25] = Extent{grid_dims[0] + halo_width, grid_dims[0] + 2*halo_width,
+                                         grid_dims[1] + halo_width, grid_dims[1] + 2*halo_width,
+                                         grid_dims[2] + halo_width, grid_dims[2] + 2*halo_width};
+
+  const Index_type grid_i_stride = 1;
+  const Index_type grid_j_stride = grid_dims[0] + 2*halo_width;
+  const Index_type grid_k_stride = grid_j_stride * (grid_dims[1] + 2*halo_width);
+
+  for (Index_type l = 0; l < num_neighbors; ++l) {
+
+    Extent extent = unpack_index_list_extents[l];
+
+    unpack_index_list_lengths[l] = (extent.i_max - extent.i_min) *
+                                   (extent.j_max - extent.j_min) *
+                                   (extent.k_max - extent.k_min) ;
+
+    allocAndInitData(unpack_index_lists[l], unpack_index_list_lengths[l], vid);
+
+    Int_ptr unpack_list = unpack_index_lists[l];
+
+    Index_type list_idx = 0;
+    for (Index_type kk = extent.k_min; kk < extent.k_max; ++kk) {
+      for (Index_type jj = extent.j_min; jj < extent.j_max; ++jj) {
+        for (Index_type ii = extent.i_min; ii < extent.i_max; ++ii) {
+
+          Index_type unpack_idx = ii * grid_i_stride +
+                           jj * grid_j_stride +
+                           kk * grid_k_stride ;
+
+          unpack_list[list_idx] = unpack_idx;
+
+          list_idx += 1;
+        }
+      }
+    }
+  }
+}
+
+//
+// Function to destroy unpacking index lists.
+//
+void destroy_unpack_lists(std::vector<Int_ptr>& unpack_index_lists,
+                          const Index_type num_neighbors,
+                          VariantID vid)
+{
+  (void) vid;
+
+  for (Index_type l = 0; l < num_neighbors; ++l) {
+    deallocData(unpack_index_lists[l]);
+  }
+}
+
+} // end namespace
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif  // RAJA_PERFSUITE_ENABLE_MPI
@@ -0,0 +1,126 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Base class for the MPI halo exchange kernels.
+///
+/// Each rank owns a grid of the same size with a halo around it. The ranks
+/// are arranged in a periodic 3D Cartesian topology (MPI_Cart_create), and
+/// every rank exchanges its faces, edges, and corners with its 26
+/// neighbors. Data for neighbor l is packed from pack_index_lists[l],
+/// sent to that neighbor, and the message received from the same neighbor
+/// is unpacked into the halo using unpack_index_lists[l].
+///
+/// The way messages are sent is selected by the kernel tuning:
+///
+///   blocking    - MPI_Sendrecv with each neighbor right after packing
+///                 its message.
+///   nonblocking - MPI_Irecv for all neighbors is posted before packing,
+///                 each message is sent with MPI_Isend as soon as it is
+///                 packed, and messages are unpacked in the order they
+///                 arrive (MPI_Waitany), overlapping packing, unpacking,
+///                 and communication.
+///   persistent  - same as nonblocking, but using persistent requests
+///                 (MPI_Send_init/MPI_Recv_init) created in setUp.
+///
+
+#ifndef RAJAPerf_Apps_MPI_HALOEXCHANGE_base_HPP
+#define RAJAPerf_Apps_MPI_HALOEXCHANGE_base_HPP
+
+#include "common/KernelBase.hpp"
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+
+#include <mpi.h>
+
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+class MPI_HALOEXCHANGE_base : public KernelBase
+{
+public:
+
+  MPI_HALOEXCHANGE_base(KernelID kid, const RunParams& params);
+
+  ~MPI_HALOEXCHANGE_base();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+protected:
+  //
+  // Tuning indices; order must match the tuning names set in the
+  // constructor.
+  //
+  enum CommMode {
+    Blocking = 0,
+    Nonblocking,
+    Persistent,
+    NumCommModes
+  };
+
+  //
+  // Communication steps used by the variants of derived kernels in each
+  // rep. The behavior of each depends on the communication mode.
+  //
+  void postRecvs();
+  void sendPacked(Index_type l);
+  Index_type waitRecv(Index_type ll);
+  void waitRecvs();
+  void waitSends();
+
+  static const int s_num_neighbors = 26;
+
+  Index_type m_grid_dims[3];
+  Index_type m_halo_width;
+  Index_type m_num_vars;
+
+  Index_type m_grid_dims_default[3];
+  Index_type m_halo_width_default;
+  Index_type m_num_vars_default;
+
+  Index_type m_grid_plus_halo_dims[3];
+  Index_type m_var_size;
+
+  std::vector<Real_ptr> m_vars;
+  std::vector<Real_ptr> m_pack_buffers;
+  std::vector<Real_ptr> m_unpack_buffers;
+
+  std::vector<Int_ptr> m_pack_index_lists;
+  std::vector<Index_type > m_pack_index_list_lengths;
+  std::vector<Int_ptr> m_unpack_index_lists;
+  std::vector<Index_type > m_unpack_index_list_lengths;
+
+  CommMode m_comm_mode;
+
+  MPI_Comm m_cart_comm;
+  int m_mpi_dims[3];
+  int m_my_cart_rank;
+
+  std::vector<int> m_mpi_ranks;
+  std::vector<int> m_send_tags;
+  std::vector<int> m_recv_tags;
+  std::vector<Index_type> m_opposite;
+
+  std::vector<MPI_Request> m_pack_mpi_requests;
+  std::vector<MPI_Request> m_unpack_mpi_requests;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif  // RAJA_PERFSUITE_ENABLE_MPI
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,120 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+#include "PICData.hpp"
+
+#include "AppsData.hpp"
+#include "common/DataUtils.hpp"
+
+#include <cmath>
+#include <random>
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+#include <omp.h>
+#endif
+
+namespace rajaperf
+{
+namespace apps
+{
+
+Index_type getPICCellsPerSide(Index_type target_num_particles)
+{
+  Index_type ncell = std::cbrt(target_num_particles / PIC_PARTICLES_PER_CELL);
+  ncell -= ncell % (2*PIC_TILE);
+  return ( ncell > 2*PIC_TILE ) ? ncell : 2*PIC_TILE;
+}
+
+void allocAndInitPICParticles(Real_ptr& x, Real_ptr& y, Real_ptr& z,
+                              Real_ptr& vx, Real_ptr& vy, Real_ptr& vz,
+                              const ADomain& domain, VariantID vid)
+{
+  const Index_type ncell = domain.imax - domain.imin;
+  const Index_type ntile = ncell / PIC_TILE;
+  const Index_type np = domain.n_real_zones * PIC_PARTICLES_PER_CELL;
+
+  allocAndInitDataConst(x, np, 0.0, vid);
+  allocAndInitDataConst(y, np, 0.0, vid);
+  allocAndInitDataConst(z, np, 0.0, vid);
+  allocAndInitDataConst(vx, np, 0.0, vid);
+  allocAndInitDataConst(vy, np, 0.0, vid);
+  allocAndInitDataConst(vz, np, 0.0, vid);
+
+  std::mt19937 gen(4793);
+  std::uniform_real_distribution<Real_type> frac(0.0, 1.0);
+
+  Index_type p = 0;
+  for (Index_type tk = 0; tk < ntile; ++tk) {
+    for (Index_type tj = 0; tj < ntile; ++tj) {
+      for (Index_type ti = 0; ti < ntile; ++ti) {
+
+        for (Index_type k = 0; k < PIC_TILE; ++k) {
+          for (Index_type j = 0; j < PIC_TILE; ++j) {
+            for (Index_type i = 0; i < PIC_TILE; ++i) {
+              for (Index_type c = 0; c < PIC_PARTICLES_PER_CELL; ++c) {
+                x[p] = domain.imin + ti*PIC_TILE + i + frac(gen);
+                y[p] = domain.jmin + tj*PIC_TILE + j + frac(gen);
+                z[p] = domain.kmin + tk*PIC_TILE + k + frac(gen);
+                vx[p] = frac(gen) - 0.5;
+                vy[p] = frac(gen) - 0.5;
+                vz[p] = frac(gen) - 0.5;
+                ++p;
+              }
+            }
+          }
+        }
+
+      }
+    }
+  }
+}
+
+void allocAndInitPICFields(Real_ptr& ex, Real_ptr& ey, Real_ptr& ez,
+                           Real_ptr& bx, Real_ptr& by, Real_ptr& bz,
+                           const ADomain& domain, VariantID vid)
+{
+  const Index_type nnodes = domain.nnalls;
+  const Index_type ncell = domain.imax - domain.imin;
+  const Real_type kwave = 8.0 * std::atan(1.0) / ncell;
+
+  allocAndInitDataConst(ex, nnodes, 0.0, vid);
+  allocAndInitDataConst(ey, nnodes, 0.0, vid);
+  allocAndInitDataConst(ez, nnodes, 0.0, vid);
+  allocAndInitDataConst(bx, nnodes, 0.0, vid);
+  allocAndInitDataConst(by, nnodes, 0.0, vid);
+  allocAndInitDataConst(bz, nnodes, 0.0, vid);
+
+  for (Index_type n = 0; n < nnodes; ++n) {
+    const Real_type px = kwave * ( n % domain.jp - domain.imin );
+    const Real_type py = kwave * ( (n / domain.jp) % (domain.kp / domain.jp) -
+                                   domain.jmin );
+    const Real_type pz = kwave * ( n / domain.kp - domain.kmin );
+
+    ex[n] = 0.1 * std::sin(py);
+    ey[n] = 0.1 * std::sin(pz);
+    ez[n] = 0.1 * std::sin(px);
+    bx[n] = 0.1 * std::cos(pz);
+    by[n] = 0.1 * std::cos(px);
+    bz[n] = 1.0 + 0.1 * std::cos(py);
+  }
+}
+
+Index_type getPICNumPrivateGrids(VariantID vid)
+{
+  Index_type ngrids = 1;
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( vid == Base_OpenMP || vid == Lambda_OpenMP || vid == RAJA_OpenMP ) {
+    ngrids = omp_get_max_threads();
+  }
+#else
+  (void) vid;
+#endif
+  return ngrids;
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,108 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+///
+/// Particles, fields and macros shared by the particle-in-cell kernels
+/// (PIC_PUSH, PIC_DEPOSIT).
+///
+/// The grid is the 3d ADomain with ncell = rzmax-1 real cells per side;
+/// fields and current live on nodes. Particle positions are in units of
+/// cells, so the cell of a particle at (x, y, z) has lowest node
+/// floor(x) + floor(y)*jp + floor(z)*kp. There are PIC_PARTICLES_PER_CELL
+/// particles per cell, stored sorted by tile of PIC_TILE^3 cells (tiles
+/// in lexicographic order, cells within a tile likewise), so the particles
+/// of tile t are [t*ppt, (t+1)*ppt) with ppt = PIC_TILE^3 * particles per
+/// cell.
+///
+
+#ifndef RAJAPerf_Apps_PICData_HPP
+#define RAJAPerf_Apps_PICData_HPP
+
+#include "common/RPTypes.hpp"
+#include "common/RAJAPerfSuite.hpp"
+
+#define PIC_PARTICLES_PER_CELL 8
+#define PIC_TILE 4
+
+//
+// Offsets from the lowest node of a cell to its 8 nodes, in the order of
+// NDPTRSET; used by PIC_PARTICLE_WEIGHTS.
+//
+#define PIC_NODE_OFFSETS_SETUP \
+  const Index_type off[8] = { 0, 1, jp, 1+jp, kp, 1+kp, jp+kp, 1+jp+kp };
+
+//
+// Lowest node n0 of the cell of particle p and trilinear weights wt[c] of
+// nodes n0 + off[c] of the cell.
+//
+#define PIC_PARTICLE_WEIGHTS \
+  const Real_type fx = floor(x[p]); \
+  const Real_type fy = floor(y[p]); \
+  const Real_type fz = floor(z[p]); \
+  const Index_type n0 = static_cast<Index_type>(fx) + \
+                        static_cast<Index_type>(fy) * jp + \
+                        static_cast<Index_type>(fz) * kp; \
+  const Real_type dx1 = x[p] - fx; \
+  const Real_type dy1 = y[p] - fy; \
+  const Real_type dz1 = z[p] - fz; \
+  const Real_type dx0 = 1.0 - dx1; \
+  const Real_type dy0 = 1.0 - dy1; \
+  const Real_type dz0 = 1.0 - dz1; \
+  Real_type wt[8]; \
+  wt[0] = dx0*dy0*dz0; \
+  wt[1] = dx1*dy0*dz0; \
+  wt[2] = dx0*dy1*dz0; \
+  wt[3] = dx1*dy1*dz0; \
+  wt[4] = dx0*dy0*dz1; \
+  wt[5] = dx1*dy0*dz1; \
+  wt[6] = dx0*dy1*dz1; \
+  wt[7] = dx1*dy1*dz1;
+
+namespace rajaperf
+{
+namespace apps
+{
+class ADomain;
+
+/*!
+ * \brief Number of real cells per side of the grid for the given target
+ *        number of particles; a multiple of 2*PIC_TILE so tiles can be
+ *        colored by parity in each direction.
+ */
+Index_type getPICCellsPerSide(Index_type target_num_particles);
+
+/*!
+ * \brief Allocate particle positions and velocities and place particles
+ *        at random in each real cell of domain, sorted by tile.
+ *
+ * Velocities are random in [-0.5, 0.5] cells per unit time in each
+ * direction. A fixed seed makes the particles, and so the checksums,
+ * the same on every run.
+ */
+void allocAndInitPICParticles(Real_ptr& x, Real_ptr& y, Real_ptr& z,
+                              Real_ptr& vx, Real_ptr& vy, Real_ptr& vz,
+                              const ADomain& domain, VariantID vid);
+
+/*!
+ * \brief Allocate nodal electric and magnetic fields and set them to
+ *        smooth fields periodic on the real cells of domain; the magnetic
+ *        field is mostly along z.
+ */
+void allocAndInitPICFields(Real_ptr& ex, Real_ptr& ey, Real_ptr& ez,
+                           Real_ptr& bx, Real_ptr& by, Real_ptr& bz,
+                           const ADomain& domain, VariantID vid);
+
+/*!
+ * \brief Number of private current grids the privatized deposit uses for
+ *        the given variant: one per OpenMP thread, else one.
+ */
+Index_type getPICNumPrivateGrids(VariantID vid);
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,293 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PIC_DEPOSIT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "AppsData.hpp"
+#include "PICData.hpp"
+
+#include <cmath>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+void PIC_DEPOSIT::runOpenMPVariantAtomic(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  PIC_DEPOSIT_DATA_SETUP;
+
+  PIC_DEPOSIT_ATOMIC_DATA_SETUP;
+
+  auto pic_deposit_atomic_lam = [=](Index_type p) {
+                                   PIC_DEPOSIT_BODY_SETUP;
+                                   for (Index_type c = 0; c < 8; ++c) {
+                                     const Index_type n = n0 + off[c];
+                                     #pragma omp atomic
+                                     jx[n] += wt[c] * cx;
+                                     #pragma omp atomic
+                                     jy[n] += wt[c] * cy;
+                                     #pragma omp atomic
+                                     jz[n] += wt[c] * cz;
+                                   }
+                                 };
+
+  auto pic_deposit_raja_atomic_lam = [=](Index_type p) {
+                                       PIC_DEPOSIT_RAJA_ATOMIC_BODY(RAJA::omp_atomic);
+                                     };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type p = 0; p < np; ++p ) {
+          PIC_DEPOSIT_BODY_SETUP;
+          for (Index_type c = 0; c < 8; ++c) {
+            const Index_type n = n0 + off[c];
+            #pragma omp atomic
+            jx[n] += wt[c] * cx;
+            #pragma omp atomic
+            jy[n] += wt[c] * cy;
+            #pragma omp atomic
+            jz[n] += wt[c] * cz;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type p = 0; p < np; ++p ) {
+          pic_deposit_atomic_lam(p);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, np), pic_deposit_raja_atomic_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PIC_DEPOSIT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void PIC_DEPOSIT::runOpenMPVariantPrivatized(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  PIC_DEPOSIT_DATA_SETUP;
+
+  PIC_DEPOSIT_PRIVATE_DATA_SETUP;
+
+  auto pic_deposit_private_lam = [=](Index_type g) {
+                                    PIC_DEPOSIT_PRIVATE_BODY;
+                                  };
+
+  auto pic_deposit_reduce_lam = [=](Index_type n) {
+                                   PIC_DEPOSIT_REDUCE_BODY;
+                                 };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type g = 0; g < nprivate; ++g ) {
+          PIC_DEPOSIT_PRIVATE_BODY;
+        }
+
+        #pragma omp parallel for
+        for (Index_type n = 0; n < nnodes; ++n ) {
+          PIC_DEPOSIT_REDUCE_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type g = 0; g < nprivate; ++g ) {
+          pic_deposit_private_lam(g);
+        }
+
+        #pragma omp parallel for
+        for (Index_type n = 0; n < nnodes; ++n ) {
+          pic_deposit_reduce_lam(n);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nprivate), pic_deposit_private_lam);
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nnodes), pic_deposit_reduce_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PIC_DEPOSIT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void PIC_DEPOSIT::runOpenMPVariantSorted(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  PIC_DEPOSIT_DATA_SETUP;
+
+  PIC_DEPOSIT_TILE_DATA_SETUP;
+
+  auto pic_deposit_tile_lam = [=](Index_type color, Index_type it) {
+                                 PIC_DEPOSIT_TILE_BODY;
+                               };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type color = 0; color < 8; ++color) {
+          #pragma omp parallel for
+          for (Index_type it = 0; it < ntiles_color; ++it ) {
+            PIC_DEPOSIT_TILE_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type color = 0; color < 8; ++color) {
+          #pragma omp parallel for
+          for (Index_type it = 0; it < ntiles_color; ++it ) {
+            pic_deposit_tile_lam(color, it);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type color = 0; color < 8; ++color) {
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(0, ntiles_color), [=](Index_type it) {
+            pic_deposit_tile_lam(color, it);
+          });
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PIC_DEPOSIT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void PIC_DEPOSIT::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningTuning() ) {
+    case 1 : runOpenMPVariantPrivatized(vid); break;
+    case 2 : runOpenMPVariantSorted(vid); break;
+    default : runOpenMPVariantAtomic(vid); break;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace apps
+} // end namespace rajaperf
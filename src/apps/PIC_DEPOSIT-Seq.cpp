@@ -0,0 +1,263 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PIC_DEPOSIT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "AppsData.hpp"
+#include "PICData.hpp"
+
+#include <cmath>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void PIC_DEPOSIT::runSeqVariantAtomic(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  PIC_DEPOSIT_DATA_SETUP;
+
+  PIC_DEPOSIT_ATOMIC_DATA_SETUP;
+
+  auto pic_deposit_atomic_lam = [=](Index_type p) {
+                                   PIC_DEPOSIT_BODY(jx, jy, jz);
+                                 };
+
+  auto pic_deposit_raja_atomic_lam = [=](Index_type p) {
+                                       PIC_DEPOSIT_RAJA_ATOMIC_BODY(RAJA::seq_atomic);
+                                     };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type p = 0; p < np; ++p ) {
+          PIC_DEPOSIT_BODY(jx, jy, jz);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type p = 0; p < np; ++p ) {
+          pic_deposit_atomic_lam(p);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, np), pic_deposit_raja_atomic_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  PIC_DEPOSIT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void PIC_DEPOSIT::runSeqVariantPrivatized(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  PIC_DEPOSIT_DATA_SETUP;
+
+  PIC_DEPOSIT_PRIVATE_DATA_SETUP;
+
+  auto pic_deposit_private_lam = [=](Index_type g) {
+                                    PIC_DEPOSIT_PRIVATE_BODY;
+                                  };
+
+  auto pic_deposit_reduce_lam = [=](Index_type n) {
+                                   PIC_DEPOSIT_REDUCE_BODY;
+                                 };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type g = 0; g < nprivate; ++g ) {
+          PIC_DEPOSIT_PRIVATE_BODY;
+        }
+
+        for (Index_type n = 0; n < nnodes; ++n ) {
+          PIC_DEPOSIT_REDUCE_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type g = 0; g < nprivate; ++g ) {
+          pic_deposit_private_lam(g);
+        }
+
+        for (Index_type n = 0; n < nnodes; ++n ) {
+          pic_deposit_reduce_lam(n);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nprivate), pic_deposit_private_lam);
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nnodes), pic_deposit_reduce_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  PIC_DEPOSIT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void PIC_DEPOSIT::runSeqVariantSorted(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  PIC_DEPOSIT_DATA_SETUP;
+
+  PIC_DEPOSIT_TILE_DATA_SETUP;
+
+  auto pic_deposit_tile_lam = [=](Index_type color, Index_type it) {
+                                 PIC_DEPOSIT_TILE_BODY;
+                               };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type color = 0; color < 8; ++color) {
+          for (Index_type it = 0; it < ntiles_color; ++it ) {
+            PIC_DEPOSIT_TILE_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type color = 0; color < 8; ++color) {
+          for (Index_type it = 0; it < ntiles_color; ++it ) {
+            pic_deposit_tile_lam(color, it);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type color = 0; color < 8; ++color) {
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(0, ntiles_color), [=](Index_type it) {
+            pic_deposit_tile_lam(color, it);
+          });
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  PIC_DEPOSIT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void PIC_DEPOSIT::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningTuning() ) {
+    case 1 : runSeqVariantPrivatized(vid); break;
+    case 2 : runSeqVariantSorted(vid); break;
+    default : runSeqVariantAtomic(vid); break;
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,117 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+#include "PIC_DEPOSIT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "AppsData.hpp"
+#include "PICData.hpp"
+#include "common/DataUtils.hpp"
+
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+PIC_DEPOSIT::PIC_DEPOSIT(const RunParams& params)
+  : KernelBase(rajaperf::Apps_PIC_DEPOSIT, params)
+{
+  setDefaultProblemSize(1000000);  // particles
+  setDefaultReps(50);
+
+  Index_type ncell = getPICCellsPerSide(getTargetProblemSize());
+  m_domain = new ADomain(ncell+1, /* ndims = */ 3);
+
+  m_np = m_domain->n_real_zones * PIC_PARTICLES_PER_CELL;
+  m_ntile = ncell / PIC_TILE;
+
+  m_q = 1.0 / PIC_PARTICLES_PER_CELL;
+
+  m_jpriv = nullptr;
+  m_nprivate = 1;
+
+  setActualProblemSize( m_np );
+
+  setItsPerRep( m_np );
+  setKernelsPerRep(1);
+  // touched data size, not actual number of stores and loads
+  setBytesPerRep( (0*sizeof(Real_type) + 6*sizeof(Real_type)) * m_np +
+                  (3*sizeof(Real_type) + 3*sizeof(Real_type)) * m_domain->nnalls );
+  setFLOPsPerRep(73 * m_np);
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+  setUsesFeature(Atomic);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  std::vector<std::string> tunings{ "atomic", "privatized", "sorted" };
+  for (size_t t = 0; t < tunings.size(); ++t) {
+    // particles deposited per second
+    setDOFsPerRep(tunings[t], m_np);
+  }
+  for (size_t vid = 0; vid < NumVariants; ++vid) {
+    setVariantTuningNames(static_cast<VariantID>(vid), tunings);
+  }
+}
+
+PIC_DEPOSIT::~PIC_DEPOSIT()
+{
+  delete m_domain;
+}
+
+void PIC_DEPOSIT::setUp(VariantID vid)
+{
+  allocAndInitPICParticles(m_x, m_y, m_z, m_vx, m_vy, m_vz, *m_domain, vid);
+
+  allocAndInitDataConst(m_jx, m_domain->nnalls, 0.0, vid);
+  allocAndInitDataConst(m_jy, m_domain->nnalls, 0.0, vid);
+  allocAndInitDataConst(m_jz, m_domain->nnalls, 0.0, vid);
+
+  m_nprivate = getPICNumPrivateGrids(vid);
+  if ( getRunningTuning() == 1 ) {
+    allocAndInitDataConst(m_jpriv, 3*m_nprivate*m_domain->nnalls, 0.0, vid);
+  }
+}
+
+void PIC_DEPOSIT::updateChecksum(VariantID vid)
+{
+  checksum[vid] += calcChecksum(m_jx, m_domain->nnalls, checksum_scale_factor );
+  checksum[vid] += calcChecksum(m_jy, m_domain->nnalls, checksum_scale_factor );
+  checksum[vid] += calcChecksum(m_jz, m_domain->nnalls, checksum_scale_factor );
+}
+
+void PIC_DEPOSIT::tearDown(VariantID vid)
+{
+  (void) vid;
+
+  deallocData(m_x);
+  deallocData(m_y);
+  deallocData(m_z);
+  deallocData(m_vx);
+  deallocData(m_vy);
+  deallocData(m_vz);
+  deallocData(m_jx);
+  deallocData(m_jy);
+  deallocData(m_jz);
+  deallocData(m_jpriv);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,189 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+///
+/// PIC_DEPOSIT kernel reference implementation:
+///
+/// for (Index_type p = 0; p < np; ++p ) {
+///   for (Index_type c = 0; c < 8; ++c ) {
+///     J[n0 + off[c]] += wt[c] * q * v[p];
+///   }
+/// }
+///
+/// Current of each particle is scattered to the nodes of its cell with
+/// trilinear weights (see PICData.hpp); particles in neighboring cells
+/// update the same nodes. Tunings resolve these conflicts by:
+///
+///   atomic     -- atomic adds to the grid
+///   privatized -- each of nprivate chunks of particles deposits to its
+///                 own zeroed grid, then the grids are summed into J
+///   sorted     -- particles are sorted by tile of cells; tiles are
+///                 colored by parity of their position in each direction
+///                 and tiles of one color, which share no nodes, deposit
+///                 concurrently without atomics, one color at a time
+///
+
+#ifndef RAJAPerf_Apps_PIC_DEPOSIT_HPP
+#define RAJAPerf_Apps_PIC_DEPOSIT_HPP
+
+#define PIC_DEPOSIT_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Real_ptr z = m_z; \
+  Real_ptr vx = m_vx; \
+  Real_ptr vy = m_vy; \
+  Real_ptr vz = m_vz; \
+  Real_ptr jx = m_jx; \
+  Real_ptr jy = m_jy; \
+  Real_ptr jz = m_jz; \
+  \
+  const Index_type jp = m_domain->jp; \
+  const Index_type kp = m_domain->kp; \
+  PIC_NODE_OFFSETS_SETUP \
+  \
+  const Real_type q = m_q;
+
+#define PIC_DEPOSIT_BODY_SETUP \
+  PIC_PARTICLE_WEIGHTS \
+  const Real_type cx = q * vx[p]; \
+  const Real_type cy = q * vy[p]; \
+  const Real_type cz = q * vz[p];
+
+#define PIC_DEPOSIT_BODY(gx, gy, gz) \
+  PIC_DEPOSIT_BODY_SETUP \
+  for (Index_type c = 0; c < 8; ++c) { \
+    const Index_type n = n0 + off[c]; \
+    gx[n] += wt[c] * cx; \
+    gy[n] += wt[c] * cy; \
+    gz[n] += wt[c] * cz; \
+  }
+
+#define PIC_DEPOSIT_RAJA_ATOMIC_BODY(policy) \
+  PIC_DEPOSIT_BODY_SETUP \
+  for (Index_type c = 0; c < 8; ++c) { \
+    const Index_type n = n0 + off[c]; \
+    RAJA::atomicAdd<policy>(&jx[n], wt[c] * cx); \
+    RAJA::atomicAdd<policy>(&jy[n], wt[c] * cy); \
+    RAJA::atomicAdd<policy>(&jz[n], wt[c] * cz); \
+  }
+
+#define PIC_DEPOSIT_ATOMIC_DATA_SETUP \
+  const Index_type np = m_np;
+
+// private grid g holds x, y, z components, nnodes each
+#define PIC_DEPOSIT_PRIVATE_DATA_SETUP \
+  const Index_type np = m_np; \
+  const Index_type nnodes = m_domain->nnalls; \
+  Real_ptr jpriv = m_jpriv; \
+  const Index_type nprivate = m_nprivate; \
+  const Index_type pchunk = (np + nprivate - 1) / nprivate;
+
+#define PIC_DEPOSIT_PRIVATE_BODY \
+  Real_ptr gx = jpriv + 3*g*nnodes; \
+  Real_ptr gy = gx + nnodes; \
+  Real_ptr gz = gy + nnodes; \
+  for (Index_type n = 0; n < 3*nnodes; ++n) { \
+    gx[n] = 0.0; \
+  } \
+  const Index_type pend = ( (g+1)*pchunk < np ) ? (g+1)*pchunk : np; \
+  for (Index_type p = g*pchunk; p < pend; ++p) { \
+    PIC_DEPOSIT_BODY(gx, gy, gz); \
+  }
+
+#define PIC_DEPOSIT_REDUCE_BODY \
+  for (Index_type g = 0; g < nprivate; ++g) { \
+    jx[n] += jpriv[3*g*nnodes + n]; \
+    jy[n] += jpriv[(3*g+1)*nnodes + n]; \
+    jz[n] += jpriv[(3*g+2)*nnodes + n]; \
+  }
+
+#define PIC_DEPOSIT_TILE_DATA_SETUP \
+  const Index_type ntile = m_ntile; \
+  const Index_type nthalf = ntile / 2; \
+  const Index_type ntiles_color = nthalf*nthalf*nthalf; \
+  const Index_type ppt = PIC_TILE*PIC_TILE*PIC_TILE * PIC_PARTICLES_PER_CELL;
+
+// tile it of the given color
+#define PIC_DEPOSIT_TILE_BODY \
+  const Index_type ti = 2*(it % nthalf) + (color & 1); \
+  const Index_type tj = 2*((it / nthalf) % nthalf) + ((color >> 1) & 1); \
+  const Index_type tk = 2*(it / (nthalf*nthalf)) + ((color >> 2) & 1); \
+  const Index_type t = ti + (tj + tk*ntile)*ntile; \
+  for (Index_type p = t*ppt; p < (t+1)*ppt; ++p) { \
+    PIC_DEPOSIT_BODY(jx, jy, jz); \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+class ADomain;
+
+class PIC_DEPOSIT : public KernelBase
+{
+public:
+
+  PIC_DEPOSIT(const RunParams& params);
+
+  ~PIC_DEPOSIT();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  PIC_DEPOSIT : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  PIC_DEPOSIT : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  PIC_DEPOSIT : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  void runSeqVariantAtomic(VariantID vid);
+  void runSeqVariantPrivatized(VariantID vid);
+  void runSeqVariantSorted(VariantID vid);
+
+  void runOpenMPVariantAtomic(VariantID vid);
+  void runOpenMPVariantPrivatized(VariantID vid);
+  void runOpenMPVariantSorted(VariantID vid);
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+  Real_ptr m_z;
+  Real_ptr m_vx;
+  Real_ptr m_vy;
+  Real_ptr m_vz;
+  Real_ptr m_jx;
+  Real_ptr m_jy;
+  Real_ptr m_jz;
+  Real_ptr m_jpriv;
+
+  Real_type m_q;
+
+  ADomain* m_domain;
+  Index_type m_np;
+  Index_type m_ntile;
+  Index_type m_nprivate;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,103 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+#include "PIC_PUSH.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "AppsData.hpp"
+#include "PICData.hpp"
+#include "common/DataUtils.hpp"
+
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+PIC_PUSH::PIC_PUSH(const RunParams& params)
+  : KernelBase(rajaperf::Apps_PIC_PUSH, params)
+{
+  setDefaultProblemSize(1000000);  // particles
+  setDefaultReps(50);
+
+  Index_type ncell = getPICCellsPerSide(getTargetProblemSize());
+  m_domain = new ADomain(ncell+1, /* ndims = */ 3);
+
+  m_np = m_domain->n_real_zones * PIC_PARTICLES_PER_CELL;
+
+  m_dt = 0.1;
+  m_qmdt2 = 0.5 * 1.0 * m_dt;  // charge to mass ratio 1
+
+  setActualProblemSize( m_np );
+
+  setItsPerRep( m_np );
+  setKernelsPerRep(1);
+  setBytesPerRep( (6*sizeof(Real_type) + 6*sizeof(Real_type)) * m_np +
+                  (0*sizeof(Real_type) + 6*sizeof(Real_type)) * m_domain->nnalls );
+  setFLOPsPerRep(185 * m_np);
+
+  // particles pushed per second
+  setDOFsPerRep(getDefaultTuningName(), m_np);
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+PIC_PUSH::~PIC_PUSH()
+{
+  delete m_domain;
+}
+
+void PIC_PUSH::setUp(VariantID vid)
+{
+  allocAndInitPICParticles(m_x, m_y, m_z, m_vx, m_vy, m_vz, *m_domain, vid);
+  allocAndInitPICFields(m_ex, m_ey, m_ez, m_bx, m_by, m_bz, *m_domain, vid);
+}
+
+void PIC_PUSH::updateChecksum(VariantID vid)
+{
+  checksum[vid] += calcChecksum(m_x, m_np, checksum_scale_factor );
+  checksum[vid] += calcChecksum(m_y, m_np, checksum_scale_factor );
+  checksum[vid] += calcChecksum(m_z, m_np, checksum_scale_factor );
+  checksum[vid] += calcChecksum(m_vx, m_np, checksum_scale_factor );
+  checksum[vid] += calcChecksum(m_vy, m_np, checksum_scale_factor );
+  checksum[vid] += calcChecksum(m_vz, m_np, checksum_scale_factor );
+}
+
+void PIC_PUSH::tearDown(VariantID vid)
+{
+  (void) vid;
+
+  deallocData(m_x);
+  deallocData(m_y);
+  deallocData(m_z);
+  deallocData(m_vx);
+  deallocData(m_vy);
+  deallocData(m_vz);
+  deallocData(m_ex);
+  deallocData(m_ey);
+  deallocData(m_ez);
+  deallocData(m_bx);
+  deallocData(m_by);
+  deallocData(m_bz);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,158 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+///
+/// PIC_PUSH kernel reference implementation:
+///
+/// for (Index_type p = 0; p < np; ++p ) {
+///
+///   // gather fields at particle with trilinear weights of cell nodes
+///   E = sum_c wt[c] * E[n0 + off[c]];
+///   B = sum_c wt[c] * B[n0 + off[c]];
+///
+///   // Boris push
+///   um = v[p] + qmdt2 * E;
+///   t = qmdt2 * B;
+///   s = 2 * t / (1 + t.t);
+///   up = um + um x t;
+///   v[p] = um + up x s + qmdt2 * E;
+///
+///   // move particle; positions are periodic on the real cells
+///   x[p] += dt * v[p];
+///   x[p] -= len * floor((x[p] - lo) / len);
+///
+/// }
+///
+/// Particle layout, weights and fields are described in PICData.hpp.
+///
+
+#ifndef RAJAPerf_Apps_PIC_PUSH_HPP
+#define RAJAPerf_Apps_PIC_PUSH_HPP
+
+#define PIC_PUSH_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Real_ptr z = m_z; \
+  Real_ptr vx = m_vx; \
+  Real_ptr vy = m_vy; \
+  Real_ptr vz = m_vz; \
+  Real_ptr ex = m_ex; \
+  Real_ptr ey = m_ey; \
+  Real_ptr ez = m_ez; \
+  Real_ptr bx = m_bx; \
+  Real_ptr by = m_by; \
+  Real_ptr bz = m_bz; \
+  \
+  const Index_type np = m_np; \
+  const Index_type jp = m_domain->jp; \
+  const Index_type kp = m_domain->kp; \
+  PIC_NODE_OFFSETS_SETUP \
+  \
+  const Real_type lo = m_domain->imin; \
+  const Real_type len = m_domain->imax - m_domain->imin; \
+  const Real_type dt = m_dt; \
+  const Real_type qmdt2 = m_qmdt2;
+
+#define PIC_PUSH_BODY \
+  PIC_PARTICLE_WEIGHTS \
+  \
+  Real_type epx = 0.0, epy = 0.0, epz = 0.0; \
+  Real_type bpx = 0.0, bpy = 0.0, bpz = 0.0; \
+  for (Index_type c = 0; c < 8; ++c) { \
+    const Index_type n = n0 + off[c]; \
+    epx += wt[c] * ex[n]; \
+    epy += wt[c] * ey[n]; \
+    epz += wt[c] * ez[n]; \
+    bpx += wt[c] * bx[n]; \
+    bpy += wt[c] * by[n]; \
+    bpz += wt[c] * bz[n]; \
+  } \
+  \
+  const Real_type umx = vx[p] + qmdt2 * epx; \
+  const Real_type umy = vy[p] + qmdt2 * epy; \
+  const Real_type umz = vz[p] + qmdt2 * epz; \
+  const Real_type tx = qmdt2 * bpx; \
+  const Real_type ty = qmdt2 * bpy; \
+  const Real_type tz = qmdt2 * bpz; \
+  const Real_type sfac = 2.0 / (1.0 + tx*tx + ty*ty + tz*tz); \
+  const Real_type upx = umx + (umy*tz - umz*ty); \
+  const Real_type upy = umy + (umz*tx - umx*tz); \
+  const Real_type upz = umz + (umx*ty - umy*tx); \
+  vx[p] = umx + sfac * (upy*tz - upz*ty) + qmdt2 * epx; \
+  vy[p] = umy + sfac * (upz*tx - upx*tz) + qmdt2 * epy; \
+  vz[p] = umz + sfac * (upx*ty - upy*tx) + qmdt2 * epz; \
+  \
+  x[p] += dt * vx[p]; \
+  y[p] += dt * vy[p]; \
+  z[p] += dt * vz[p]; \
+  x[p] -= len * floor((x[p] - lo) / len); \
+  y[p] -= len * floor((y[p] - lo) / len); \
+  z[p] -= len * floor((z[p] - lo) / len);
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+class ADomain;
+
+class PIC_PUSH : public KernelBase
+{
+public:
+
+  PIC_PUSH(const RunParams& params);
+
+  ~PIC_PUSH();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  PIC_PUSH : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  PIC_PUSH : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  PIC_PUSH : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  Real_ptr m_x;
+  Real_ptr m_y;
+  Real_ptr m_z;
+  Real_ptr m_vx;
+  Real_ptr m_vy;
+  Real_ptr m_vz;
+  Real_ptr m_ex;
+  Real_ptr m_ey;
+  Real_ptr m_ez;
+  Real_ptr m_bx;
+  Real_ptr m_by;
+  Real_ptr m_bz;
+
+  Real_type m_dt;
+  Real_type m_qmdt2;
+
+  ADomain* m_domain;
+  Index_type m_np;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,477 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+#include "STENCIL_27PT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "AppsData.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+  //
+  // Tile sizes in k and j; i rows are kept whole for unit-stride access.
+  //
+  constexpr Index_type k_block_sz = 8;
+  constexpr Index_type j_block_sz = 16;
+
+void STENCIL_27PT::runSeqVariantPlain(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  const Index_type ibegin = m_domain->imin;
+  const Index_type iend = m_domain->imax;
+  const Index_type jbegin = m_domain->jmin;
+  const Index_type jend = m_domain->jmax;
+  const Index_type kbegin = m_domain->kmin;
+  const Index_type kend = m_domain->kmax;
+
+  STENCIL_27PT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 0; t < tsteps; ++t) {
+
+          for (Index_type k = kbegin; k < kend; ++k ) {
+            for (Index_type j = jbegin; j < jend; ++j ) {
+              for (Index_type i = ibegin; i < iend; ++i ) {
+                STENCIL_27PT_BODY(b, a);
+              }
+            }
+          }
+
+          for (Index_type k = kbegin; k < kend; ++k ) {
+            for (Index_type j = jbegin; j < jend; ++j ) {
+              for (Index_type i = ibegin; i < iend; ++i ) {
+                STENCIL_27PT_BODY(a, b);
+              }
+            }
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto stencil27pt_lam1 = [=](Index_type i, Index_type j, Index_type k) {
+                                STENCIL_27PT_BODY(b, a);
+                              };
+      auto stencil27pt_lam2 = [=](Index_type i, Index_type j, Index_type k) {
+                                STENCIL_27PT_BODY(a, b);
+                              };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 0; t < tsteps; ++t) {
+
+          for (Index_type k = kbegin; k < kend; ++k ) {
+            for (Index_type j = jbegin; j < jend; ++j ) {
+              for (Index_type i = ibegin; i < iend; ++i ) {
+                stencil27pt_lam1(i, j, k);
+              }
+            }
+          }
+
+          for (Index_type k = kbegin; k < kend; ++k ) {
+            for (Index_type j = jbegin; j < jend; ++j ) {
+              for (Index_type i = ibegin; i < iend; ++i ) {
+                stencil27pt_lam2(i, j, k);
+              }
+            }
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<2, RAJA::loop_exec,    // k
+            RAJA::statement::For<1, RAJA::loop_exec,    // j
+              RAJA::statement::For<0, RAJA::loop_exec,    // i
+                RAJA::statement::Lambda<0>
+              >
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 0; t < tsteps; ++t) {
+
+          RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{ibegin, iend},
+                                                   RAJA::RangeSegment{jbegin, jend},
+                                                   RAJA::RangeSegment{kbegin, kend}),
+            [=](Index_type i, Index_type j, Index_type k) {
+              STENCIL_27PT_BODY(b, a);
+            }
+          );
+
+          RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{ibegin, iend},
+                                                   RAJA::RangeSegment{jbegin, jend},
+                                                   RAJA::RangeSegment{kbegin, kend}),
+            [=](Index_type i, Index_type j, Index_type k) {
+              STENCIL_27PT_BODY(a, b);
+            }
+          );
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  STENCIL_27PT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void STENCIL_27PT::runSeqVariantTiled(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  const Index_type ibegin = m_domain->imin;
+  const Index_type iend = m_domain->imax;
+  const Index_type jbegin = m_domain->jmin;
+  const Index_type jend = m_domain->jmax;
+  const Index_type kbegin = m_domain->kmin;
+  const Index_type kend = m_domain->kmax;
+
+  STENCIL_27PT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 0; t < tsteps; ++t) {
+
+          for (Index_type kk = kbegin; kk < kend; kk += k_block_sz ) {
+            for (Index_type jj = jbegin; jj < jend; jj += j_block_sz ) {
+              const Index_type kk_end = std::min(kk + k_block_sz, kend);
+              const Index_type jj_end = std::min(jj + j_block_sz, jend);
+              for (Index_type k = kk; k < kk_end; ++k ) {
+                for (Index_type j = jj; j < jj_end; ++j ) {
+                  for (Index_type i = ibegin; i < iend; ++i ) {
+                    STENCIL_27PT_BODY(b, a);
+                  }
+                }
+              }
+            }
+          }
+
+          for (Index_type kk = kbegin; kk < kend; kk += k_block_sz ) {
+            for (Index_type jj = jbegin; jj < jend; jj += j_block_sz ) {
+              const Index_type kk_end = std::min(kk + k_block_sz, kend);
+              const Index_type jj_end = std::min(jj + j_block_sz, jend);
+              for (Index_type k = kk; k < kk_end; ++k ) {
+                for (Index_type j = jj; j < jj_end; ++j ) {
+                  for (Index_type i = ibegin; i < iend; ++i ) {
+                    STENCIL_27PT_BODY(a, b);
+                  }
+                }
+              }
+            }
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto stencil27pt_tiled_lam1 = [=](Index_type i, Index_type j, Index_type k) {
+                                      STENCIL_27PT_BODY(b, a);
+                                    };
+      auto stencil27pt_tiled_lam2 = [=](Index_type i, Index_type j, Index_type k) {
+                                      STENCIL_27PT_BODY(a, b);
+                                    };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 0; t < tsteps; ++t) {
+
+          for (Index_type kk = kbegin; kk < kend; kk += k_block_sz ) {
+            for (Index_type jj = jbegin; jj < jend; jj += j_block_sz ) {
+              const Index_type kk_end = std::min(kk + k_block_sz, kend);
+              const Index_type jj_end = std::min(jj + j_block_sz, jend);
+              for (Index_type k = kk; k < kk_end; ++k ) {
+                for (Index_type j = jj; j < jj_end; ++j ) {
+                  for (Index_type i = ibegin; i < iend; ++i ) {
+                    stencil27pt_tiled_lam1(i, j, k);
+                  }
+                }
+              }
+            }
+          }
+
+          for (Index_type kk = kbegin; kk < kend; kk += k_block_sz ) {
+            for (Index_type jj = jbegin; jj < jend; jj += j_block_sz ) {
+              const Index_type kk_end = std::min(kk + k_block_sz, kend);
+              const Index_type jj_end = std::min(jj + j_block_sz, jend);
+              for (Index_type k = kk; k < kk_end; ++k ) {
+                for (Index_type j = jj; j < jj_end; ++j ) {
+                  for (Index_type i = ibegin; i < iend; ++i ) {
+                    stencil27pt_tiled_lam2(i, j, k);
+                  }
+                }
+              }
+            }
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::Tile<2, RAJA::tile_fixed<k_block_sz>, RAJA::loop_exec,
+            RAJA::statement::Tile<1, RAJA::tile_fixed<j_block_sz>, RAJA::loop_exec,
+              RAJA::statement::For<2, RAJA::loop_exec,    // k
+                RAJA::statement::For<1, RAJA::loop_exec,    // j
+                  RAJA::statement::For<0, RAJA::loop_exec,    // i
+                    RAJA::statement::Lambda<0>
+                  >
+                >
+              >
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type t = 0; t < tsteps; ++t) {
+
+          RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{ibegin, iend},
+                                                   RAJA::RangeSegment{jbegin, jend},
+                                                   RAJA::RangeSegment{kbegin, kend}),
+            [=](Index_type i, Index_type j, Index_type k) {
+              STENCIL_27PT_BODY(b, a);
+            }
+          );
+
+          RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{ibegin, iend},
+                                                   RAJA::RangeSegment{jbegin, jend},
+                                                   RAJA::RangeSegment{kbegin, kend}),
+            [=](Index_type i, Index_type j, Index_type k) {
+              STENCIL_27PT_BODY(a, b);
+            }
+          );
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  STENCIL_27PT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void STENCIL_27PT::runSeqVariantTemporal(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  const Index_type ibegin = m_domain->imin;
+  const Index_type iend = m_domain->imax;
+  const Index_type jbegin = m_domain->jmin;
+  const Index_type jend = m_domain->jmax;
+  const Index_type kbegin = m_domain->kmin;
+  const Index_type kend = m_domain->kmax;
+
+  STENCIL_27PT_DATA_SETUP;
+
+  const Index_type nsweeps = 2 * tsteps;
+  const Index_type nwaves = (kend - kbegin) + nsweeps - 1;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type w = 0; w < nwaves; ++w) {
+          for (Index_type s = 0; s < nsweeps; ++s) {
+            const Index_type k = kbegin + w - s;
+            if ( k >= kbegin && k < kend ) {
+              if ( s % 2 == 0 ) {
+                for (Index_type j = jbegin; j < jend; ++j ) {
+                  for (Index_type i = ibegin; i < iend; ++i ) {
+                    STENCIL_27PT_BODY(b, a);
+                  }
+                }
+              } else {
+                for (Index_type j = jbegin; j < jend; ++j ) {
+                  for (Index_type i = ibegin; i < iend; ++i ) {
+                    STENCIL_27PT_BODY(a, b);
+                  }
+                }
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto stencil27pt_temporal_lam1 = [=](Index_type i, Index_type j, Index_type k) {
+                                         STENCIL_27PT_BODY(b, a);
+                                       };
+      auto stencil27pt_temporal_lam2 = [=](Index_type i, Index_type j, Index_type k) {
+                                         STENCIL_27PT_BODY(a, b);
+                                       };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type w = 0; w < nwaves; ++w) {
+          for (Index_type s = 0; s < nsweeps; ++s) {
+            const Index_type k = kbegin + w - s;
+            if ( k >= kbegin && k < kend ) {
+              if ( s % 2 == 0 ) {
+                for (Index_type j = jbegin; j < jend; ++j ) {
+                  for (Index_type i = ibegin; i < iend; ++i ) {
+                    stencil27pt_temporal_lam1(i, j, k);
+                  }
+                }
+              } else {
+                for (Index_type j = jbegin; j < jend; ++j ) {
+                  for (Index_type i = ibegin; i < iend; ++i ) {
+                    stencil27pt_temporal_lam2(i, j, k);
+                  }
+                }
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<1, RAJA::loop_exec,    // j
+            RAJA::statement::For<0, RAJA::loop_exec,    // i
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type w = 0; w < nwaves; ++w) {
+          for (Index_type s = 0; s < nsweeps; ++s) {
+            const Index_type k = kbegin + w - s;
+            if ( k >= kbegin && k < kend ) {
+              if ( s % 2 == 0 ) {
+                RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{ibegin, iend},
+                                                         RAJA::RangeSegment{jbegin, jend}),
+                  [=](Index_type i, Index_type j) {
+                    STENCIL_27PT_BODY(b, a);
+                  }
+                );
+              } else {
+                RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{ibegin, iend},
+                                                         RAJA::RangeSegment{jbegin, jend}),
+                  [=](Index_type i, Index_type j) {
+                    STENCIL_27PT_BODY(a, b);
+                  }
+                );
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  STENCIL_27PT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void STENCIL_27PT::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningTuning() ) {
+    case 1 : runSeqVariantTiled(vid); break;
+    case 2 : runSeqVariantTemporal(vid); break;
+    default : runSeqVariantPlain(vid); break;
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,105 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "STENCIL_27PT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "AppsData.hpp"
+#include "common/DataUtils.hpp"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+STENCIL_27PT::STENCIL_27PT(const RunParams& params)
+  : KernelBase(rajaperf::Apps_STENCIL_27PT, params)
+{
+  setDefaultProblemSize(100*100*100);  // See rzmax in ADomain struct
+  setDefaultReps(10);
+
+  Index_type rzmax = std::cbrt(getTargetProblemSize())+1;
+  m_domain = new ADomain(rzmax, /* ndims = */ 3);
+
+  m_array_length = m_domain->nnalls;
+
+  m_tsteps = 4;
+
+  m_c0 = 0.3;
+  m_c1 = 0.05;
+  m_c2 = 0.025;
+  m_c3 = 0.0125;
+
+  const Index_type nz = m_domain->imax - m_domain->imin;
+
+  setActualProblemSize( nz * nz * nz );
+
+  setItsPerRep( 2 * m_tsteps * getActualProblemSize() );
+  setKernelsPerRep( 2 * m_tsteps );
+  // touched data size, not actual number of stores and loads
+  setBytesPerRep( 2 * m_tsteps *
+                  ( (1*sizeof(Real_type) + 0*sizeof(Real_type)) *
+                    getActualProblemSize() +
+                    (0*sizeof(Real_type) + 1*sizeof(Real_type)) *
+                    ( (nz+2)*(nz+2)*(nz+2) ) ) );
+  setFLOPsPerRep( 2 * m_tsteps * 30 * getActualProblemSize() );
+
+  checksum_scale_factor = 0.0001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Kernel);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  std::vector<std::string> tunings{ "plain", "tiled", "temporal" };
+  for (size_t vid = 0; vid < NumVariants; ++vid) {
+    setVariantTuningNames(static_cast<VariantID>(vid), tunings);
+  }
+}
+
+STENCIL_27PT::~STENCIL_27PT()
+{
+  delete m_domain;
+}
+
+void STENCIL_27PT::setUp(VariantID vid)
+{
+  allocAndInitData(m_a, m_array_length, vid);
+  allocAndInitData(m_b, m_array_length, vid);
+}
+
+void STENCIL_27PT::updateChecksum(VariantID vid)
+{
+  checksum[vid] += calcChecksum(m_a, m_array_length, checksum_scale_factor );
+  checksum[vid] += calcChecksum(m_b, m_array_length, checksum_scale_factor );
+}
+
+void STENCIL_27PT::tearDown(VariantID vid)
+{
+  (void) vid;
+
+  deallocData(m_a);
+  deallocData(m_b);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
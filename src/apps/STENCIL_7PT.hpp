@@ -0,0 +1,180 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+///
+/// STENCIL_7PT kernel reference implementation:
+///
+/// 7-point stencil on the padded ADomain mesh, applied tsteps times per
+/// rep ping-ponging between arrays a and b. The coefficients
+/// (c0 = 0.4, c1 = 0.1) sum to one so repeated application
+/// stays bounded.
+///
+/// STENCIL (a -> b):
+///
+///   Index_type ip = i + j*jp + k*kp ;
+///   b[ip] = c0 * a[ip] +
+///           c1 * ( a[ip-1]  + a[ip+1]  +
+///                  a[ip-jp] + a[ip+jp] +
+///                  a[ip-kp] + a[ip+kp] ) ;
+///
+/// The kernel has three tunings that apply the same sweeps in a different
+/// loop order.
+///
+/// plain:
+///
+/// for (Index_type t = 0; t < tsteps; ++t) {
+///
+///   for (Index_type k = kbegin; k < kend; ++k ) {
+///     for (Index_type j = jbegin; j < jend; ++j ) {
+///       for (Index_type i = ibegin; i < iend; ++i ) {
+///         STENCIL (a -> b)
+///       }
+///     }
+///   }
+///
+///   for (Index_type k = kbegin; k < kend; ++k ) {
+///     for (Index_type j = jbegin; j < jend; ++j ) {
+///       for (Index_type i = ibegin; i < iend; ++i ) {
+///         STENCIL (b -> a)
+///       }
+///     }
+///   }
+///
+/// }
+///
+/// tiled (spatially tiled in k and j):
+///
+/// for (Index_type t = 0; t < tsteps; ++t) {
+///
+///   for (Index_type kk = kbegin; kk < kend; kk += k_block_sz ) {
+///     for (Index_type jj = jbegin; jj < jend; jj += j_block_sz ) {
+///       for (Index_type k = kk; k < min(kk+k_block_sz, kend); ++k ) {
+///         for (Index_type j = jj; j < min(jj+j_block_sz, jend); ++j ) {
+///           for (Index_type i = ibegin; i < iend; ++i ) {
+///             STENCIL (a -> b)
+///           }
+///         }
+///       }
+///     }
+///   }
+///
+///   ...same tiled sweep for (b -> a)
+///
+/// }
+///
+/// temporal (temporally blocked):
+///
+/// Time-skewed (wavefront) sweep over k-planes. Sweep s = 2*t (a -> b) or
+/// s = 2*t+1 (b -> a) of the plain tuning is applied to plane k at wavefront
+/// w = (k - kbegin) + s, so all sweeps of a rep advance together through a
+/// window of about nsweeps+2 planes that can stay resident in cache:
+///
+/// const Index_type nsweeps = 2*tsteps;
+///
+/// for (Index_type w = 0; w < (kend - kbegin) + nsweeps - 1; ++w) {
+///   for (Index_type s = 0; s < nsweeps; ++s) {
+///     Index_type k = kbegin + w - s;
+///     if ( k >= kbegin && k < kend ) {
+///       for (Index_type j = jbegin; j < jend; ++j ) {
+///         for (Index_type i = ibegin; i < iend; ++i ) {
+///           if ( s % 2 == 0 ) STENCIL (a -> b) else STENCIL (b -> a)
+///         }
+///       }
+///     }
+///   }
+/// }
+///
+/// Plane k of sweep s only reads planes k-1, k, k+1 of sweep s-1, which are
+/// complete when it executes, and overwrites plane k of sweep s-2, which no
+/// later plane of sweep s-1 needs, so the result is bitwise identical to
+/// the plain tuning.
+///
+
+#ifndef RAJAPerf_Apps_STENCIL_7PT_HPP
+#define RAJAPerf_Apps_STENCIL_7PT_HPP
+
+#define STENCIL_7PT_DATA_SETUP \
+  Real_ptr a = m_a; \
+  Real_ptr b = m_b; \
+\
+  const Index_type jp = m_domain->jp; \
+  const Index_type kp = m_domain->kp; \
+\
+  const Index_type tsteps = m_tsteps; \
+  const Real_type c0 = m_c0; \
+  const Real_type c1 = m_c1;
+
+#define STENCIL_7PT_BODY(out, in) \
+  Index_type ip = i + j*jp + k*kp ; \
+  out[ip] = c0 * in[ip] + \
+            c1 * ( in[ip-1]  + in[ip+1]  + \
+                   in[ip-jp] + in[ip+jp] + \
+                   in[ip-kp] + in[ip+kp] ) ;
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+class ADomain;
+
+class STENCIL_7PT : public KernelBase
+{
+public:
+
+  STENCIL_7PT(const RunParams& params);
+
+  ~STENCIL_7PT();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  STENCIL_7PT : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  STENCIL_7PT : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  STENCIL_7PT : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  void runSeqVariantPlain(VariantID vid);
+  void runSeqVariantTiled(VariantID vid);
+  void runSeqVariantTemporal(VariantID vid);
+
+  void runOpenMPVariantPlain(VariantID vid);
+  void runOpenMPVariantTiled(VariantID vid);
+  void runOpenMPVariantTemporal(VariantID vid);
+
+  Real_ptr m_a;
+  Real_ptr m_b;
+
+  Real_type m_c0;
+  Real_type m_c1;
+
+  Index_type m_tsteps;
+
+  ADomain* m_domain;
+  Index_type m_array_length;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
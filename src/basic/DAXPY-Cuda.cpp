@@ -28,11 +28,11 @@ namespace basic
 
 
 #define DAXPY_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(x, m_x, iend); \
-  allocAndInitCudaDeviceData(y, m_y, iend);
+  allocAndInitCudaDeviceData(x, m_x.get<Real_type>(), iend); \
+  allocAndInitCudaDeviceData(y, m_y.get<Real_type>(), iend);
 
 #define DAXPY_DATA_TEARDOWN_CUDA \
-  getCudaDeviceData(m_y, y, iend); \
+  getCudaDeviceData(m_y.get<Real_type>(), y, iend); \
   deallocCudaDeviceData(x); \
   deallocCudaDeviceData(y);
 
@@ -18,15 +18,16 @@ namespace basic
 {
 
 
-void DAXPY::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void DAXPY::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  DAXPY_DATA_SETUP;
+  DAXPY_DATA_SETUP_TYPED(Data_type);
 
   auto daxpy_lam = [=](Index_type i) {
                      DAXPY_BODY;
@@ -85,6 +86,18 @@ void DAXPY::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void DAXPY::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
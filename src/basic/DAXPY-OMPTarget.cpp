@@ -30,11 +30,11 @@ namespace basic
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(x, m_x, iend, did, hid); \
-  allocAndInitOpenMPDeviceData(y, m_y, iend, did, hid);
+  allocAndInitOpenMPDeviceData(x, m_x.get<Real_type>(), iend, did, hid); \
+  allocAndInitOpenMPDeviceData(y, m_y.get<Real_type>(), iend, did, hid);
 
 #define DAXPY_DATA_TEARDOWN_OMP_TARGET \
-  getOpenMPDeviceData(m_y, y, iend, hid, did); \
+  getOpenMPDeviceData(m_y.get<Real_type>(), y, iend, hid, did); \
   deallocOpenMPDeviceData(x, did); \
   deallocOpenMPDeviceData(y, did);
 
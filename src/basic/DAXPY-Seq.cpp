@@ -18,13 +18,14 @@ namespace basic
 {
 
 
-void DAXPY::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void DAXPY::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  DAXPY_DATA_SETUP;
+  DAXPY_DATA_SETUP_TYPED(Data_type);
 
   auto daxpy_lam = [=](Index_type i) {
                      DAXPY_BODY;
@@ -86,5 +87,13 @@ void DAXPY::runSeqVariant(VariantID vid)
 
 }
 
+void DAXPY::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
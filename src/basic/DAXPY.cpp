@@ -12,6 +12,8 @@
 
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 namespace basic
@@ -51,6 +53,17 @@ DAXPY::DAXPY(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (1*data_size + 2*data_size) * getActualProblemSize() );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 DAXPY::~DAXPY()
@@ -59,8 +72,10 @@ DAXPY::~DAXPY()
 
 void DAXPY::setUp(VariantID vid)
 {
-  allocAndInitDataConst(m_y, getActualProblemSize(), 0.0, vid);
-  allocAndInitData(m_x, getActualProblemSize(), vid);
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitDataConst(m_y, getActualProblemSize(), 0.0, pid, vid);
+  allocAndInitData(m_x, getActualProblemSize(), pid, vid);
   initData(m_a);
 }
 
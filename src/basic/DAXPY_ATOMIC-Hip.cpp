@@ -28,11 +28,11 @@ namespace basic
 
 
 #define DAXPY_ATOMIC_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(x, m_x, iend); \
-  allocAndInitHipDeviceData(y, m_y, iend);
+  allocAndInitHipDeviceData(x, m_x.get<Real_type>(), iend); \
+  allocAndInitHipDeviceData(y, m_y.get<Real_type>(), iend);
 
 #define DAXPY_ATOMIC_DATA_TEARDOWN_HIP \
-  getHipDeviceData(m_y, y, iend); \
+  getHipDeviceData(m_y.get<Real_type>(), y, iend); \
   deallocHipDeviceData(x); \
   deallocHipDeviceData(y);
 
@@ -18,15 +18,16 @@ namespace basic
 {
 
 
-void DAXPY_ATOMIC::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void DAXPY_ATOMIC::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  DAXPY_ATOMIC_DATA_SETUP;
+  DAXPY_ATOMIC_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -89,6 +90,18 @@ void DAXPY_ATOMIC::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void DAXPY_ATOMIC::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
@@ -18,13 +18,14 @@ namespace basic
 {
 
 
-void DAXPY_ATOMIC::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void DAXPY_ATOMIC::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  DAXPY_ATOMIC_DATA_SETUP;
+  DAXPY_ATOMIC_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -89,5 +90,13 @@ void DAXPY_ATOMIC::runSeqVariant(VariantID vid)
 
 }
 
+void DAXPY_ATOMIC::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
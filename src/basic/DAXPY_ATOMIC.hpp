@@ -17,10 +17,12 @@
 #ifndef RAJAPerf_Basic_DAXPY_ATOMIC_HPP
 #define RAJAPerf_Basic_DAXPY_ATOMIC_HPP
 
-#define DAXPY_ATOMIC_DATA_SETUP \
-  Real_ptr x = m_x; \
-  Real_ptr y = m_y; \
-  Real_type a = m_a;
+#define DAXPY_ATOMIC_DATA_SETUP_TYPED(Data_type) \
+  Data_type* x = m_x.get<Data_type>(); \
+  Data_type* y = m_y.get<Data_type>(); \
+  Data_type a = m_a;
+
+#define DAXPY_ATOMIC_DATA_SETUP DAXPY_ATOMIC_DATA_SETUP_TYPED(Real_type)
 
 #define DAXPY_ATOMIC_BODY  \
   y[i] += a * x[i] ;
@@ -57,8 +59,13 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
-  Real_ptr m_x;
-  Real_ptr m_y;
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_x;
+  Precision_ptr m_y;
   Real_type m_a;
 };
 
@@ -0,0 +1,80 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "GATHER.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "RandomAccessData.hpp"
+#include "common/DataUtils.hpp"
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+GATHER::GATHER(const RunParams& params)
+  : KernelBase(rajaperf::Basic_GATHER, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(100);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type) + 1*sizeof(Int_type)) * getActualProblemSize() );
+  setFLOPsPerRep(0);
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  for (size_t vid = 0; vid < NumVariants; ++vid) {
+    setVariantTuningNames(static_cast<VariantID>(vid),
+                          getRandomAccessTuningNames());
+  }
+}
+
+GATHER::~GATHER()
+{
+}
+
+void GATHER::setUp(VariantID vid)
+{
+  allocAndInitDataConst(m_x, getActualProblemSize(), 0.0, vid);
+  allocAndInitData(m_y, getActualProblemSize(), vid);
+  allocAndInitDataConst(m_idx,
+                        getActualProblemSize() + RANDOM_ACCESS_PREFETCH_DISTANCE,
+                        0, vid);
+  initRandomAccessIndices(m_idx, getActualProblemSize(),
+                          getRandomAccessDistribution(getRunningTuning()));
+}
+
+void GATHER::updateChecksum(VariantID vid)
+{
+  checksum[vid] += calcChecksum(m_x, getActualProblemSize());
+}
+
+void GATHER::tearDown(VariantID vid)
+{
+  (void) vid;
+  deallocData(m_x);
+  deallocData(m_y);
+  deallocData(m_idx);
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -28,15 +28,15 @@ namespace basic
 
 
 #define IF_QUAD_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(a, m_a, iend); \
-  allocAndInitCudaDeviceData(b, m_b, iend); \
-  allocAndInitCudaDeviceData(c, m_c, iend); \
-  allocAndInitCudaDeviceData(x1, m_x1, iend); \
-  allocAndInitCudaDeviceData(x2, m_x2, iend);
+  allocAndInitCudaDeviceData(a, m_a.get<Real_type>(), iend); \
+  allocAndInitCudaDeviceData(b, m_b.get<Real_type>(), iend); \
+  allocAndInitCudaDeviceData(c, m_c.get<Real_type>(), iend); \
+  allocAndInitCudaDeviceData(x1, m_x1.get<Real_type>(), iend); \
+  allocAndInitCudaDeviceData(x2, m_x2.get<Real_type>(), iend);
 
 #define IF_QUAD_DATA_TEARDOWN_CUDA \
-  getCudaDeviceData(m_x1, x1, iend); \
-  getCudaDeviceData(m_x2, x2, iend); \
+  getCudaDeviceData(m_x1.get<Real_type>(), x1, iend); \
+  getCudaDeviceData(m_x2.get<Real_type>(), x2, iend); \
   deallocCudaDeviceData(a); \
   deallocCudaDeviceData(b); \
   deallocCudaDeviceData(c); \
@@ -28,15 +28,15 @@ namespace basic
 
 
 #define IF_QUAD_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(a, m_a, iend); \
-  allocAndInitHipDeviceData(b, m_b, iend); \
-  allocAndInitHipDeviceData(c, m_c, iend); \
-  allocAndInitHipDeviceData(x1, m_x1, iend); \
-  allocAndInitHipDeviceData(x2, m_x2, iend);
+  allocAndInitHipDeviceData(a, m_a.get<Real_type>(), iend); \
+  allocAndInitHipDeviceData(b, m_b.get<Real_type>(), iend); \
+  allocAndInitHipDeviceData(c, m_c.get<Real_type>(), iend); \
+  allocAndInitHipDeviceData(x1, m_x1.get<Real_type>(), iend); \
+  allocAndInitHipDeviceData(x2, m_x2.get<Real_type>(), iend);
 
 #define IF_QUAD_DATA_TEARDOWN_HIP \
-  getHipDeviceData(m_x1, x1, iend); \
-  getHipDeviceData(m_x2, x2, iend); \
+  getHipDeviceData(m_x1.get<Real_type>(), x1, iend); \
+  getHipDeviceData(m_x2.get<Real_type>(), x2, iend); \
   deallocHipDeviceData(a); \
   deallocHipDeviceData(b); \
   deallocHipDeviceData(c); \
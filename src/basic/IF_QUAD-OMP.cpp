@@ -18,18 +18,19 @@ namespace basic
 {
 
 
-void IF_QUAD::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void IF_QUAD::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  IF_QUAD_DATA_SETUP;
+  IF_QUAD_DATA_SETUP_TYPED(Data_type);
 
   auto ifquad_lam = [=](Index_type i) {
-                      IF_QUAD_BODY;
+                      IF_QUAD_BODY_TYPED(Data_type);
                     };
 
   switch ( vid ) {
@@ -41,7 +42,7 @@ void IF_QUAD::runOpenMPVariant(VariantID vid)
 
         #pragma omp parallel for
         for (Index_type i = ibegin; i < iend; ++i ) {
-          IF_QUAD_BODY;
+          IF_QUAD_BODY_TYPED(Data_type);
         }
 
       }
@@ -85,6 +86,18 @@ void IF_QUAD::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void IF_QUAD::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
@@ -30,15 +30,15 @@ namespace basic
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(a, m_a, iend, did, hid); \
-  allocAndInitOpenMPDeviceData(b, m_b, iend, did, hid); \
-  allocAndInitOpenMPDeviceData(c, m_c, iend, did, hid); \
-  allocAndInitOpenMPDeviceData(x1, m_x1, iend, did, hid); \
-  allocAndInitOpenMPDeviceData(x2, m_x2, iend, did, hid);
+  allocAndInitOpenMPDeviceData(a, m_a.get<Real_type>(), iend, did, hid); \
+  allocAndInitOpenMPDeviceData(b, m_b.get<Real_type>(), iend, did, hid); \
+  allocAndInitOpenMPDeviceData(c, m_c.get<Real_type>(), iend, did, hid); \
+  allocAndInitOpenMPDeviceData(x1, m_x1.get<Real_type>(), iend, did, hid); \
+  allocAndInitOpenMPDeviceData(x2, m_x2.get<Real_type>(), iend, did, hid);
 
 #define IF_QUAD_DATA_TEARDOWN_OMP_TARGET \
-  getOpenMPDeviceData(m_x1, x1, iend, hid, did); \
-  getOpenMPDeviceData(m_x2, x2, iend, hid, did); \
+  getOpenMPDeviceData(m_x1.get<Real_type>(), x1, iend, hid, did); \
+  getOpenMPDeviceData(m_x2.get<Real_type>(), x2, iend, hid, did); \
   deallocOpenMPDeviceData(a, did); \
   deallocOpenMPDeviceData(b, did); \
   deallocOpenMPDeviceData(c, did); \
@@ -18,16 +18,17 @@ namespace basic
 {
 
 
-void IF_QUAD::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void IF_QUAD::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  IF_QUAD_DATA_SETUP;
+  IF_QUAD_DATA_SETUP_TYPED(Data_type);
 
   auto ifquad_lam = [=](Index_type i) {
-                      IF_QUAD_BODY;
+                      IF_QUAD_BODY_TYPED(Data_type);
                     };
 
   switch ( vid ) {
@@ -38,7 +39,7 @@ void IF_QUAD::runSeqVariant(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         for (Index_type i = ibegin; i < iend; ++i ) {
-          IF_QUAD_BODY;
+          IF_QUAD_BODY_TYPED(Data_type);
         }
 
       }
@@ -86,5 +87,13 @@ void IF_QUAD::runSeqVariant(VariantID vid)
 
 }
 
+void IF_QUAD::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
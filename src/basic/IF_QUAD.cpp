@@ -12,6 +12,8 @@
 
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 namespace basic
@@ -55,6 +57,17 @@ IF_QUAD::IF_QUAD(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (2*data_size + 3*data_size) * getActualProblemSize() );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 IF_QUAD::~IF_QUAD()
@@ -63,11 +76,13 @@ IF_QUAD::~IF_QUAD()
 
 void IF_QUAD::setUp(VariantID vid)
 {
-  allocAndInitDataRandSign(m_a, getActualProblemSize(), vid);
-  allocAndInitData(m_b, getActualProblemSize(), vid);
-  allocAndInitData(m_c, getActualProblemSize(), vid);
-  allocAndInitDataConst(m_x1, getActualProblemSize(), 0.0, vid);
-  allocAndInitDataConst(m_x2, getActualProblemSize(), 0.0, vid);
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitDataRandSign(m_a, getActualProblemSize(), pid, vid);
+  allocAndInitData(m_b, getActualProblemSize(), pid, vid);
+  allocAndInitData(m_c, getActualProblemSize(), pid, vid);
+  allocAndInitDataConst(m_x1, getActualProblemSize(), 0.0, pid, vid);
+  allocAndInitDataConst(m_x2, getActualProblemSize(), 0.0, pid, vid);
 }
 
 void IF_QUAD::updateChecksum(VariantID vid)
@@ -25,15 +25,17 @@
 #ifndef RAJAPerf_Basic_IF_QUAD_HPP
 #define RAJAPerf_Basic_IF_QUAD_HPP
 
-#define IF_QUAD_DATA_SETUP \
-  Real_ptr a = m_a; \
-  Real_ptr b = m_b; \
-  Real_ptr c = m_c; \
-  Real_ptr x1 = m_x1; \
-  Real_ptr x2 = m_x2;
-
-#define IF_QUAD_BODY  \
-  Real_type s = b[i]*b[i] - 4.0*a[i]*c[i]; \
+#define IF_QUAD_DATA_SETUP_TYPED(Data_type) \
+  Data_type* a = m_a.get<Data_type>(); \
+  Data_type* b = m_b.get<Data_type>(); \
+  Data_type* c = m_c.get<Data_type>(); \
+  Data_type* x1 = m_x1.get<Data_type>(); \
+  Data_type* x2 = m_x2.get<Data_type>();
+
+#define IF_QUAD_DATA_SETUP IF_QUAD_DATA_SETUP_TYPED(Real_type)
+
+#define IF_QUAD_BODY_TYPED(Data_type)  \
+  Data_type s = b[i]*b[i] - 4.0*a[i]*c[i]; \
   if ( s >= 0 ) { \
     s = sqrt(s); \
     x2[i] = (-b[i]+s)/(2.0*a[i]); \
@@ -43,6 +45,8 @@
     x1[i] = 0.0; \
   }
 
+#define IF_QUAD_BODY IF_QUAD_BODY_TYPED(Real_type)
+
 #include "common/KernelBase.hpp"
 
 namespace rajaperf
@@ -71,11 +75,16 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
-  Real_ptr m_a;
-  Real_ptr m_b;
-  Real_ptr m_c;
-  Real_ptr m_x1;
-  Real_ptr m_x2;
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_a;
+  Precision_ptr m_b;
+  Precision_ptr m_c;
+  Precision_ptr m_x1;
+  Precision_ptr m_x2;
 };
 
 } // end namespace basic
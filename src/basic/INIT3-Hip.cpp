@@ -28,16 +28,16 @@ namespace basic
 
 
 #define INIT3_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(out1, m_out1, iend); \
-  allocAndInitHipDeviceData(out2, m_out2, iend); \
-  allocAndInitHipDeviceData(out3, m_out3, iend); \
-  allocAndInitHipDeviceData(in1, m_in1, iend); \
-  allocAndInitHipDeviceData(in2, m_in2, iend);
+  allocAndInitHipDeviceData(out1, m_out1.get<Real_type>(), iend); \
+  allocAndInitHipDeviceData(out2, m_out2.get<Real_type>(), iend); \
+  allocAndInitHipDeviceData(out3, m_out3.get<Real_type>(), iend); \
+  allocAndInitHipDeviceData(in1, m_in1.get<Real_type>(), iend); \
+  allocAndInitHipDeviceData(in2, m_in2.get<Real_type>(), iend);
 
 #define INIT3_DATA_TEARDOWN_HIP \
-  getHipDeviceData(m_out1, out1, iend); \
-  getHipDeviceData(m_out2, out2, iend); \
-  getHipDeviceData(m_out3, out3, iend); \
+  getHipDeviceData(m_out1.get<Real_type>(), out1, iend); \
+  getHipDeviceData(m_out2.get<Real_type>(), out2, iend); \
+  getHipDeviceData(m_out3.get<Real_type>(), out3, iend); \
   deallocHipDeviceData(out1); \
   deallocHipDeviceData(out2); \
   deallocHipDeviceData(out3); \
@@ -30,16 +30,16 @@ namespace basic
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(out1, m_out1, iend, did, hid); \
-  allocAndInitOpenMPDeviceData(out2, m_out2, iend, did, hid); \
-  allocAndInitOpenMPDeviceData(out3, m_out3, iend, did, hid); \
-  allocAndInitOpenMPDeviceData(in1, m_in1, iend, did, hid); \
-  allocAndInitOpenMPDeviceData(in2, m_in2, iend, did, hid);
+  allocAndInitOpenMPDeviceData(out1, m_out1.get<Real_type>(), iend, did, hid); \
+  allocAndInitOpenMPDeviceData(out2, m_out2.get<Real_type>(), iend, did, hid); \
+  allocAndInitOpenMPDeviceData(out3, m_out3.get<Real_type>(), iend, did, hid); \
+  allocAndInitOpenMPDeviceData(in1, m_in1.get<Real_type>(), iend, did, hid); \
+  allocAndInitOpenMPDeviceData(in2, m_in2.get<Real_type>(), iend, did, hid);
 
 #define INIT3_DATA_TEARDOWN_OMP_TARGET \
-  getOpenMPDeviceData(m_out1, out1, iend, hid, did); \
-  getOpenMPDeviceData(m_out2, out2, iend, hid, did); \
-  getOpenMPDeviceData(m_out3, out3, iend, hid, did); \
+  getOpenMPDeviceData(m_out1.get<Real_type>(), out1, iend, hid, did); \
+  getOpenMPDeviceData(m_out2.get<Real_type>(), out2, iend, hid, did); \
+  getOpenMPDeviceData(m_out3.get<Real_type>(), out3, iend, hid, did); \
   deallocOpenMPDeviceData(out1, did); \
   deallocOpenMPDeviceData(out2, did); \
   deallocOpenMPDeviceData(out3, did); \
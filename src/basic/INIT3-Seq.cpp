@@ -18,13 +18,14 @@ namespace basic
 {
 
 
-void INIT3::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void INIT3::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  INIT3_DATA_SETUP;
+  INIT3_DATA_SETUP_TYPED(Data_type);
 
   auto init3_lam = [=](Index_type i) {
                      INIT3_BODY;
@@ -86,5 +87,13 @@ void INIT3::runSeqVariant(VariantID vid)
 
 }
 
+void INIT3::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -18,12 +18,14 @@
 #define RAJAPerf_Basic_INIT3_HPP
 
 
-#define INIT3_DATA_SETUP \
-  Real_ptr out1 = m_out1; \
-  Real_ptr out2 = m_out2; \
-  Real_ptr out3 = m_out3; \
-  Real_ptr in1 = m_in1; \
-  Real_ptr in2 = m_in2;
+#define INIT3_DATA_SETUP_TYPED(Data_type) \
+  Data_type* out1 = m_out1.get<Data_type>(); \
+  Data_type* out2 = m_out2.get<Data_type>(); \
+  Data_type* out3 = m_out3.get<Data_type>(); \
+  Data_type* in1 = m_in1.get<Data_type>(); \
+  Data_type* in2 = m_in2.get<Data_type>();
+
+#define INIT3_DATA_SETUP INIT3_DATA_SETUP_TYPED(Real_type)
 
 #define INIT3_BODY  \
   out1[i] = out2[i] = out3[i] = - in1[i] - in2[i] ;
@@ -57,11 +59,16 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
-  Real_ptr m_out1;
-  Real_ptr m_out2;
-  Real_ptr m_out3;
-  Real_ptr m_in1;
-  Real_ptr m_in2;
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_out1;
+  Precision_ptr m_out2;
+  Precision_ptr m_out3;
+  Precision_ptr m_in1;
+  Precision_ptr m_in2;
 };
 
 } // end namespace basic
@@ -28,10 +28,10 @@ namespace basic
 
 
 #define INIT_VIEW1D_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(a, m_a, iend);
+  allocAndInitHipDeviceData(a, m_a.get<Real_type>(), iend);
 
 #define INIT_VIEW1D_DATA_TEARDOWN_HIP \
-  getHipDeviceData(m_a, a, iend); \
+  getHipDeviceData(m_a.get<Real_type>(), a, iend); \
   deallocHipDeviceData(a);
 
 __global__ void initview1d(Real_ptr a,
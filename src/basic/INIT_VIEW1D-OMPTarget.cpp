@@ -30,10 +30,10 @@ namespace basic
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(a, m_a, getActualProblemSize(), did, hid);
+  allocAndInitOpenMPDeviceData(a, m_a.get<Real_type>(), getActualProblemSize(), did, hid);
 
 #define INIT_VIEW1D_DATA_TEARDOWN_OMP_TARGET \
-  getOpenMPDeviceData(m_a, a, getActualProblemSize(), hid, did); \
+  getOpenMPDeviceData(m_a.get<Real_type>(), a, getActualProblemSize(), hid, did); \
   deallocOpenMPDeviceData(a, did);
 
 
@@ -18,13 +18,14 @@ namespace basic
 {
 
 
-void INIT_VIEW1D::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void INIT_VIEW1D::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  INIT_VIEW1D_DATA_SETUP;
+  INIT_VIEW1D_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -65,7 +66,7 @@ void INIT_VIEW1D::runSeqVariant(VariantID vid)
 
     case RAJA_Seq : {
 
-      INIT_VIEW1D_VIEW_RAJA;
+      INIT_VIEW1D_VIEW_RAJA_TYPED(Data_type);
 
       auto initview1d_lam = [=](Index_type i) {
                               INIT_VIEW1D_BODY_RAJA;
@@ -92,5 +93,13 @@ void INIT_VIEW1D::runSeqVariant(VariantID vid)
 
 }
 
+void INIT_VIEW1D::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
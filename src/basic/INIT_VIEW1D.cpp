@@ -12,6 +12,8 @@
 
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 namespace basic
@@ -52,6 +54,17 @@ INIT_VIEW1D::INIT_VIEW1D(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (1*data_size + 0*data_size) * getActualProblemSize() );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 INIT_VIEW1D::~INIT_VIEW1D()
@@ -60,7 +73,9 @@ INIT_VIEW1D::~INIT_VIEW1D()
 
 void INIT_VIEW1D::setUp(VariantID vid)
 {
-  allocAndInitDataConst(m_a, getActualProblemSize(), 0.0, vid);
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitDataConst(m_a, getActualProblemSize(), 0.0, pid, vid);
   m_val = 0.00000123;
 }
 
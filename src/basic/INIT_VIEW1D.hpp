@@ -24,9 +24,11 @@
 #define RAJAPerf_Basic_INIT_VIEW1D_HPP
 
 
-#define INIT_VIEW1D_DATA_SETUP \
-  Real_ptr a = m_a; \
-  const Real_type v = m_val;
+#define INIT_VIEW1D_DATA_SETUP_TYPED(Data_type) \
+  Data_type* a = m_a.get<Data_type>(); \
+  const Data_type v = m_val;
+
+#define INIT_VIEW1D_DATA_SETUP INIT_VIEW1D_DATA_SETUP_TYPED(Real_type)
 
 #define INIT_VIEW1D_BODY  \
   a[i] = (i+1) * v;
@@ -34,11 +36,13 @@
 #define INIT_VIEW1D_BODY_RAJA  \
   view(i) = (i+1) * v;
 
-#define INIT_VIEW1D_VIEW_RAJA \
-  using ViewType = RAJA::View<Real_type, RAJA::Layout<1, Index_type, 0> >; \
+#define INIT_VIEW1D_VIEW_RAJA_TYPED(Data_type) \
+  using ViewType = RAJA::View<Data_type, RAJA::Layout<1, Index_type, 0> >; \
   const RAJA::Layout<1> my_layout(iend); \
   ViewType view(a, my_layout);
 
+#define INIT_VIEW1D_VIEW_RAJA INIT_VIEW1D_VIEW_RAJA_TYPED(Real_type)
+
 
 #include "common/KernelBase.hpp"
 
@@ -68,7 +72,12 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
-  Real_ptr m_a;
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_a;
   Real_type m_val;
 };
 
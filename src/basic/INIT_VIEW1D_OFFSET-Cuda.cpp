@@ -28,10 +28,10 @@ namespace basic
 
 
 #define INIT_VIEW1D_OFFSET_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(a, m_a, getActualProblemSize());
+  allocAndInitCudaDeviceData(a, m_a.get<Real_type>(), getActualProblemSize());
 
 #define INIT_VIEW1D_OFFSET_DATA_TEARDOWN_CUDA \
-  getCudaDeviceData(m_a, a, getActualProblemSize()); \
+  getCudaDeviceData(m_a.get<Real_type>(), a, getActualProblemSize()); \
   deallocCudaDeviceData(a);
 
 __global__ void initview1d_offset(Real_ptr a,
@@ -28,10 +28,10 @@ namespace basic
 
 
 #define INIT_VIEW1D_OFFSET_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(a, m_a, getActualProblemSize());
+  allocAndInitHipDeviceData(a, m_a.get<Real_type>(), getActualProblemSize());
 
 #define INIT_VIEW1D_OFFSET_DATA_TEARDOWN_HIP \
-  getHipDeviceData(m_a, a, getActualProblemSize()); \
+  getHipDeviceData(m_a.get<Real_type>(), a, getActualProblemSize()); \
   deallocHipDeviceData(a);
 
 __global__ void initview1d_offset(Real_ptr a,
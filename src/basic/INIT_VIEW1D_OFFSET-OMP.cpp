@@ -18,15 +18,16 @@ namespace basic
 {
 
 
-void INIT_VIEW1D_OFFSET::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void INIT_VIEW1D_OFFSET::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 1;
   const Index_type iend = getActualProblemSize()+1;
 
-  INIT_VIEW1D_OFFSET_DATA_SETUP;
+  INIT_VIEW1D_OFFSET_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -68,7 +69,7 @@ void INIT_VIEW1D_OFFSET::runOpenMPVariant(VariantID vid)
 
     case RAJA_OpenMP : {
 
-      INIT_VIEW1D_OFFSET_VIEW_RAJA;
+      INIT_VIEW1D_OFFSET_VIEW_RAJA_TYPED(Data_type);
 
       auto initview1doffset_lam = [=](Index_type i) {
                                     INIT_VIEW1D_OFFSET_BODY_RAJA;
@@ -91,6 +92,18 @@ void INIT_VIEW1D_OFFSET::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void INIT_VIEW1D_OFFSET::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
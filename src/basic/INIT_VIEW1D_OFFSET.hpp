@@ -24,9 +24,11 @@
 #define RAJAPerf_Basic_INIT_VIEW1D_OFFSET_HPP
 
 
-#define INIT_VIEW1D_OFFSET_DATA_SETUP \
-  Real_ptr a = m_a; \
-  const Real_type v = m_val;
+#define INIT_VIEW1D_OFFSET_DATA_SETUP_TYPED(Data_type) \
+  Data_type* a = m_a.get<Data_type>(); \
+  const Data_type v = m_val;
+
+#define INIT_VIEW1D_OFFSET_DATA_SETUP INIT_VIEW1D_OFFSET_DATA_SETUP_TYPED(Real_type)
 
 #define INIT_VIEW1D_OFFSET_BODY  \
     a[i-ibegin] = i * v;
@@ -34,10 +36,12 @@
 #define INIT_VIEW1D_OFFSET_BODY_RAJA  \
     view(i) = i * v;
 
-#define INIT_VIEW1D_OFFSET_VIEW_RAJA  \
-  using ViewType = RAJA::View<Real_type, RAJA::OffsetLayout<1> >; \
+#define INIT_VIEW1D_OFFSET_VIEW_RAJA_TYPED(Data_type)  \
+  using ViewType = RAJA::View<Data_type, RAJA::OffsetLayout<1> >; \
   ViewType view(a, RAJA::make_offset_layout<1>({{1}}, {{iend+1}}));
 
+#define INIT_VIEW1D_OFFSET_VIEW_RAJA INIT_VIEW1D_OFFSET_VIEW_RAJA_TYPED(Real_type)
+
 
 #include "common/KernelBase.hpp"
 
@@ -67,7 +71,12 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
-  Real_ptr m_a;
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_a;
   Real_type m_val;
 };
 
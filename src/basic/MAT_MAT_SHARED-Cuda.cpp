@@ -21,14 +21,14 @@ namespace basic {
 
 #define MAT_MAT_SHARED_DATA_SETUP_CUDA                                         \
   const Index_type NN = m_N * m_N;                                             \
-  allocAndInitCudaDeviceData(A, m_A, NN);                                      \
-  allocAndInitCudaDeviceData(B, m_B, NN);                                      \
-  allocAndInitCudaDeviceData(C, m_C, NN);
+  allocAndInitCudaDeviceData(A, m_A.get<Real_type>(), NN);                                      \
+  allocAndInitCudaDeviceData(B, m_B.get<Real_type>(), NN);                                      \
+  allocAndInitCudaDeviceData(C, m_C.get<Real_type>(), NN);
 
 #define MAT_MAT_SHARED_DATA_TEARDOWN_CUDA                                      \
-  getCudaDeviceData(m_A, A, NN);                                               \
-  getCudaDeviceData(m_B, B, NN);                                               \
-  getCudaDeviceData(m_C, C, NN);                                               \
+  getCudaDeviceData(m_A.get<Real_type>(), A, NN);                                               \
+  getCudaDeviceData(m_B.get<Real_type>(), B, NN);                                               \
+  getCudaDeviceData(m_C.get<Real_type>(), C, NN);                                               \
   deallocCudaDeviceData(A);                                                    \
   deallocCudaDeviceData(B);                                                    \
   deallocCudaDeviceData(C);
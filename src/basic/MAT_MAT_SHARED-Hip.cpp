@@ -21,14 +21,14 @@ namespace basic {
 
 #define MAT_MAT_SHARED_DATA_SETUP_HIP                                          \
   const Index_type NN = m_N * m_N;                                             \
-  allocAndInitHipDeviceData(A, m_A, NN);                                       \
-  allocAndInitHipDeviceData(B, m_B, NN);                                       \
-  allocAndInitHipDeviceData(C, m_C, NN);
+  allocAndInitHipDeviceData(A, m_A.get<Real_type>(), NN);                                       \
+  allocAndInitHipDeviceData(B, m_B.get<Real_type>(), NN);                                       \
+  allocAndInitHipDeviceData(C, m_C.get<Real_type>(), NN);
 
 #define MAT_MAT_SHARED_DATA_TEARDOWN_HIP                                       \
-  getHipDeviceData(m_A, A, NN);                                                \
-  getHipDeviceData(m_B, B, NN);                                                \
-  getHipDeviceData(m_C, C, NN);                                                \
+  getHipDeviceData(m_A.get<Real_type>(), A, NN);                                                \
+  getHipDeviceData(m_B.get<Real_type>(), B, NN);                                                \
+  getHipDeviceData(m_C.get<Real_type>(), C, NN);                                                \
   deallocHipDeviceData(A);                                                     \
   deallocHipDeviceData(B);                                                     \
   deallocHipDeviceData(C);
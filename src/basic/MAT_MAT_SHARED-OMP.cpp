@@ -15,13 +15,14 @@
 namespace rajaperf {
 namespace basic {
 
-void MAT_MAT_SHARED::runOpenMPVariant(VariantID vid) {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void MAT_MAT_SHARED::runOpenMPVariantPrecision(VariantID vid) {
   const Index_type run_reps = getRunReps();
   const Index_type N = m_N;
 
-  MAT_MAT_SHARED_DATA_SETUP;
+  MAT_MAT_SHARED_DATA_SETUP_TYPED(Data_type);
 
   const Index_type Nx = RAJA_DIVIDE_CEILING_INT(N, TL_SZ);
   const Index_type Ny = RAJA_DIVIDE_CEILING_INT(N, TL_SZ);
@@ -39,7 +40,7 @@ void MAT_MAT_SHARED::runOpenMPVariant(VariantID vid) {
         for (Index_type by = 0; by < Ny; ++by) {
           for (Index_type bx = 0; bx < Nx; ++bx) {
 
-            MAT_MAT_SHARED_BODY_0
+            MAT_MAT_SHARED_BODY_0_TYPED(Data_type)
 
             for (Index_type ty = 0; ty < TL_SZ; ++ty) {
               for (Index_type tx = 0; tx < TL_SZ; ++tx) {
@@ -85,7 +86,7 @@ void MAT_MAT_SHARED::runOpenMPVariant(VariantID vid) {
 
       auto outer_y = [&](Index_type by) {
         auto outer_x = [&](Index_type bx) {
-          MAT_MAT_SHARED_BODY_0
+          MAT_MAT_SHARED_BODY_0_TYPED(Data_type)
 
           auto inner_y_1 = [&](Index_type ty) {
             auto inner_x_1 = [&](Index_type tx) { MAT_MAT_SHARED_BODY_1 };
@@ -201,7 +202,7 @@ void MAT_MAT_SHARED::runOpenMPVariant(VariantID vid) {
               RAJA::expt::loop<outer_x>(ctx, RAJA::RangeSegment(0, Nx),
                 [&](Index_type bx) {
 
-                  MAT_MAT_SHARED_BODY_0
+                  MAT_MAT_SHARED_BODY_0_TYPED(Data_type)
 
                   RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, TL_SZ),
                     [&](Index_type ty) {
@@ -270,6 +271,17 @@ void MAT_MAT_SHARED::runOpenMPVariant(VariantID vid) {
               << std::endl;
   }
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void MAT_MAT_SHARED::runOpenMPVariant(VariantID vid) {
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
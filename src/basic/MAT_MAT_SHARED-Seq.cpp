@@ -13,12 +13,13 @@
 namespace rajaperf {
 namespace basic {
 
-void MAT_MAT_SHARED::runSeqVariant(VariantID vid) {
+template < typename Data_type >
+void MAT_MAT_SHARED::runSeqVariantPrecision(VariantID vid) {
 
   const Index_type run_reps = getRunReps();
   const Index_type N = m_N;
 
-  MAT_MAT_SHARED_DATA_SETUP;
+  MAT_MAT_SHARED_DATA_SETUP_TYPED(Data_type);
   const Index_type Nx = RAJA_DIVIDE_CEILING_INT(N, TL_SZ);
   const Index_type Ny = RAJA_DIVIDE_CEILING_INT(N, TL_SZ);
 
@@ -34,7 +35,7 @@ void MAT_MAT_SHARED::runSeqVariant(VariantID vid) {
 
           //Work around for when compiling with CLANG and HIP
           //See notes in MAT_MAT_SHARED.hpp
-          MAT_MAT_SHARED_BODY_0_CLANG_HIP_CPU
+          MAT_MAT_SHARED_BODY_0_CLANG_HIP_CPU_TYPED(Data_type)
 
           for (Index_type ty = 0; ty < TL_SZ; ++ty) {
             for (Index_type tx = 0; tx < TL_SZ; ++tx) {
@@ -82,7 +83,7 @@ void MAT_MAT_SHARED::runSeqVariant(VariantID vid) {
       auto outer_y = [&](Index_type by) {
         auto outer_x = [&](Index_type bx) {
 
-          MAT_MAT_SHARED_BODY_0_CLANG_HIP_CPU
+          MAT_MAT_SHARED_BODY_0_CLANG_HIP_CPU_TYPED(Data_type)
 
           auto inner_y_1 = [&](Index_type ty) {
             auto inner_x_1 = [&](Index_type tx) { MAT_MAT_SHARED_BODY_1 };
@@ -198,7 +199,7 @@ void MAT_MAT_SHARED::runSeqVariant(VariantID vid) {
               RAJA::expt::loop<outer_x>(ctx, RAJA::RangeSegment(0, Nx),
                 [&](Index_type bx) {
 
-                  MAT_MAT_SHARED_BODY_0
+                  MAT_MAT_SHARED_BODY_0_TYPED(Data_type)
 
                   RAJA::expt::loop<inner_y>(ctx, RAJA::RangeSegment(0, TL_SZ),
 
@@ -271,5 +272,12 @@ void MAT_MAT_SHARED::runSeqVariant(VariantID vid) {
   }
 }
 
+void MAT_MAT_SHARED::runSeqVariant(VariantID vid) {
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -12,6 +12,8 @@
 
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 #include <algorithm>
 
 namespace rajaperf {
@@ -61,16 +63,29 @@ MAT_MAT_SHARED::MAT_MAT_SHARED(const RunParams &params)
   setVariantDefined(Base_HIP);
   setVariantDefined(Lambda_HIP);
   setVariantDefined(RAJA_HIP);
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    m_N*m_N*data_size +
+                    m_N*m_N*data_size );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 MAT_MAT_SHARED::~MAT_MAT_SHARED() {}
 
 void MAT_MAT_SHARED::setUp(VariantID vid) {
+  const PrecisionID pid = getRunningPrecision();
   const Index_type NN = m_N * m_N;
 
-  allocAndInitDataConst(m_A, NN, 1.0, vid);
-  allocAndInitDataConst(m_B, NN, 1.0, vid);
-  allocAndInitDataConst(m_C, NN, 0.0, vid);
+  allocAndInitDataConst(m_A, NN, 1.0, pid, vid);
+  allocAndInitDataConst(m_B, NN, 1.0, pid, vid);
+  allocAndInitDataConst(m_C, NN, 0.0, pid, vid);
 }
 
 void MAT_MAT_SHARED::updateChecksum(VariantID vid) {
@@ -71,10 +71,12 @@
 
 constexpr rajaperf::Index_type TL_SZ = 16;
 
-#define MAT_MAT_SHARED_DATA_SETUP                                              \
-  Real_ptr A = m_A;                                                            \
-  Real_ptr B = m_B;                                                            \
-  Real_ptr C = m_C;
+#define MAT_MAT_SHARED_DATA_SETUP_TYPED(Data_type)                                              \
+  Data_type* A = m_A.get<Data_type>();                                                            \
+  Data_type* B = m_B.get<Data_type>();                                                            \
+  Data_type* C = m_C.get<Data_type>();
+
+#define MAT_MAT_SHARED_DATA_SETUP MAT_MAT_SHARED_DATA_SETUP_TYPED(Real_type)
 
 /*
  When doing the device compile pass hipcc/clang will put in the device
@@ -84,15 +86,20 @@ constexpr rajaperf::Index_type TL_SZ = 16;
  functions. Nvcc doesn't look at host only code when it does the device pass
  so it doesn't see these kind of problems.
  */
-#define MAT_MAT_SHARED_BODY_0_CLANG_HIP_CPU                   \
-  double As[TL_SZ][TL_SZ];                                    \
-  double Bs[TL_SZ][TL_SZ];                                    \
-  double Cs[TL_SZ][TL_SZ];
+#define MAT_MAT_SHARED_BODY_0_CLANG_HIP_CPU_TYPED(Data_type)  \
+  Data_type As[TL_SZ][TL_SZ];                                 \
+  Data_type Bs[TL_SZ][TL_SZ];                                 \
+  Data_type Cs[TL_SZ][TL_SZ];
+
+#define MAT_MAT_SHARED_BODY_0_CLANG_HIP_CPU \
+  MAT_MAT_SHARED_BODY_0_CLANG_HIP_CPU_TYPED(Real_type)
+
+#define MAT_MAT_SHARED_BODY_0_TYPED(Data_type)                                 \
+  RAJA_TEAM_SHARED Data_type As[TL_SZ][TL_SZ];                                 \
+  RAJA_TEAM_SHARED Data_type Bs[TL_SZ][TL_SZ];                                 \
+  RAJA_TEAM_SHARED Data_type Cs[TL_SZ][TL_SZ];
 
-#define MAT_MAT_SHARED_BODY_0                                                  \
-  RAJA_TEAM_SHARED double As[TL_SZ][TL_SZ];                                    \
-  RAJA_TEAM_SHARED double Bs[TL_SZ][TL_SZ];                                    \
-  RAJA_TEAM_SHARED double Cs[TL_SZ][TL_SZ];
+#define MAT_MAT_SHARED_BODY_0 MAT_MAT_SHARED_BODY_0_TYPED(Real_type)
 
 #define MAT_MAT_SHARED_BODY_1 Cs[ty][tx] = 0;
 
@@ -156,9 +163,14 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
-  Real_ptr m_A;
-  Real_ptr m_B;
-  Real_ptr m_C;
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_A;
+  Precision_ptr m_B;
+  Precision_ptr m_C;
 
   Index_type m_N;
   Index_type m_N_default;
@@ -28,16 +28,16 @@ namespace basic
 
 
 #define MULADDSUB_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(out1, m_out1, iend); \
-  allocAndInitCudaDeviceData(out2, m_out2, iend); \
-  allocAndInitCudaDeviceData(out3, m_out3, iend); \
-  allocAndInitCudaDeviceData(in1, m_in1, iend); \
-  allocAndInitCudaDeviceData(in2, m_in2, iend);
+  allocAndInitCudaDeviceData(out1, m_out1.get<Real_type>(), iend); \
+  allocAndInitCudaDeviceData(out2, m_out2.get<Real_type>(), iend); \
+  allocAndInitCudaDeviceData(out3, m_out3.get<Real_type>(), iend); \
+  allocAndInitCudaDeviceData(in1, m_in1.get<Real_type>(), iend); \
+  allocAndInitCudaDeviceData(in2, m_in2.get<Real_type>(), iend);
 
 #define MULADDSUB_DATA_TEARDOWN_CUDA \
-  getCudaDeviceData(m_out1, out1, iend); \
-  getCudaDeviceData(m_out2, out2, iend); \
-  getCudaDeviceData(m_out3, out3, iend); \
+  getCudaDeviceData(m_out1.get<Real_type>(), out1, iend); \
+  getCudaDeviceData(m_out2.get<Real_type>(), out2, iend); \
+  getCudaDeviceData(m_out3.get<Real_type>(), out3, iend); \
   deallocCudaDeviceData(out1); \
   deallocCudaDeviceData(out2); \
   deallocCudaDeviceData(out3); \
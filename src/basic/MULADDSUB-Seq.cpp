@@ -18,13 +18,14 @@ namespace basic
 {
 
 
-void MULADDSUB::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void MULADDSUB::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  MULADDSUB_DATA_SETUP;
+  MULADDSUB_DATA_SETUP_TYPED(Data_type);
 
   auto mas_lam = [=](Index_type i) {
                    MULADDSUB_BODY;
@@ -86,5 +87,13 @@ void MULADDSUB::runSeqVariant(VariantID vid)
 
 }
 
+void MULADDSUB::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
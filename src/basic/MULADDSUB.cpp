@@ -12,6 +12,8 @@
 
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 namespace basic
@@ -51,6 +53,17 @@ MULADDSUB::MULADDSUB(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (3*data_size + 2*data_size) * getActualProblemSize() );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 MULADDSUB::~MULADDSUB()
@@ -59,11 +72,13 @@ MULADDSUB::~MULADDSUB()
 
 void MULADDSUB::setUp(VariantID vid)
 {
-  allocAndInitDataConst(m_out1, getActualProblemSize(), 0.0, vid);
-  allocAndInitDataConst(m_out2, getActualProblemSize(), 0.0, vid);
-  allocAndInitDataConst(m_out3, getActualProblemSize(), 0.0, vid);
-  allocAndInitData(m_in1, getActualProblemSize(), vid);
-  allocAndInitData(m_in2, getActualProblemSize(), vid);
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitDataConst(m_out1, getActualProblemSize(), 0.0, pid, vid);
+  allocAndInitDataConst(m_out2, getActualProblemSize(), 0.0, pid, vid);
+  allocAndInitDataConst(m_out3, getActualProblemSize(), 0.0, pid, vid);
+  allocAndInitData(m_in1, getActualProblemSize(), pid, vid);
+  allocAndInitData(m_in2, getActualProblemSize(), pid, vid);
 }
 
 void MULADDSUB::updateChecksum(VariantID vid)
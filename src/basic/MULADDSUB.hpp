@@ -19,12 +19,14 @@
 #ifndef RAJAPerf_Basic_MULADDSUB_HPP
 #define RAJAPerf_Basic_MULADDSUB_HPP
 
-#define MULADDSUB_DATA_SETUP \
-  Real_ptr out1 = m_out1; \
-  Real_ptr out2 = m_out2; \
-  Real_ptr out3 = m_out3; \
-  Real_ptr in1 = m_in1; \
-  Real_ptr in2 = m_in2;
+#define MULADDSUB_DATA_SETUP_TYPED(Data_type) \
+  Data_type* out1 = m_out1.get<Data_type>(); \
+  Data_type* out2 = m_out2.get<Data_type>(); \
+  Data_type* out3 = m_out3.get<Data_type>(); \
+  Data_type* in1 = m_in1.get<Data_type>(); \
+  Data_type* in2 = m_in2.get<Data_type>();
+
+#define MULADDSUB_DATA_SETUP MULADDSUB_DATA_SETUP_TYPED(Real_type)
 
 #define MULADDSUB_BODY  \
   out1[i] = in1[i] * in2[i] ; \
@@ -60,11 +62,16 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
-  Real_ptr m_out1;
-  Real_ptr m_out2;
-  Real_ptr m_out3;
-  Real_ptr m_in1;
-  Real_ptr m_in2;
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_out1;
+  Precision_ptr m_out2;
+  Precision_ptr m_out3;
+  Precision_ptr m_in1;
+  Precision_ptr m_in2;
 };
 
 } // end namespace basic
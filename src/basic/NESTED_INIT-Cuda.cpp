@@ -38,10 +38,10 @@ namespace basic
 
 
 #define NESTED_INIT_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(array, m_array, m_array_length);
+  allocAndInitCudaDeviceData(array, m_array.get<Real_type>(), m_array_length);
 
 #define NESTED_INIT_DATA_TEARDOWN_CUDA \
-  getCudaDeviceData(m_array, array, m_array_length); \
+  getCudaDeviceData(m_array.get<Real_type>(), array, m_array_length); \
   deallocCudaDeviceData(array);
 
 __global__ void nested_init(Real_ptr array,
@@ -38,10 +38,10 @@ namespace basic
 
 
 #define NESTED_INIT_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(array, m_array, m_array_length);
+  allocAndInitHipDeviceData(array, m_array.get<Real_type>(), m_array_length);
 
 #define NESTED_INIT_DATA_TEARDOWN_HIP \
-  getHipDeviceData(m_array, array, m_array_length); \
+  getHipDeviceData(m_array.get<Real_type>(), array, m_array_length); \
   deallocHipDeviceData(array);
 
 __global__ void nested_init(Real_ptr array,
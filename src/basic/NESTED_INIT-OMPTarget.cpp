@@ -25,10 +25,10 @@ namespace basic
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(array, m_array, m_array_length, did, hid);
+  allocAndInitOpenMPDeviceData(array, m_array.get<Real_type>(), m_array_length, did, hid);
 
 #define NESTED_INIT_DATA_TEARDOWN_OMP_TARGET \
-  getOpenMPDeviceData(m_array, array, m_array_length, hid, did); \
+  getOpenMPDeviceData(m_array.get<Real_type>(), array, m_array_length, hid, did); \
   deallocOpenMPDeviceData(array, did);
 
 
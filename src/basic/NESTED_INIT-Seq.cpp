@@ -18,11 +18,12 @@ namespace basic
 {
 
 
-void NESTED_INIT::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void NESTED_INIT::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
 
-  NESTED_INIT_DATA_SETUP;
+  NESTED_INIT_DATA_SETUP_TYPED(Data_type);
 
   auto nestedinit_lam = [=](Index_type i, Index_type j, Index_type k) {
                           NESTED_INIT_BODY;
@@ -106,5 +107,13 @@ void NESTED_INIT::runSeqVariant(VariantID vid)
 
 }
 
+void NESTED_INIT::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -12,6 +12,8 @@
 
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 namespace basic
@@ -62,6 +64,17 @@ NESTED_INIT::NESTED_INIT(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (1*data_size + 0*data_size) * getActualProblemSize() );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 NESTED_INIT::~NESTED_INIT()
@@ -70,7 +83,9 @@ NESTED_INIT::~NESTED_INIT()
 
 void NESTED_INIT::setUp(VariantID vid)
 {
-  allocAndInitDataConst(m_array, m_array_length, 0.0, vid);
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitDataConst(m_array, m_array_length, 0.0, pid, vid);
 }
 
 void NESTED_INIT::updateChecksum(VariantID vid)
@@ -81,8 +96,7 @@ void NESTED_INIT::updateChecksum(VariantID vid)
 void NESTED_INIT::tearDown(VariantID vid)
 {
   (void) vid;
-  RAJA::free_aligned(m_array);
-  m_array = 0;
+  deallocData(m_array);
 }
 
 } // end namespace basic
@@ -22,12 +22,14 @@
 #define RAJAPerf_Basic_NESTED_INIT_HPP
 
 
-#define NESTED_INIT_DATA_SETUP \
-  Real_ptr array = m_array; \
+#define NESTED_INIT_DATA_SETUP_TYPED(Data_type) \
+  Data_type* array = m_array.get<Data_type>(); \
   Index_type ni = m_ni; \
   Index_type nj = m_nj; \
   Index_type nk = m_nk;
 
+#define NESTED_INIT_DATA_SETUP NESTED_INIT_DATA_SETUP_TYPED(Real_type)
+
 #define NESTED_INIT_BODY  \
   array[i+ni*(j+nj*k)] = 0.00000001 * i * j * k ;
 
@@ -60,9 +62,14 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
   Index_type m_array_length;
 
-  Real_ptr m_array;
+  Precision_ptr m_array;
 
   Index_type m_ni;
   Index_type m_nj;
@@ -28,7 +28,7 @@ namespace basic
 
 
 #define PI_ATOMIC_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(pi, m_pi, 1);
+  allocAndInitCudaDeviceData(pi, m_pi.get<Real_type>(), 1);
 
 #define PI_ATOMIC_DATA_TEARDOWN_CUDA \
   deallocCudaDeviceData(pi);
@@ -66,8 +66,8 @@ void PI_ATOMIC::runCudaVariant(VariantID vid)
       pi_atomic<<<grid_size, block_size>>>( pi, dx, iend );
       cudaErrchk( cudaGetLastError() );
 
-      getCudaDeviceData(m_pi, pi, 1);
-      *m_pi *= 4.0;
+      getCudaDeviceData(m_pi.get<Real_type>(), pi, 1);
+      *m_pi.get<Real_type>() *= 4.0;
 
     }
     stopTimer();
@@ -91,8 +91,8 @@ void PI_ATOMIC::runCudaVariant(VariantID vid)
       });
       cudaErrchk( cudaGetLastError() );
 
-      getCudaDeviceData(m_pi, pi, 1);
-      *m_pi *= 4.0;
+      getCudaDeviceData(m_pi.get<Real_type>(), pi, 1);
+      *m_pi.get<Real_type>() *= 4.0;
 
     }
     stopTimer();
@@ -114,8 +114,8 @@ void PI_ATOMIC::runCudaVariant(VariantID vid)
           RAJA::atomicAdd<RAJA::cuda_atomic>(pi, dx / (1.0 + x * x));
       });
 
-      getCudaDeviceData(m_pi, pi, 1);
-      *m_pi *= 4.0;
+      getCudaDeviceData(m_pi.get<Real_type>(), pi, 1);
+      *m_pi.get<Real_type>() *= 4.0;
 
     }
     stopTimer();
@@ -28,7 +28,7 @@ namespace basic
 
 
 #define PI_ATOMIC_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(pi, m_pi, 1);
+  allocAndInitHipDeviceData(pi, m_pi.get<Real_type>(), 1);
 
 #define PI_ATOMIC_DATA_TEARDOWN_HIP \
   deallocHipDeviceData(pi);
@@ -66,8 +66,8 @@ void PI_ATOMIC::runHipVariant(VariantID vid)
       hipLaunchKernelGGL(atomic_pi,grid_size, block_size, 0, 0, pi, dx, iend );
       hipErrchk( hipGetLastError() );
 
-      getHipDeviceData(m_pi, pi, 1);
-      *m_pi *= 4.0;
+      getHipDeviceData(m_pi.get<Real_type>(), pi, 1);
+      *m_pi.get<Real_type>() *= 4.0;
 
     }
     stopTimer();
@@ -93,8 +93,8 @@ void PI_ATOMIC::runHipVariant(VariantID vid)
           grid_size, block_size, 0, 0, ibegin, iend, atomic_pi_lambda);
       hipErrchk( hipGetLastError() );
 
-      getHipDeviceData(m_pi, pi, 1);
-      *m_pi *= 4.0;
+      getHipDeviceData(m_pi.get<Real_type>(), pi, 1);
+      *m_pi.get<Real_type>() *= 4.0;
 
     }
     stopTimer();
@@ -116,8 +116,8 @@ void PI_ATOMIC::runHipVariant(VariantID vid)
           RAJA::atomicAdd<RAJA::hip_atomic>(pi, dx / (1.0 + x * x));
       });
 
-      getHipDeviceData(m_pi, pi, 1);
-      *m_pi *= 4.0;
+      getHipDeviceData(m_pi.get<Real_type>(), pi, 1);
+      *m_pi.get<Real_type>() *= 4.0;
 
     }
     stopTimer();
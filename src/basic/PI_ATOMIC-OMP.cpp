@@ -18,15 +18,16 @@ namespace basic
 {
 
 
-void PI_ATOMIC::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void PI_ATOMIC::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  PI_ATOMIC_DATA_SETUP;
+  PI_ATOMIC_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -38,7 +39,7 @@ void PI_ATOMIC::runOpenMPVariant(VariantID vid)
         *pi = m_pi_init;
         #pragma omp parallel for
         for (Index_type i = ibegin; i < iend; ++i ) {
-          double x = (double(i) + 0.5) * dx;
+          Data_type x = (Data_type(i) + 0.5) * dx;
           #pragma omp atomic
           *pi += dx / (1.0 + x * x);
         }
@@ -53,7 +54,7 @@ void PI_ATOMIC::runOpenMPVariant(VariantID vid)
     case Lambda_OpenMP : {
 
       auto piatomic_base_lam = [=](Index_type i) {
-                                 double x = (double(i) + 0.5) * dx;
+                                 Data_type x = (Data_type(i) + 0.5) * dx;
                                  #pragma omp atomic
                                  *pi += dx / (1.0 + x * x);
                                };
@@ -82,8 +83,8 @@ void PI_ATOMIC::runOpenMPVariant(VariantID vid)
         *pi = m_pi_init;
         RAJA::forall<RAJA::omp_parallel_for_exec>(
           RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
-            double x = (double(i) + 0.5) * dx;
-            RAJA::atomicAdd<RAJA::omp_atomic>(pi, dx / (1.0 + x * x));
+            Data_type x = (Data_type(i) + 0.5) * dx;
+            RAJA::atomicAdd<RAJA::omp_atomic>(pi, dx / (Data_type(1.0) + x * x));
         });
         *pi *= 4.0;
 
@@ -98,6 +99,18 @@ void PI_ATOMIC::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void PI_ATOMIC::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
@@ -30,7 +30,7 @@ namespace basic
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(pi, m_pi, 1, did, hid);
+  allocAndInitOpenMPDeviceData(pi, m_pi.get<Real_type>(), 1, did, hid);
 
 #define PI_ATOMIC_DATA_TEARDOWN_OMP_TARGET \
   deallocOpenMPDeviceData(pi, did);
@@ -61,8 +61,8 @@ void PI_ATOMIC::runOpenMPTargetVariant(VariantID vid)
         *pi += dx / (1.0 + x * x);
       }
 
-      getOpenMPDeviceData(m_pi, pi, 1, hid, did);
-      *m_pi *= 4.0;
+      getOpenMPDeviceData(m_pi.get<Real_type>(), pi, 1, hid, did);
+      *m_pi.get<Real_type>() *= 4.0;
 
     }
     stopTimer();
@@ -84,8 +84,8 @@ void PI_ATOMIC::runOpenMPTargetVariant(VariantID vid)
           RAJA::atomicAdd<RAJA::omp_atomic>(pi, dx / (1.0 + x * x));
       });
 
-      getOpenMPDeviceData(m_pi, pi, 1, hid, did);
-      *m_pi *= 4.0;
+      getOpenMPDeviceData(m_pi.get<Real_type>(), pi, 1, hid, did);
+      *m_pi.get<Real_type>() *= 4.0;
 
     }
     stopTimer();
@@ -18,13 +18,14 @@ namespace basic
 {
 
 
-void PI_ATOMIC::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void PI_ATOMIC::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  PI_ATOMIC_DATA_SETUP;
+  PI_ATOMIC_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -35,7 +36,7 @@ void PI_ATOMIC::runSeqVariant(VariantID vid)
 
         *pi = m_pi_init;
         for (Index_type i = ibegin; i < iend; ++i ) {
-          double x = (double(i) + 0.5) * dx;
+          Data_type x = (Data_type(i) + 0.5) * dx;
           *pi += dx / (1.0 + x * x);
         }
         *pi *= 4.0;
@@ -50,7 +51,7 @@ void PI_ATOMIC::runSeqVariant(VariantID vid)
     case Lambda_Seq : {
 
       auto piatomic_base_lam = [=](Index_type i) {
-                                 double x = (double(i) + 0.5) * dx;
+                                 Data_type x = (Data_type(i) + 0.5) * dx;
                                  *pi += dx / (1.0 + x * x);
                                };
 
@@ -77,8 +78,8 @@ void PI_ATOMIC::runSeqVariant(VariantID vid)
         *pi = m_pi_init;
         RAJA::forall<RAJA::loop_exec>( RAJA::RangeSegment(ibegin, iend),
           [=](Index_type i) {
-            double x = (double(i) + 0.5) * dx;
-            RAJA::atomicAdd<RAJA::seq_atomic>(pi, dx / (1.0 + x * x));
+            Data_type x = (Data_type(i) + 0.5) * dx;
+            RAJA::atomicAdd<RAJA::seq_atomic>(pi, dx / (Data_type(1.0) + x * x));
         });
         *pi *= 4.0;
 
@@ -97,5 +98,13 @@ void PI_ATOMIC::runSeqVariant(VariantID vid)
 
 }
 
+void PI_ATOMIC::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -12,6 +12,8 @@
 
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 namespace basic
@@ -53,6 +55,18 @@ PI_ATOMIC::PI_ATOMIC(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (1*data_size + 1*data_size) +
+                    (0*data_size + 0*data_size) * getActualProblemSize() );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 PI_ATOMIC::~PI_ATOMIC()
@@ -61,14 +75,16 @@ PI_ATOMIC::~PI_ATOMIC()
 
 void PI_ATOMIC::setUp(VariantID vid)
 {
+  const PrecisionID pid = getRunningPrecision();
+
   m_dx = 1.0 / double(getActualProblemSize());
-  allocAndInitDataConst(m_pi, 1, 0.0, vid);
+  allocAndInitDataConst(m_pi, 1, 0.0, pid, vid);
   m_pi_init = 0.0;
 }
 
 void PI_ATOMIC::updateChecksum(VariantID vid)
 {
-  checksum[vid] += Checksum_type(*m_pi);
+  checksum[vid] += calcChecksum(m_pi, 1);
 }
 
 void PI_ATOMIC::tearDown(VariantID vid)
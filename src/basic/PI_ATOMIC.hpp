@@ -23,9 +23,11 @@
 #ifndef RAJAPerf_Basic_PI_ATOMIC_HPP
 #define RAJAPerf_Basic_PI_ATOMIC_HPP
 
-#define PI_ATOMIC_DATA_SETUP \
-  Real_type dx = m_dx; \
-  Real_ptr pi = m_pi;
+#define PI_ATOMIC_DATA_SETUP_TYPED(Data_type) \
+  Data_type dx = m_dx; \
+  Data_type* pi = m_pi.get<Data_type>();
+
+#define PI_ATOMIC_DATA_SETUP PI_ATOMIC_DATA_SETUP_TYPED(Real_type)
 
 
 #include "common/KernelBase.hpp"
@@ -56,8 +58,13 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
   Real_type m_dx;
-  Real_ptr m_pi;
+  Precision_ptr m_pi;
   Real_type m_pi_init;
 };
 
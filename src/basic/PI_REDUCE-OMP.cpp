@@ -18,15 +18,16 @@ namespace basic
 {
 
 
-void PI_REDUCE::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void PI_REDUCE::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  PI_REDUCE_DATA_SETUP;
+  PI_REDUCE_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -35,11 +36,11 @@ void PI_REDUCE::runOpenMPVariant(VariantID vid)
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type pi = m_pi_init;
+        Data_type pi = m_pi_init;
 
         #pragma omp parallel for reduction(+:pi)
         for (Index_type i = ibegin; i < iend; ++i ) {
-          PI_REDUCE_BODY;
+          PI_REDUCE_BODY_TYPED(Data_type);
         }
 
         m_pi = 4.0 * pi;
@@ -52,15 +53,15 @@ void PI_REDUCE::runOpenMPVariant(VariantID vid)
 
     case Lambda_OpenMP : {
 
-      auto pireduce_base_lam = [=](Index_type i) -> Real_type {
-                                 double x = (double(i) + 0.5) * dx;
+      auto pireduce_base_lam = [=](Index_type i) -> Data_type {
+                                 Data_type x = (Data_type(i) + 0.5) * dx;
                                  return dx / (1.0 + x * x);
                                };
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type pi = m_pi_init;
+        Data_type pi = m_pi_init;
 
         #pragma omp parallel for reduction(+:pi)
         for (Index_type i = ibegin; i < iend; ++i ) {
@@ -80,12 +81,12 @@ void PI_REDUCE::runOpenMPVariant(VariantID vid)
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::ReduceSum<RAJA::omp_reduce, Real_type> pi(m_pi_init);
+        RAJA::ReduceSum<RAJA::omp_reduce, Data_type> pi(m_pi_init);
 
         RAJA::forall<RAJA::omp_parallel_for_exec>(
           RAJA::RangeSegment(ibegin, iend),
           [=](Index_type i) {
-            PI_REDUCE_BODY;
+            PI_REDUCE_BODY_TYPED(Data_type);
         });
 
         m_pi = 4.0 * pi.get();
@@ -101,6 +102,18 @@ void PI_REDUCE::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void PI_REDUCE::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
@@ -18,13 +18,14 @@ namespace basic
 {
 
 
-void PI_REDUCE::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void PI_REDUCE::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  PI_REDUCE_DATA_SETUP;
+  PI_REDUCE_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -33,10 +34,10 @@ void PI_REDUCE::runSeqVariant(VariantID vid)
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type pi = m_pi_init;
+        Data_type pi = m_pi_init;
 
         for (Index_type i = ibegin; i < iend; ++i ) {
-          PI_REDUCE_BODY;
+          PI_REDUCE_BODY_TYPED(Data_type);
         }
 
         m_pi = 4.0 * pi;
@@ -50,15 +51,15 @@ void PI_REDUCE::runSeqVariant(VariantID vid)
 #if defined(RUN_RAJA_SEQ)
     case Lambda_Seq : {
 
-      auto pireduce_base_lam = [=](Index_type i) -> Real_type {
-                                 double x = (double(i) + 0.5) * dx;
+      auto pireduce_base_lam = [=](Index_type i) -> Data_type {
+                                 Data_type x = (Data_type(i) + 0.5) * dx;
                                  return dx / (1.0 + x * x);
                                };
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type pi = m_pi_init;
+        Data_type pi = m_pi_init;
 
         for (Index_type i = ibegin; i < iend; ++i ) {
           pi += pireduce_base_lam(i);
@@ -77,11 +78,11 @@ void PI_REDUCE::runSeqVariant(VariantID vid)
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::ReduceSum<RAJA::seq_reduce, Real_type> pi(m_pi_init);
+        RAJA::ReduceSum<RAJA::seq_reduce, Data_type> pi(m_pi_init);
 
         RAJA::forall<RAJA::loop_exec>( RAJA::RangeSegment(ibegin, iend),
           [=](Index_type i) {
-            PI_REDUCE_BODY;
+            PI_REDUCE_BODY_TYPED(Data_type);
         });
 
         m_pi = 4.0 * pi.get();
@@ -101,5 +102,13 @@ void PI_REDUCE::runSeqVariant(VariantID vid)
 
 }
 
+void PI_REDUCE::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -23,13 +23,17 @@
 #ifndef RAJAPerf_Basic_PI_REDUCE_HPP
 #define RAJAPerf_Basic_PI_REDUCE_HPP
 
-#define PI_REDUCE_DATA_SETUP \
-  Real_type dx = m_dx;
+#define PI_REDUCE_DATA_SETUP_TYPED(Data_type) \
+  Data_type dx = m_dx;
 
-#define PI_REDUCE_BODY \
-  double x = (double(i) + 0.5) * dx; \
+#define PI_REDUCE_DATA_SETUP PI_REDUCE_DATA_SETUP_TYPED(Real_type)
+
+#define PI_REDUCE_BODY_TYPED(Data_type) \
+  Data_type x = (Data_type(i) + 0.5) * dx; \
   pi += dx / (1.0 + x * x);
 
+#define PI_REDUCE_BODY PI_REDUCE_BODY_TYPED(Real_type)
+
 #include "common/KernelBase.hpp"
 
 namespace rajaperf
@@ -58,6 +62,11 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
   Real_type m_dx;
   Real_type m_pi;
   Real_type m_pi_init;
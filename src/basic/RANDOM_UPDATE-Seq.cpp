@@ -0,0 +1,117 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RANDOM_UPDATE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "RandomAccessData.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+void RANDOM_UPDATE::runSeqVariant(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  const bool prefetch = getRandomAccessPrefetch(getRunningTuning());
+
+  RANDOM_UPDATE_DATA_SETUP;
+
+  auto random_update_lam = [=](Index_type i) {
+                           RANDOM_UPDATE_BODY;
+                         };
+
+  auto random_update_prefetch_lam = [=](Index_type i) {
+                                    RANDOM_UPDATE_PREFETCH;
+                                    RANDOM_UPDATE_BODY;
+                                  };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if ( prefetch ) {
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            RANDOM_UPDATE_PREFETCH;
+            RANDOM_UPDATE_BODY;
+          }
+        } else {
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            RANDOM_UPDATE_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if ( prefetch ) {
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            random_update_prefetch_lam(i);
+          }
+        } else {
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            random_update_lam(i);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if ( prefetch ) {
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(ibegin, iend), random_update_prefetch_lam);
+        } else {
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(ibegin, iend), random_update_lam);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      getCout() << "\n  RANDOM_UPDATE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+} // end namespace basic
+} // end namespace rajaperf
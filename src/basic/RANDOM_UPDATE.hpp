@@ -0,0 +1,81 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// RANDOM_UPDATE kernel reference implementation:
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   x[idx[i]] += y[i] ;
+/// }
+///
+/// The index array idx is a permutation of ibegin, ..., iend-1 from the
+/// distribution of the kernel tuning run (see RandomAccessData.hpp), so
+/// the kernel updates x in place at the indices in idx in that order.
+///
+
+#ifndef RAJAPerf_Basic_RANDOM_UPDATE_HPP
+#define RAJAPerf_Basic_RANDOM_UPDATE_HPP
+
+#define RANDOM_UPDATE_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  Int_ptr idx = m_idx;
+
+#define RANDOM_UPDATE_BODY  \
+  x[idx[i]] += y[i] ;
+
+#define RANDOM_UPDATE_PREFETCH  \
+  RANDOM_ACCESS_PREFETCH_WRITE(&x[idx[i + RANDOM_ACCESS_PREFETCH_DISTANCE]]) ;
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace basic
+{
+
+class RANDOM_UPDATE : public KernelBase
+{
+public:
+
+  RANDOM_UPDATE(const RunParams& params);
+
+  ~RANDOM_UPDATE();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  RANDOM_UPDATE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  RANDOM_UPDATE : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  RANDOM_UPDATE : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  Real_ptr m_x;
+  Real_ptr m_y;
+  Int_ptr m_idx;
+};
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
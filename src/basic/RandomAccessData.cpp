@@ -0,0 +1,119 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "RandomAccessData.hpp"
+
+#include <algorithm>
+#include <random>
+#include <utility>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+const std::vector<std::string>& getRandomAccessTuningNames()
+{
+  static const std::vector<std::string> names {
+    "contiguous",
+    "strided",
+    "block_shuffled",
+    "random",
+    "block_shuffled_prefetch",
+    "random_prefetch"
+  };
+  return names;
+}
+
+IndexDistribution getRandomAccessDistribution(size_t tune_idx)
+{
+  switch ( tune_idx ) {
+    case 1 : return Index_Strided;
+    case 2 :
+    case 4 : return Index_BlockShuffled;
+    case 3 :
+    case 5 : return Index_Random;
+    default : return Index_Contiguous;
+  }
+}
+
+bool getRandomAccessPrefetch(size_t tune_idx)
+{
+  return tune_idx >= 4;
+}
+
+/*
+ * Shuffle entries of given array with a fixed seed so the permutation,
+ * and so the checksums, are the same on every run and platform.
+ */
+static void shuffle(Int_ptr a, Index_type len)
+{
+  std::mt19937 gen(4793);
+  for (Index_type i = len-1; i > 0; --i) {
+    Index_type j = static_cast<Index_type>(gen() % (i+1));
+    std::swap(a[i], a[j]);
+  }
+}
+
+void initRandomAccessIndices(Int_ptr idx, Index_type len,
+                             IndexDistribution dist)
+{
+  switch ( dist ) {
+
+    case Index_Strided : {
+      Index_type ii = 0;
+      for (Index_type offset = 0; offset < RANDOM_ACCESS_STRIDE; ++offset) {
+        for (Index_type i = offset; i < len; i += RANDOM_ACCESS_STRIDE) {
+          idx[ii++] = i;
+        }
+      }
+      break;
+    }
+
+    case Index_BlockShuffled : {
+      const Index_type nblocks =
+        (len + RANDOM_ACCESS_BLOCK - 1) / RANDOM_ACCESS_BLOCK;
+      std::vector<Int_type> blocks(nblocks);
+      for (Index_type b = 0; b < nblocks; ++b) {
+        blocks[b] = b;
+      }
+      shuffle(blocks.data(), nblocks);
+      Index_type ii = 0;
+      for (Index_type b = 0; b < nblocks; ++b) {
+        Index_type ibegin = blocks[b] * RANDOM_ACCESS_BLOCK;
+        Index_type iend = std::min(ibegin + RANDOM_ACCESS_BLOCK, len);
+        for (Index_type i = ibegin; i < iend; ++i) {
+          idx[ii++] = i;
+        }
+      }
+      break;
+    }
+
+    case Index_Random : {
+      for (Index_type i = 0; i < len; ++i) {
+        idx[i] = i;
+      }
+      shuffle(idx, len);
+      break;
+    }
+
+    default : {
+      for (Index_type i = 0; i < len; ++i) {
+        idx[i] = i;
+      }
+    }
+
+  }
+
+  for (Index_type i = 0; i < RANDOM_ACCESS_PREFETCH_DISTANCE; ++i) {
+    idx[len + i] = ( len > 0 ) ? idx[i % len] : 0;
+  }
+}
+
+} // end namespace basic
+} // end namespace rajaperf
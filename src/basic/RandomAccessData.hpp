@@ -0,0 +1,93 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Index arrays and tunings shared by the random access kernels
+/// (GATHER, SCATTER, RANDOM_UPDATE).
+///
+/// Each tuning of these kernels accesses data through an index array that
+/// is a permutation of 0, ..., len-1 drawn from one of these distributions:
+///
+///   contiguous     -- idx[i] = i
+///   strided        -- every RANDOM_ACCESS_STRIDE-th element, then the
+///                     next offset, and so on
+///   block_shuffled -- blocks of RANDOM_ACCESS_BLOCK contiguous elements
+///                     visited in random order
+///   random         -- a random permutation
+///
+/// Since each index appears once, scattered writes never conflict. The
+/// block_shuffled and random distributions also have a tuning that issues
+/// software prefetches RANDOM_ACCESS_PREFETCH_DISTANCE iterations ahead.
+///
+
+#ifndef RAJAPerf_Basic_RandomAccessData_HPP
+#define RAJAPerf_Basic_RandomAccessData_HPP
+
+#include "common/RPTypes.hpp"
+
+#include <string>
+#include <vector>
+
+#define RANDOM_ACCESS_STRIDE 16
+#define RANDOM_ACCESS_BLOCK 64
+#define RANDOM_ACCESS_PREFETCH_DISTANCE 32
+
+//
+// Software prefetch of the given address for reading or writing; does
+// nothing with compilers that have no prefetch builtin.
+//
+#if defined(__GNUC__) || defined(__clang__)
+#define RANDOM_ACCESS_PREFETCH_READ(addr) __builtin_prefetch((addr), 0)
+#define RANDOM_ACCESS_PREFETCH_WRITE(addr) __builtin_prefetch((addr), 1)
+#else
+#define RANDOM_ACCESS_PREFETCH_READ(addr)
+#define RANDOM_ACCESS_PREFETCH_WRITE(addr)
+#endif
+
+namespace rajaperf
+{
+namespace basic
+{
+
+enum IndexDistribution {
+  Index_Contiguous = 0,
+  Index_Strided,
+  Index_BlockShuffled,
+  Index_Random
+};
+
+/*!
+ * \brief Names of the tunings of the random access kernels.
+ */
+const std::vector<std::string>& getRandomAccessTuningNames();
+
+/*!
+ * \brief Index distribution used by the tuning with given index.
+ */
+IndexDistribution getRandomAccessDistribution(size_t tune_idx);
+
+/*!
+ * \brief Return true if the tuning with given index prefetches.
+ */
+bool getRandomAccessPrefetch(size_t tune_idx);
+
+/*!
+ * \brief Fill index array with a permutation of 0, ..., len-1 drawn from
+ *        the given distribution.
+ *
+ * The array must have room for len + RANDOM_ACCESS_PREFETCH_DISTANCE
+ * entries; the extra entries repeat the first ones so that prefetching
+ * loops may read ahead of the last iteration.
+ */
+void initRandomAccessIndices(Int_ptr idx, Index_type len,
+                             IndexDistribution dist);
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
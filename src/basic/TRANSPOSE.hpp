@@ -0,0 +1,99 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// TRANSPOSE kernel reference implementation:
+///
+/// for (Index_type j = 0; j < N; ++j ) {
+///   for (Index_type i = 0; i < N; ++i ) {
+///     B[i][j] = A[j][i];
+///   }
+/// }
+///
+/// A and B are N x N matrices stored with the i index contiguous, so reads
+/// of A are unit stride and writes of B have stride N.
+///
+/// The tunings are described in TransposeData.hpp.
+///
+
+#ifndef RAJAPerf_Basic_TRANSPOSE_HPP
+#define RAJAPerf_Basic_TRANSPOSE_HPP
+
+#define TRANSPOSE_DATA_SETUP \
+  Real_ptr a = m_a; \
+  Real_ptr b = m_b; \
+  const Index_type N = m_N;
+
+#define TRANSPOSE_BLOCKS_SETUP \
+  Int_ptr blocks = m_blocks; \
+  const Index_type nblocks = m_nblocks;
+
+#define TRANSPOSE_BODY  \
+  b[j + i*N] = a[i + j*N];
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace basic
+{
+
+class TRANSPOSE : public KernelBase
+{
+public:
+
+  TRANSPOSE(const RunParams& params);
+
+  ~TRANSPOSE();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  TRANSPOSE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  TRANSPOSE : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  TRANSPOSE : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  void runSeqVariantNaive(VariantID vid);
+  template < Index_type tile_size >
+  void runSeqVariantTiled(VariantID vid);
+  void runSeqVariantRecursive(VariantID vid);
+
+  void runOpenMPVariantNaive(VariantID vid);
+  template < Index_type tile_size >
+  void runOpenMPVariantTiled(VariantID vid);
+  void runOpenMPVariantRecursive(VariantID vid);
+
+  Real_ptr m_a;
+  Real_ptr m_b;
+
+  Index_type m_N;
+
+  Int_ptr m_blocks;
+  Index_type m_nblocks;
+};
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,302 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TRANSPOSE_INPLACE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "TransposeData.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+void TRANSPOSE_INPLACE::runOpenMPVariantNaive(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  TRANSPOSE_INPLACE_DATA_SETUP;
+
+  auto transpose_inplace_lam = [=](Index_type i, Index_type j) {
+                                 TRANSPOSE_INPLACE_BODY;
+                               };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type j = 0; j < N; ++j ) {
+          for (Index_type i = 0; i < N; ++i ) {
+            TRANSPOSE_INPLACE_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type j = 0; j < N; ++j ) {
+          for (Index_type i = 0; i < N; ++i ) {
+            transpose_inplace_lam(i, j);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<1, RAJA::omp_parallel_for_exec,    // j
+            RAJA::statement::For<0, RAJA::loop_exec,    // i
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{0, N},
+                                                 RAJA::RangeSegment{0, N}),
+          transpose_inplace_lam
+        );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  TRANSPOSE_INPLACE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+template < Index_type tile_size >
+void TRANSPOSE_INPLACE::runOpenMPVariantTiled(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  TRANSPOSE_INPLACE_DATA_SETUP;
+
+  auto transpose_inplace_lam = [=](Index_type i, Index_type j) {
+                                 TRANSPOSE_INPLACE_BODY;
+                               };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type jj = 0; jj < N; jj += tile_size ) {
+          for (Index_type ii = 0; ii < N; ii += tile_size ) {
+            const Index_type jj_end = std::min(jj + tile_size, N);
+            const Index_type ii_end = std::min(ii + tile_size, N);
+            for (Index_type j = jj; j < jj_end; ++j ) {
+              for (Index_type i = ii; i < ii_end; ++i ) {
+                TRANSPOSE_INPLACE_BODY;
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type jj = 0; jj < N; jj += tile_size ) {
+          for (Index_type ii = 0; ii < N; ii += tile_size ) {
+            const Index_type jj_end = std::min(jj + tile_size, N);
+            const Index_type ii_end = std::min(ii + tile_size, N);
+            for (Index_type j = jj; j < jj_end; ++j ) {
+              for (Index_type i = ii; i < ii_end; ++i ) {
+                transpose_inplace_lam(i, j);
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::Tile<1, RAJA::tile_fixed<tile_size>, RAJA::omp_parallel_for_exec,
+            RAJA::statement::Tile<0, RAJA::tile_fixed<tile_size>, RAJA::loop_exec,
+              RAJA::statement::For<1, RAJA::loop_exec,    // j
+                RAJA::statement::For<0, RAJA::loop_exec,    // i
+                  RAJA::statement::Lambda<0>
+                >
+              >
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment{0, N},
+                                                 RAJA::RangeSegment{0, N}),
+          transpose_inplace_lam
+        );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  TRANSPOSE_INPLACE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+void TRANSPOSE_INPLACE::runOpenMPVariantRecursive(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  TRANSPOSE_INPLACE_DATA_SETUP;
+  TRANSPOSE_INPLACE_BLOCKS_SETUP;
+
+  auto transpose_inplace_lam = [=](Index_type i, Index_type j) {
+                                 TRANSPOSE_INPLACE_BODY;
+                               };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type ib = 0; ib < nblocks; ++ib ) {
+          TRANSPOSE_BLOCK_SETUP;
+          for (Index_type j = jbegin; j < jend; ++j ) {
+            for (Index_type i = ibegin; i < iend; ++i ) {
+              TRANSPOSE_INPLACE_BODY;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type ib = 0; ib < nblocks; ++ib ) {
+          TRANSPOSE_BLOCK_SETUP;
+          for (Index_type j = jbegin; j < jend; ++j ) {
+            for (Index_type i = ibegin; i < iend; ++i ) {
+              transpose_inplace_lam(i, j);
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nblocks), [=](Index_type ib) {
+          TRANSPOSE_BLOCK_SETUP;
+          for (Index_type j = jbegin; j < jend; ++j ) {
+            for (Index_type i = ibegin; i < iend; ++i ) {
+              transpose_inplace_lam(i, j);
+            }
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  TRANSPOSE_INPLACE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void TRANSPOSE_INPLACE::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  TRANSPOSE_TUNING_DISPATCH(getRunningTuning(), runOpenMPVariantNaive,
+                            runOpenMPVariantTiled, runOpenMPVariantRecursive,
+                            vid)
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -0,0 +1,89 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TRANSPOSE_INPLACE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "TransposeData.hpp"
+#include "common/DataUtils.hpp"
+
+#include <cmath>
+
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+TRANSPOSE_INPLACE::TRANSPOSE_INPLACE(const RunParams& params)
+  : KernelBase(rajaperf::Basic_TRANSPOSE_INPLACE, params)
+{
+  Index_type N_default = 1000;
+
+  setDefaultProblemSize( N_default * N_default );
+  setDefaultReps(50);
+
+  m_N = std::sqrt( getTargetProblemSize() ) + 1;
+
+  setActualProblemSize( m_N * m_N );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  // elements above and below the diagonal are each read and written once
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) *
+                  m_N * (m_N-1) );
+  setFLOPsPerRep(0);
+
+  checksum_scale_factor = 0.0001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Kernel);
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  for (size_t vid = 0; vid < NumVariants; ++vid) {
+    setVariantTuningNames(static_cast<VariantID>(vid),
+                          getTransposeTuningNames());
+  }
+}
+
+TRANSPOSE_INPLACE::~TRANSPOSE_INPLACE()
+{
+}
+
+void TRANSPOSE_INPLACE::setUp(VariantID vid)
+{
+  allocAndInitData(m_a, m_N*m_N, vid);
+  m_nblocks = allocAndInitTransposeBlocks(m_blocks, m_N,
+                                          /* upper = */ true, vid);
+}
+
+void TRANSPOSE_INPLACE::updateChecksum(VariantID vid)
+{
+  checksum[vid] += calcChecksum(m_a, m_N*m_N, checksum_scale_factor );
+}
+
+void TRANSPOSE_INPLACE::tearDown(VariantID vid)
+{
+  (void) vid;
+  deallocData(m_a);
+  deallocData(m_blocks);
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -0,0 +1,104 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// TRANSPOSE_INPLACE kernel reference implementation:
+///
+/// for (Index_type j = 0; j < N; ++j ) {
+///   for (Index_type i = 0; i < N; ++i ) {
+///     if ( j > i ) {
+///       swap(A[j][i], A[i][j]);
+///     }
+///   }
+/// }
+///
+/// A is an N x N matrix stored with the i index contiguous. The naive and
+/// tiled tunings visit the whole matrix and skip elements on and below the
+/// diagonal; the recursive tuning only visits blocks above the diagonal.
+///
+/// The tunings are described in TransposeData.hpp.
+///
+
+#ifndef RAJAPerf_Basic_TRANSPOSE_INPLACE_HPP
+#define RAJAPerf_Basic_TRANSPOSE_INPLACE_HPP
+
+#define TRANSPOSE_INPLACE_DATA_SETUP \
+  Real_ptr a = m_a; \
+  const Index_type N = m_N;
+
+#define TRANSPOSE_INPLACE_BLOCKS_SETUP \
+  Int_ptr blocks = m_blocks; \
+  const Index_type nblocks = m_nblocks;
+
+#define TRANSPOSE_INPLACE_BODY  \
+  if ( j > i ) { \
+    Real_type tmp = a[i + j*N]; \
+    a[i + j*N] = a[j + i*N]; \
+    a[j + i*N] = tmp; \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace basic
+{
+
+class TRANSPOSE_INPLACE : public KernelBase
+{
+public:
+
+  TRANSPOSE_INPLACE(const RunParams& params);
+
+  ~TRANSPOSE_INPLACE();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  TRANSPOSE_INPLACE : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  TRANSPOSE_INPLACE : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  TRANSPOSE_INPLACE : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  void runSeqVariantNaive(VariantID vid);
+  template < Index_type tile_size >
+  void runSeqVariantTiled(VariantID vid);
+  void runSeqVariantRecursive(VariantID vid);
+
+  void runOpenMPVariantNaive(VariantID vid);
+  template < Index_type tile_size >
+  void runOpenMPVariantTiled(VariantID vid);
+  void runOpenMPVariantRecursive(VariantID vid);
+
+  Real_ptr m_a;
+
+  Index_type m_N;
+
+  Int_ptr m_blocks;
+  Index_type m_nblocks;
+};
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -20,27 +20,29 @@ namespace basic
 //
 // Function used in TRAP_INT loop.
 //
+template < typename Data_type >
 RAJA_INLINE
-Real_type trap_int_func(Real_type x,
-                        Real_type y,
-                        Real_type xp,
-                        Real_type yp)
+Data_type trap_int_func(Data_type x,
+                        Data_type y,
+                        Data_type xp,
+                        Data_type yp)
 {
-   Real_type denom = (x - xp)*(x - xp) + (y - yp)*(y - yp);
+   Data_type denom = (x - xp)*(x - xp) + (y - yp)*(y - yp);
    denom = 1.0/sqrt(denom);
    return denom;
 }
 
 
-void TRAP_INT::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void TRAP_INT::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  TRAP_INT_DATA_SETUP;
+  TRAP_INT_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -49,11 +51,11 @@ void TRAP_INT::runOpenMPVariant(VariantID vid)
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type sumx = m_sumx_init;
+        Data_type sumx = m_sumx_init;
 
         #pragma omp parallel for reduction(+:sumx)
         for (Index_type i = ibegin; i < iend; ++i ) {
-          TRAP_INT_BODY;
+          TRAP_INT_BODY_TYPED(Data_type);
         }
 
         m_sumx += sumx * h;
@@ -66,15 +68,15 @@ void TRAP_INT::runOpenMPVariant(VariantID vid)
 
     case Lambda_OpenMP : {
 
-      auto trapint_base_lam = [=](Index_type i) -> Real_type {
-                                Real_type x = x0 + i*h;
+      auto trapint_base_lam = [=](Index_type i) -> Data_type {
+                                Data_type x = x0 + i*h;
                                 return trap_int_func(x, y, xp, yp);
                               };
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type sumx = m_sumx_init;
+        Data_type sumx = m_sumx_init;
 
         #pragma omp parallel for reduction(+:sumx)
         for (Index_type i = ibegin; i < iend; ++i ) {
@@ -94,14 +96,14 @@ void TRAP_INT::runOpenMPVariant(VariantID vid)
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::ReduceSum<RAJA::omp_reduce, Real_type> sumx(m_sumx_init);
+        RAJA::ReduceSum<RAJA::omp_reduce, Data_type> sumx(m_sumx_init);
 
         RAJA::forall<RAJA::omp_parallel_for_exec>(
           RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
-          TRAP_INT_BODY;
+          TRAP_INT_BODY_TYPED(Data_type);
         });
 
-        m_sumx += static_cast<Real_type>(sumx.get()) * h;
+        m_sumx += static_cast<Data_type>(sumx.get()) * h;
 
       }
       stopTimer();
@@ -114,6 +116,18 @@ void TRAP_INT::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void TRAP_INT::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
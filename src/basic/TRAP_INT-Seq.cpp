@@ -20,25 +20,27 @@ namespace basic
 //
 // Function used in TRAP_INT loop.
 //
+template < typename Data_type >
 RAJA_INLINE
-Real_type trap_int_func(Real_type x,
-                        Real_type y,
-                        Real_type xp,
-                        Real_type yp)
+Data_type trap_int_func(Data_type x,
+                        Data_type y,
+                        Data_type xp,
+                        Data_type yp)
 {
-   Real_type denom = (x - xp)*(x - xp) + (y - yp)*(y - yp);
+   Data_type denom = (x - xp)*(x - xp) + (y - yp)*(y - yp);
    denom = 1.0/sqrt(denom);
    return denom;
 }
 
 
-void TRAP_INT::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void TRAP_INT::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  TRAP_INT_DATA_SETUP;
+  TRAP_INT_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -47,10 +49,10 @@ void TRAP_INT::runSeqVariant(VariantID vid)
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type sumx = m_sumx_init;
+        Data_type sumx = m_sumx_init;
 
         for (Index_type i = ibegin; i < iend; ++i ) {
-          TRAP_INT_BODY;
+          TRAP_INT_BODY_TYPED(Data_type);
         }
 
         m_sumx += sumx * h;
@@ -64,15 +66,15 @@ void TRAP_INT::runSeqVariant(VariantID vid)
 #if defined(RUN_RAJA_SEQ)
     case Lambda_Seq : {
 
-      auto trapint_base_lam = [=](Index_type i) -> Real_type {
-                                Real_type x = x0 + i*h;
+      auto trapint_base_lam = [=](Index_type i) -> Data_type {
+                                Data_type x = x0 + i*h;
                                 return trap_int_func(x, y, xp, yp);
                               };
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type sumx = m_sumx_init;
+        Data_type sumx = m_sumx_init;
 
         for (Index_type i = ibegin; i < iend; ++i ) {
           sumx += trapint_base_lam(i);
@@ -91,14 +93,14 @@ void TRAP_INT::runSeqVariant(VariantID vid)
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::ReduceSum<RAJA::seq_reduce, Real_type> sumx(m_sumx_init);
+        RAJA::ReduceSum<RAJA::seq_reduce, Data_type> sumx(m_sumx_init);
 
         RAJA::forall<RAJA::loop_exec>(
           RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
-          TRAP_INT_BODY;
+          TRAP_INT_BODY_TYPED(Data_type);
         });
 
-        m_sumx += static_cast<Real_type>(sumx.get()) * h;
+        m_sumx += static_cast<Data_type>(sumx.get()) * h;
 
       }
       stopTimer();
@@ -115,5 +117,13 @@ void TRAP_INT::runSeqVariant(VariantID vid)
 
 }
 
+void TRAP_INT::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
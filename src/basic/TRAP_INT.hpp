@@ -29,17 +29,21 @@
 #define RAJAPerf_Basic_TRAP_INT_HPP
 
 
-#define TRAP_INT_DATA_SETUP \
-  Real_type x0 = m_x0; \
-  Real_type xp = m_xp; \
-  Real_type y = m_y; \
-  Real_type yp = m_yp; \
-  Real_type h = m_h;
-
-#define TRAP_INT_BODY \
-  Real_type x = x0 + i*h; \
+#define TRAP_INT_DATA_SETUP_TYPED(Data_type) \
+  Data_type x0 = m_x0; \
+  Data_type xp = m_xp; \
+  Data_type y = m_y; \
+  Data_type yp = m_yp; \
+  Data_type h = m_h;
+
+#define TRAP_INT_DATA_SETUP TRAP_INT_DATA_SETUP_TYPED(Real_type)
+
+#define TRAP_INT_BODY_TYPED(Data_type) \
+  Data_type x = x0 + i*h; \
   sumx += trap_int_func(x, y, xp, yp);
 
+#define TRAP_INT_BODY TRAP_INT_BODY_TYPED(Real_type)
+
 
 #include "common/KernelBase.hpp"
 
@@ -69,6 +73,11 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
   Real_type m_x0;
   Real_type m_xp;
   Real_type m_y;
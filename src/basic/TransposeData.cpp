@@ -0,0 +1,101 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TransposeData.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+const std::vector<std::string>& getTransposeTuningNames()
+{
+  static const std::vector<std::string> names {
+    "naive",
+    "tile_16",
+    "tile_32",
+    "tile_64",
+    "recursive"
+  };
+  return names;
+}
+
+/*
+ * Add leaf blocks of given block, halving its longer side until both
+ * sides are at most TRANSPOSE_LEAF_SIZE.
+ */
+static void addBlocks(std::vector<Int_type>& blocks,
+                      Index_type ibegin, Index_type iend,
+                      Index_type jbegin, Index_type jend)
+{
+  const Index_type ilen = iend - ibegin;
+  const Index_type jlen = jend - jbegin;
+  if ( ilen <= 0 || jlen <= 0 ) {
+    return;
+  }
+
+  if ( ilen <= TRANSPOSE_LEAF_SIZE && jlen <= TRANSPOSE_LEAF_SIZE ) {
+    blocks.push_back(ibegin);
+    blocks.push_back(iend);
+    blocks.push_back(jbegin);
+    blocks.push_back(jend);
+  } else if ( ilen >= jlen ) {
+    const Index_type imid = ibegin + ilen/2;
+    addBlocks(blocks, ibegin, imid, jbegin, jend);
+    addBlocks(blocks, imid, iend, jbegin, jend);
+  } else {
+    const Index_type jmid = jbegin + jlen/2;
+    addBlocks(blocks, ibegin, iend, jbegin, jmid);
+    addBlocks(blocks, ibegin, iend, jmid, jend);
+  }
+}
+
+/*
+ * Add leaf blocks of the upper triangle of a diagonal block; the block
+ * below the diagonal is skipped at each level.
+ */
+static void addUpperBlocks(std::vector<Int_type>& blocks,
+                           Index_type begin, Index_type end)
+{
+  if ( end - begin <= TRANSPOSE_LEAF_SIZE ) {
+    if ( end > begin ) {
+      blocks.push_back(begin);
+      blocks.push_back(end);
+      blocks.push_back(begin);
+      blocks.push_back(end);
+    }
+  } else {
+    const Index_type mid = begin + (end - begin)/2;
+    addUpperBlocks(blocks, begin, mid);
+    addBlocks(blocks, begin, mid, mid, end);
+    addUpperBlocks(blocks, mid, end);
+  }
+}
+
+Index_type allocAndInitTransposeBlocks(Int_ptr& blocks, Index_type N,
+                                       bool upper, VariantID vid)
+{
+  std::vector<Int_type> block_list;
+  if ( upper ) {
+    addUpperBlocks(block_list, 0, N);
+  } else {
+    addBlocks(block_list, 0, N, 0, N);
+  }
+
+  allocAndInitDataConst(blocks, block_list.size(), 0, vid);
+  std::copy(block_list.begin(), block_list.end(), blocks);
+
+  return block_list.size() / 4;
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -0,0 +1,85 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Tunings and recursive block lists shared by the matrix transpose
+/// kernels (TRANSPOSE, TRANSPOSE_INPLACE).
+///
+/// Each kernel has these tunings:
+///
+///   naive     -- loop over the whole matrix
+///   tile_<T>  -- loop over T x T tiles, T = 16, 32, 64
+///   recursive -- cache-oblivious; visit the leaf blocks of a recursive
+///                halving of the matrix, in recursion order
+///
+/// Leaf blocks are at most TRANSPOSE_LEAF_SIZE on a side. The list of
+/// blocks is built in setUp() so that all variants, including the RAJA
+/// forall variants, traverse the same blocks in the same order.
+///
+
+#ifndef RAJAPerf_Basic_TransposeData_HPP
+#define RAJAPerf_Basic_TransposeData_HPP
+
+#include "common/RPTypes.hpp"
+#include "common/RAJAPerfSuite.hpp"
+
+#include <string>
+#include <vector>
+
+#define TRANSPOSE_LEAF_SIZE 16
+
+//
+// Each block in a block list is stored as four entries:
+// ibegin, iend, jbegin, jend.
+//
+#define TRANSPOSE_BLOCK_SETUP \
+  const Index_type ibegin = blocks[4*ib]; \
+  const Index_type iend = blocks[4*ib + 1]; \
+  const Index_type jbegin = blocks[4*ib + 2]; \
+  const Index_type jend = blocks[4*ib + 3];
+
+//
+// Call the method of the running tuning; the order of cases must match
+// the names returned by getTransposeTuningNames().
+//
+#define TRANSPOSE_TUNING_DISPATCH(tune_idx, naive, tiled, recursive, vid) \
+  switch (tune_idx) { \
+    case 0: naive(vid); break; \
+    case 1: tiled<16>(vid); break; \
+    case 2: tiled<32>(vid); break; \
+    case 3: tiled<64>(vid); break; \
+    case 4: recursive(vid); break; \
+    default: \
+      getCout() << "\n  " << getName() \
+                << " : Unknown tuning = " << tune_idx << std::endl; \
+  }
+
+namespace rajaperf
+{
+namespace basic
+{
+
+/*!
+ * \brief Names of the tunings of the transpose kernels.
+ */
+const std::vector<std::string>& getTransposeTuningNames();
+
+/*!
+ * \brief Allocate and fill list of leaf blocks of an N x N matrix in
+ *        recursive order; return number of blocks.
+ *
+ * If upper is true, only blocks with elements above the diagonal (j > i)
+ * are listed and diagonal blocks are square, for in-place transposes.
+ */
+Index_type allocAndInitTransposeBlocks(Int_ptr& blocks, Index_type N,
+                                       bool upper, VariantID vid);
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
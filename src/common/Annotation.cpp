@@ -0,0 +1,149 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "Annotation.hpp"
+
+#include "RAJAPerfSuite.hpp"
+#include "OutputUtils.hpp"
+
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+#include <mpi.h>
+#endif
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+namespace rajaperf
+{
+
+/*!
+ * \brief Annotation backend that does nothing.
+ */
+class NoOpAnnotation : public AnnotationBackend
+{
+public:
+  void beginRegion(const char*) override { }
+  void endRegion(const char*) override { }
+};
+
+/*!
+ * \brief Annotation backend that writes regions as duration events in the
+ *        Chrome trace event format, viewable in chrome://tracing or
+ *        Perfetto. With MPI, each rank writes its own file and is shown
+ *        as a separate process.
+ *
+ * Events are written as they occur and the file is flushed at the end of
+ * every region except the "timed" ones, so flushing does not perturb
+ * kernel timings. The closing bracket of the event array is optional in
+ * this format, so the trace of a run that is killed can still be viewed
+ * up to the last flushed region.
+ */
+class ChromeTraceAnnotation : public AnnotationBackend
+{
+public:
+  ChromeTraceAnnotation(const std::string& out_fprefix)
+    : pid(0),
+      num_events(0),
+      start(std::chrono::steady_clock::now())
+  {
+    std::string file_name = out_fprefix + "-trace";
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+    int num_ranks;
+    MPI_Comm_rank(MPI_COMM_WORLD, &pid);
+    MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+    if ( num_ranks > 1 ) {
+      file_name += "-rank" + std::to_string(pid);
+    }
+#endif
+    file_name += ".json";
+
+    file.open(file_name.c_str(), std::ios::out | std::ios::trunc);
+    if ( !file ) {
+      getCout() << " ERROR: Can't open trace file " << file_name << std::endl;
+    }
+    file << "[";
+  }
+
+  ~ChromeTraceAnnotation()
+  {
+    file << "\n]" << std::endl;
+  }
+
+  void beginRegion(const char* name) override { writeEvent(name, 'B'); }
+  void endRegion(const char* name) override
+  {
+    writeEvent(name, 'E');
+    if ( std::strcmp(name, "timed") != 0 ) {
+      file.flush();
+    }
+  }
+
+private:
+  void writeEvent(const char* name, char phase)
+  {
+    std::chrono::duration<double, std::micro> ts =
+      std::chrono::steady_clock::now() - start;
+
+    file << (num_events > 0 ? ",\n" : "\n")
+         << "{\"name\": " << jsonString(name)
+         << ", \"cat\": \"RAJAPerf\", \"ph\": \"" << phase << "\""
+         << ", \"ts\": " << std::fixed << std::setprecision(3) << ts.count()
+         << ", \"pid\": " << pid << ", \"tid\": 0}";
+    ++num_events;
+  }
+
+  std::ofstream file;
+  int pid;
+  long num_events;
+  std::chrono::steady_clock::time_point start;
+};
+
+
+static AnnotationBackend* annotation_backend = nullptr;
+
+const std::vector<std::string>& getAnnotationBackendNames()
+{
+  static const std::vector<std::string> names { "none", "chrome" };
+  return names;
+}
+
+AnnotationBackend* makeAnnotationBackend(const std::string& name,
+                                         const std::string& out_fprefix)
+{
+  if ( name == "none" ) {
+    return new NoOpAnnotation();
+  } else if ( name == "chrome" ) {
+    return new ChromeTraceAnnotation(out_fprefix);
+  }
+  return nullptr;
+}
+
+void setAnnotationBackend(AnnotationBackend* backend)
+{
+  delete annotation_backend;
+  annotation_backend = backend;
+}
+
+void beginAnnotation(const char* name)
+{
+  if ( annotation_backend ) {
+    annotation_backend->beginRegion(name);
+  }
+}
+
+void endAnnotation(const char* name)
+{
+  if ( annotation_backend ) {
+    annotation_backend->endRegion(name);
+  }
+}
+
+}  // closing brace for rajaperf namespace
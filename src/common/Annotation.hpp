@@ -0,0 +1,72 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Annotation of suite regions (passes, kernel variant runs and their
+/// phases, and timed regions) for profiling and tracing tools.
+///
+
+#ifndef RAJAPerf_Annotation_HPP
+#define RAJAPerf_Annotation_HPP
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Base class for tools that suite regions are reported to.
+ *
+ * Regions are properly nested and are begun and ended on the thread that
+ * runs the suite. To support another tool (e.g., ITT or NVTX ranges),
+ * derive a class from this one and add its name to
+ * getAnnotationBackendNames() and makeAnnotationBackend().
+ *
+ *******************************************************************************
+ */
+class AnnotationBackend
+{
+public:
+  virtual ~AnnotationBackend() { }
+
+  virtual void beginRegion(const char* name) = 0;
+  virtual void endRegion(const char* name) = 0;
+};
+
+/*!
+ * \brief Names of annotation backends that may be selected to run with.
+ */
+const std::vector<std::string>& getAnnotationBackendNames();
+
+/*!
+ * \brief Create annotation backend with given name, writing any output to
+ *        files whose names start with the given prefix (including path).
+ *
+ * Returns null pointer if name is not a known backend.
+ */
+AnnotationBackend* makeAnnotationBackend(const std::string& name,
+                                         const std::string& out_fprefix);
+
+/*!
+ * \brief Set backend that suite regions are reported to, deleting the
+ *        previous one; a null pointer turns annotation off.
+ */
+void setAnnotationBackend(AnnotationBackend* backend);
+
+/*!
+ * \brief Begin and end a named suite region.
+ */
+void beginAnnotation(const char* name);
+void endAnnotation(const char* name);
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
@@ -12,12 +12,37 @@
 #include "RAJA/internal/MemUtils_CPU.hpp"
 
 #include <cstdlib>
+#include <algorithm>
+#include <map>
 
 namespace rajaperf
 {
 
 static int data_init_count = 0;
 
+//
+// Bytes allocated by the allocation methods below, by address.
+//
+static std::map<const void*, size_t> data_alloc_sizes;
+static size_t data_alloc_bytes = 0;
+static size_t data_alloc_peak = 0;
+
+static void recordDataAlloc(const void* ptr, size_t bytes)
+{
+  data_alloc_sizes[ptr] = bytes;
+  data_alloc_bytes += bytes;
+  data_alloc_peak = std::max(data_alloc_peak, data_alloc_bytes);
+}
+
+static void recordDataDealloc(const void* ptr)
+{
+  auto alloc = data_alloc_sizes.find(ptr);
+  if ( alloc != data_alloc_sizes.end() ) {
+    data_alloc_bytes -= alloc->second;
+    data_alloc_sizes.erase(alloc);
+  }
+}
+
 /*
  * Reset counter for data initialization.
  */
@@ -35,6 +60,25 @@ void incDataInitCount()
 }
 
 
+/*
+ * Bytes allocated by data allocation methods.
+ */
+size_t getDataAllocBytes()
+{
+  return data_alloc_bytes;
+}
+
+size_t getDataAllocPeak()
+{
+  return data_alloc_peak;
+}
+
+void resetDataAllocPeak()
+{
+  data_alloc_peak = data_alloc_bytes;
+}
+
+
 /*
  * Allocate and initialize aligned integer data arrays.
  */
@@ -42,44 +86,191 @@ void allocAndInitData(Int_ptr& ptr, int len, VariantID vid)
 {
   // Should we do this differently for alignment?? If so, change dealloc()
   ptr = new Int_type[len];
+  recordDataAlloc(ptr, len*sizeof(Int_type));
   initData(ptr, len, vid);
 }
 
+void allocAndInitDataConst(Int_ptr& ptr, int len, Int_type val,
+                           VariantID vid)
+{
+  ptr = new Int_type[len];
+  recordDataAlloc(ptr, len*sizeof(Int_type));
+  initDataConst(ptr, len, val, vid);
+}
+
+/*
+ * Allocate, initialize, and free aligned floating point data arrays of
+ * any precision.
+ */
+template < typename Data_type >
+static void allocAlignedData(Data_type*& ptr, int len)
+{
+  ptr =
+    RAJA::allocate_aligned_type<Data_type>(RAJA::DATA_ALIGN,
+                                           len*sizeof(Data_type));
+  recordDataAlloc(ptr, len*sizeof(Data_type));
+}
+
+template < typename Data_type >
+static void deallocAlignedData(Data_type*& ptr)
+{
+  if (ptr) {
+    recordDataDealloc(ptr);
+    RAJA::free_aligned(ptr);
+    ptr = 0;
+  }
+}
+
+template < typename Data_type >
+static void initFloatingData(Data_type* ptr, int len, VariantID vid)
+{
+  (void) vid;
+
+  Data_type factor = ( data_init_count % 2 ? 0.1 : 0.2 );
+
+// first touch...
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( vid == Base_OpenMP ||
+       vid == Lambda_OpenMP ||
+       vid == RAJA_OpenMP ) {
+    #pragma omp parallel for
+    for (int i = 0; i < len; ++i) {
+      ptr[i] = factor*(i + 1.1)/(i + 1.12345);
+    };
+  }
+#endif
+
+  for (int i = 0; i < len; ++i) {
+    ptr[i] = factor*(i + 1.1)/(i + 1.12345);
+  }
+
+  incDataInitCount();
+}
+
+template < typename Data_type >
+static void initFloatingDataConst(Data_type* ptr, int len, Data_type val,
+                                  VariantID vid)
+{
+
+// first touch...
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( vid == Base_OpenMP ||
+       vid == Lambda_OpenMP ||
+       vid == RAJA_OpenMP ) {
+    #pragma omp parallel for
+    for (int i = 0; i < len; ++i) {
+      ptr[i] = 0;
+    };
+  }
+#else
+  (void) vid;
+#endif
+
+  for (int i = 0; i < len; ++i) {
+    ptr[i] = val;
+  };
+
+  incDataInitCount();
+}
+
+template < typename Data_type >
+static long double calcFloatingChecksum(const Data_type* ptr, int len,
+                                        Real_type scale_factor)
+{
+  long double tchk = 0.0;
+  for (Index_type j = 0; j < len; ++j) {
+    tchk += (j+1)*ptr[j]*scale_factor;
+#if 0 // RDH DEBUG
+    if ( (j % 100) == 0 ) {
+      getCout() << "j : tchk = " << j << " : " << tchk << std::endl;
+    }
+#endif
+  }
+  return tchk;
+}
+
+template < typename Data_type >
+static void initFloatingDataRandSign(Data_type* ptr, int len, VariantID vid)
+{
+  (void) vid;
+
+// First touch...
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( vid == Base_OpenMP ||
+       vid == Lambda_OpenMP ||
+       vid == RAJA_OpenMP ) {
+    #pragma omp parallel for
+    for (int i = 0; i < len; ++i) {
+      ptr[i] = 0.0;
+    };
+  }
+#endif
+
+  Data_type factor = ( data_init_count % 2 ? 0.1 : 0.2 );
+
+  srand(4793);
+
+  for (int i = 0; i < len; ++i) {
+    Data_type signfact = Data_type(rand())/RAND_MAX;
+    signfact = ( signfact < 0.5 ? -1.0 : 1.0 );
+    ptr[i] = signfact*factor*(i + 1.1)/(i + 1.12345);
+  };
+
+  incDataInitCount();
+}
+
+template < typename Data_type >
+static void initFloatingDataRandValue(Data_type* ptr, int len, VariantID vid)
+{
+  (void) vid;
+
+// First touch...
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( vid == Base_OpenMP ||
+       vid == Lambda_OpenMP ||
+       vid == RAJA_OpenMP ) {
+    #pragma omp parallel for
+    for (int i = 0; i < len; ++i) {
+      ptr[i] = 0.0;
+    };
+  }
+#endif
+
+  srand(4793);
+
+  for (int i = 0; i < len; ++i) {
+    ptr[i] = Data_type(rand())/RAND_MAX;
+  };
+
+  incDataInitCount();
+}
+
+
 /*
  * Allocate and initialize aligned data arrays.
  */
 void allocAndInitData(Real_ptr& ptr, int len, VariantID vid )
 {
-  ptr =
-    RAJA::allocate_aligned_type<Real_type>(RAJA::DATA_ALIGN,
-                                           len*sizeof(Real_type));
+  allocAlignedData(ptr, len);
   initData(ptr, len, vid);
 }
 
 void allocAndInitDataConst(Real_ptr& ptr, int len, Real_type val,
                            VariantID vid)
 {
-  (void) vid;
-
-  ptr =
-    RAJA::allocate_aligned_type<Real_type>(RAJA::DATA_ALIGN,
-                                           len*sizeof(Real_type));
+  allocAlignedData(ptr, len);
   initDataConst(ptr, len, val, vid);
 }
 
 void allocAndInitDataRandSign(Real_ptr& ptr, int len, VariantID vid)
 {
-  ptr =
-    RAJA::allocate_aligned_type<Real_type>(RAJA::DATA_ALIGN,
-                                           len*sizeof(Real_type));
+  allocAlignedData(ptr, len);
   initDataRandSign(ptr, len, vid);
 }
 
 void allocAndInitDataRandValue(Real_ptr& ptr, int len, VariantID vid)
 {
-  ptr =
-    RAJA::allocate_aligned_type<Real_type>(RAJA::DATA_ALIGN,
-                                           len*sizeof(Real_type));
+  allocAlignedData(ptr, len);
   initDataRandValue(ptr, len, vid);
 }
 
@@ -87,9 +278,63 @@ void allocAndInitData(Complex_ptr& ptr, int len, VariantID vid)
 {
   // Should we do this differently for alignment?? If so, change dealloc()
   ptr = new Complex_type[len];
+  recordDataAlloc(ptr, len*sizeof(Complex_type));
   initData(ptr, len, vid);
 }
 
+/*
+ * Allocate and initialize aligned data arrays of a precision.
+ */
+void allocAndInitData(Precision_ptr& ptr, int len, PrecisionID pid,
+                      VariantID vid)
+{
+  if ( pid == Precision_Double ) {
+    allocAlignedData(ptr.get<Double_type>(), len);
+    initFloatingData(ptr.get<Double_type>(), len, vid);
+  } else {
+    allocAlignedData(ptr.get<Float_type>(), len);
+    initFloatingData(ptr.get<Float_type>(), len, vid);
+  }
+}
+
+void allocAndInitDataConst(Precision_ptr& ptr, int len, Real_type val,
+                           PrecisionID pid, VariantID vid)
+{
+  if ( pid == Precision_Double ) {
+    allocAlignedData(ptr.get<Double_type>(), len);
+    initFloatingDataConst(ptr.get<Double_type>(), len,
+                          static_cast<Double_type>(val), vid);
+  } else {
+    allocAlignedData(ptr.get<Float_type>(), len);
+    initFloatingDataConst(ptr.get<Float_type>(), len,
+                          static_cast<Float_type>(val), vid);
+  }
+}
+
+void allocAndInitDataRandSign(Precision_ptr& ptr, int len, PrecisionID pid,
+                              VariantID vid)
+{
+  if ( pid == Precision_Double ) {
+    allocAlignedData(ptr.get<Double_type>(), len);
+    initFloatingDataRandSign(ptr.get<Double_type>(), len, vid);
+  } else {
+    allocAlignedData(ptr.get<Float_type>(), len);
+    initFloatingDataRandSign(ptr.get<Float_type>(), len, vid);
+  }
+}
+
+void allocAndInitDataRandValue(Precision_ptr& ptr, int len, PrecisionID pid,
+                               VariantID vid)
+{
+  if ( pid == Precision_Double ) {
+    allocAlignedData(ptr.get<Double_type>(), len);
+    initFloatingDataRandValue(ptr.get<Double_type>(), len, vid);
+  } else {
+    allocAlignedData(ptr.get<Float_type>(), len);
+    initFloatingDataRandValue(ptr.get<Float_type>(), len, vid);
+  }
+}
+
 
 /*
  * Free data arrays of given type.
@@ -97,6 +342,7 @@ void allocAndInitData(Complex_ptr& ptr, int len, VariantID vid)
 void deallocData(Int_ptr& ptr)
 {
   if (ptr) {
+    recordDataDealloc(ptr);
     delete [] ptr;
     ptr = 0;
   }
@@ -104,20 +350,24 @@ void deallocData(Int_ptr& ptr)
 
 void deallocData(Real_ptr& ptr)
 {
-  if (ptr) {
-    RAJA::free_aligned(ptr);
-    ptr = 0;
-  }
+  deallocAlignedData(ptr);
 }
 
 void deallocData(Complex_ptr& ptr)
 {
   if (ptr) {
+    recordDataDealloc(ptr);
     delete [] ptr;
     ptr = 0;
   }
 }
 
+void deallocData(Precision_ptr& ptr)
+{
+  deallocAlignedData(ptr.get<Float_type>());
+  deallocAlignedData(ptr.get<Double_type>());
+}
+
 
 /*
  * \brief Initialize Int_type data array to
@@ -166,33 +416,13 @@ void initData(Int_ptr& ptr, int len, VariantID vid)
  */
 void initData(Real_ptr& ptr, int len, VariantID vid)
 {
-  (void) vid;
-
-  Real_type factor = ( data_init_count % 2 ? 0.1 : 0.2 );
-
-// first touch...
-#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
-  if ( vid == Base_OpenMP ||
-       vid == Lambda_OpenMP ||
-       vid == RAJA_OpenMP ) {
-    #pragma omp parallel for
-    for (int i = 0; i < len; ++i) {
-      ptr[i] = factor*(i + 1.1)/(i + 1.12345);
-    };
-  }
-#endif
-
-  for (int i = 0; i < len; ++i) {
-    ptr[i] = factor*(i + 1.1)/(i + 1.12345);
-  }
-
-  incDataInitCount();
+  initFloatingData(ptr, len, vid);
 }
 
 /*
- * Initialize Real_type data array to constant values.
+ * Initialize Int_type data array to constant values.
  */
-void initDataConst(Real_ptr& ptr, int len, Real_type val,
+void initDataConst(Int_ptr& ptr, int len, Int_type val,
                    VariantID vid)
 {
 
@@ -217,36 +447,21 @@ void initDataConst(Real_ptr& ptr, int len, Real_type val,
   incDataInitCount();
 }
 
+/*
+ * Initialize Real_type data array to constant values.
+ */
+void initDataConst(Real_ptr& ptr, int len, Real_type val,
+                   VariantID vid)
+{
+  initFloatingDataConst(ptr, len, val, vid);
+}
+
 /*
  * Initialize Real_type data array with random sign.
  */
 void initDataRandSign(Real_ptr& ptr, int len, VariantID vid)
 {
-  (void) vid;
-
-// First touch...
-#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
-  if ( vid == Base_OpenMP ||
-       vid == Lambda_OpenMP ||
-       vid == RAJA_OpenMP ) {
-    #pragma omp parallel for
-    for (int i = 0; i < len; ++i) {
-      ptr[i] = 0.0;
-    };
-  }
-#endif
-
-  Real_type factor = ( data_init_count % 2 ? 0.1 : 0.2 );
-
-  srand(4793);
-
-  for (int i = 0; i < len; ++i) {
-    Real_type signfact = Real_type(rand())/RAND_MAX;
-    signfact = ( signfact < 0.5 ? -1.0 : 1.0 );
-    ptr[i] = signfact*factor*(i + 1.1)/(i + 1.12345);
-  };
-
-  incDataInitCount();
+  initFloatingDataRandSign(ptr, len, vid);
 }
 
 /*
@@ -254,27 +469,7 @@ void initDataRandSign(Real_ptr& ptr, int len, VariantID vid)
  */
 void initDataRandValue(Real_ptr& ptr, int len, VariantID vid)
 {
-  (void) vid;
-
-// First touch...
-#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
-  if ( vid == Base_OpenMP ||
-       vid == Lambda_OpenMP ||
-       vid == RAJA_OpenMP ) {
-    #pragma omp parallel for
-    for (int i = 0; i < len; ++i) {
-      ptr[i] = 0.0;
-    };
-  }
-#endif
-
-  srand(4793);
-
-  for (int i = 0; i < len; ++i) {
-    ptr[i] = Real_type(rand())/RAND_MAX;
-  };
-
-  incDataInitCount();
+  initFloatingDataRandValue(ptr, len, vid);
 }
 
 /*
@@ -324,10 +519,25 @@ void initData(Real_type& d, VariantID vid)
  */
 long double calcChecksum(const Real_ptr ptr, int len,
                          Real_type scale_factor)
+{
+  return calcFloatingChecksum(ptr, len, scale_factor);
+}
+
+long double calcChecksum(const Precision_ptr& ptr, int len,
+                         Real_type scale_factor)
+{
+  if ( ptr.double_ptr ) {
+    return calcFloatingChecksum(ptr.double_ptr, len, scale_factor);
+  }
+  return calcFloatingChecksum(ptr.float_ptr, len, scale_factor);
+}
+
+long double calcChecksum(const Complex_ptr ptr, int len,
+                         Real_type scale_factor)
 {
   long double tchk = 0.0;
   for (Index_type j = 0; j < len; ++j) {
-    tchk += (j+1)*ptr[j]*scale_factor;
+    tchk += (j+1)*(real(ptr[j])+imag(ptr[j]))*scale_factor;
 #if 0 // RDH DEBUG
     if ( (j % 100) == 0 ) {
       getCout() << "j : tchk = " << j << " : " << tchk << std::endl;
@@ -337,17 +547,12 @@ long double calcChecksum(const Real_ptr ptr, int len,
   return tchk;
 }
 
-long double calcChecksum(const Complex_ptr ptr, int len,
+long double calcChecksum(const Int_ptr ptr, int len,
                          Real_type scale_factor)
 {
   long double tchk = 0.0;
   for (Index_type j = 0; j < len; ++j) {
-    tchk += (j+1)*(real(ptr[j])+imag(ptr[j]))*scale_factor;
-#if 0 // RDH DEBUG
-    if ( (j % 100) == 0 ) {
-      getCout() << "j : tchk = " << j << " : " << tchk << std::endl;
-    }
-#endif
+    tchk += (j+1)*ptr[j]*scale_factor;
   }
   return tchk;
 }
@@ -42,6 +42,24 @@ void resetDataInitCount();
  */
 void incDataInitCount();
 
+/*!
+ * \brief Return number of bytes currently allocated by the data
+ *        allocation methods below.
+ */
+size_t getDataAllocBytes();
+
+/*!
+ * \brief Return largest number of bytes allocated at once by the data
+ *        allocation methods below since the last call to
+ *        resetDataAllocPeak().
+ */
+size_t getDataAllocPeak();
+
+/*!
+ * \brief Reset peak allocated bytes to the number currently allocated.
+ */
+void resetDataAllocPeak();
+
 
 /*!
  * \brief Allocate and initialize Int_type data array.
@@ -51,6 +69,15 @@ void incDataInitCount();
 void allocAndInitData(Int_ptr& ptr, int len,
                       VariantID vid = NumVariants);
 
+/*!
+ * \brief Allocate and initialize Int_type data array.
+ * 
+ * Array entries are initialized using the method 
+ * initDataConst(Int_ptr& ptr...) below.
+ */
+void allocAndInitDataConst(Int_ptr& ptr, int len, Int_type val,
+                           VariantID vid = NumVariants);
+
 /*!
  * \brief Allocate and initialize aligned Real_type data array.
  *
@@ -91,6 +118,43 @@ void allocAndInitDataRandValue(Real_ptr& ptr, int len,
 void allocAndInitData(Complex_ptr& ptr, int len,
                       VariantID vid = NumVariants);
 
+/*!
+ * \brief Allocate and initialize aligned data array of a kernel templated
+ *        on its value type, with the type of the given precision (mixed
+ *        precision data is Float_type).
+ *
+ * Array is initialized like allocAndInitData(Real_ptr& ptr...) above.
+ */
+void allocAndInitData(Precision_ptr& ptr, int len, PrecisionID pid,
+                      VariantID vid = NumVariants);
+
+/*!
+ * \brief Allocate and initialize aligned data array of a kernel templated
+ *        on its value type, with the type of the given precision.
+ *
+ * Array entries are set to given constant value.
+ */
+void allocAndInitDataConst(Precision_ptr& ptr, int len, Real_type val,
+                           PrecisionID pid, VariantID vid = NumVariants);
+
+/*!
+ * \brief Allocate and initialize aligned data array of a kernel templated
+ *        on its value type, with random sign.
+ *
+ * Array is initialized like allocAndInitDataRandSign(Real_ptr& ptr...) above.
+ */
+void allocAndInitDataRandSign(Precision_ptr& ptr, int len, PrecisionID pid,
+                              VariantID vid = NumVariants);
+
+/*!
+ * \brief Allocate and initialize aligned data array of a kernel templated
+ *        on its value type, with random values.
+ *
+ * Array is initialized like allocAndInitDataRandValue(Real_ptr& ptr...) above.
+ */
+void allocAndInitDataRandValue(Precision_ptr& ptr, int len, PrecisionID pid,
+                               VariantID vid = NumVariants);
+
 
 /*!
  * \brief Free data arrays.
@@ -100,6 +164,8 @@ void deallocData(Int_ptr& ptr);
 void deallocData(Real_ptr& ptr);
 ///
 void deallocData(Complex_ptr& ptr);
+///
+void deallocData(Precision_ptr& ptr);
 
 
 /*!
@@ -122,6 +188,14 @@ void initData(Int_ptr& ptr, int len,
 void initData(Real_ptr& ptr, int len,
               VariantID vid = NumVariants);
 
+/*!
+ * \brief Initialize Int_type data array.
+ *
+ * Array entries are set to given constant value.
+ */
+void initDataConst(Int_ptr& ptr, int len, Int_type val,
+                   VariantID vid = NumVariants);
+
 /*!
  * \brief Initialize Real_type data array.
  *
@@ -178,6 +252,12 @@ long double calcChecksum(Real_ptr d, int len,
 ///
 long double calcChecksum(Complex_ptr d, int len,
                          Real_type scale_factor = 1.0);
+///
+long double calcChecksum(Int_ptr d, int len,
+                         Real_type scale_factor = 1.0);
+///
+long double calcChecksum(const Precision_ptr& d, int len,
+                         Real_type scale_factor = 1.0);
 
 
 /*!
@@ -0,0 +1,192 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "Energy.hpp"
+
+#include <cstdlib>
+#include <fstream>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace rajaperf
+{
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Array of names for each domain in EnergyDomain enum.
+ *
+ * IMPORTANT: This is only modified when a domain is added or removed.
+ *
+ *            ENUM VALUES MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE)
+ *            WITH ARRAY OF DOMAIN NAMES BELOW!!!
+ *
+ *******************************************************************************
+ */
+static const std::string EnergyDomainNames [] =
+{
+
+  std::string("Package"),
+  std::string("DRAM"),
+
+  std::string("Unknown Domain")  // Keep this at the end and DO NOT remove....
+
+}; // END EnergyDomainNames
+
+
+/*
+ * An open RAPL energy counter; there is one per domain per package.
+ */
+struct EnergyCounter
+{
+  EnergyDomain domain;
+  int fd;                 // open energy_uj file
+  uint64_t max_range;     // value (microjoules) at which counter wraps
+};
+
+static const std::string powercap_dir("/sys/class/powercap");
+
+static std::vector<EnergyCounter> energy_counters;
+
+/*
+ * Read value of counter in open sysfs file; returns false on error.
+ */
+static bool readCounter(int fd, uint64_t& value)
+{
+  char buf[32];
+  ssize_t len = pread(fd, buf, sizeof(buf)-1, 0);
+  if ( len <= 0 ) {
+    return false;
+  }
+  buf[len] = '\0';
+  value = strtoull(buf, nullptr, 10);
+  return true;
+}
+
+
+const std::string& getEnergyDomainName(EnergyDomain ed)
+{
+  return EnergyDomainNames[ed];
+}
+
+bool initEnergyCounters()
+{
+  finalizeEnergyCounters();
+
+  DIR* dir = opendir(powercap_dir.c_str());
+  if ( !dir ) {
+    return false;
+  }
+
+  //
+  // Every RAPL zone and subzone has an entry named intel-rapl:<n>[:<m>],
+  // on AMD processors too. Packages are named package-<n> and their DRAM
+  // subzones dram; other zones (core, uncore, psys) are not used.
+  //
+  const std::string zone_prefix("intel-rapl:");
+  struct dirent* entry;
+  while ( (entry = readdir(dir)) != nullptr ) {
+    std::string zone(entry->d_name);
+    if ( zone.compare(0, zone_prefix.size(), zone_prefix) != 0 ) {
+      continue;
+    }
+    std::string zone_path = powercap_dir + "/" + zone;
+
+    std::string name;
+    {
+      std::ifstream name_file((zone_path + "/name").c_str());
+      name_file >> name;
+    }
+
+    EnergyCounter counter;
+    if ( name.compare(0, 8, "package-") == 0 ) {
+      counter.domain = Energy_Package;
+    } else if ( name == "dram" ) {
+      counter.domain = Energy_DRAM;
+    } else {
+      continue;
+    }
+
+    counter.max_range = 0;
+    {
+      std::ifstream range_file((zone_path + "/max_energy_range_uj").c_str());
+      range_file >> counter.max_range;
+    }
+
+    counter.fd = open((zone_path + "/energy_uj").c_str(), O_RDONLY);
+    uint64_t value;
+    if ( counter.fd < 0 ) {
+      continue;
+    }
+    if ( counter.max_range == 0 || !readCounter(counter.fd, value) ) {
+      close(counter.fd);
+      continue;
+    }
+
+    energy_counters.push_back(counter);
+  }
+  closedir(dir);
+
+  return !energy_counters.empty();
+}
+
+void finalizeEnergyCounters()
+{
+  for (size_t i = 0; i < energy_counters.size(); ++i) {
+    close(energy_counters[i].fd);
+  }
+  energy_counters.clear();
+}
+
+bool haveEnergyCounters()
+{
+  return !energy_counters.empty();
+}
+
+bool haveEnergyDomain(EnergyDomain ed)
+{
+  for (size_t i = 0; i < energy_counters.size(); ++i) {
+    if ( energy_counters[i].domain == ed ) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void readEnergyCounters(EnergySample& sample)
+{
+  sample.resize(energy_counters.size());
+  for (size_t i = 0; i < energy_counters.size(); ++i) {
+    if ( !readCounter(energy_counters[i].fd, sample[i]) ) {
+      sample[i] = 0;
+    }
+  }
+}
+
+void getEnergyJoules(const EnergySample& start, const EnergySample& stop,
+                     double joules[NumEnergyDomains])
+{
+  for (size_t ed = 0; ed < NumEnergyDomains; ++ed) {
+    joules[ed] = 0.0;
+  }
+
+  for (size_t i = 0; i < energy_counters.size() &&
+                     i < start.size() && i < stop.size(); ++i) {
+    uint64_t delta;
+    if ( stop[i] >= start[i] ) {
+      delta = stop[i] - start[i];
+    } else {
+      delta = energy_counters[i].max_range - start[i] + stop[i];
+    }
+    joules[energy_counters[i].domain] += static_cast<double>(delta) * 1.0e-6;
+  }
+}
+
+}  // closing brace for rajaperf namespace
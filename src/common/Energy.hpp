@@ -0,0 +1,96 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Energy measurement with RAPL counters read through the Linux powercap
+/// interface (/sys/class/powercap).
+///
+
+#ifndef RAJAPerf_Energy_HPP
+#define RAJAPerf_Energy_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Enumeration defining unique id for each energy domain measured.
+ *
+ * Each domain is summed over all packages (sockets) of the node.
+ *
+ * IMPORTANT: This is only modified when a domain is added or removed.
+ *
+ *            ENUM VALUES MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE)
+ *            WITH ARRAY OF DOMAIN NAMES IN IMPLEMENTATION FILE!!!
+ *
+ *******************************************************************************
+ */
+enum EnergyDomain {
+
+  Energy_Package = 0,
+  Energy_DRAM,
+
+  NumEnergyDomains // Keep this one last and NEVER comment out (!!)
+
+};
+
+/*!
+ * \brief Return name associated with energy domain id.
+ */
+const std::string& getEnergyDomainName(EnergyDomain ed);
+
+/*!
+ * \brief Find and open readable RAPL energy counters.
+ *
+ * Returns false, leaving energy measurement disabled, if there are none;
+ * e.g., the machine has no powercap interface or its counters may only be
+ * read by root.
+ */
+bool initEnergyCounters();
+
+/*!
+ * \brief Close energy counters and disable energy measurement.
+ */
+void finalizeEnergyCounters();
+
+/*!
+ * \brief Return true if energy counters were opened successfully.
+ */
+bool haveEnergyCounters();
+
+/*!
+ * \brief Return true if there is a counter for given energy domain.
+ */
+bool haveEnergyDomain(EnergyDomain ed);
+
+/*!
+ * \brief Counter values (microjoules) read at one time.
+ */
+using EnergySample = std::vector<uint64_t>;
+
+/*!
+ * \brief Read current values of all energy counters.
+ */
+void readEnergyCounters(EnergySample& sample);
+
+/*!
+ * \brief Energy (joules) used in each domain between two samples.
+ *
+ * A counter that wrapped around once between the samples is accounted for.
+ */
+void getEnergyJoules(const EnergySample& start, const EnergySample& stop,
+                     double joules[NumEnergyDomains]);
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
@@ -11,6 +11,7 @@
 
 #include "common/KernelBase.hpp"
 #include "common/OutputUtils.hpp"
+#include "common/Annotation.hpp"
 
 #ifdef RAJA_PERFSUITE_ENABLE_MPI
 #include <mpi.h>
@@ -22,8 +23,12 @@
 #include "algorithm/SORT.hpp"
 
 #include <list>
+#include <map>
+#include <tuple>
+#include <limits>
 #include <vector>
 #include <string>
+#include <algorithm>
 
 #include <iostream>
 #include <iomanip>
@@ -31,7 +36,15 @@
 #include <fstream>
 #include <cmath>
 
+#include <cstdlib>
+#include <ctime>
+
 #include <unistd.h>
+#include <sys/utsname.h>
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+#include <omp.h>
+#endif
 
 
 namespace rajaperf {
@@ -40,7 +53,8 @@ using namespace std;
 
 Executor::Executor(int argc, char** argv)
   : run_params(argc, argv),
-    reference_vid(NumVariants)
+    reference_vid(NumVariants),
+    compare_passed(true)
 {
 }
 
@@ -50,6 +64,7 @@ Executor::~Executor()
   for (size_t ik = 0; ik < kernels.size(); ++ik) {
     delete kernels[ik];
   }
+  finalizeEnergyCounters();
 }
 
 
@@ -527,11 +542,7 @@ void Executor::setupSuite()
 
     for (KIDset::iterator kid = run_kern.begin();
          kid != run_kern.end(); ++kid) {
-///   RDH DISABLE COUPLE KERNEL until we find a reasonable way to do
-///   complex numbers in GPU code
-      if ( *kid != Apps_COUPLE ) {
-        kernels.push_back( getKernelObject(*kid, run_params) );
-      }
+      kernels.push_back( getKernelObject(*kid, run_params) );
     }
 
     if ( !(run_params.getInvalidVariantInput().empty()) ||
@@ -546,18 +557,145 @@ void Executor::setupSuite()
         variant_ids.push_back( *vid );
       }
 
+      //
+      // Determine tunings to run for each variant. The set of tuning
+      // names of all kernels is only used to validate tuning input.
+      //
+      set<string> all_tunings;
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+        for (size_t ik = 0; ik < kernels.size(); ++ik) {
+          KernelBase* kern = kernels[ik];
+          for (size_t t = 0; t < kern->getNumVariantTunings(vid); ++t) {
+            all_tunings.insert( kern->getVariantTuningName(vid, t) );
+          }
+        }
+      }
+
+      const vector<string>& tuning_in = run_params.getTuningInput();
+      const vector<string>& exclude_tuning_in =
+        run_params.getExcludeTuningInput();
+
+      vector<string> invalid;
+      for (size_t it = 0; it < tuning_in.size(); ++it) {
+        if ( all_tunings.find(tuning_in[it]) == all_tunings.end() ) {
+          invalid.push_back(tuning_in[it]);
+        }
+      }
+      run_params.setInvalidTuningInput(invalid);
+
+      invalid.clear();
+      for (size_t it = 0; it < exclude_tuning_in.size(); ++it) {
+        if ( all_tunings.find(exclude_tuning_in[it]) == all_tunings.end() ) {
+          invalid.push_back(exclude_tuning_in[it]);
+        }
+      }
+      run_params.setInvalidExcludeTuningInput(invalid);
+
+      const vector<string>& precision_in = run_params.getPrecisionInput();
+
+      invalid.clear();
+      for (size_t ip = 0; ip < precision_in.size(); ++ip) {
+        bool valid = false;
+        for (size_t pid = 0; pid < NumPrecisions; ++pid) {
+          if ( precision_in[ip] ==
+               getPrecisionName(static_cast<PrecisionID>(pid)) ) {
+            valid = true;
+          }
+        }
+        if ( !valid ) {
+          invalid.push_back(precision_in[ip]);
+        }
+      }
+      run_params.setInvalidPrecisionInput(invalid);
+
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+        for (size_t ik = 0; ik < kernels.size(); ++ik) {
+          KernelBase* kern = kernels[ik];
+          for (size_t t = 0; t < kern->getNumVariantTunings(vid); ++t) {
+            const string& tname = kern->getVariantTuningName(vid, t);
+            bool selected =
+              ( tuning_in.empty() ||
+                find(tuning_in.begin(), tuning_in.end(), tname) !=
+                  tuning_in.end() ) &&
+              find(exclude_tuning_in.begin(), exclude_tuning_in.end(), tname) ==
+                exclude_tuning_in.end() &&
+              ( precision_in.empty() || !kern->hasTuningPrecision(tname) ||
+                find(precision_in.begin(), precision_in.end(),
+                     getPrecisionName(kern->getTuningPrecision(tname))) !=
+                  precision_in.end() );
+            if ( selected &&
+                 find(tuning_names[vid].begin(), tuning_names[vid].end(),
+                      tname) == tuning_names[vid].end() ) {
+              tuning_names[vid].push_back(tname);
+            }
+          }
+        }
+      }
+
+      if ( !(run_params.getInvalidTuningInput().empty()) ||
+           !(run_params.getInvalidExcludeTuningInput().empty()) ||
+           !(run_params.getInvalidPrecisionInput().empty()) ) {
+
+        run_params.setInputState(RunParams::BadInput);
+
       //
       // If we've gotten to this point, we have good input to run.
       //
-      if ( run_params.getInputState() != RunParams::DryRun &&
-           run_params.getInputState() != RunParams::CheckRun ) {
+      } else if ( run_params.getInputState() != RunParams::DryRun &&
+                  run_params.getInputState() != RunParams::CheckRun ) {
         run_params.setInputState(RunParams::PerfRun);
       }
 
+      if ( run_params.getInputState() != RunParams::BadInput &&
+           !run_params.getResumeLogName().empty() &&
+           !readRunLog(run_params.getResumeLogName()) ) {
+        run_params.setInputState(RunParams::BadInput);
+      }
+
     } // kernel and variant input both look good
 
   } // if kernel input looks good
 
+  in_state = run_params.getInputState();
+  if ( in_state == RunParams::PerfRun ||
+       in_state == RunParams::CheckRun ||
+       in_state == RunParams::DryRun ) {
+
+    //
+    // Calibrate timer before any kernel runs. With MPI, all ranks use the
+    // coarsest resolution and largest overhead measured on any rank so
+    // they flag the same times as unreliable.
+    //
+    setTimer(run_params.getTimerID());
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+    TimerCalibration calibration = getTimerCalibration();
+    double local_vals[2] = { calibration.resolution, calibration.overhead };
+    double max_vals[2];
+    MPI_Allreduce(local_vals, max_vals, 2, MPI_DOUBLE, MPI_MAX,
+                  MPI_COMM_WORLD);
+    calibration.resolution = max_vals[0];
+    calibration.overhead = max_vals[1];
+    setTimerCalibration(calibration);
+#endif
+
+    //
+    // Energy is only measured if counters can be read on all ranks.
+    //
+    if ( run_params.measureEnergy() ) {
+      int have_energy = initEnergyCounters() ? 1 : 0;
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+      int local_have_energy = have_energy;
+      MPI_Allreduce(&local_have_energy, &have_energy, 1, MPI_INT, MPI_MIN,
+                    MPI_COMM_WORLD);
+#endif
+      if ( !have_energy ) {
+        finalizeEnergyCounters();
+      }
+    }
+  }
+
 }
 
 
@@ -615,6 +753,39 @@ void Executor::reportRunSummary(ostream& str) const
       str << "\t Kernel size = " << run_params.getSize() << endl;
     }
     str << "\t Kernel rep factor = " << run_params.getRepFactor() << endl;
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+    {
+      int num_ranks;
+      MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+      str << "\t # MPI ranks = " << num_ranks << ", "
+          << RunParams::ScalingModeToStr(run_params.getScalingMode())
+          << " scaling ("
+          << ( run_params.getScalingMode() == RunParams::ScalingMode::Strong ?
+               "kernel size is divided among ranks" :
+               "each rank runs the full kernel size" )
+          << ")" << endl;
+    }
+#endif
+    {
+      const TimerCalibration& calibration = getTimerCalibration();
+      str << "\t Timer = " << getTimerName(getTimer())
+          << " (resolution = " << calibration.resolution * 1.0e9
+          << " ns, overhead = " << calibration.overhead * 1.0e9 << " ns)"
+          << endl;
+    }
+    if ( run_params.measureEnergy() ) {
+      str << "\t Energy domains =";
+      if ( haveEnergyCounters() ) {
+        for (size_t ed = 0; ed < NumEnergyDomains; ++ed) {
+          if ( haveEnergyDomain(static_cast<EnergyDomain>(ed)) ) {
+            str << " " << getEnergyDomainName(static_cast<EnergyDomain>(ed));
+          }
+        }
+      } else {
+        str << " none (no readable RAPL counters, energy will not be reported)";
+      }
+      str << endl;
+    }
     str << "\t Output files will be named " << ofiles << endl;
 
     str << "\nThe following kernels and variants (when available for a kernel) will be run:" << endl;
@@ -622,7 +793,16 @@ void Executor::reportRunSummary(ostream& str) const
     str << "\nVariants"
         << "\n--------\n";
     for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-      str << getVariantName(variant_ids[iv]) << endl;
+      VariantID vid = variant_ids[iv];
+      str << getVariantName(vid);
+      if ( tuning_names[vid].size() > 1 ) {
+        str << " (tunings:";
+        for (size_t t = 0; t < tuning_names[vid].size(); ++t) {
+          str << " " << tuning_names[vid][t];
+        }
+        str << ")";
+      }
+      str << endl;
     }
 
     str << endl;
@@ -742,6 +922,64 @@ void Executor::writeKernelInfoSummary(ostream& str, bool to_file) const
 }
 
 
+/*
+ * Run log columns of each rank after its time and checksum, holding the
+ * memory and energy samples of the pass.
+ */
+static vector<string> getRunLogSampleColumns()
+{
+  vector<string> columns{ "Mem Samples", "Alloc Bytes",
+                          "SetUp Minor Faults", "SetUp Major Faults",
+                          "Timed Minor Faults", "Timed Major Faults",
+                          "Energy Samples" };
+  for (size_t ed = 0; ed < NumEnergyDomains; ++ed) {
+    columns.push_back(
+      getEnergyDomainName(static_cast<EnergyDomain>(ed)) + " Energy");
+  }
+  columns.push_back("Energy Time");
+  return columns;
+}
+
+/*
+ * Append the samples of a pass, the difference of the samples of a kernel
+ * variant tuning after and before it ran, to vals in run log column order.
+ * The largest allocation so far stands in for that of the pass.
+ */
+static void packRunLogSamples(const KernelBase::Samples& before,
+                              const KernelBase::Samples& after,
+                              vector<double>& vals)
+{
+  vals.push_back(after.num_mem_samples - before.num_mem_samples);
+  vals.push_back(after.alloc_bytes);
+  vals.push_back(after.setup_minor_faults - before.setup_minor_faults);
+  vals.push_back(after.setup_major_faults - before.setup_major_faults);
+  vals.push_back(after.timed_minor_faults - before.timed_minor_faults);
+  vals.push_back(after.timed_major_faults - before.timed_major_faults);
+  vals.push_back(after.num_energy_samples - before.num_energy_samples);
+  for (size_t ed = 0; ed < NumEnergyDomains; ++ed) {
+    vals.push_back(after.timed_energy[ed] - before.timed_energy[ed]);
+  }
+  vals.push_back(after.energy_time - before.energy_time);
+}
+
+static KernelBase::Samples unpackRunLogSamples(const vector<double>& vals)
+{
+  KernelBase::Samples samples;
+  size_t iv = 0;
+  samples.num_mem_samples = static_cast<int>(vals[iv++]);
+  samples.alloc_bytes = static_cast<size_t>(vals[iv++]);
+  samples.setup_minor_faults = static_cast<long>(vals[iv++]);
+  samples.setup_major_faults = static_cast<long>(vals[iv++]);
+  samples.timed_minor_faults = static_cast<long>(vals[iv++]);
+  samples.timed_major_faults = static_cast<long>(vals[iv++]);
+  samples.num_energy_samples = static_cast<int>(vals[iv++]);
+  for (size_t ed = 0; ed < NumEnergyDomains; ++ed) {
+    samples.timed_energy[ed] = vals[iv++];
+  }
+  samples.energy_time = vals[iv++];
+  return samples;
+}
+
 void Executor::runSuite()
 {
   RunParams::InputOpt in_state = run_params.getInputState();
@@ -772,13 +1010,27 @@ void Executor::runSuite()
         getCout() << getVariantName(vid) << " variant" << endl;
       }
       if ( warmup_kernel->hasVariantDefined(vid) ) {
-        warmup_kernel->execute(vid);
+        warmup_kernel->execute(vid, 0);
       }
     }
     delete warmup_kernels[ik];
   }
 
 
+  openRunLog();
+
+  //
+  // The run log has created the output directory on rank 0 by now.
+  //
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+  MPI_Barrier(MPI_COMM_WORLD);
+#endif
+  string outdir = recursiveMkdir(run_params.getOutputDirName());
+  string out_fprefix = ( outdir.empty() ? string(".") : outdir ) + "/" +
+                       run_params.getOutputFilePrefix();
+  setAnnotationBackend(
+    makeAnnotationBackend(run_params.getAnnotationName(), out_fprefix) );
+
   getCout() << "\n\nRunning specified kernels and variants...\n";
 
   const int npasses = run_params.getNumPasses();
@@ -787,6 +1039,9 @@ void Executor::runSuite()
       getCout() << "\nPass through suite # " << ip << "\n";
     }
 
+    const string pass_name = "Pass " + to_string(ip);
+    beginAnnotation(pass_name.c_str());
+
     for (size_t ik = 0; ik < kernels.size(); ++ik) {
       KernelBase* kernel = kernels[ik];
       if ( run_params.showProgress() ) {
@@ -796,23 +1051,318 @@ void Executor::runSuite()
       for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
          VariantID vid = variant_ids[iv];
          KernelBase* kern = kernels[ik];
-         if ( run_params.showProgress() ) {
-           if ( kern->hasVariantDefined(vid) ) {
-             getCout() << "   Running ";
-           } else {
-             getCout() << "   No ";
-           }
-           getCout() << getVariantName(vid) << " variant" << endl;
-         }
-         if ( kern->hasVariantDefined(vid) ) {
-           kernels[ik]->execute(vid);
+         if ( run_params.showProgress() && !kern->hasVariantDefined(vid) ) {
+           getCout() << "   No " << getVariantName(vid) << " variant" << endl;
          }
+         for (size_t t = 0; t < kern->getNumVariantTunings(vid); ++t) {
+           const string& tname = kern->getVariantTuningName(vid, t);
+           if ( find(tuning_names[vid].begin(), tuning_names[vid].end(),
+                     tname) == tuning_names[vid].end() ) {
+             continue;
+           }
+           auto resumed = resumed_results.find(
+             make_tuple(kern->getName(), getVariantTuningColumnName(vid, tname), ip));
+           if ( resumed != resumed_results.end() ) {
+             if ( run_params.showProgress() ) {
+               getCout() << "   Resumed "
+                         << getVariantTuningColumnName(vid, tname)
+                         << " variant from run log" << endl;
+             }
+             kern->restoreExecution(vid, t, resumed->second.time,
+                                    resumed->second.checksum,
+                                    unpackRunLogSamples(resumed->second.samples));
+             continue;
+           }
+           if ( run_params.showProgress() ) {
+             getCout() << "   Running "
+                       << getVariantTuningColumnName(vid, tname)
+                       << " variant" << endl;
+           }
+           KernelBase::Samples prev_samples = kern->getSamples(vid, t);
+           kernels[ik]->execute(vid, t);
+           writeRunLogRecord(kern, vid, t, ip, prev_samples);
+         } // loop over tunings
       } // loop over variants
 
     } // loop over kernels
 
+    endAnnotation(pass_name.c_str());
+
   } // loop over passes through suite
 
+  setAnnotationBackend(nullptr);
+
+}
+
+/*
+ * Return the run log header lines recording the parameters that results in
+ * the log depend on: the number of passes and, for each kernel run, its
+ * problem size, reps, and variant tunings (which reflect the selected
+ * precisions).
+ */
+vector<string> Executor::getRunLogParams() const
+{
+  vector<string> params;
+  params.push_back("# Passes : " + to_string(run_params.getNumPasses()));
+
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    KernelBase* kern = kernels[ik];
+    string line = "# " + kern->getName() +
+                  " : Size " + to_string(kern->getTargetProblemSize()) +
+                  " , Reps " + to_string(kern->getRunReps()) + " ,";
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      VariantID vid = variant_ids[iv];
+      for (size_t t = 0; t < kern->getNumVariantTunings(vid); ++t) {
+        const string& tname = kern->getVariantTuningName(vid, t);
+        if ( find(tuning_names[vid].begin(), tuning_names[vid].end(),
+                  tname) != tuning_names[vid].end() ) {
+          line += " " + getVariantTuningColumnName(vid, tname);
+        }
+      }
+    }
+    params.push_back(line);
+  }
+
+  return params;
+}
+
+/*
+ * Open run log that results of each kernel variant tuning pass are written
+ * to as soon as it has run; when resuming a run, its log is appended to.
+ */
+void Executor::openRunLog()
+{
+  int rank = 0;
+  int num_ranks = 1;
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+#endif
+
+  if ( rank != 0 ) {
+    run_log.reset(makeNullStream());
+    return;
+  }
+
+  string log_name = run_params.getResumeLogName();
+  if ( !log_name.empty() ) {
+
+    //
+    // Start on a new line if the interrupted run stopped mid-line.
+    //
+    bool need_newline = false;
+    {
+      ifstream in(log_name.c_str(), ios::in | ios::binary);
+      in.seekg(0, ios::end);
+      if ( in && in.tellg() > 0 ) {
+        char last = '\n';
+        in.seekg(-1, ios::end);
+        in.get(last);
+        need_newline = ( last != '\n' );
+      }
+    }
+
+    run_log.reset(new ofstream(log_name.c_str(), ios::out | ios::app));
+    if ( need_newline ) {
+      *run_log << endl;
+    }
+
+  } else {
+
+    string outdir = recursiveMkdir(run_params.getOutputDirName());
+    log_name = ( outdir.empty() ? string(".") : outdir ) + "/" +
+               run_params.getOutputFilePrefix() + "-run.log";
+
+    run_log.reset(new ofstream(log_name.c_str(), ios::out | ios::trunc));
+
+    const vector<string> params = getRunLogParams();
+    for (size_t ip = 0; ip < params.size(); ++ip) {
+      *run_log << params[ip] << endl;
+    }
+
+    const vector<string> sample_columns = getRunLogSampleColumns();
+
+    *run_log << "Kernel , Variant , Pass";
+    for (int r = 0; r < num_ranks; ++r) {
+      string rank_str = ( num_ranks > 1 ) ? " Rank " + to_string(r) : "";
+      *run_log << " ," << rank_str << " Time ," << rank_str << " Checksum";
+      for (size_t ic = 0; ic < sample_columns.size(); ++ic) {
+        *run_log << " ," << rank_str << " " << sample_columns[ic];
+      }
+    }
+    *run_log << endl;
+
+  }
+
+  if ( !*run_log ) {
+    getCout() << " ERROR: Can't open run log file " << log_name << endl;
+  }
+}
+
+/*
+ * Append time, checksum, and memory and energy samples of the given pass of
+ * a kernel variant tuning that just ran to the run log; prev_samples are
+ * its samples before the pass. With MPI, results of all ranks go on one
+ * line; all ranks must call this collectively.
+ */
+void Executor::writeRunLogRecord(KernelBase* kern, VariantID vid,
+                                 size_t tune_idx, int pass,
+                                 const KernelBase::Samples& prev_samples)
+{
+  Checksum_type cksum = kern->getChecksum(vid, tune_idx);
+
+  vector<double> vals(1, kern->getPassTimes(vid, tune_idx).back());
+  packRunLogSamples(prev_samples, kern->getSamples(vid, tune_idx), vals);
+  const size_t nvals = vals.size();
+
+  vector<Checksum_type> cksums(1, cksum);
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+  int rank;
+  int num_ranks;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+  vector<double> rank_vals(vals);
+  vals.resize( rank == 0 ? num_ranks * nvals : 0 );
+  cksums.resize( rank == 0 ? num_ranks : 0 );
+  MPI_Gather(rank_vals.data(), nvals, MPI_DOUBLE,
+             vals.data(), nvals, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+  MPI_Gather(&cksum, 1, Checksum_MPI_type,
+             cksums.data(), 1, Checksum_MPI_type, 0, MPI_COMM_WORLD);
+#endif
+
+  ostream& log = *run_log;
+  log << kern->getName() << " , "
+      << getVariantTuningColumnName(vid, kern->getVariantTuningName(vid, tune_idx))
+      << " , " << pass;
+  for (size_t r = 0; r < cksums.size(); ++r) {
+    const double* rank_vals = &vals[r * nvals];
+    log << " , " << setprecision(numeric_limits<double>::max_digits10)
+        << rank_vals[0]
+        << " , " << setprecision(numeric_limits<Checksum_type>::max_digits10)
+        << cksums[r];
+    for (size_t iv = 1; iv < nvals; ++iv) {
+      log << " , " << setprecision(numeric_limits<double>::max_digits10)
+          << rank_vals[iv];
+    }
+  }
+  log << endl;  // flush so the record survives if the run is killed
+}
+
+/*
+ * Read results of kernel variant tuning passes completed by an interrupted
+ * run from its run log. Lines that are incomplete, as the last one may be
+ * when a run is killed, are ignored. The log is rejected if it is from a
+ * run with different parameters, so its results are not mixed with those
+ * of this run.
+ */
+bool Executor::readRunLog(const string& log_name)
+{
+  int rank = 0;
+  int num_ranks = 1;
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+#endif
+
+  ifstream log(log_name.c_str());
+  if ( !log ) {
+    getCout() << "\nBad input: can't open run log file " << log_name
+              << " to resume" << endl;
+    return false;
+  }
+
+  auto split_line = [](const string& line) {
+    vector<string> fields;
+    istringstream line_str(line);
+    string field;
+    while ( getline(line_str, field, ',') ) {
+      size_t first = field.find_first_not_of(" \t");
+      size_t last = field.find_last_not_of(" \t\r");
+      fields.push_back( first == string::npos ?
+                        string() : field.substr(first, last - first + 1) );
+    }
+    return fields;
+  };
+
+  //
+  // Column title line has a time, checksum, and sample columns for each rank.
+  //
+  const size_t nsamples = getRunLogSampleColumns().size();
+  const size_t nrank_fields = 2 + nsamples;
+  const size_t nfields = 3 + nrank_fields * num_ranks;
+
+  //
+  // Run parameter lines precede the column title line.
+  //
+  const vector<string> params = getRunLogParams();
+  vector<string> log_params;
+  string line;
+  while ( getline(log, line) && !line.empty() && line[0] == '#' ) {
+    log_params.push_back( line.substr(0, line.find_last_not_of("\r") + 1) );
+  }
+  if ( log_params != params ) {
+    size_t ip = 0;
+    while ( ip < params.size() && ip < log_params.size() &&
+            params[ip] == log_params[ip] ) {
+      ++ip;
+    }
+    getCout() << "\nBad input: run log file " << log_name
+              << " is not from a run with the same parameters" << endl;
+    getCout() << "  this run: "
+              << ( ip < params.size() ? params[ip] : string("(none)") ) << endl;
+    getCout() << "  run log:  "
+              << ( ip < log_params.size() ? log_params[ip] : string("(none)") )
+              << endl;
+    return false;
+  }
+
+  size_t log_nfields = split_line(line).size();
+  if ( log_nfields != nfields ) {
+    getCout() << "\nBad input: run log file " << log_name
+              << " is not from a run with " << num_ranks
+              << " MPI ranks" << endl;
+    return false;
+  }
+
+  while ( getline(log, line) ) {
+    if ( log.eof() ) {
+      break;  // last line was not finished
+    }
+    vector<string> fields = split_line(line);
+    if ( fields.size() != nfields ) {
+      continue;
+    }
+
+    const size_t rank_field = 3 + nrank_fields * rank;
+
+    RunLogRecord record;
+    char* time_end = nullptr;
+    char* cksum_end = nullptr;
+    const string& time_str = fields[rank_field];
+    const string& cksum_str = fields[rank_field + 1];
+    record.time = strtod(time_str.c_str(), &time_end);
+    record.checksum = strtold(cksum_str.c_str(), &cksum_end);
+    bool valid = ( time_end != time_str.c_str() &&
+                   cksum_end != cksum_str.c_str() );
+    for (size_t is = 0; is < nsamples && valid; ++is) {
+      char* sample_end = nullptr;
+      const string& sample_str = fields[rank_field + 2 + is];
+      record.samples.push_back(strtod(sample_str.c_str(), &sample_end));
+      valid = ( sample_end != sample_str.c_str() );
+    }
+    if ( !valid ) {
+      continue;
+    }
+
+    resumed_results[make_tuple(fields[0], fields[1], atoi(fields[2].c_str()))] =
+      record;
+  }
+
+  getCout() << "\nResuming run with " << resumed_results.size()
+            << " kernel variant passes read from " << log_name << endl;
+
+  return true;
 }
 
 void Executor::outputRunData()
@@ -825,6 +1375,22 @@ void Executor::outputRunData()
 
   getCout() << "\n\nGenerate run report files...\n";
 
+  //
+  // Read previous run times to compare against before changing directory
+  // so a relative path is taken from where the Suite was started.
+  //
+  map<pair<string, string>, vector<double>> baseline_times;
+  bool have_baseline = false;
+  if ( !run_params.getCompareDirName().empty() ) {
+    have_baseline = readBaselineTimes(run_params.getCompareDirName(),
+                                      baseline_times);
+    if ( !have_baseline ) {
+      getCout() << " ERROR: Can't read run times to compare to in "
+                << run_params.getCompareDirName() << endl;
+      compare_passed = false;
+    }
+  }
+
   //
   // Generate output file prefix (including directory path).
   //
@@ -848,6 +1414,58 @@ void Executor::outputRunData()
     }
   }
 
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+  file = openOutputFile(out_fprefix + "-timing-ranks.csv");
+  writeRankTimingReport(*file);
+
+  if ( run_params.perRankTiming() ) {
+    file = openOutputFile(out_fprefix + "-timing-per-rank.csv");
+    writePerRankTimingReport(*file);
+  }
+#endif
+
+  {
+    bool have_dofs = false;
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      have_dofs = have_dofs || kernels[ik]->hasDOFsPerRep();
+    }
+    if ( have_dofs ) {
+      file = openOutputFile(out_fprefix + "-dofs.csv");
+      writeCSVReport(*file, CSVRepMode::DOFsRate,
+                     RunParams::CombinerOpt::Average, 1 /* prec */);
+    }
+  }
+
+  file = openOutputFile(out_fprefix + "-bandwidth.csv");
+  writeCSVReport(*file, CSVRepMode::BandwidthRate,
+                 RunParams::CombinerOpt::Average, 3 /* prec */);
+
+  if ( getKernel(Stream_COPY) ) {
+    file = openOutputFile(out_fprefix + "-bandwidth-copy.csv");
+    writeCSVReport(*file, CSVRepMode::CopyBandwidthFraction,
+                   RunParams::CombinerOpt::Average, 3 /* prec */);
+  }
+
+  file = openOutputFile(out_fprefix + "-flops.csv");
+  writeCSVReport(*file, CSVRepMode::FLOPsRate,
+                 RunParams::CombinerOpt::Average, 3 /* prec */);
+
+  file = openOutputFile(out_fprefix + "-timing-passes.csv");
+  writePassTimingReport(*file);
+
+  file = openOutputFile(out_fprefix + "-memory.csv");
+  writeMemoryReport(*file);
+
+  if ( haveEnergyCounters() ) {
+    file = openOutputFile(out_fprefix + "-energy.csv");
+    writeEnergyReport(*file);
+  }
+
+  if ( have_baseline ) {
+    file = openOutputFile(out_fprefix + "-compare.csv");
+    writeCompareReport(*file, baseline_times);
+  }
+
   file = openOutputFile(out_fprefix + "-checksum.txt");
   writeChecksumReport(*file);
 
@@ -865,6 +1483,9 @@ void Executor::outputRunData()
     bool to_file = true;
     writeKernelInfoSummary(*file, to_file);
   }
+
+  file = openOutputFile(out_fprefix + ".json");
+  writeJSONReport(*file);
 }
 
 unique_ptr<ostream> Executor::openOutputFile(const string& filename) const
@@ -900,21 +1521,39 @@ void Executor::writeCSVReport(ostream& file, CSVRepMode mode,
     }
     kercol_width++;
 
-    vector<size_t> varcol_width(variant_ids.size());
+    //
+    // One column for each tuning of each variant.
+    //
+    vector<VariantID> col_vid;
+    vector<string> col_tuning;
     for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-      varcol_width[iv] = max(prec+2, getVariantName(variant_ids[iv]).size());
+      VariantID vid = variant_ids[iv];
+      for (size_t t = 0; t < tuning_names[vid].size(); ++t) {
+        col_vid.push_back(vid);
+        col_tuning.push_back(tuning_names[vid][t]);
+      }
+    }
+
+    vector<size_t> varcol_width(col_vid.size());
+    for (size_t ic = 0; ic < col_vid.size(); ++ic) {
+      varcol_width[ic] = max(prec+2,
+        getVariantTuningColumnName(col_vid[ic], col_tuning[ic]).size());
     }
 
     //
     // Print title line.
     //
     file << getReportTitle(mode, combiner);
+    if ( mode == CSVRepMode::Timing ) {
+      file << "('*' marks times too short to measure reliably with timer "
+           << getTimerName(getTimer()) << ") ";
+    }
 
     //
     // Wrtie CSV file contents for report.
     //
 
-    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+    for (size_t ic = 0; ic < col_vid.size(); ++ic) {
       file << sepchr;
     }
     file << endl;
@@ -923,9 +1562,9 @@ void Executor::writeCSVReport(ostream& file, CSVRepMode mode,
     // Print column title line.
     //
     file <<left<< setw(kercol_width) << kernel_col_name;
-    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-      file << sepchr <<left<< setw(varcol_width[iv])
-           << getVariantName(variant_ids[iv]);
+    for (size_t ic = 0; ic < col_vid.size(); ++ic) {
+      file << sepchr <<left<< setw(varcol_width[ic])
+           << getVariantTuningColumnName(col_vid[ic], col_tuning[ic]);
     }
     file << endl;
 
@@ -934,20 +1573,56 @@ void Executor::writeCSVReport(ostream& file, CSVRepMode mode,
     //
     for (size_t ik = 0; ik < kernels.size(); ++ik) {
       KernelBase* kern = kernels[ik];
+      if ( (mode == CSVRepMode::DOFsRate) && !kern->hasDOFsPerRep() ) {
+        continue;
+      }
+      const bool bytes_mode = ( mode == CSVRepMode::BandwidthRate ||
+                                mode == CSVRepMode::CopyBandwidthFraction );
+      const bool flops_mode = ( mode == CSVRepMode::FLOPsRate );
+      if ( bytes_mode || flops_mode ) {
+        bool have_amount = false;
+        for (size_t ic = 0; ic < col_vid.size(); ++ic) {
+          Index_type per_rep = bytes_mode ?
+            kern->getBytesPerRep(col_tuning[ic]) :
+            kern->getFLOPsPerRep(col_tuning[ic]);
+          have_amount = have_amount || per_rep > 0;
+        }
+        if ( !have_amount ) {
+          continue;
+        }
+      }
       file <<left<< setw(kercol_width) << kern->getName();
-      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-        VariantID vid = variant_ids[iv];
-        file << sepchr <<right<< setw(varcol_width[iv]);
-        if ( (mode == CSVRepMode::Speedup) &&
-             (!kern->hasVariantDefined(reference_vid) ||
-              !kern->hasVariantDefined(vid)) ) {
+      for (size_t ic = 0; ic < col_vid.size(); ++ic) {
+        VariantID vid = col_vid[ic];
+        size_t tune_idx = kern->getVariantTuningIndex(vid, col_tuning[ic]);
+        file << sepchr <<right<< setw(varcol_width[ic]);
+        if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+          file << "Not run";
+        } else if ( (mode == CSVRepMode::Speedup) &&
+                    !kern->wasVariantTuningRun(reference_vid,
+                      getReferenceTuning(kern, reference_vid, vid, tune_idx)) ) {
           file << "Not run";
-        } else if ( (mode == CSVRepMode::Timing) &&
-                    !kern->hasVariantDefined(vid) ) {
+        } else if ( (mode == CSVRepMode::DOFsRate) &&
+                    kern->getDOFsPerRep(col_tuning[ic]) < 0 ) {
+          file << "Not run";
+        } else if ( bytes_mode &&
+                    kern->getBytesPerRep(col_tuning[ic]) <= 0 ) {
+          file << "Not run";
+        } else if ( flops_mode &&
+                    kern->getFLOPsPerRep(col_tuning[ic]) <= 0 ) {
+          file << "Not run";
+        } else if ( (mode == CSVRepMode::CopyBandwidthFraction) &&
+                    !getKernel(Stream_COPY)->wasVariantRun(vid) ) {
           file << "Not run";
         } else {
-          file << setprecision(prec) << std::fixed
-               << getReportDataEntry(mode, combiner, kern, vid);
+          long double entry =
+            getReportDataEntry(mode, combiner, kern, vid, tune_idx);
+          ostringstream entry_str;
+          entry_str << setprecision(prec) << std::fixed << entry;
+          if ( (mode == CSVRepMode::Timing) && isTimeUnreliable(entry) ) {
+            entry_str << "*";
+          }
+          file << entry_str.str();
         }
       }
       file << endl;
@@ -978,12 +1653,24 @@ void Executor::writeFOMReport(ostream& file, vector<FOMGroup>& fom_groups)
 
     size_t fom_col_width = prec+14;
 
-    size_t ncols = 0;
+    //
+    // One column for each tuning of each variant compared to a PM baseline.
+    //
+    vector<VariantID> col_base_vid;
+    vector<VariantID> col_comp_vid;
+    vector<string> col_tuning;
     for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
       const FOMGroup& group = fom_groups[ifg];
-      ncols += group.variants.size(); // num variants to compare
-                                      // to each PM baseline
+      for (size_t gv = 0; gv < group.variants.size(); ++gv) {
+        VariantID comp_vid = group.variants[gv];
+        for (size_t t = 0; t < tuning_names[comp_vid].size(); ++t) {
+          col_base_vid.push_back(group.base);
+          col_comp_vid.push_back(comp_vid);
+          col_tuning.push_back(tuning_names[comp_vid][t]);
+        }
+      }
     }
+    size_t ncols = col_comp_vid.size();
 
     vector<int> col_exec_count(ncols, 0);
     vector<double> col_min(ncols, numeric_limits<double>::max());
@@ -991,8 +1678,10 @@ void Executor::writeFOMReport(ostream& file, vector<FOMGroup>& fom_groups)
     vector<double> col_avg(ncols, 0.0);
     vector<double> col_stddev(ncols, 0.0);
     vector< vector<double> > pct_diff(kernels.size());
+    vector< vector<bool> > was_run(kernels.size());
     for (size_t ik = 0; ik < kernels.size(); ++ik) {
       pct_diff[ik] = vector<double>(ncols, 0.0);
+      was_run[ik] = vector<bool>(ncols, false);
     }
 
     //
@@ -1017,12 +1706,10 @@ void Executor::writeFOMReport(ostream& file, vector<FOMGroup>& fom_groups)
     // Print column title line.
     //
     file <<left<< setw(kercol_width) << kernel_col_name;
-    for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
-      const FOMGroup& group = fom_groups[ifg];
-      for (size_t gv = 0; gv < group.variants.size(); ++gv) {
-        string name = getVariantName(group.variants[gv]);
-        file << sepchr <<left<< setw(fom_col_width) << name << pass;
-      }
+    for (size_t col = 0; col < ncols; ++col) {
+      string name = getVariantTuningColumnName(col_comp_vid[col],
+                                               col_tuning[col]);
+      file << sepchr <<left<< setw(fom_col_width) << name << pass;
     }
     file << endl;
 
@@ -1039,53 +1726,59 @@ void Executor::writeFOMReport(ostream& file, vector<FOMGroup>& fom_groups)
 
       file <<left<< setw(kercol_width) << kern->getName();
 
-      int col = 0;
-      for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
-        const FOMGroup& group = fom_groups[ifg];
+      for (size_t col = 0; col < ncols; ++col) {
+        VariantID base_vid = col_base_vid[col];
+        VariantID comp_vid = col_comp_vid[col];
+
+        //
+        // Compare against the baseline tuning with the same name, or
+        // else the first baseline tuning with the same precision.
+        //
+        size_t comp_tune = kern->getVariantTuningIndex(comp_vid,
+                                                       col_tuning[col]);
+        size_t base_tune = kern->getNumVariantTunings(base_vid);
+        if ( kern->wasVariantTuningRun(comp_vid, comp_tune) ) {
+          base_tune = getReferenceTuning(kern, base_vid, comp_vid, comp_tune);
+        }
 
-        VariantID base_vid = group.base;
+        //
+        // If kernel variant was run, generate data for it and
+        // print (signed) percentage difference from baseline.
+        //
+        if ( kern->wasVariantTuningRun(comp_vid, comp_tune) &&
+             kern->wasVariantTuningRun(base_vid, base_tune) ) {
+          col_exec_count[col]++;
+          was_run[ik][col] = true;
+
+          const RunParams::CombinerOpt avg = RunParams::CombinerOpt::Average;
+          pct_diff[ik][col] =
+            (getCombinedTime(avg, kern, comp_vid, comp_tune) -
+             getCombinedTime(avg, kern, base_vid, base_tune)) /
+             getCombinedTime(avg, kern, base_vid, base_tune);
+
+          string pfstring(pass);
+          if (pct_diff[ik][col] > run_params.getPFTolerance()) {
+            pfstring = fail;
+          }
 
-        for (size_t gv = 0; gv < group.variants.size(); ++gv) {
-          VariantID comp_vid = group.variants[gv];
+          file << sepchr << setw(fom_col_width) << setprecision(prec)
+               <<left<< pct_diff[ik][col] <<right<< pfstring;
 
           //
-          // If kernel variant was run, generate data for it and
-          // print (signed) percentage difference from baseline.
+          // Gather data for column summaries (unsigned).
           //
-          if ( kern->wasVariantRun(comp_vid) ) {
-            col_exec_count[col]++;
+          col_min[col] = min( col_min[col], pct_diff[ik][col] );
+          col_max[col] = max( col_max[col], pct_diff[ik][col] );
+          col_avg[col] += pct_diff[ik][col];
 
-            pct_diff[ik][col] =
-              (kern->getTotTime(comp_vid) - kern->getTotTime(base_vid)) /
-               kern->getTotTime(base_vid);
+        } else {  // variant was not run, print a big fat goose egg...
 
-            string pfstring(pass);
-            if (pct_diff[ik][col] > run_params.getPFTolerance()) {
-              pfstring = fail;
-            }
-
-            file << sepchr << setw(fom_col_width) << setprecision(prec)
-                 <<left<< pct_diff[ik][col] <<right<< pfstring;
-
-            //
-            // Gather data for column summaries (unsigned).
-            //
-            col_min[col] = min( col_min[col], pct_diff[ik][col] );
-            col_max[col] = max( col_max[col], pct_diff[ik][col] );
-            col_avg[col] += pct_diff[ik][col];
-
-          } else {  // variant was not run, print a big fat goose egg...
-
-            file << sepchr <<left<< setw(fom_col_width) << setprecision(prec)
-                 << 0.0 << pass;
-
-          }
-
-          col++;
+          file << sepchr <<left<< setw(fom_col_width) << setprecision(prec)
+               << 0.0 << pass;
 
-        }  // loop over group variants
+        }
 
-      }  // loop over fom_groups (i.e., columns)
+      }  // loop over columns
 
       file << endl;
 
@@ -1107,27 +1800,13 @@ void Executor::writeFOMReport(ostream& file, vector<FOMGroup>& fom_groups)
 
     // Column standard deviaation...
     for (size_t ik = 0; ik < kernels.size(); ++ik) {
-      KernelBase* kern = kernels[ik];
-
-      int col = 0;
-      for (size_t ifg = 0; ifg < fom_groups.size(); ++ifg) {
-        const FOMGroup& group = fom_groups[ifg];
-
-        for (size_t gv = 0; gv < group.variants.size(); ++gv) {
-          VariantID comp_vid = group.variants[gv];
-
-          if ( kern->wasVariantRun(comp_vid) ) {
-            col_stddev[col] += ( pct_diff[ik][col] - col_avg[col] ) *
-                               ( pct_diff[ik][col] - col_avg[col] );
-          }
-
-          col++;
-
-        } // loop over group variants
-
-      }  // loop over groups
-
-    }  // loop over kernels
+      for (size_t col = 0; col < ncols; ++col) {
+        if ( was_run[ik][col] ) {
+          col_stddev[col] += ( pct_diff[ik][col] - col_avg[col] ) *
+                             ( pct_diff[ik][col] - col_avg[col] );
+        }
+      }  // loop over columns
+    }  // loop over kernels
 
     for (size_t col = 0; col < ncols; ++col) {
       if ( col_exec_count[col] > 0 ) {
@@ -1200,13 +1879,27 @@ void Executor::writeChecksumReport(ostream& file)
     size_t prec = 20;
     size_t checksum_width = prec + 8;
 
+    //
+    // One row for each tuning of each variant.
+    //
+    vector<VariantID> row_vid;
+    vector<string> row_tuning;
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      VariantID vid = variant_ids[iv];
+      for (size_t t = 0; t < tuning_names[vid].size(); ++t) {
+        row_vid.push_back(vid);
+        row_tuning.push_back(tuning_names[vid][t]);
+      }
+    }
+    const size_t nrows = row_vid.size();
+
     size_t namecol_width = 0;
     for (size_t ik = 0; ik < kernels.size(); ++ik) {
       namecol_width = max(namecol_width, kernels[ik]->getName().size());
     }
-    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+    for (size_t ir = 0; ir < nrows; ++ir) {
       namecol_width = max(namecol_width,
-                          getVariantName(variant_ids[iv]).size());
+        getVariantTuningColumnName(row_vid[ir], row_tuning[ir]).size());
     }
     namecol_width++;
 
@@ -1255,27 +1948,31 @@ void Executor::writeChecksumReport(ostream& file)
       file <<left<< setw(namecol_width) << kern->getName() << endl;
       file << dot_line << endl;
 
-      Checksum_type cksum_ref = 0.0;
-      size_t ivck = 0;
-      bool found_ref = false;
-      while ( ivck < variant_ids.size() && !found_ref ) {
-        VariantID vid = variant_ids[ivck];
-        if ( kern->wasVariantRun(vid) ) {
-          cksum_ref = kern->getChecksum(vid);
-          found_ref = true;
-        }
-        ++ivck;
-      }
-
-      // get vector of checksums and diffs
-      std::vector<Checksum_type> checksums(variant_ids.size(), 0.0);
-      std::vector<Checksum_type> checksums_diff(variant_ids.size(), 0.0);
-      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-        VariantID vid = variant_ids[iv];
+      // get vector of checksums and diffs, where each tuning is compared
+      // to the same tuning of the first variant run
+      std::vector<bool> row_run(nrows, false);
+      std::vector<Checksum_type> checksums(nrows, 0.0);
+      std::vector<Checksum_type> checksums_diff(nrows, 0.0);
+      for (size_t ir = 0; ir < nrows; ++ir) {
+        VariantID vid = row_vid[ir];
+        size_t tune_idx = kern->getVariantTuningIndex(vid, row_tuning[ir]);
+
+        if ( kern->wasVariantTuningRun(vid, tune_idx) ) {
+          Checksum_type cksum_ref = 0.0;
+          bool found_ref = false;
+          for (size_t irck = 0; irck <= ir && !found_ref; ++irck) {
+            VariantID vidck = row_vid[irck];
+            size_t tuneck = kern->getVariantTuningIndex(vidck, row_tuning[ir]);
+            if ( row_tuning[irck] == row_tuning[ir] &&
+                 kern->wasVariantTuningRun(vidck, tuneck) ) {
+              cksum_ref = kern->getChecksum(vidck, tuneck);
+              found_ref = true;
+            }
+          }
 
-        if ( kern->wasVariantRun(vid) ) {
-          checksums[iv] = kern->getChecksum(vid);
-          checksums_diff[iv] = cksum_ref - kern->getChecksum(vid);
+          row_run[ir] = true;
+          checksums[ir] = kern->getChecksum(vid, tune_idx);
+          checksums_diff[ir] = cksum_ref - checksums[ir];
         }
       }
 
@@ -1285,68 +1982,68 @@ void Executor::writeChecksumReport(ostream& file)
       }
 
       // get stats for checksums
-      std::vector<Checksum_type> checksums_sum(variant_ids.size(), 0.0);
-      MPI_Allreduce(checksums.data(), checksums_sum.data(), variant_ids.size(),
+      std::vector<Checksum_type> checksums_sum(nrows, 0.0);
+      MPI_Allreduce(checksums.data(), checksums_sum.data(), nrows,
                  Checksum_MPI_type, MPI_SUM, MPI_COMM_WORLD);
 
-      std::vector<Checksum_type> checksums_avg(variant_ids.size(), 0.0);
-      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-        checksums_avg[iv] = checksums_sum[iv] / num_ranks;
+      std::vector<Checksum_type> checksums_avg(nrows, 0.0);
+      for (size_t ir = 0; ir < nrows; ++ir) {
+        checksums_avg[ir] = checksums_sum[ir] / num_ranks;
       }
 
       // get stats for checksums_abs_diff
-      std::vector<Checksum_type> checksums_abs_diff(variant_ids.size(), 0.0);
-      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-        checksums_abs_diff[iv] = std::abs(checksums_diff[iv]);
+      std::vector<Checksum_type> checksums_abs_diff(nrows, 0.0);
+      for (size_t ir = 0; ir < nrows; ++ir) {
+        checksums_abs_diff[ir] = std::abs(checksums_diff[ir]);
       }
 
-      std::vector<Checksum_type> checksums_abs_diff_min(variant_ids.size(), 0.0);
-      std::vector<Checksum_type> checksums_abs_diff_max(variant_ids.size(), 0.0);
-      std::vector<Checksum_type> checksums_abs_diff_sum(variant_ids.size(), 0.0);
+      std::vector<Checksum_type> checksums_abs_diff_min(nrows, 0.0);
+      std::vector<Checksum_type> checksums_abs_diff_max(nrows, 0.0);
+      std::vector<Checksum_type> checksums_abs_diff_sum(nrows, 0.0);
 
-      MPI_Allreduce(checksums_abs_diff.data(), checksums_abs_diff_min.data(), variant_ids.size(),
+      MPI_Allreduce(checksums_abs_diff.data(), checksums_abs_diff_min.data(), nrows,
                  Checksum_MPI_type, MPI_MIN, MPI_COMM_WORLD);
-      MPI_Allreduce(checksums_abs_diff.data(), checksums_abs_diff_max.data(), variant_ids.size(),
+      MPI_Allreduce(checksums_abs_diff.data(), checksums_abs_diff_max.data(), nrows,
                  Checksum_MPI_type, MPI_MAX, MPI_COMM_WORLD);
-      MPI_Allreduce(checksums_abs_diff.data(), checksums_abs_diff_sum.data(), variant_ids.size(),
+      MPI_Allreduce(checksums_abs_diff.data(), checksums_abs_diff_sum.data(), nrows,
                  Checksum_MPI_type, MPI_SUM, MPI_COMM_WORLD);
 
-      std::vector<Checksum_type> checksums_abs_diff_avg(variant_ids.size(), 0.0);
-      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-        checksums_abs_diff_avg[iv] = checksums_abs_diff_sum[iv] / num_ranks;
+      std::vector<Checksum_type> checksums_abs_diff_avg(nrows, 0.0);
+      for (size_t ir = 0; ir < nrows; ++ir) {
+        checksums_abs_diff_avg[ir] = checksums_abs_diff_sum[ir] / num_ranks;
       }
 
-      std::vector<Checksum_type> checksums_abs_diff_diff2avg2(variant_ids.size(), 0.0);
-      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-        checksums_abs_diff_diff2avg2[iv] = (checksums_abs_diff[iv] - checksums_abs_diff_avg[iv]) *
-                                           (checksums_abs_diff[iv] - checksums_abs_diff_avg[iv]) ;
+      std::vector<Checksum_type> checksums_abs_diff_diff2avg2(nrows, 0.0);
+      for (size_t ir = 0; ir < nrows; ++ir) {
+        checksums_abs_diff_diff2avg2[ir] = (checksums_abs_diff[ir] - checksums_abs_diff_avg[ir]) *
+                                           (checksums_abs_diff[ir] - checksums_abs_diff_avg[ir]) ;
       }
 
-      std::vector<Checksum_type> checksums_abs_diff_stddev(variant_ids.size(), 0.0);
-      MPI_Allreduce(checksums_abs_diff_diff2avg2.data(), checksums_abs_diff_stddev.data(), variant_ids.size(),
+      std::vector<Checksum_type> checksums_abs_diff_stddev(nrows, 0.0);
+      MPI_Allreduce(checksums_abs_diff_diff2avg2.data(), checksums_abs_diff_stddev.data(), nrows,
                  Checksum_MPI_type, MPI_SUM, MPI_COMM_WORLD);
-      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-        checksums_abs_diff_stddev[iv] = std::sqrt(checksums_abs_diff_stddev[iv] / num_ranks) ;
+      for (size_t ir = 0; ir < nrows; ++ir) {
+        checksums_abs_diff_stddev[ir] = std::sqrt(checksums_abs_diff_stddev[ir] / num_ranks) ;
       }
 
 #endif
 
-      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
-        VariantID vid = variant_ids[iv];
+      for (size_t ir = 0; ir < nrows; ++ir) {
+        string name = getVariantTuningColumnName(row_vid[ir], row_tuning[ir]);
 
-        if ( kern->wasVariantRun(vid) ) {
-          file <<left<< setw(namecol_width) << getVariantName(vid)
+        if ( row_run[ir] ) {
+          file <<left<< setw(namecol_width) << name
                << showpoint << setprecision(prec)
 #ifdef RAJA_PERFSUITE_ENABLE_MPI
-               <<left<< setw(checksum_width) << checksums_avg[iv]
-               <<left<< setw(checksum_width) << checksums_abs_diff_max[iv]
-               <<left<< setw(checksum_width) << checksums_abs_diff_stddev[iv] << endl;
+               <<left<< setw(checksum_width) << checksums_avg[ir]
+               <<left<< setw(checksum_width) << checksums_abs_diff_max[ir]
+               <<left<< setw(checksum_width) << checksums_abs_diff_stddev[ir] << endl;
 #else
-               <<left<< setw(checksum_width) << checksums[iv]
-               <<left<< setw(checksum_width) << checksums_diff[iv] << endl;
+               <<left<< setw(checksum_width) << checksums[ir]
+               <<left<< setw(checksum_width) << checksums_diff[ir] << endl;
 #endif
         } else {
-          file <<left<< setw(namecol_width) << getVariantName(vid)
+          file <<left<< setw(namecol_width) << name
 #ifdef RAJA_PERFSUITE_ENABLE_MPI
                <<left<< setw(checksum_width) << "Not Run"
                <<left<< setw(checksum_width) << "Not Run"
@@ -1369,102 +2066,1517 @@ void Executor::writeChecksumReport(ostream& file)
 }
 
 
-string Executor::getReportTitle(CSVRepMode mode, RunParams::CombinerOpt combiner)
+/*
+ * Single JSON document describing the run: build configuration, host,
+ * run parameters, and every metric for each kernel variant tuning run.
+ * With MPI, all ranks must call this collectively; times are those of the
+ * slowest rank and checksums are averaged over ranks, as in other reports.
+ */
+void Executor::writeJSONReport(ostream& file)
 {
-  string title;
-  switch ( combiner ) {
-    case RunParams::CombinerOpt::Average : {
-      title = string("Mean ");
-    }
-    break;
-    case RunParams::CombinerOpt::Minimum : {
-      title = string("Min ");
-    }
-    break;
-    case RunParams::CombinerOpt::Maximum : {
-      title = string("Max ");
+  int num_ranks = 1;
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+  MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+#endif
+
+  //
+  // Non-finite values are not valid JSON numbers.
+  //
+  auto json_number = [](long double val) {
+    ostringstream str;
+    if ( std::isfinite(val) ) {
+      str << setprecision(15) << val;
+    } else {
+      str << "null";
     }
-    break;
-    default : { cout << "\n Unknown CSV combiner mode = " << combiner << endl; }
+    return str.str();
+  };
+  auto json_bool = [](bool val) { return string(val ? "true" : "false"); };
+
+  file << "{" << endl;
+
+  //
+  // Build configuration.
+  //
+  string raja_version("unknown");
+#if defined(RAJA_VERSION_MAJOR)
+  raja_version = to_string(RAJA_VERSION_MAJOR) + "." +
+                 to_string(RAJA_VERSION_MINOR) + "." +
+                 to_string(RAJA_VERSION_PATCHLEVEL);
+#endif
+
+  bool have_openmp = false;
+  bool have_target_openmp = false;
+  bool have_cuda = false;
+  bool have_hip = false;
+  bool have_mpi = false;
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  have_openmp = true;
+#endif
+#if defined(RAJA_ENABLE_TARGET_OPENMP)
+  have_target_openmp = true;
+#endif
+#if defined(RAJA_ENABLE_CUDA)
+  have_cuda = true;
+#endif
+#if defined(RAJA_ENABLE_HIP)
+  have_hip = true;
+#endif
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  have_mpi = true;
+#endif
+
+  file << "  \"build\": {" << endl;
+  file << "    \"perfsuite_version\": "
+       << jsonString(RAJA_PERFSUITE_VERSION_STRING) << "," << endl;
+  file << "    \"raja_version\": " << jsonString(raja_version) << "," << endl;
+  file << "    \"compiler\": "
+       << jsonString(RAJA_PERFSUITE_COMPILER) << "," << endl;
+  file << "    \"compiler_options\": "
+       << jsonString(RAJA_PERFSUITE_COMPILER_OPTIONS) << "," << endl;
+  file << "    \"systype\": "
+       << jsonString(RAJA_PERFSUITE_BUILD_SYSTYPE) << "," << endl;
+  file << "    \"host\": "
+       << jsonString(RAJA_PERFSUITE_BUILD_HOST) << "," << endl;
+  file << "    \"real_type_bytes\": " << sizeof(Real_type) << "," << endl;
+  file << "    \"openmp\": " << json_bool(have_openmp) << "," << endl;
+  file << "    \"openmp_target\": " << json_bool(have_target_openmp) << ","
+       << endl;
+  file << "    \"cuda\": " << json_bool(have_cuda) << "," << endl;
+  file << "    \"hip\": " << json_bool(have_hip) << "," << endl;
+  file << "    \"mpi\": " << json_bool(have_mpi) << endl;
+  file << "  }," << endl;
+
+  //
+  // Host the run was made on (MPI rank 0).
+  //
+  char hostname[256] = "";
+  gethostname(hostname, sizeof(hostname)-1);
+
+  string os_name;
+  struct utsname uts;
+  if ( uname(&uts) == 0 ) {
+    os_name = string(uts.sysname) + " " + uts.release + " " + uts.machine;
   }
-  switch ( mode ) {
-    case CSVRepMode::Timing : {
-      title += string("Runtime Report (sec.) ");
-      break;
+
+  string cpu_model;
+  {
+    ifstream cpuinfo("/proc/cpuinfo");
+    string line;
+    while ( cpu_model.empty() && getline(cpuinfo, line) ) {
+      if ( line.compare(0, 10, "model name") == 0 ) {
+        size_t pos = line.find(':');
+        if ( pos != string::npos ) {
+          cpu_model = line.substr(line.find_first_not_of(" \t", pos+1));
+        }
+      }
     }
-    case CSVRepMode::Speedup : {
-      if ( haveReferenceVariant() ) {
-        title += string("Speedup Report (T_ref/T_var)") +
-                 string(": ref var = ") + getVariantName(reference_vid) +
-                 string(" ");
+  }
+
+  int omp_threads = 0;
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  omp_threads = omp_get_max_threads();
+#endif
+
+  const char* user = getenv("USER");
+
+  char date[64] = "";
+  {
+    time_t now = time(nullptr);
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+  }
+
+  file << "  \"host\": {" << endl;
+  file << "    \"hostname\": " << jsonString(hostname) << "," << endl;
+  file << "    \"os\": " << jsonString(os_name) << "," << endl;
+  file << "    \"cpu_model\": " << jsonString(cpu_model) << "," << endl;
+  file << "    \"online_cpus\": " << sysconf(_SC_NPROCESSORS_ONLN) << ","
+       << endl;
+  file << "    \"openmp_max_threads\": " << omp_threads << "," << endl;
+  file << "    \"mpi_ranks\": " << num_ranks << "," << endl;
+  file << "    \"user\": " << jsonString(user ? user : "") << "," << endl;
+  file << "    \"date\": " << jsonString(date) << endl;
+  file << "  }," << endl;
+
+  //
+  // Timer used and its calibration.
+  //
+  {
+    const TimerCalibration& calibration = getTimerCalibration();
+    file << "  \"timer\": {" << endl;
+    file << "    \"name\": " << jsonString(getTimerName(getTimer())) << ","
+         << endl;
+    file << "    \"tick_period\": " << json_number(calibration.tick_period)
+         << "," << endl;
+    file << "    \"resolution\": " << json_number(calibration.resolution)
+         << "," << endl;
+    file << "    \"overhead\": " << json_number(calibration.overhead) << endl;
+    file << "  }," << endl;
+  }
+
+  //
+  // Run parameters.
+  //
+  file << "  \"run_params\": ";
+  run_params.printJSON(file, "  ");
+  file << "," << endl;
+
+  if ( haveReferenceVariant() ) {
+    file << "  \"reference_variant\": "
+         << jsonString(getVariantName(reference_vid)) << "," << endl;
+  }
+
+  //
+  // Kernel data and results for each variant tuning run.
+  //
+  file << "  \"kernels\": [";
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    KernelBase* kern = kernels[ik];
+
+    file << (ik > 0 ? "," : "") << endl;
+    file << "    {" << endl;
+    file << "      \"name\": " << jsonString(kern->getName()) << "," << endl;
+
+    file << "      \"features\": [";
+    bool first_feature = true;
+    for (size_t fid = 0; fid < NumFeatures; ++fid) {
+      if ( kern->usesFeature(static_cast<FeatureID>(fid)) ) {
+        file << (first_feature ? "" : ", ")
+             << jsonString(getFeatureName(static_cast<FeatureID>(fid)));
+        first_feature = false;
       }
-      break;
     }
-    default : { getCout() << "\n Unknown CSV report mode = " << mode << endl; }
-  };
-  return title;
-}
+    file << "]," << endl;
 
-long double Executor::getReportDataEntry(CSVRepMode mode,
-                                         RunParams::CombinerOpt combiner,
-                                         KernelBase* kern,
-                                         VariantID vid)
-{
-  long double retval = 0.0;
-  switch ( mode ) {
-    case CSVRepMode::Timing : {
-      switch ( combiner ) {
-        case RunParams::CombinerOpt::Average : {
-          retval = kern->getTotTime(vid) / run_params.getNumPasses();
+    file << "      \"problem_size\": " << kern->getActualProblemSize() << ","
+         << endl;
+    file << "      \"default_problem_size\": "
+         << kern->getDefaultProblemSize() << "," << endl;
+    file << "      \"reps\": " << kern->getRunReps() << "," << endl;
+    file << "      \"its_per_rep\": " << kern->getItsPerRep() << "," << endl;
+    file << "      \"kernels_per_rep\": " << kern->getKernelsPerRep() << ","
+         << endl;
+    file << "      \"bytes_per_rep\": " << kern->getBytesPerRep() << ","
+         << endl;
+    file << "      \"flops_per_rep\": " << kern->getFLOPsPerRep() << ","
+         << endl;
+
+    file << "      \"variants\": [";
+    bool first_tuning = true;
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      VariantID vid = variant_ids[iv];
+      for (size_t tune_idx = 0; tune_idx < kern->getNumVariantTunings(vid);
+           ++tune_idx) {
+        if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+          continue;
+        }
+        const string& tname = kern->getVariantTuningName(vid, tune_idx);
+
+        Checksum_type cksum = kern->getChecksum(vid, tune_idx);
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+        Checksum_type cksum_sum = 0.0;
+        MPI_Allreduce(&cksum, &cksum_sum, 1, Checksum_MPI_type, MPI_SUM,
+                      MPI_COMM_WORLD);
+        cksum = cksum_sum / num_ranks;
+#endif
+
+        file << (first_tuning ? "" : ",") << endl;
+        first_tuning = false;
+        file << "        {" << endl;
+        file << "          \"variant\": " << jsonString(getVariantName(vid))
+             << "," << endl;
+        file << "          \"tuning\": " << jsonString(tname) << "," << endl;
+        long double time_minimum =
+          getCombinedTime(RunParams::CombinerOpt::Minimum, kern, vid, tune_idx);
+        file << "          \"time_average\": " << json_number(
+          getCombinedTime(RunParams::CombinerOpt::Average, kern, vid, tune_idx))
+             << "," << endl;
+        file << "          \"time_minimum\": " << json_number(time_minimum)
+             << "," << endl;
+        file << "          \"time_maximum\": " << json_number(
+          getCombinedTime(RunParams::CombinerOpt::Maximum, kern, vid, tune_idx))
+             << "," << endl;
+        file << "          \"time_unreliable\": "
+             << json_bool(isTimeUnreliable(time_minimum)) << "," << endl;
+        if ( haveReferenceVariant() &&
+             kern->wasVariantTuningRun(reference_vid,
+               getReferenceTuning(kern, reference_vid, vid, tune_idx)) ) {
+          file << "          \"speedup\": " << json_number(
+            getReportDataEntry(CSVRepMode::Speedup,
+                               RunParams::CombinerOpt::Average,
+                               kern, vid, tune_idx)) << "," << endl;
+        }
+        if ( kern->getBytesPerRep(tname) > 0 ) {
+          file << "          \"bandwidth_GBps\": " << json_number(
+            getReportDataEntry(CSVRepMode::BandwidthRate,
+                               RunParams::CombinerOpt::Average,
+                               kern, vid, tune_idx)) << "," << endl;
         }
-        break;
-        case RunParams::CombinerOpt::Minimum : {
-          retval = kern->getMinTime(vid);
+        if ( kern->getFLOPsPerRep(tname) > 0 ) {
+          file << "          \"GFLOPs\": " << json_number(
+            getReportDataEntry(CSVRepMode::FLOPsRate,
+                               RunParams::CombinerOpt::Average,
+                               kern, vid, tune_idx)) << "," << endl;
         }
-        break;
-        case RunParams::CombinerOpt::Maximum : {
-          retval = kern->getMaxTime(vid);
+        if ( kern->getDOFsPerRep(tname) >= 0 ) {
+          file << "          \"DOFs_per_sec\": " << json_number(
+            getReportDataEntry(CSVRepMode::DOFsRate,
+                               RunParams::CombinerOpt::Average,
+                               kern, vid, tune_idx)) << "," << endl;
         }
-        break;
-        default : { cout << "\n Unknown CSV combiner mode = " << combiner << endl; }
+        vector<double> mem_usage;
+        getMemoryUsage(kern, vid, tune_idx, mem_usage);
+        file << "          \"alloc_bytes\": "
+             << static_cast<size_t>(mem_usage[0]) << "," << endl;
+        file << "          \"setup_minor_faults\": "
+             << json_number(mem_usage[1]) << "," << endl;
+        file << "          \"setup_major_faults\": "
+             << json_number(mem_usage[2]) << "," << endl;
+        file << "          \"timed_minor_faults\": "
+             << json_number(mem_usage[3]) << "," << endl;
+        file << "          \"timed_major_faults\": "
+             << json_number(mem_usage[4]) << "," << endl;
+        if ( haveEnergyCounters() ) {
+          vector<double> energy;
+          getEnergyUsage(kern, vid, tune_idx, energy);
+          file << "          \"package_joules\": "
+               << json_number(energy[0]) << "," << endl;
+          file << "          \"dram_joules\": "
+               << json_number(energy[1]) << "," << endl;
+          file << "          \"watts\": "
+               << json_number(energy[2]) << "," << endl;
+          file << "          \"GFLOPs_per_watt\": "
+               << json_number(energy[3]) << "," << endl;
+          file << "          \"GBps_per_watt\": "
+               << json_number(energy[4]) << "," << endl;
+        }
+        file << "          \"checksum\": " << json_number(cksum) << endl;
+        file << "        }";
       }
-      break;
     }
-    case CSVRepMode::Speedup : {
-      if ( haveReferenceVariant() ) {
-        if ( kern->hasVariantDefined(reference_vid) &&
-             kern->hasVariantDefined(vid) ) {
-          switch ( combiner ) {
-            case RunParams::CombinerOpt::Average : {
-              retval = kern->getTotTime(reference_vid) / kern->getTotTime(vid);
-            }
-            break;
-            case RunParams::CombinerOpt::Minimum : {
-              retval = kern->getMinTime(reference_vid) / kern->getMinTime(vid);
-            }
-            break;
-            case RunParams::CombinerOpt::Maximum : {
-              retval = kern->getMaxTime(reference_vid) / kern->getMaxTime(vid);
-            }
-            break;
-            default : { cout << "\n Unknown CSV combiner mode = " << combiner << endl; }
-          }
-        } else {
-          retval = 0.0;
+    file << (first_tuning ? "" : "\n      ") << "]" << endl;
+    file << "    }";
+  }
+  file << (kernels.empty() ? "" : "\n  ") << "]" << endl;
+
+  file << "}" << endl;
+
+  file.flush();
+}
+
+
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+/*
+ * Mean time per pass on this rank for each variant tuning row of the
+ * given kernel; rows that were not run are flagged and get zero time.
+ */
+void Executor::getRankTimes(KernelBase* kern,
+                            const vector<VariantID>& row_vid,
+                            const vector<string>& row_tuning,
+                            vector<bool>& row_run,
+                            vector<double>& row_time)
+{
+  const size_t nrows = row_vid.size();
+  row_run.assign(nrows, false);
+  row_time.assign(nrows, 0.0);
+  for (size_t ir = 0; ir < nrows; ++ir) {
+    VariantID vid = row_vid[ir];
+    size_t tune_idx = kern->getVariantTuningIndex(vid, row_tuning[ir]);
+    if ( kern->wasVariantTuningRun(vid, tune_idx) ) {
+      row_run[ir] = true;
+      row_time[ir] = kern->getTotTime(vid, tune_idx) /
+                     run_params.getNumPasses();
+    }
+  }
+}
+
+void Executor::writeRankTimingReport(ostream& file)
+{
+  if ( file ) {
+
+    int num_ranks;
+    MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string sepchr(" , ");
+    size_t prec = 6;
+
+    //
+    // One row for each tuning of each variant of each kernel.
+    //
+    vector<VariantID> row_vid;
+    vector<string> row_tuning;
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      VariantID vid = variant_ids[iv];
+      for (size_t t = 0; t < tuning_names[vid].size(); ++t) {
+        row_vid.push_back(vid);
+        row_tuning.push_back(tuning_names[vid][t]);
+      }
+    }
+    const size_t nrows = row_vid.size();
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    }
+    kercol_width++;
+
+    size_t varcol_width = variant_col_name.size();
+    for (size_t ir = 0; ir < nrows; ++ir) {
+      varcol_width = max(varcol_width,
+        getVariantTuningColumnName(row_vid[ir], row_tuning[ir]).size());
+    }
+    varcol_width++;
+
+    const vector<string> stat_names { "Min", "Max", "Mean", "Std Dev",
+                                      "Imbalance (Max/Mean)", "Max Rank" };
+    vector<size_t> statcol_width(stat_names.size());
+    for (size_t is = 0; is < stat_names.size(); ++is) {
+      statcol_width[is] = max(prec+6, stat_names[is].size());
+    }
+
+    //
+    // Print title line.
+    //
+    file << "Cross-Rank Runtime Report (sec.) : mean time per pass on each of "
+         << num_ranks << " MPI ranks ";
+    for (size_t is = 0; is < stat_names.size() + 1; ++is) {
+      file << sepchr;
+    }
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name;
+    for (size_t is = 0; is < stat_names.size(); ++is) {
+      file << sepchr <<left<< setw(statcol_width[is]) << stat_names[is];
+    }
+    file << endl;
+
+    //
+    // Print row of statistics for each variant tuning of each kernel.
+    //
+    struct TimeRank { double time; int rank; };
+
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      vector<bool> row_run;
+      vector<double> times;
+      getRankTimes(kern, row_vid, row_tuning, row_run, times);
+
+      vector<double> times_min(nrows, 0.0);
+      vector<double> times_sum(nrows, 0.0);
+      MPI_Allreduce(times.data(), times_min.data(), nrows,
+                    MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+      MPI_Allreduce(times.data(), times_sum.data(), nrows,
+                    MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+      vector<TimeRank> times_rank(nrows);
+      vector<TimeRank> times_max(nrows);
+      for (size_t ir = 0; ir < nrows; ++ir) {
+        times_rank[ir].time = times[ir];
+        times_rank[ir].rank = rank;
+      }
+      MPI_Allreduce(times_rank.data(), times_max.data(), nrows,
+                    MPI_DOUBLE_INT, MPI_MAXLOC, MPI_COMM_WORLD);
+
+      vector<double> times_avg(nrows, 0.0);
+      vector<double> times_diff2avg2(nrows, 0.0);
+      for (size_t ir = 0; ir < nrows; ++ir) {
+        times_avg[ir] = times_sum[ir] / num_ranks;
+        times_diff2avg2[ir] = (times[ir] - times_avg[ir]) *
+                              (times[ir] - times_avg[ir]);
+      }
+
+      vector<double> times_stddev(nrows, 0.0);
+      MPI_Allreduce(times_diff2avg2.data(), times_stddev.data(), nrows,
+                    MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+      for (size_t ir = 0; ir < nrows; ++ir) {
+        times_stddev[ir] = std::sqrt(times_stddev[ir] / num_ranks);
+      }
+
+      for (size_t ir = 0; ir < nrows; ++ir) {
+        if ( !row_run[ir] ) {
+          continue;
         }
-#if 0 // RDH DEBUG  (leave this here, it's useful for debugging!)
-        getCout() << "Kernel(iv): " << kern->getName() << "(" << vid << ")" << endl;
-        getCout() << "\tref_time, tot_time, retval = "
-             << kern->getTotTime(reference_vid) << " , "
-             << kern->getTotTime(vid) << " , "
-             << retval << endl;
-#endif
+
+        double imbalance = ( times_avg[ir] > 0.0 ?
+                             times_max[ir].time / times_avg[ir] : 1.0 );
+
+        file <<left<< setw(kercol_width) << kern->getName()
+             << sepchr <<left<< setw(varcol_width)
+             << getVariantTuningColumnName(row_vid[ir], row_tuning[ir])
+             << setprecision(prec) << std::fixed
+             << sepchr <<right<< setw(statcol_width[0]) << times_min[ir]
+             << sepchr <<right<< setw(statcol_width[1]) << times_max[ir].time
+             << sepchr <<right<< setw(statcol_width[2]) << times_avg[ir]
+             << sepchr <<right<< setw(statcol_width[3]) << times_stddev[ir]
+             << setprecision(3)
+             << sepchr <<right<< setw(statcol_width[4]) << imbalance
+             << sepchr <<right<< setw(statcol_width[5]) << times_max[ir].rank
+             << endl;
       }
-      break;
     }
-    default : { getCout() << "\n Unknown CSV report mode = " << mode << endl; }
-  };
-  return retval;
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+void Executor::writePerRankTimingReport(ostream& file)
+{
+  if ( file ) {
+
+    int rank;
+    int num_ranks;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string sepchr(" , ");
+    size_t prec = 6;
+
+    //
+    // One row for each tuning of each variant of each kernel.
+    //
+    vector<VariantID> row_vid;
+    vector<string> row_tuning;
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      VariantID vid = variant_ids[iv];
+      for (size_t t = 0; t < tuning_names[vid].size(); ++t) {
+        row_vid.push_back(vid);
+        row_tuning.push_back(tuning_names[vid][t]);
+      }
+    }
+    const size_t nrows = row_vid.size();
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    }
+    kercol_width++;
+
+    size_t varcol_width = variant_col_name.size();
+    for (size_t ir = 0; ir < nrows; ++ir) {
+      varcol_width = max(varcol_width,
+        getVariantTuningColumnName(row_vid[ir], row_tuning[ir]).size());
+    }
+    varcol_width++;
+
+    size_t rankcol_width = prec+6;
+
+    //
+    // Print title line.
+    //
+    file << "Per-Rank Mean Runtime Report (sec.) ";
+    for (int r = 0; r < num_ranks + 1; ++r) {
+      file << sepchr;
+    }
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name;
+    for (int r = 0; r < num_ranks; ++r) {
+      file << sepchr <<left<< setw(rankcol_width)
+           << string("Rank ") + to_string(r);
+    }
+    file << endl;
+
+    //
+    // Gather times from all ranks and print a row for each variant tuning
+    // of each kernel.
+    //
+    vector<double> all_times( rank == 0 ? nrows * num_ranks : 0 );
+
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+
+      vector<bool> row_run;
+      vector<double> times;
+      getRankTimes(kern, row_vid, row_tuning, row_run, times);
+
+      MPI_Gather(times.data(), nrows, MPI_DOUBLE,
+                 all_times.data(), nrows, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+
+      for (size_t ir = 0; ir < nrows; ++ir) {
+        if ( !row_run[ir] ) {
+          continue;
+        }
+
+        file <<left<< setw(kercol_width) << kern->getName()
+             << sepchr <<left<< setw(varcol_width)
+             << getVariantTuningColumnName(row_vid[ir], row_tuning[ir])
+             << setprecision(prec) << std::fixed;
+        if ( rank == 0 ) {
+          for (int r = 0; r < num_ranks; ++r) {
+            file << sepchr <<right<< setw(rankcol_width)
+                 << all_times[r * nrows + ir];
+          }
+        }
+        file << endl;
+      }
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+#endif
+
+/*
+ * Memory use of the given kernel variant tuning: bytes allocated and page
+ * faults per run during setUp() and timed region. With MPI, each is the
+ * maximum over ranks; all ranks must call this collectively.
+ */
+void Executor::getMemoryUsage(KernelBase* kern, VariantID vid, size_t tune_idx,
+                              vector<double>& usage)
+{
+  usage.assign(5, 0.0);
+  if ( kern->hasMemoryUsage(vid, tune_idx) ) {
+    usage[0] = kern->getAllocBytes(vid, tune_idx);
+    usage[1] = kern->getSetUpMinorFaults(vid, tune_idx);
+    usage[2] = kern->getSetUpMajorFaults(vid, tune_idx);
+    usage[3] = kern->getTimedMinorFaults(vid, tune_idx);
+    usage[4] = kern->getTimedMajorFaults(vid, tune_idx);
+  }
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+  vector<double> local_usage(usage);
+  MPI_Allreduce(local_usage.data(), usage.data(), usage.size(), MPI_DOUBLE,
+                MPI_MAX, MPI_COMM_WORLD);
+#endif
+}
+
+void Executor::writeMemoryReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string sepchr(" , ");
+
+    const string col_names[] = { "Allocated bytes",
+                                 "SetUp minor faults",
+                                 "SetUp major faults",
+                                 "Timed minor faults",
+                                 "Timed major faults" };
+    const size_t ncols = 5;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    }
+    kercol_width++;
+
+    size_t varcol_width = variant_col_name.size();
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      VariantID vid = variant_ids[iv];
+      for (size_t t = 0; t < tuning_names[vid].size(); ++t) {
+        varcol_width = max(varcol_width,
+          getVariantTuningColumnName(vid, tuning_names[vid][t]).size());
+      }
+    }
+    varcol_width++;
+
+    //
+    // Print title line.
+    //
+    file << "Memory Usage Report (bytes allocated by kernel, page faults per run";
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+    file << "; maximum over MPI ranks";
+#endif
+    file << ")";
+    for (size_t ic = 0; ic < ncols + 1; ++ic) {
+      file << sepchr;
+    }
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name;
+    for (size_t ic = 0; ic < ncols; ++ic) {
+      file << sepchr <<left<< col_names[ic];
+    }
+    file << endl;
+
+    //
+    // Print a row for each variant tuning run of each kernel.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+        for (size_t t = 0; t < tuning_names[vid].size(); ++t) {
+          size_t tune_idx = kern->getVariantTuningIndex(vid, tuning_names[vid][t]);
+          if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+            continue;
+          }
+
+          vector<double> usage;
+          getMemoryUsage(kern, vid, tune_idx, usage);
+
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width)
+               << getVariantTuningColumnName(vid, tuning_names[vid][t]);
+          file << sepchr <<right<< setw(col_names[0].size())
+               << static_cast<size_t>(usage[0]);
+          for (size_t ic = 1; ic < ncols; ++ic) {
+            file << sepchr <<right<< setw(col_names[ic].size())
+                 << setprecision(1) << std::fixed << usage[ic];
+          }
+          file << endl;
+        }
+      }
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+/*
+ * Energy used by the given kernel variant tuning per run: package and DRAM
+ * joules, mean power (watts) of both, and FLOP rate and bandwidth per watt.
+ * Entries are NaN if they could not be measured. With MPI, energy and power
+ * are summed over one rank per node, since all ranks on a node read the
+ * same counters; all ranks must call this collectively.
+ */
+void Executor::getEnergyUsage(KernelBase* kern, VariantID vid, size_t tune_idx,
+                              vector<double>& energy)
+{
+  static int node_rank = -1;
+  if ( node_rank < 0 ) {
+    node_rank = 0;
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+    MPI_Comm node_comm;
+    MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0,
+                        MPI_INFO_NULL, &node_comm);
+    MPI_Comm_rank(node_comm, &node_rank);
+    MPI_Comm_free(&node_comm);
+#endif
+  }
+
+  double local_vals[3] = { 0.0, 0.0, 0.0 };
+  if ( node_rank == 0 && kern->hasEnergy(vid, tune_idx) ) {
+    local_vals[0] = kern->getEnergy(Energy_Package, vid, tune_idx);
+    local_vals[1] = kern->getEnergy(Energy_DRAM, vid, tune_idx);
+    double time = kern->getEnergyTime(vid, tune_idx);
+    if ( time > 0.0 ) {
+      local_vals[2] = (local_vals[0] + local_vals[1]) / time;
+    }
+  }
+  double vals[3] = { local_vals[0], local_vals[1], local_vals[2] };
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+  MPI_Allreduce(local_vals, vals, 3, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#endif
+
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  energy.assign(5, nan);
+  energy[0] = vals[0];
+  if ( haveEnergyDomain(Energy_DRAM) ) {
+    energy[1] = vals[1];
+  }
+  if ( vals[2] > 0.0 ) {
+    energy[2] = vals[2];
+    const string& tname = kern->getVariantTuningName(vid, tune_idx);
+    if ( kern->getFLOPsPerRep(tname) > 0 ) {
+      energy[3] = getReportDataEntry(CSVRepMode::FLOPsRate,
+                                     RunParams::CombinerOpt::Average,
+                                     kern, vid, tune_idx) / vals[2];
+    }
+    if ( kern->getBytesPerRep(tname) > 0 ) {
+      energy[4] = getReportDataEntry(CSVRepMode::BandwidthRate,
+                                     RunParams::CombinerOpt::Average,
+                                     kern, vid, tune_idx) / vals[2];
+    }
+  }
+}
+
+void Executor::writeEnergyReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string sepchr(" , ");
+
+    const string col_names[] = { "Package J",
+                                 "DRAM J",
+                                 "Watts",
+                                 "GFLOP/s per W",
+                                 "GB/s per W" };
+    const size_t ncols = 5;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    }
+    kercol_width++;
+
+    size_t varcol_width = variant_col_name.size();
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      VariantID vid = variant_ids[iv];
+      for (size_t t = 0; t < tuning_names[vid].size(); ++t) {
+        varcol_width = max(varcol_width,
+          getVariantTuningColumnName(vid, tuning_names[vid][t]).size());
+      }
+    }
+    varcol_width++;
+
+    //
+    // Print title line.
+    //
+    file << "Energy Report (timed region per run";
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+    file << "; summed over nodes";
+#endif
+    file << ")";
+    for (size_t ic = 0; ic < ncols + 1; ++ic) {
+      file << sepchr;
+    }
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name;
+    for (size_t ic = 0; ic < ncols; ++ic) {
+      file << sepchr <<left<< col_names[ic];
+    }
+    file << endl;
+
+    //
+    // Print a row for each variant tuning run of each kernel.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+        for (size_t t = 0; t < tuning_names[vid].size(); ++t) {
+          size_t tune_idx = kern->getVariantTuningIndex(vid, tuning_names[vid][t]);
+          if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+            continue;
+          }
+
+          vector<double> energy;
+          getEnergyUsage(kern, vid, tune_idx, energy);
+
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width)
+               << getVariantTuningColumnName(vid, tuning_names[vid][t]);
+          for (size_t ic = 0; ic < ncols; ++ic) {
+            file << sepchr <<right<< setw(col_names[ic].size());
+            if ( std::isnan(energy[ic]) ) {
+              file << "n/a";
+            } else {
+              file << setprecision(ic < 2 ? 6 : 3) << std::fixed
+                   << energy[ic];
+            }
+          }
+          file << endl;
+        }
+      }
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+/*
+ * Time of each pass of the given kernel variant tuning. With MPI, each
+ * pass time is that of the slowest rank; all ranks must call this
+ * collectively.
+ */
+void Executor::getPassTimes(KernelBase* kern, VariantID vid, size_t tune_idx,
+                            vector<double>& times)
+{
+  const vector<Timer::ElapsedType>& pass_times =
+    kern->getPassTimes(vid, tune_idx);
+  times.assign(pass_times.begin(), pass_times.end());
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+  vector<double> local_times(times);
+  MPI_Allreduce(local_times.data(), times.data(), times.size(), MPI_DOUBLE,
+                MPI_MAX, MPI_COMM_WORLD);
+#endif
+}
+
+void Executor::writePassTimingReport(ostream& file)
+{
+  if ( file ) {
+
+    //
+    // Set basic table formatting parameters.
+    //
+    const string kernel_col_name("Kernel  ");
+    const string variant_col_name("Variant  ");
+    const string sepchr(" , ");
+    size_t prec = 9;
+
+    size_t kercol_width = kernel_col_name.size();
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      kercol_width = max(kercol_width, kernels[ik]->getName().size());
+    }
+    kercol_width++;
+
+    size_t varcol_width = variant_col_name.size();
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      VariantID vid = variant_ids[iv];
+      for (size_t t = 0; t < tuning_names[vid].size(); ++t) {
+        varcol_width = max(varcol_width,
+          getVariantTuningColumnName(vid, tuning_names[vid][t]).size());
+      }
+    }
+    varcol_width++;
+
+    size_t passcol_width = prec+6;
+
+    //
+    // Print title line.
+    //
+    file << "Runtime Report for each pass (sec.) ";
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+    file << "of slowest MPI rank ";
+#endif
+    file << endl;
+
+    //
+    // Print column title line.
+    //
+    file <<left<< setw(kercol_width) << kernel_col_name
+         << sepchr <<left<< setw(varcol_width) << variant_col_name;
+    for (int p = 0; p < run_params.getNumPasses(); ++p) {
+      file << sepchr <<left<< setw(passcol_width)
+           << string("Pass ") + to_string(p+1);
+    }
+    file << endl;
+
+    //
+    // Print a row for each variant tuning run of each kernel.
+    //
+    for (size_t ik = 0; ik < kernels.size(); ++ik) {
+      KernelBase* kern = kernels[ik];
+      for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+        VariantID vid = variant_ids[iv];
+        for (size_t t = 0; t < tuning_names[vid].size(); ++t) {
+          size_t tune_idx = kern->getVariantTuningIndex(vid, tuning_names[vid][t]);
+          if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+            continue;
+          }
+
+          vector<double> times;
+          getPassTimes(kern, vid, tune_idx, times);
+
+          file <<left<< setw(kercol_width) << kern->getName()
+               << sepchr <<left<< setw(varcol_width)
+               << getVariantTuningColumnName(vid, tuning_names[vid][t])
+               << setprecision(prec) << std::scientific;
+          for (size_t p = 0; p < times.size(); ++p) {
+            file << sepchr <<right<< setw(passcol_width) << times[p];
+          }
+          file << endl;
+        }
+      }
+    }
+
+    file.flush();
+
+  } // note file will be closed when file stream goes out of scope
+}
+
+/*
+ * Read run times of a previous run from the per-pass runtime report in the
+ * given directory, or from its mean runtime report if there is none (as
+ * for runs made before the per-pass report existed). Times are keyed by
+ * kernel name and variant tuning column name.
+ */
+bool Executor::readBaselineTimes(const string& dir,
+                                 map<pair<string, string>, vector<double>>& times)
+{
+  const string fprefix = dir + "/" + run_params.getOutputFilePrefix();
+
+  auto split_line = [](const string& line) {
+    vector<string> fields;
+    istringstream line_str(line);
+    string field;
+    while ( getline(line_str, field, ',') ) {
+      size_t first = field.find_first_not_of(" \t");
+      size_t last = field.find_last_not_of(" \t\r");
+      fields.push_back( first == string::npos ?
+                        string() : field.substr(first, last - first + 1) );
+    }
+    return fields;
+  };
+
+  string line;
+
+  ifstream pass_file(fprefix + "-timing-passes.csv");
+  if ( pass_file ) {
+    getline(pass_file, line);  // title line
+    getline(pass_file, line);  // column title line
+    while ( getline(pass_file, line) ) {
+      vector<string> fields = split_line(line);
+      if ( fields.size() < 3 ) {
+        continue;
+      }
+      vector<double>& samples = times[make_pair(fields[0], fields[1])];
+      for (size_t f = 2; f < fields.size(); ++f) {
+        samples.push_back( ::atof(fields[f].c_str()) );
+      }
+    }
+    return true;
+  }
+
+  ifstream mean_file(fprefix + "-timing-" +
+                     RunParams::CombinerOptToStr(RunParams::CombinerOpt::Average) +
+                     ".csv");
+  if ( mean_file ) {
+    getline(mean_file, line);  // title line
+    getline(mean_file, line);  // column title line
+    vector<string> col_names = split_line(line);
+    while ( getline(mean_file, line) ) {
+      vector<string> fields = split_line(line);
+      for (size_t f = 1; f < fields.size() && f < col_names.size(); ++f) {
+        char* end = nullptr;
+        double val = strtod(fields[f].c_str(), &end);
+        if ( end != fields[f].c_str() ) {
+          times[make_pair(fields[0], col_names[f])].push_back(val);
+        }
+      }
+    }
+    return true;
+  }
+
+  return false;
+}
+
+/*
+ * Regularized incomplete beta function I_x(a, b), evaluated with its
+ * continued fraction expansion.
+ */
+static double incompleteBeta(double a, double b, double x)
+{
+  if ( x <= 0.0 ) { return 0.0; }
+  if ( x >= 1.0 ) { return 1.0; }
+
+  if ( x > (a + 1.0) / (a + b + 2.0) ) {
+    return 1.0 - incompleteBeta(b, a, 1.0 - x);
+  }
+
+  const int max_iter = 300;
+  const double eps = 1.0e-14;
+  const double tiny = 1.0e-300;
+
+  double c = 1.0;
+  double d = 1.0 - (a + b) * x / (a + 1.0);
+  if ( std::abs(d) < tiny ) { d = tiny; }
+  d = 1.0 / d;
+  double frac = d;
+  for (int m = 1; m <= max_iter; ++m) {
+    double coef = m * (b - m) * x / ((a + 2*m - 1.0) * (a + 2*m));
+    d = 1.0 + coef * d;
+    if ( std::abs(d) < tiny ) { d = tiny; }
+    c = 1.0 + coef / c;
+    if ( std::abs(c) < tiny ) { c = tiny; }
+    d = 1.0 / d;
+    frac *= d * c;
+
+    coef = -(a + m) * (a + b + m) * x / ((a + 2*m) * (a + 2*m + 1.0));
+    d = 1.0 + coef * d;
+    if ( std::abs(d) < tiny ) { d = tiny; }
+    c = 1.0 + coef / c;
+    if ( std::abs(c) < tiny ) { c = tiny; }
+    d = 1.0 / d;
+    frac *= d * c;
+
+    if ( std::abs(d * c - 1.0) < eps ) {
+      break;
+    }
+  }
+
+  return exp( lgamma(a + b) - lgamma(a) - lgamma(b) +
+              a * log(x) + b * log(1.0 - x) ) * frac / a;
+}
+
+/*
+ * Two-sided p-value of Welch's t-test for equal means of two samples;
+ * negative if either sample has fewer than two values.
+ */
+static double welchTTestPValue(const vector<double>& x, const vector<double>& y)
+{
+  if ( x.size() < 2 || y.size() < 2 ) {
+    return -1.0;
+  }
+
+  auto mean_var = [](const vector<double>& s, double& mean, double& var) {
+    mean = 0.0;
+    for (size_t i = 0; i < s.size(); ++i) { mean += s[i]; }
+    mean /= s.size();
+    var = 0.0;
+    for (size_t i = 0; i < s.size(); ++i) { var += (s[i]-mean)*(s[i]-mean); }
+    var /= (s.size() - 1);
+  };
+
+  double mean_x, var_x, mean_y, var_y;
+  mean_var(x, mean_x, var_x);
+  mean_var(y, mean_y, var_y);
+
+  const double se2_x = var_x / x.size();
+  const double se2_y = var_y / y.size();
+  const double se2 = se2_x + se2_y;
+  if ( se2 <= 0.0 ) {
+    return ( mean_x == mean_y ) ? 1.0 : 0.0;
+  }
+
+  const double t = (mean_x - mean_y) / sqrt(se2);
+  const double df = se2 * se2 / ( se2_x * se2_x / (x.size() - 1) +
+                                  se2_y * se2_y / (y.size() - 1) );
+
+  return incompleteBeta(0.5 * df, 0.5, df / (df + t * t));
+}
+
+/*
+ * Compare mean time of each kernel variant tuning run against the previous
+ * run times given. A variant tuning regresses when its mean time exceeds
+ * that of the previous run by more than the pass-fail tolerance and, when
+ * both runs have at least two passes, the difference is significant.
+ */
+void Executor::writeCompareReport(ostream& file,
+                                  const map<pair<string, string>, vector<double>>& baseline)
+{
+  const double alpha = 0.05;
+  const double tol = run_params.getPFTolerance();
+
+  //
+  // Set basic table formatting parameters.
+  //
+  const string kernel_col_name("Kernel  ");
+  const string variant_col_name("Variant  ");
+  const string sepchr(" , ");
+  const string status_col_name("Status");
+  size_t prec = 6;
+
+  size_t kercol_width = kernel_col_name.size();
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    kercol_width = max(kercol_width, kernels[ik]->getName().size());
+  }
+  kercol_width++;
+
+  size_t varcol_width = variant_col_name.size();
+  for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+    VariantID vid = variant_ids[iv];
+    for (size_t t = 0; t < tuning_names[vid].size(); ++t) {
+      varcol_width = max(varcol_width,
+        getVariantTuningColumnName(vid, tuning_names[vid][t]).size());
+    }
+  }
+  varcol_width++;
+
+  const string col_names[] = { "Previous Time", "Time", "Rel. Change",
+                               "p-value" };
+  size_t col_width = prec+8;
+
+  //
+  // Print title line.
+  //
+  file << "Comparison to " << run_params.getCompareDirName()
+       << " (mean times in sec.; REGRESSION if slower by more than "
+       << tol*100.0 << "% with p < " << alpha << ")";
+  for (size_t ic = 0; ic < 5; ++ic) {
+    file << sepchr;
+  }
+  file << endl;
+
+  //
+  // Print column title line.
+  //
+  file <<left<< setw(kercol_width) << kernel_col_name
+       << sepchr <<left<< setw(varcol_width) << variant_col_name;
+  for (size_t ic = 0; ic < 4; ++ic) {
+    file << sepchr <<left<< setw(col_width) << col_names[ic];
+  }
+  file << sepchr << status_col_name << endl;
+
+  //
+  // Print a row for each variant tuning run of each kernel.
+  //
+  vector<string> regressions;
+
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    KernelBase* kern = kernels[ik];
+    for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
+      VariantID vid = variant_ids[iv];
+      for (size_t t = 0; t < tuning_names[vid].size(); ++t) {
+        size_t tune_idx = kern->getVariantTuningIndex(vid, tuning_names[vid][t]);
+        if ( !kern->wasVariantTuningRun(vid, tune_idx) ) {
+          continue;
+        }
+        const string col_name =
+          getVariantTuningColumnName(vid, tuning_names[vid][t]);
+
+        vector<double> times;
+        getPassTimes(kern, vid, tune_idx, times);
+
+        file <<left<< setw(kercol_width) << kern->getName()
+             << sepchr <<left<< setw(varcol_width) << col_name;
+
+        auto prev = baseline.find(make_pair(kern->getName(), col_name));
+        if ( prev == baseline.end() || prev->second.empty() || times.empty() ) {
+          file << sepchr <<right<< setw(col_width) << "Not run"
+               << sepchr <<right<< setw(col_width) << ""
+               << sepchr <<right<< setw(col_width) << ""
+               << sepchr <<right<< setw(col_width) << ""
+               << sepchr << "NEW" << endl;
+          continue;
+        }
+        const vector<double>& prev_times = prev->second;
+
+        double prev_mean = 0.0;
+        for (size_t p = 0; p < prev_times.size(); ++p) {
+          prev_mean += prev_times[p];
+        }
+        prev_mean /= prev_times.size();
+
+        double mean = 0.0;
+        for (size_t p = 0; p < times.size(); ++p) {
+          mean += times[p];
+        }
+        mean /= times.size();
+
+        double change = (prev_mean > 0.0) ? (mean - prev_mean) / prev_mean
+                                          : 0.0;
+        double pval = welchTTestPValue(times, prev_times);
+        bool significant = ( pval < 0.0 || pval < alpha );
+
+        string status("OK");
+        if ( change > tol && significant ) {
+          status = "REGRESSION";
+          regressions.push_back(kern->getName() + " " + col_name);
+        } else if ( change < -tol && significant ) {
+          status = "IMPROVEMENT";
+        }
+
+        file << setprecision(prec) << std::scientific
+             << sepchr <<right<< setw(col_width) << prev_mean
+             << sepchr <<right<< setw(col_width) << mean
+             << std::fixed
+             << sepchr <<right<< setw(col_width) << change
+             << sepchr <<right<< setw(col_width);
+        if ( pval < 0.0 ) {
+          file << "n/a";
+        } else {
+          file << pval;
+        }
+        file << sepchr << status << endl;
+      }
+    }
+  }
+
+  file.flush();
+
+  getCout() << "\nComparison to " << run_params.getCompareDirName()
+            << ": " << regressions.size() << " regression(s)" << endl;
+  for (size_t ir = 0; ir < regressions.size(); ++ir) {
+    getCout() << "  REGRESSION " << regressions[ir] << endl;
+  }
+
+  if ( !regressions.empty() ) {
+    compare_passed = false;
+  }
+}
+
+string Executor::getReportTitle(CSVRepMode mode, RunParams::CombinerOpt combiner)
+{
+  string title;
+  switch ( combiner ) {
+    case RunParams::CombinerOpt::Average : {
+      title = string("Mean ");
+    }
+    break;
+    case RunParams::CombinerOpt::Minimum : {
+      title = string("Min ");
+    }
+    break;
+    case RunParams::CombinerOpt::Maximum : {
+      title = string("Max ");
+    }
+    break;
+    default : { cout << "\n Unknown CSV combiner mode = " << combiner << endl; }
+  }
+  switch ( mode ) {
+    case CSVRepMode::Timing : {
+      title += string("Runtime Report (sec.) ");
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+      int num_ranks;
+      MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+      title += string("of slowest of ") + to_string(num_ranks) +
+               string(" MPI ranks ");
+#endif
+      break;
+    }
+    case CSVRepMode::Speedup : {
+      if ( haveReferenceVariant() ) {
+        title += string("Speedup Report (T_ref/T_var)") +
+                 string(": ref var = ") + getVariantName(reference_vid) +
+                 string(" ");
+      }
+      break;
+    }
+    case CSVRepMode::DOFsRate : {
+      title = string("Mean DOFs/sec Report ");
+      break;
+    }
+    case CSVRepMode::BandwidthRate : {
+      title += string("Bandwidth Report (GB/s) ");
+      break;
+    }
+    case CSVRepMode::CopyBandwidthFraction : {
+      title += string("Bandwidth Report (fraction of Stream_COPY bandwidth ") +
+               string("with same variant) ");
+      break;
+    }
+    case CSVRepMode::FLOPsRate : {
+      title += string("FLOP Rate Report (GFLOP/s) ");
+      break;
+    }
+    default : { getCout() << "\n Unknown CSV report mode = " << mode << endl; }
+  };
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+  if ( mode == CSVRepMode::DOFsRate ||
+       mode == CSVRepMode::BandwidthRate ||
+       mode == CSVRepMode::CopyBandwidthFraction ||
+       mode == CSVRepMode::FLOPsRate ) {
+    int num_ranks;
+    MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+    title += string("aggregated over ") + to_string(num_ranks) +
+             string(" MPI ranks (") +
+             RunParams::ScalingModeToStr(run_params.getScalingMode()) +
+             string(" scaling) ");
+  }
+#endif
+  return title;
+}
+
+long double Executor::getReportDataEntry(CSVRepMode mode,
+                                         RunParams::CombinerOpt combiner,
+                                         KernelBase* kern,
+                                         VariantID vid,
+                                         size_t tune_idx)
+{
+  long double retval = 0.0;
+  switch ( mode ) {
+    case CSVRepMode::Timing : {
+      retval = getCombinedTime(combiner, kern, vid, tune_idx);
+      break;
+    }
+    case CSVRepMode::Speedup : {
+      if ( haveReferenceVariant() ) {
+        size_t ref_tune =
+          getReferenceTuning(kern, reference_vid, vid, tune_idx);
+        if ( kern->wasVariantTuningRun(reference_vid, ref_tune) &&
+             kern->wasVariantTuningRun(vid, tune_idx) ) {
+          retval = getCombinedTime(combiner, kern, reference_vid, ref_tune) /
+                   getCombinedTime(combiner, kern, vid, tune_idx);
+        } else {
+          retval = 0.0;
+        }
+#if 0 // RDH DEBUG  (leave this here, it's useful for debugging!)
+        getCout() << "Kernel(iv): " << kern->getName() << "(" << vid << ")" << endl;
+        getCout() << "\tref_time, tot_time, retval = "
+             << kern->getTotTime(reference_vid, ref_tune) << " , "
+             << kern->getTotTime(vid, tune_idx) << " , "
+             << retval << endl;
+#endif
+      }
+      break;
+    }
+    case CSVRepMode::DOFsRate : {
+      //
+      // Total DOFs of all ranks over the time of the slowest rank.
+      //
+      const string& tname = kern->getVariantTuningName(vid, tune_idx);
+      long double amount =
+        static_cast<long double>(kern->getDOFsPerRep(tname)) *
+        kern->getRunReps();
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+      long double local_amount = amount;
+      MPI_Allreduce(&local_amount, &amount, 1, MPI_LONG_DOUBLE, MPI_SUM,
+                    MPI_COMM_WORLD);
+#endif
+      long double avg_time =
+        getCombinedTime(RunParams::CombinerOpt::Average, kern, vid, tune_idx);
+      if ( avg_time > 0.0 ) {
+        retval = amount / avg_time;
+      }
+      break;
+    }
+    case CSVRepMode::BandwidthRate :
+    case CSVRepMode::FLOPsRate : {
+      //
+      // Total bytes or FLOPs of all ranks over the time of the slowest rank.
+      //
+      const string& tname = kern->getVariantTuningName(vid, tune_idx);
+      long double per_rep = ( mode == CSVRepMode::BandwidthRate ) ?
+        kern->getBytesPerRep(tname) : kern->getFLOPsPerRep(tname);
+      long double amount = per_rep * kern->getRunReps();
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+      long double local_amount = amount;
+      MPI_Allreduce(&local_amount, &amount, 1, MPI_LONG_DOUBLE, MPI_SUM,
+                    MPI_COMM_WORLD);
+#endif
+      long double avg_time =
+        getCombinedTime(RunParams::CombinerOpt::Average, kern, vid, tune_idx);
+      if ( avg_time > 0.0 ) {
+        retval = amount / avg_time * 1.0e-9;
+      }
+      break;
+    }
+    case CSVRepMode::CopyBandwidthFraction : {
+      //
+      // Compare against the best Stream_COPY tuning with the same variant,
+      // which is close to the attainable memory bandwidth.
+      //
+      KernelBase* copy = getKernel(Stream_COPY);
+      long double copy_bw = 0.0;
+      for (size_t t = 0; t < copy->getNumVariantTunings(vid); ++t) {
+        if ( copy->wasVariantTuningRun(vid, t) ) {
+          copy_bw = max(copy_bw,
+            getReportDataEntry(CSVRepMode::BandwidthRate, combiner,
+                               copy, vid, t));
+        }
+      }
+      long double bw = getReportDataEntry(CSVRepMode::BandwidthRate,
+                                          combiner, kern, vid, tune_idx);
+      if ( copy_bw > 0.0 ) {
+        retval = bw / copy_bw;
+      }
+      break;
+    }
+    default : { getCout() << "\n Unknown CSV report mode = " << mode << endl; }
+  };
+  return retval;
+}
+
+size_t Executor::getReferenceTuning(KernelBase* kern,
+                                    VariantID ref_vid,
+                                    VariantID vid,
+                                    size_t tune_idx)
+{
+  //
+  // Compare against the ref_vid tuning with the same name, or else its
+  // first run tuning with the same precision. Returns the number of ref_vid
+  // tunings when there is no such tuning.
+  //
+  const string& tname = kern->getVariantTuningName(vid, tune_idx);
+  const PrecisionID pid = kern->getTuningPrecision(tname);
+  size_t num_ref_tunings = kern->getNumVariantTunings(ref_vid);
+
+  size_t ref_tune = kern->getVariantTuningIndex(ref_vid, tname);
+  if ( kern->wasVariantTuningRun(ref_vid, ref_tune) ) {
+    return ref_tune;
+  }
+  for (ref_tune = 0; ref_tune < num_ref_tunings; ++ref_tune) {
+    const string& ref_tname = kern->getVariantTuningName(ref_vid, ref_tune);
+    if ( kern->wasVariantTuningRun(ref_vid, ref_tune) &&
+         kern->getTuningPrecision(ref_tname) == pid ) {
+      return ref_tune;
+    }
+  }
+  return num_ref_tunings;
+}
+
+/*
+ * Time for the given kernel variant tuning combined over passes. With MPI,
+ * this is the time of the slowest rank, since every kernel variant starts
+ * together on all ranks; all ranks must call this collectively.
+ */
+long double Executor::getCombinedTime(RunParams::CombinerOpt combiner,
+                                      KernelBase* kern,
+                                      VariantID vid,
+                                      size_t tune_idx)
+{
+  double time = 0.0;
+  switch ( combiner ) {
+    case RunParams::CombinerOpt::Average : {
+      time = kern->getTotTime(vid, tune_idx) / run_params.getNumPasses();
+    }
+    break;
+    case RunParams::CombinerOpt::Minimum : {
+      time = kern->getMinTime(vid, tune_idx);
+    }
+    break;
+    case RunParams::CombinerOpt::Maximum : {
+      time = kern->getMaxTime(vid, tune_idx);
+    }
+    break;
+    default : { cout << "\n Unknown CSV combiner mode = " << combiner << endl; }
+  }
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+  double max_time = time;
+  MPI_Allreduce(&time, &max_time, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  time = max_time;
+#endif
+  return time;
+}
+
+/*
+ * Times less than this many times the timer resolution (or its overhead,
+ * if larger) are too short to measure reliably.
+ */
+static const double unreliable_time_factor = 100.0;
+
+bool Executor::isTimeUnreliable(long double time) const
+{
+  const TimerCalibration& calibration = getTimerCalibration();
+  return time < unreliable_time_factor *
+                std::max(calibration.resolution, calibration.overhead);
+}
+
+/*
+ * Kernel with given id in the run, or nullptr if it is not being run.
+ */
+KernelBase* Executor::getKernel(KernelID kid) const
+{
+  for (size_t ik = 0; ik < kernels.size(); ++ik) {
+    if ( kernels[ik]->getKernelID() == kid ) {
+      return kernels[ik];
+    }
+  }
+  return nullptr;
+}
+
+string Executor::getVariantTuningColumnName(VariantID vid,
+                                            const string& tuning_name) const
+{
+  if ( tuning_name == KernelBase::getDefaultTuningName() ) {
+    return getVariantName(vid);
+  }
+  return getVariantName(vid) + "-" + tuning_name;
 }
 
 void Executor::getFOMGroups(vector<FOMGroup>& fom_groups)
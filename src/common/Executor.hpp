@@ -10,17 +10,20 @@
 #define RAJAPerf_Executor_HPP
 
 #include "common/RAJAPerfSuite.hpp"
+#include "common/KernelBase.hpp"
 #include "common/RunParams.hpp"
+#include "common/RPTypes.hpp"
 
 #include <iosfwd>
 #include <streambuf>
 #include <memory>
 #include <utility>
 #include <set>
+#include <map>
+#include <tuple>
 
 namespace rajaperf {
 
-class KernelBase;
 class WarmupKernel;
 
 /*!
@@ -45,12 +48,22 @@ public:
 
   void outputRunData();
 
+  /*!
+   * \brief False if results were compared to a previous run (--compare-to)
+   * and a regression was found or the previous results could not be read.
+   */
+  bool comparePassed() const { return compare_passed; }
+
 private:
   Executor() = delete;
 
   enum CSVRepMode {
     Timing = 0,
     Speedup,
+    DOFsRate,
+    BandwidthRate,
+    CopyBandwidthFraction,
+    FLOPsRate,
 
     NumRepModes // Keep this one last and DO NOT remove (!!)
   };
@@ -64,24 +77,90 @@ private:
 
   bool haveReferenceVariant() { return reference_vid < NumVariants; }
 
+  bool isTimeUnreliable(long double time) const;
+
+  KernelBase* getKernel(KernelID kid) const;
+
+  std::string getVariantTuningColumnName(VariantID vid,
+                                         const std::string& tuning_name) const;
+
   void writeKernelInfoSummary(std::ostream& str, bool to_file) const;
 
   void writeCSVReport(std::ostream& file, CSVRepMode mode,
                       RunParams::CombinerOpt combiner, size_t prec);
   std::string getReportTitle(CSVRepMode mode, RunParams::CombinerOpt combiner);
   long double getReportDataEntry(CSVRepMode mode, RunParams::CombinerOpt combiner,
-                                 KernelBase* kern, VariantID vid);
+                                 KernelBase* kern, VariantID vid,
+                                 size_t tune_idx);
+  long double getCombinedTime(RunParams::CombinerOpt combiner,
+                              KernelBase* kern, VariantID vid,
+                              size_t tune_idx);
+  size_t getReferenceTuning(KernelBase* kern, VariantID ref_vid,
+                            VariantID vid, size_t tune_idx);
+
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  void writeRankTimingReport(std::ostream& file);
+  void writePerRankTimingReport(std::ostream& file);
+  void getRankTimes(KernelBase* kern,
+                    const std::vector<VariantID>& row_vid,
+                    const std::vector<std::string>& row_tuning,
+                    std::vector<bool>& row_run,
+                    std::vector<double>& row_time);
+#endif
 
   void writeChecksumReport(std::ostream& file);
 
+  std::vector<std::string> getRunLogParams() const;
+  void openRunLog();
+  void writeRunLogRecord(KernelBase* kern, VariantID vid, size_t tune_idx,
+                         int pass, const KernelBase::Samples& prev_samples);
+  bool readRunLog(const std::string& log_name);
+
+  void writeJSONReport(std::ostream& file);
+
+  void writeMemoryReport(std::ostream& file);
+  void getMemoryUsage(KernelBase* kern, VariantID vid, size_t tune_idx,
+                      std::vector<double>& usage);
+
+  void writeEnergyReport(std::ostream& file);
+  void getEnergyUsage(KernelBase* kern, VariantID vid, size_t tune_idx,
+                      std::vector<double>& energy);
+
+  void writePassTimingReport(std::ostream& file);
+  void getPassTimes(KernelBase* kern, VariantID vid, size_t tune_idx,
+                    std::vector<double>& times);
+  bool readBaselineTimes(const std::string& dir,
+         std::map<std::pair<std::string, std::string>, std::vector<double>>& times);
+  void writeCompareReport(std::ostream& file,
+         const std::map<std::pair<std::string, std::string>,
+                        std::vector<double>>& baseline);
+
   void writeFOMReport(std::ostream& file, std::vector<FOMGroup>& fom_groups);
   void getFOMGroups(std::vector<FOMGroup>& fom_groups);
 
   RunParams run_params;
   std::vector<KernelBase*> kernels;
   std::vector<VariantID>   variant_ids;
+  std::vector<std::string> tuning_names[NumVariants];
 
   VariantID reference_vid;
+
+  bool compare_passed;
+
+  //
+  // Results of a kernel variant tuning pass read from a run log; samples
+  // holds its memory and energy sample columns.
+  //
+  struct RunLogRecord
+  {
+    double time;
+    Checksum_type checksum;
+    std::vector<double> samples;
+  };
+
+  std::unique_ptr<std::ostream> run_log;
+  std::map<std::tuple<std::string, std::string, int>,
+           RunLogRecord> resumed_results;
 };
 
 }  // closing brace for rajaperf namespace
@@ -11,9 +11,28 @@
 #include "RunParams.hpp"
 
 #include <cmath>
+#include <algorithm>
+#include <type_traits>
+
+#include <sys/resource.h>
 
 namespace rajaperf {
 
+/*
+ * Page faults of this process so far.
+ */
+static void getPageFaults(long& minor_faults, long& major_faults)
+{
+  struct rusage usage;
+  if ( getrusage(RUSAGE_SELF, &usage) == 0 ) {
+    minor_faults = usage.ru_minflt;
+    major_faults = usage.ru_majflt;
+  } else {
+    minor_faults = 0;
+    major_faults = 0;
+  }
+}
+
 KernelBase::KernelBase(KernelID kid, const RunParams& params) :
   run_params(params)
 {
@@ -39,16 +58,16 @@ KernelBase::KernelBase(KernelID kid, const RunParams& params) :
   FLOPs_per_rep = -1;
 
   running_variant = NumVariants;
+  running_tuning = 0;
 
   checksum_scale_factor = 1.0;
 
   for (size_t vid = 0; vid < NumVariants; ++vid) {
     checksum[vid] = 0.0;
-    num_exec[vid] = 0;
-    min_time[vid] = std::numeric_limits<double>::max();
-    max_time[vid] = -std::numeric_limits<double>::max();
-    tot_time[vid] = 0.0;
   }
+
+  timer_start_minor_faults = 0;
+  timer_start_major_faults = 0;
 }
 
 
@@ -59,14 +78,21 @@ KernelBase::~KernelBase()
 
 Index_type KernelBase::getTargetProblemSize() const
 {
-  Index_type target_size = static_cast<Index_type>(0);
+  double target_size = 0.0;
   if (run_params.getSizeMeaning() == RunParams::SizeMeaning::Factor) {
-    target_size =
-      static_cast<Index_type>(default_prob_size*run_params.getSizeFactor());
+    target_size = default_prob_size*run_params.getSizeFactor();
   } else if (run_params.getSizeMeaning() == RunParams::SizeMeaning::Direct) {
-    target_size = static_cast<Index_type>(run_params.getSize());
+    target_size = run_params.getSize();
   }
-  return target_size;
+#ifdef RAJA_PERFSUITE_ENABLE_MPI
+  // With strong scaling the size given is split evenly among ranks.
+  if (run_params.getScalingMode() == RunParams::ScalingMode::Strong) {
+    int num_ranks;
+    MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+    target_size /= num_ranks;
+  }
+#endif
+  return static_cast<Index_type>(target_size);
 }
 
 Index_type KernelBase::getRunReps() const
@@ -83,35 +109,274 @@ Index_type KernelBase::getRunReps() const
 void KernelBase::setVariantDefined(VariantID vid)
 {
   has_variant_defined[vid] = isVariantAvailable(vid);
+
+  if ( has_variant_defined[vid] ) {
+    setVariantTuningNames(vid, {getDefaultTuningName()});
+  }
+}
+
+void KernelBase::setVariantTuningNames(VariantID vid,
+                                       const std::vector<std::string>& names)
+{
+  if ( !has_variant_defined[vid] ) {
+    return;
+  }
+
+  const size_t ntunings = names.size();
+
+  tuning_names[vid] = names;
+  num_exec[vid].assign(ntunings, 0);
+  min_time[vid].assign(ntunings, std::numeric_limits<double>::max());
+  max_time[vid].assign(ntunings, -std::numeric_limits<double>::max());
+  tot_time[vid].assign(ntunings, 0.0);
+  pass_times[vid].assign(ntunings, std::vector<Timer::ElapsedType>());
+
+  num_mem_samples[vid].assign(ntunings, 0);
+  alloc_bytes[vid].assign(ntunings, 0);
+  setup_minor_faults[vid].assign(ntunings, 0);
+  setup_major_faults[vid].assign(ntunings, 0);
+  timed_minor_faults[vid].assign(ntunings, 0);
+  timed_major_faults[vid].assign(ntunings, 0);
+
+  num_energy_samples[vid].assign(ntunings, 0);
+  for (size_t ed = 0; ed < NumEnergyDomains; ++ed) {
+    timed_energy[vid][ed].assign(ntunings, 0.0);
+  }
+  energy_time[vid].assign(ntunings, 0.0);
+
+  tuning_checksum[vid].assign(ntunings, 0.0);
+}
+
+void KernelBase::setVariantPrecisions(VariantID vid,
+                                      const std::vector<PrecisionID>& pids)
+{
+  if ( !has_variant_defined[vid] ) {
+    return;
+  }
+
+  std::vector<std::string> names;
+  for (size_t ip = 0; ip < pids.size(); ++ip) {
+    names.push_back( getPrecisionName(pids[ip]) );
+    tuning_precision[ names.back() ] = pids[ip];
+  }
+
+  setVariantTuningNames(vid, names);
+}
+
+const std::string& KernelBase::getDefaultTuningName()
+{
+  static const std::string default_tuning_name("default");
+  return default_tuning_name;
+}
+
+size_t KernelBase::getVariantTuningIndex(VariantID vid,
+                                         const std::string& tuning_name) const
+{
+  size_t tune_idx = 0;
+  while ( tune_idx < tuning_names[vid].size() &&
+          tuning_names[vid][tune_idx] != tuning_name ) {
+    ++tune_idx;
+  }
+  return tune_idx; // == getNumVariantTunings(vid) if not found
+}
+
+Index_type KernelBase::getDOFsPerRep(const std::string& tuning_name) const
+{
+  auto dofs = dofs_per_rep.find(tuning_name);
+  if ( dofs == dofs_per_rep.end() ) {
+    return -1;
+  }
+  return dofs->second;
+}
+
+PrecisionID KernelBase::getTuningPrecision(const std::string& tuning_name) const
+{
+  auto precision = tuning_precision.find(tuning_name);
+  if ( precision == tuning_precision.end() ) {
+    // tunings without a precision use Real_type
+    return std::is_same<Real_type, Float_type>::value ? Precision_Float
+                                                      : Precision_Double;
+  }
+  return precision->second;
+}
+
+Index_type KernelBase::getBytesPerRep(const std::string& tuning_name) const
+{
+  auto bytes = tuning_bytes_per_rep.find(tuning_name);
+  if ( bytes == tuning_bytes_per_rep.end() ) {
+    return bytes_per_rep;
+  }
+  return bytes->second;
+}
+
+Index_type KernelBase::getFLOPsPerRep(const std::string& tuning_name) const
+{
+  auto FLOPs = tuning_FLOPs_per_rep.find(tuning_name);
+  if ( FLOPs == tuning_FLOPs_per_rep.end() ) {
+    return FLOPs_per_rep;
+  }
+  return FLOPs->second;
 }
 
+bool KernelBase::wasVariantRun(VariantID vid) const
+{
+  for (size_t t = 0; t < num_exec[vid].size(); ++t) {
+    if ( num_exec[vid][t] > 0 ) {
+      return true;
+    }
+  }
+  return false;
+}
 
-void KernelBase::execute(VariantID vid)
+
+void KernelBase::execute(VariantID vid, size_t tune_idx)
 {
   running_variant = vid;
+  running_tuning = tune_idx;
+
+  std::string region_name = getName() + "." + getVariantName(vid);
+  if ( tuning_names[vid][tune_idx] != getDefaultTuningName() ) {
+    region_name += "-" + tuning_names[vid][tune_idx];
+  }
+  beginAnnotation(region_name.c_str());
 
   resetTimer();
 
   resetDataInitCount();
+  resetDataAllocPeak();
+  const size_t start_alloc_bytes = getDataAllocBytes();
+
+  long start_minor_faults, start_major_faults;
+  getPageFaults(start_minor_faults, start_major_faults);
+  beginAnnotation("setUp");
   this->setUp(vid);
+  endAnnotation("setUp");
+  long end_minor_faults, end_major_faults;
+  getPageFaults(end_minor_faults, end_major_faults);
+  setup_minor_faults[vid][tune_idx] += end_minor_faults - start_minor_faults;
+  setup_major_faults[vid][tune_idx] += end_major_faults - start_major_faults;
 
+  beginAnnotation("run");
   this->runKernel(vid);
+  endAnnotation("run");
+
+  alloc_bytes[vid][tune_idx] = std::max(alloc_bytes[vid][tune_idx],
+                                        getDataAllocPeak() - start_alloc_bytes);
+  num_mem_samples[vid][tune_idx]++;
 
+  beginAnnotation("checksum");
+  checksum[vid] = tuning_checksum[vid][tune_idx];
   this->updateChecksum(vid);
+  tuning_checksum[vid][tune_idx] = checksum[vid];
+  endAnnotation("checksum");
 
+  beginAnnotation("tearDown");
   this->tearDown(vid);
+  endAnnotation("tearDown");
+
+  endAnnotation(region_name.c_str());
+
+  running_variant = NumVariants;
+  running_tuning = 0;
+}
+
+KernelBase::Samples KernelBase::getSamples(VariantID vid,
+                                           size_t tune_idx) const
+{
+  Samples samples;
+  samples.num_mem_samples = num_mem_samples[vid][tune_idx];
+  samples.alloc_bytes = alloc_bytes[vid][tune_idx];
+  samples.setup_minor_faults = setup_minor_faults[vid][tune_idx];
+  samples.setup_major_faults = setup_major_faults[vid][tune_idx];
+  samples.timed_minor_faults = timed_minor_faults[vid][tune_idx];
+  samples.timed_major_faults = timed_major_faults[vid][tune_idx];
+
+  samples.num_energy_samples = num_energy_samples[vid][tune_idx];
+  for (size_t ed = 0; ed < NumEnergyDomains; ++ed) {
+    samples.timed_energy[ed] = timed_energy[vid][ed][tune_idx];
+  }
+  samples.energy_time = energy_time[vid][tune_idx];
+
+  return samples;
+}
+
+void KernelBase::restoreExecution(VariantID vid, size_t tune_idx,
+                                  Timer::ElapsedType exec_time,
+                                  Checksum_type cksum,
+                                  const Samples& samples)
+{
+  running_variant = vid;
+  running_tuning = tune_idx;
+
+  recordExecTime(exec_time);
+  tuning_checksum[vid][tune_idx] = cksum;
+
+  num_mem_samples[vid][tune_idx] += samples.num_mem_samples;
+  alloc_bytes[vid][tune_idx] = std::max(alloc_bytes[vid][tune_idx],
+                                        samples.alloc_bytes);
+  setup_minor_faults[vid][tune_idx] += samples.setup_minor_faults;
+  setup_major_faults[vid][tune_idx] += samples.setup_major_faults;
+  timed_minor_faults[vid][tune_idx] += samples.timed_minor_faults;
+  timed_major_faults[vid][tune_idx] += samples.timed_major_faults;
+
+  num_energy_samples[vid][tune_idx] += samples.num_energy_samples;
+  for (size_t ed = 0; ed < NumEnergyDomains; ++ed) {
+    timed_energy[vid][ed][tune_idx] += samples.timed_energy[ed];
+  }
+  energy_time[vid][tune_idx] += samples.energy_time;
 
   running_variant = NumVariants;
+  running_tuning = 0;
+}
+
+void KernelBase::recordExecTime(Timer::ElapsedType exec_time)
+{
+  num_exec[running_variant][running_tuning]++;
+
+  Timer::ElapsedType& min_t = min_time[running_variant][running_tuning];
+  Timer::ElapsedType& max_t = max_time[running_variant][running_tuning];
+  min_t = std::min(min_t, exec_time);
+  max_t = std::max(max_t, exec_time);
+  tot_time[running_variant][running_tuning] += exec_time;
+  pass_times[running_variant][running_tuning].push_back(exec_time);
+}
+
+void KernelBase::startTimedFaults()
+{
+  getPageFaults(timer_start_minor_faults, timer_start_major_faults);
 }
 
-void KernelBase::recordExecTime()
+void KernelBase::recordTimedFaults()
 {
-  num_exec[running_variant]++;
+  long minor_faults, major_faults;
+  getPageFaults(minor_faults, major_faults);
+  timed_minor_faults[running_variant][running_tuning] +=
+    minor_faults - timer_start_minor_faults;
+  timed_major_faults[running_variant][running_tuning] +=
+    major_faults - timer_start_major_faults;
+}
 
-  RAJA::Timer::ElapsedType exec_time = timer.elapsed();
-  min_time[running_variant] = std::min(min_time[running_variant], exec_time);
-  max_time[running_variant] = std::max(max_time[running_variant], exec_time);
-  tot_time[running_variant] += exec_time;
+void KernelBase::startTimedEnergy()
+{
+  if ( haveEnergyCounters() ) {
+    readEnergyCounters(timer_start_energy);
+  }
+}
+
+void KernelBase::recordTimedEnergy()
+{
+  if ( !haveEnergyCounters() ) {
+    return;
+  }
+  readEnergyCounters(timer_stop_energy);
+
+  double joules[NumEnergyDomains];
+  getEnergyJoules(timer_start_energy, timer_stop_energy, joules);
+  for (size_t ed = 0; ed < NumEnergyDomains; ++ed) {
+    timed_energy[running_variant][ed][running_tuning] += joules[ed];
+  }
+  energy_time[running_variant][running_tuning] += timer.elapsed();
+  num_energy_samples[running_variant][running_tuning]++;
 }
 
 void KernelBase::runKernel(VariantID vid)
@@ -207,30 +472,18 @@ void KernelBase::print(std::ostream& os) const
   os << "\t\t\t kernels_per_rep = " << kernels_per_rep << std::endl;
   os << "\t\t\t bytes_per_rep = " << bytes_per_rep << std::endl;
   os << "\t\t\t FLOPs_per_rep = " << FLOPs_per_rep << std::endl;
-  os << "\t\t\t num_exec: " << std::endl;
-  for (unsigned j = 0; j < NumVariants; ++j) {
-    os << "\t\t\t\t" << getVariantName(static_cast<VariantID>(j))
-                     << " : " << num_exec[j] << std::endl;
-  }
-  os << "\t\t\t min_time: " << std::endl;
+  os << "\t\t\t tunings (num_exec, min_time, max_time, tot_time, checksum): "
+     << std::endl;
   for (unsigned j = 0; j < NumVariants; ++j) {
-    os << "\t\t\t\t" << getVariantName(static_cast<VariantID>(j))
-                     << " : " << min_time[j] << std::endl;
-  }
-  os << "\t\t\t max_time: " << std::endl;
-  for (unsigned j = 0; j < NumVariants; ++j) {
-    os << "\t\t\t\t" << getVariantName(static_cast<VariantID>(j))
-                     << " : " << max_time[j] << std::endl;
-  }
-  os << "\t\t\t tot_time: " << std::endl;
-  for (unsigned j = 0; j < NumVariants; ++j) {
-    os << "\t\t\t\t" << getVariantName(static_cast<VariantID>(j))
-                     << " : " << tot_time[j] << std::endl;
-  }
-  os << "\t\t\t checksum: " << std::endl;
-  for (unsigned j = 0; j < NumVariants; ++j) {
-    os << "\t\t\t\t" << getVariantName(static_cast<VariantID>(j))
-                     << " : " << checksum[j] << std::endl;
+    for (size_t t = 0; t < tuning_names[j].size(); ++t) {
+      os << "\t\t\t\t" << getVariantName(static_cast<VariantID>(j))
+                       << "-" << tuning_names[j][t]
+                       << " : " << num_exec[j][t]
+                       << " , " << min_time[j][t]
+                       << " , " << max_time[j][t]
+                       << " , " << tot_time[j][t]
+                       << " , " << tuning_checksum[j][t] << std::endl;
+    }
   }
   os << std::endl;
 }
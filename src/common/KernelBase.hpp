@@ -13,8 +13,10 @@
 #include "common/RPTypes.hpp"
 #include "common/DataUtils.hpp"
 #include "common/RunParams.hpp"
+#include "common/Annotation.hpp"
+#include "common/Energy.hpp"
+#include "common/Timer.hpp"
 
-#include "RAJA/util/Timer.hpp"
 #if defined(RAJA_PERFSUITE_ENABLE_MPI)
 #include <mpi.h>
 #endif
@@ -26,6 +28,8 @@
 #endif
 
 #include <string>
+#include <vector>
+#include <map>
 #include <iostream>
 #include <limits>
 
@@ -64,6 +68,42 @@ public:
   void setUsesFeature(FeatureID fid) { uses_feature[fid] = true; }
   void setVariantDefined(VariantID vid);
 
+  //
+  // Kernels that run more than one implementation of a variant (e.g.,
+  // instantiations for different compile-time sizes) replace the single
+  // default tuning of a defined variant with a list of named tunings.
+  // The index of the tuning being run is available in the run methods
+  // via getRunningTuning().
+  //
+  void setVariantTuningNames(VariantID vid,
+                             const std::vector<std::string>& names);
+
+  //
+  // Degrees of freedom processed per rep for a named tuning; used to
+  // report DOFs/sec for discretization kernels.
+  //
+  void setDOFsPerRep(const std::string& tuning_name, Index_type dofs)
+    { dofs_per_rep[tuning_name] = dofs; }
+
+  //
+  // Bytes and FLOPs per rep for a named tuning, for kernels whose tunings
+  // do different amounts of work; other tunings use the values set with
+  // setBytesPerRep(bytes) and setFLOPsPerRep(FLOPs).
+  //
+  void setBytesPerRep(const std::string& tuning_name, Index_type bytes)
+    { tuning_bytes_per_rep[tuning_name] = bytes; }
+  void setFLOPsPerRep(const std::string& tuning_name, Index_type FLOPs)
+    { tuning_FLOPs_per_rep[tuning_name] = FLOPs; }
+
+  //
+  // Kernels templated on their value type replace the tunings of a
+  // variant with one tuning per floating point precision, named after
+  // the precision. The precision of the tuning being run is available in
+  // the run methods via getRunningPrecision().
+  //
+  void setVariantPrecisions(VariantID vid,
+                            const std::vector<PrecisionID>& pids);
+
   //
   // Getter methods used to generate kernel execution summary
   // and kernel details report ouput.
@@ -76,6 +116,8 @@ public:
   Index_type getKernelsPerRep() const { return kernels_per_rep; };
   Index_type getBytesPerRep() const { return bytes_per_rep; }
   Index_type getFLOPsPerRep() const { return FLOPs_per_rep; }
+  Index_type getBytesPerRep(const std::string& tuning_name) const;
+  Index_type getFLOPsPerRep(const std::string& tuning_name) const;
 
   Index_type getTargetProblemSize() const;
   Index_type getRunReps() const;
@@ -85,20 +127,116 @@ public:
   bool hasVariantDefined(VariantID vid) const
     { return has_variant_defined[vid]; }
 
+  static const std::string& getDefaultTuningName();
+
+  size_t getNumVariantTunings(VariantID vid) const
+    { return tuning_names[vid].size(); }
+  const std::string& getVariantTuningName(VariantID vid, size_t tune_idx) const
+    { return tuning_names[vid][tune_idx]; }
+  size_t getVariantTuningIndex(VariantID vid,
+                               const std::string& tuning_name) const;
+
+  bool hasDOFsPerRep() const { return !dofs_per_rep.empty(); }
+  Index_type getDOFsPerRep(const std::string& tuning_name) const;
+
+  bool hasTuningPrecision(const std::string& tuning_name) const
+    { return tuning_precision.find(tuning_name) != tuning_precision.end(); }
+  PrecisionID getTuningPrecision(const std::string& tuning_name) const;
+
 
   //
   // Methods to get information about kernel execution for reports
   // containing kernel execution information
   //
-  bool wasVariantRun(VariantID vid) const
-    { return num_exec[vid] > 0; }
+  bool wasVariantTuningRun(VariantID vid, size_t tune_idx) const
+    { return tune_idx < num_exec[vid].size() && num_exec[vid][tune_idx] > 0; }
+  bool wasVariantRun(VariantID vid) const;
+
+  double getMinTime(VariantID vid, size_t tune_idx) const
+    { return min_time[vid][tune_idx]; }
+  double getMaxTime(VariantID vid, size_t tune_idx) const
+    { return max_time[vid][tune_idx]; }
+  double getTotTime(VariantID vid, size_t tune_idx) const
+    { return tot_time[vid][tune_idx]; }
+  const std::vector<Timer::ElapsedType>& getPassTimes(VariantID vid,
+                                                          size_t tune_idx) const
+    { return pass_times[vid][tune_idx]; }
+
+  //
+  // Memory use of a kernel variant tuning: the largest number of bytes
+  // allocated through DataUtils allocation methods during a run, and the
+  // page faults per run during setUp() and in the timed region.
+  //
+  bool hasMemoryUsage(VariantID vid, size_t tune_idx) const
+    { return tune_idx < num_mem_samples[vid].size() &&
+             num_mem_samples[vid][tune_idx] > 0; }
+  size_t getAllocBytes(VariantID vid, size_t tune_idx) const
+    { return alloc_bytes[vid][tune_idx]; }
+  double getSetUpMinorFaults(VariantID vid, size_t tune_idx) const
+    { return double(setup_minor_faults[vid][tune_idx]) /
+             num_mem_samples[vid][tune_idx]; }
+  double getSetUpMajorFaults(VariantID vid, size_t tune_idx) const
+    { return double(setup_major_faults[vid][tune_idx]) /
+             num_mem_samples[vid][tune_idx]; }
+  double getTimedMinorFaults(VariantID vid, size_t tune_idx) const
+    { return double(timed_minor_faults[vid][tune_idx]) /
+             num_mem_samples[vid][tune_idx]; }
+  double getTimedMajorFaults(VariantID vid, size_t tune_idx) const
+    { return double(timed_major_faults[vid][tune_idx]) /
+             num_mem_samples[vid][tune_idx]; }
 
-  double getMinTime(VariantID vid) const { return min_time[vid]; }
-  double getMaxTime(VariantID vid) const { return max_time[vid]; }
-  double getTotTime(VariantID vid) { return tot_time[vid]; }
-  Checksum_type getChecksum(VariantID vid) const { return checksum[vid]; }
+  //
+  // Energy used by a kernel variant tuning in the timed region, in joules
+  // per run for each domain, and the time per run it was measured over.
+  //
+  bool hasEnergy(VariantID vid, size_t tune_idx) const
+    { return tune_idx < num_energy_samples[vid].size() &&
+             num_energy_samples[vid][tune_idx] > 0; }
+  double getEnergy(EnergyDomain ed, VariantID vid, size_t tune_idx) const
+    { return timed_energy[vid][ed][tune_idx] /
+             num_energy_samples[vid][tune_idx]; }
+  double getEnergyTime(VariantID vid, size_t tune_idx) const
+    { return energy_time[vid][tune_idx] /
+             num_energy_samples[vid][tune_idx]; }
 
-  void execute(VariantID vid);
+  //
+  // Memory and energy samples of a kernel variant tuning summed over its
+  // runs (alloc_bytes is the largest of any run), as kept in the run log.
+  //
+  struct Samples
+  {
+    int num_mem_samples = 0;
+    size_t alloc_bytes = 0;
+    long setup_minor_faults = 0;
+    long setup_major_faults = 0;
+    long timed_minor_faults = 0;
+    long timed_major_faults = 0;
+
+    int num_energy_samples = 0;
+    double timed_energy[NumEnergyDomains] = { };
+    Timer::ElapsedType energy_time = 0.0;
+  };
+
+  Samples getSamples(VariantID vid, size_t tune_idx) const;
+
+  Checksum_type getChecksum(VariantID vid, size_t tune_idx) const
+    { return tuning_checksum[vid][tune_idx]; }
+
+  void execute(VariantID vid, size_t tune_idx);
+
+  /*!
+   * \brief Record the time, checksum, and memory and energy samples of a
+   * pass of the kernel variant tuning made in an earlier, interrupted run
+   * instead of running it.
+   */
+  void restoreExecution(VariantID vid, size_t tune_idx,
+                        Timer::ElapsedType exec_time,
+                        Checksum_type cksum,
+                        const Samples& samples);
+
+  size_t getRunningTuning() const { return running_tuning; }
+  PrecisionID getRunningPrecision() const
+    { return getTuningPrecision(tuning_names[running_variant][running_tuning]); }
 
   void synchronize()
   {
@@ -124,16 +262,21 @@ public:
 #ifdef RAJA_PERFSUITE_ENABLE_MPI
     MPI_Barrier(MPI_COMM_WORLD);
 #endif
+    startTimedFaults();
+    beginAnnotation("timed");
+    startTimedEnergy();
     timer.start();
   }
 
   void stopTimer()
   {
     synchronize();
+    timer.stop(); recordTimedEnergy(); recordExecTime();
+    endAnnotation("timed"); recordTimedFaults();
 #ifdef RAJA_PERFSUITE_ENABLE_MPI
+    // Record this rank's own time; the barrier only keeps ranks in step.
     MPI_Barrier(MPI_COMM_WORLD);
 #endif
-    timer.stop(); recordExecTime();
   }
 
   void resetTimer() { timer.reset(); }
@@ -174,7 +317,14 @@ protected:
 private:
   KernelBase() = delete;
 
-  void recordExecTime();
+  void recordExecTime() { recordExecTime(timer.elapsed()); }
+  void recordExecTime(Timer::ElapsedType exec_time);
+
+  void startTimedFaults();
+  void recordTimedFaults();
+
+  void startTimedEnergy();
+  void recordTimedEnergy();
 
   //
   // Static properties of kernel, independent of run
@@ -191,6 +341,13 @@ private:
 
   bool has_variant_defined[NumVariants];
 
+  std::vector<std::string> tuning_names[NumVariants];
+
+  std::map<std::string, Index_type> dofs_per_rep;
+  std::map<std::string, Index_type> tuning_bytes_per_rep;
+  std::map<std::string, Index_type> tuning_FLOPs_per_rep;
+  std::map<std::string, PrecisionID> tuning_precision;
+
   //
   // Properties of kernel dependent on how kernel is run
   //
@@ -200,14 +357,38 @@ private:
   Index_type FLOPs_per_rep;
 
   VariantID running_variant;
+  size_t running_tuning;
+
+  //
+  // Run data is kept per tuning of each variant. Kernels accumulate
+  // checksums in checksum[vid]; it is saved per tuning after each run.
+  //
+  std::vector<int> num_exec[NumVariants];
+
+  Timer timer;
+
+  std::vector<Timer::ElapsedType> min_time[NumVariants];
+  std::vector<Timer::ElapsedType> max_time[NumVariants];
+  std::vector<Timer::ElapsedType> tot_time[NumVariants];
+  std::vector<std::vector<Timer::ElapsedType>> pass_times[NumVariants];
+  std::vector<Checksum_type> tuning_checksum[NumVariants];
+
+  std::vector<int> num_mem_samples[NumVariants];
+  std::vector<size_t> alloc_bytes[NumVariants];
+  std::vector<long> setup_minor_faults[NumVariants];
+  std::vector<long> setup_major_faults[NumVariants];
+  std::vector<long> timed_minor_faults[NumVariants];
+  std::vector<long> timed_major_faults[NumVariants];
 
-  int num_exec[NumVariants];
+  long timer_start_minor_faults;
+  long timer_start_major_faults;
 
-  RAJA::Timer timer;
+  std::vector<int> num_energy_samples[NumVariants];
+  std::vector<double> timed_energy[NumVariants][NumEnergyDomains];
+  std::vector<Timer::ElapsedType> energy_time[NumVariants];
 
-  RAJA::Timer::ElapsedType min_time[NumVariants];
-  RAJA::Timer::ElapsedType max_time[NumVariants];
-  RAJA::Timer::ElapsedType tot_time[NumVariants];
+  EnergySample timer_start_energy;
+  EnergySample timer_stop_energy;
 };
 
 }  // closing brace for rajaperf namespace
@@ -26,6 +26,12 @@ namespace rajaperf
  */
 std::string recursiveMkdir(const std::string& in_path);
 
+/*!
+ * \brief Return given string as a quoted JSON string, with special
+ * characters escaped.
+ */
+std::string jsonString(const std::string& str);
+
 }  // closing brace for rajaperf namespace
 
 #endif  // closing endif for header file include guard
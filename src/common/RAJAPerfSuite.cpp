@@ -19,6 +19,7 @@
 //
 #include "basic/DAXPY.hpp"
 #include "basic/DAXPY_ATOMIC.hpp"
+#include "basic/GATHER.hpp"
 #include "basic/IF_QUAD.hpp"
 #include "basic/INIT3.hpp"
 #include "basic/INIT_VIEW1D.hpp"
@@ -28,13 +29,19 @@
 #include "basic/NESTED_INIT.hpp"
 #include "basic/PI_ATOMIC.hpp"
 #include "basic/PI_REDUCE.hpp"
+#include "basic/RANDOM_UPDATE.hpp"
 #include "basic/REDUCE3_INT.hpp"
+#include "basic/SCATTER.hpp"
+#include "basic/TRANSPOSE.hpp"
+#include "basic/TRANSPOSE_INPLACE.hpp"
 #include "basic/TRAP_INT.hpp"
 
 //
 // Lcals kernels...
 //
+#include "lcals/BANDED_LIN_EQ.hpp"
 #include "lcals/DIFF_PREDICT.hpp"
+#include "lcals/DISC_ORD.hpp"
 #include "lcals/EOS.hpp"
 #include "lcals/FIRST_DIFF.hpp"
 #include "lcals/FIRST_MIN.hpp"
@@ -42,7 +49,14 @@
 #include "lcals/GEN_LIN_RECUR.hpp"
 #include "lcals/HYDRO_1D.hpp"
 #include "lcals/HYDRO_2D.hpp"
+#include "lcals/HYDRO_2D_IMPLICIT.hpp"
+#include "lcals/ICCG.hpp"
+#include "lcals/IMPLICIT_COND.hpp"
 #include "lcals/INT_PREDICT.hpp"
+#include "lcals/MAT_X_MAT.hpp"
+#include "lcals/MONTE_CARLO.hpp"
+#include "lcals/PIC_1D.hpp"
+#include "lcals/PIC_2D.hpp"
 #include "lcals/PLANCKIAN.hpp"
 #include "lcals/TRIDIAG_ELIM.hpp"
 
@@ -53,6 +67,8 @@
 #include "polybench/POLYBENCH_3MM.hpp"
 #include "polybench/POLYBENCH_ADI.hpp"
 #include "polybench/POLYBENCH_ATAX.hpp"
+#include "polybench/POLYBENCH_CHOLESKY.hpp"
+#include "polybench/POLYBENCH_CORRELATION.hpp"
 #include "polybench/POLYBENCH_FDTD_2D.hpp"
 #include "polybench/POLYBENCH_FLOYD_WARSHALL.hpp"
 #include "polybench/POLYBENCH_GEMM.hpp"
@@ -61,7 +77,12 @@
 #include "polybench/POLYBENCH_HEAT_3D.hpp"
 #include "polybench/POLYBENCH_JACOBI_1D.hpp"
 #include "polybench/POLYBENCH_JACOBI_2D.hpp"
+#include "polybench/POLYBENCH_LU.hpp"
 #include "polybench/POLYBENCH_MVT.hpp"
+#include "polybench/POLYBENCH_SEIDEL_2D.hpp"
+#include "polybench/POLYBENCH_SYR2K.hpp"
+#include "polybench/POLYBENCH_SYRK.hpp"
+#include "polybench/POLYBENCH_TRISOLV.hpp"
 
 //
 // Stream kernels...
@@ -75,23 +96,40 @@
 //
 // Apps kernels...
 //
-#include "apps/WIP-COUPLE.hpp"
+#include "apps/BATCHED_GEMM.hpp"
+#include "apps/BATCHED_LU.hpp"
+#include "apps/BATCHED_SOLVE.hpp"
+#include "apps/CG.hpp"
+#include "apps/COUPLE.hpp"
 #include "apps/DEL_DOT_VEC_2D.hpp"
 #include "apps/DIFFUSION3DPA.hpp"
+#include "apps/EDGE_FLUX.hpp"
 #include "apps/ENERGY.hpp"
+#include "apps/FFT_1D_BATCHED.hpp"
+#include "apps/FFT_3D.hpp"
 #include "apps/FIR.hpp"
 #include "apps/HALOEXCHANGE.hpp"
 #include "apps/HALOEXCHANGE_FUSED.hpp"
 #include "apps/LTIMES.hpp"
 #include "apps/LTIMES_NOVIEW.hpp"
 #include "apps/MASS3DPA.hpp"
+#include "apps/MPI_HALOEXCHANGE.hpp"
+#include "apps/MPI_HALOEXCHANGE_FUSED.hpp"
 #include "apps/NODAL_ACCUMULATION_3D.hpp"
+#include "apps/PIC_DEPOSIT.hpp"
+#include "apps/PIC_PUSH.hpp"
 #include "apps/PRESSURE.hpp"
+#include "apps/STENCIL_27PT.hpp"
+#include "apps/STENCIL_7PT.hpp"
 #include "apps/VOL3D.hpp"
 
 //
 // Algorithm kernels...
 //
+#include "algorithm/BFS.hpp"
+#include "algorithm/CC.hpp"
+#include "algorithm/HASH_BUILD.hpp"
+#include "algorithm/HASH_PROBE.hpp"
 #include "algorithm/SORT.hpp"
 #include "algorithm/SORTPAIRS.hpp"
 
@@ -147,6 +185,7 @@ static const std::string KernelNames [] =
 //
   std::string("Basic_DAXPY"),
   std::string("Basic_DAXPY_ATOMIC"),
+  std::string("Basic_GATHER"),
   std::string("Basic_IF_QUAD"),
   std::string("Basic_INIT3"),
   std::string("Basic_INIT_VIEW1D"),
@@ -156,13 +195,19 @@ static const std::string KernelNames [] =
   std::string("Basic_NESTED_INIT"),
   std::string("Basic_PI_ATOMIC"),
   std::string("Basic_PI_REDUCE"),
+  std::string("Basic_RANDOM_UPDATE"),
   std::string("Basic_REDUCE3_INT"),
+  std::string("Basic_SCATTER"),
+  std::string("Basic_TRANSPOSE"),
+  std::string("Basic_TRANSPOSE_INPLACE"),
   std::string("Basic_TRAP_INT"),
 
 //
 // Lcals kernels...
 //
+  std::string("Lcals_BANDED_LIN_EQ"),
   std::string("Lcals_DIFF_PREDICT"),
+  std::string("Lcals_DISC_ORD"),
   std::string("Lcals_EOS"),
   std::string("Lcals_FIRST_DIFF"),
   std::string("Lcals_FIRST_MIN"),
@@ -170,7 +215,14 @@ static const std::string KernelNames [] =
   std::string("Lcals_GEN_LIN_RECUR"),
   std::string("Lcals_HYDRO_1D"),
   std::string("Lcals_HYDRO_2D"),
+  std::string("Lcals_HYDRO_2D_IMPLICIT"),
+  std::string("Lcals_ICCG"),
+  std::string("Lcals_IMPLICIT_COND"),
   std::string("Lcals_INT_PREDICT"),
+  std::string("Lcals_MAT_X_MAT"),
+  std::string("Lcals_MONTE_CARLO"),
+  std::string("Lcals_PIC_1D"),
+  std::string("Lcals_PIC_2D"),
   std::string("Lcals_PLANCKIAN"),
   std::string("Lcals_TRIDIAG_ELIM"),
 
@@ -181,6 +233,8 @@ static const std::string KernelNames [] =
   std::string("Polybench_3MM"),
   std::string("Polybench_ADI"),
   std::string("Polybench_ATAX"),
+  std::string("Polybench_CHOLESKY"),
+  std::string("Polybench_CORRELATION"),
   std::string("Polybench_FDTD_2D"),
   std::string("Polybench_FLOYD_WARSHALL"),
   std::string("Polybench_GEMM"),
@@ -189,7 +243,12 @@ static const std::string KernelNames [] =
   std::string("Polybench_HEAT_3D"),
   std::string("Polybench_JACOBI_1D"),
   std::string("Polybench_JACOBI_2D"),
+  std::string("Polybench_LU"),
   std::string("Polybench_MVT"),
+  std::string("Polybench_SEIDEL_2D"),
+  std::string("Polybench_SYR2K"),
+  std::string("Polybench_SYRK"),
+  std::string("Polybench_TRISOLV"),
 
 //
 // Stream kernels...
@@ -203,23 +262,42 @@ static const std::string KernelNames [] =
 //
 // Apps kernels...
 //
+  std::string("Apps_BATCHED_GEMM"),
+  std::string("Apps_BATCHED_LU"),
+  std::string("Apps_BATCHED_SOLVE"),
+  std::string("Apps_CG"),
   std::string("Apps_COUPLE"),
   std::string("Apps_DEL_DOT_VEC_2D"),
   std::string("Apps_DIFFUSION3DPA"),
+  std::string("Apps_EDGE_FLUX"),
   std::string("Apps_ENERGY"),
+  std::string("Apps_FFT_1D_BATCHED"),
+  std::string("Apps_FFT_3D"),
   std::string("Apps_FIR"),
   std::string("Apps_HALOEXCHANGE"),
   std::string("Apps_HALOEXCHANGE_FUSED"),
   std::string("Apps_LTIMES"),
   std::string("Apps_LTIMES_NOVIEW"),
   std::string("Apps_MASS3DPA"),
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  std::string("Apps_MPI_HALOEXCHANGE"),
+  std::string("Apps_MPI_HALOEXCHANGE_FUSED"),
+#endif
   std::string("Apps_NODAL_ACCUMULATION_3D"),
+  std::string("Apps_PIC_DEPOSIT"),
+  std::string("Apps_PIC_PUSH"),
   std::string("Apps_PRESSURE"),
+  std::string("Apps_STENCIL_27PT"),
+  std::string("Apps_STENCIL_7PT"),
   std::string("Apps_VOL3D"),
 
 //
 // Algorithm kernels...
 //
+  std::string("Algorithm_BFS"),
+  std::string("Algorithm_CC"),
+  std::string("Algorithm_HASH_BUILD"),
+  std::string("Algorithm_HASH_PROBE"),
   std::string("Algorithm_SORT"),
   std::string("Algorithm_SORTPAIRS"),
 
@@ -295,11 +373,36 @@ static const std::string FeatureNames [] =
 
   std::string("View"),
 
+  std::string("MPI"),
+
   std::string("Unknown Feature")  // Keep this at the end and DO NOT remove....
 
 }; // END FeatureNames
 
 
+/*!
+ *******************************************************************************
+ *
+ * \brief Array of names for each floating point PRECISION of kernels
+ *        templated on their value type; also used as their tuning names.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ENUM OF PRECISION IDS IN HEADER FILE!!!
+ *
+ *******************************************************************************
+ */
+static const std::string PrecisionNames [] =
+{
+
+  std::string("float"),
+  std::string("double"),
+  std::string("mixed"),
+
+  std::string("Unknown Precision")  // Keep this at the end and DO NOT remove....
+
+}; // END PrecisionNames
+
+
 /*
  *******************************************************************************
  *
@@ -421,6 +524,31 @@ const std::string& getFeatureName(FeatureID fid)
   return FeatureNames[fid];
 }
 
+/*
+ *******************************************************************************
+ *
+ * Return precision name associated with PrecisionID enum value.
+ *
+ *******************************************************************************
+ */
+const std::string& getPrecisionName(PrecisionID pid)
+{
+  return PrecisionNames[pid];
+}
+
+/*
+ *******************************************************************************
+ *
+ * Return size in bytes of the data type of a precision.
+ *
+ *******************************************************************************
+ */
+size_t getPrecisionDataSize(PrecisionID pid)
+{
+  return ( pid == Precision_Double ) ? sizeof(Double_type)
+                                     : sizeof(Float_type);
+}
+
 /*
  *******************************************************************************
  *
@@ -446,6 +574,10 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new basic::DAXPY_ATOMIC(run_params);
        break;
     }
+    case Basic_GATHER : {
+       kernel = new basic::GATHER(run_params);
+       break;
+    }
     case Basic_IF_QUAD : {
        kernel = new basic::IF_QUAD(run_params);
        break;
@@ -482,10 +614,26 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new basic::PI_REDUCE(run_params);
        break;
     }
+    case Basic_RANDOM_UPDATE : {
+       kernel = new basic::RANDOM_UPDATE(run_params);
+       break;
+    }
     case Basic_REDUCE3_INT : {
        kernel = new basic::REDUCE3_INT(run_params);
        break;
     }
+    case Basic_SCATTER : {
+       kernel = new basic::SCATTER(run_params);
+       break;
+    }
+    case Basic_TRANSPOSE : {
+       kernel = new basic::TRANSPOSE(run_params);
+       break;
+    }
+    case Basic_TRANSPOSE_INPLACE : {
+       kernel = new basic::TRANSPOSE_INPLACE(run_params);
+       break;
+    }
     case Basic_TRAP_INT : {
        kernel = new basic::TRAP_INT(run_params);
        break;
@@ -494,10 +642,18 @@ KernelBase* getKernelObject(KernelID kid,
 //
 // Lcals kernels...
 //
+    case Lcals_BANDED_LIN_EQ : {
+       kernel = new lcals::BANDED_LIN_EQ(run_params);
+       break;
+    }
     case Lcals_DIFF_PREDICT : {
        kernel = new lcals::DIFF_PREDICT(run_params);
        break;
     }
+    case Lcals_DISC_ORD : {
+       kernel = new lcals::DISC_ORD(run_params);
+       break;
+    }
     case Lcals_EOS : {
        kernel = new lcals::EOS(run_params);
        break;
@@ -526,10 +682,38 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new lcals::HYDRO_2D(run_params);
        break;
     }
+    case Lcals_HYDRO_2D_IMPLICIT : {
+       kernel = new lcals::HYDRO_2D_IMPLICIT(run_params);
+       break;
+    }
+    case Lcals_ICCG : {
+       kernel = new lcals::ICCG(run_params);
+       break;
+    }
+    case Lcals_IMPLICIT_COND : {
+       kernel = new lcals::IMPLICIT_COND(run_params);
+       break;
+    }
     case Lcals_INT_PREDICT : {
        kernel = new lcals::INT_PREDICT(run_params);
        break;
     }
+    case Lcals_MAT_X_MAT : {
+       kernel = new lcals::MAT_X_MAT(run_params);
+       break;
+    }
+    case Lcals_MONTE_CARLO : {
+       kernel = new lcals::MONTE_CARLO(run_params);
+       break;
+    }
+    case Lcals_PIC_1D : {
+       kernel = new lcals::PIC_1D(run_params);
+       break;
+    }
+    case Lcals_PIC_2D : {
+       kernel = new lcals::PIC_2D(run_params);
+       break;
+    }
     case Lcals_PLANCKIAN : {
        kernel = new lcals::PLANCKIAN(run_params);
        break;
@@ -558,6 +742,14 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new polybench::POLYBENCH_ATAX(run_params);
        break;
     }
+    case Polybench_CHOLESKY : {
+       kernel = new polybench::POLYBENCH_CHOLESKY(run_params);
+       break;
+    }
+    case Polybench_CORRELATION : {
+       kernel = new polybench::POLYBENCH_CORRELATION(run_params);
+       break;
+    }
     case Polybench_FDTD_2D : {
        kernel = new polybench::POLYBENCH_FDTD_2D(run_params);
        break;
@@ -590,10 +782,30 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new polybench::POLYBENCH_JACOBI_2D(run_params);
        break;
     }
+    case Polybench_LU : {
+       kernel = new polybench::POLYBENCH_LU(run_params);
+       break;
+    }
     case Polybench_MVT : {
        kernel = new polybench::POLYBENCH_MVT(run_params);
        break;
     }
+    case Polybench_SEIDEL_2D : {
+       kernel = new polybench::POLYBENCH_SEIDEL_2D(run_params);
+       break;
+    }
+    case Polybench_SYR2K : {
+       kernel = new polybench::POLYBENCH_SYR2K(run_params);
+       break;
+    }
+    case Polybench_SYRK : {
+       kernel = new polybench::POLYBENCH_SYRK(run_params);
+       break;
+    }
+    case Polybench_TRISOLV : {
+       kernel = new polybench::POLYBENCH_TRISOLV(run_params);
+       break;
+    }
 
 //
 // Stream kernels...
@@ -622,6 +834,22 @@ KernelBase* getKernelObject(KernelID kid,
 //
 // Apps kernels...
 //
+    case Apps_BATCHED_GEMM : {
+       kernel = new apps::BATCHED_GEMM(run_params);
+       break;
+    }
+    case Apps_BATCHED_LU : {
+       kernel = new apps::BATCHED_LU(run_params);
+       break;
+    }
+    case Apps_BATCHED_SOLVE : {
+       kernel = new apps::BATCHED_SOLVE(run_params);
+       break;
+    }
+    case Apps_CG : {
+       kernel = new apps::CG(run_params);
+       break;
+    }
     case Apps_COUPLE : {
        kernel = new apps::COUPLE(run_params);
        break;
@@ -634,10 +862,22 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new apps::DIFFUSION3DPA(run_params);
        break;
     }
+    case Apps_EDGE_FLUX : {
+       kernel = new apps::EDGE_FLUX(run_params);
+       break;
+    }
     case Apps_ENERGY : {
        kernel = new apps::ENERGY(run_params);
        break;
     }
+    case Apps_FFT_1D_BATCHED : {
+       kernel = new apps::FFT_1D_BATCHED(run_params);
+       break;
+    }
+    case Apps_FFT_3D : {
+       kernel = new apps::FFT_3D(run_params);
+       break;
+    }
     case Apps_FIR : {
        kernel = new apps::FIR(run_params);
        break;
@@ -662,14 +902,40 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new apps::MASS3DPA(run_params);
        break;
     }
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+    case Apps_MPI_HALOEXCHANGE : {
+       kernel = new apps::MPI_HALOEXCHANGE(run_params);
+       break;
+    }
+    case Apps_MPI_HALOEXCHANGE_FUSED : {
+       kernel = new apps::MPI_HALOEXCHANGE_FUSED(run_params);
+       break;
+    }
+#endif
     case Apps_NODAL_ACCUMULATION_3D : {
        kernel = new apps::NODAL_ACCUMULATION_3D(run_params);
        break;
     }
+    case Apps_PIC_DEPOSIT : {
+       kernel = new apps::PIC_DEPOSIT(run_params);
+       break;
+    }
+    case Apps_PIC_PUSH : {
+       kernel = new apps::PIC_PUSH(run_params);
+       break;
+    }
     case Apps_PRESSURE : {
        kernel = new apps::PRESSURE(run_params);
        break;
     }
+    case Apps_STENCIL_27PT : {
+       kernel = new apps::STENCIL_27PT(run_params);
+       break;
+    }
+    case Apps_STENCIL_7PT : {
+       kernel = new apps::STENCIL_7PT(run_params);
+       break;
+    }
     case Apps_VOL3D : {
        kernel = new apps::VOL3D(run_params);
        break;
@@ -678,6 +944,22 @@ KernelBase* getKernelObject(KernelID kid,
 //
 // Algorithm kernels...
 //
+    case Algorithm_BFS: {
+       kernel = new algorithm::BFS(run_params);
+       break;
+    }
+    case Algorithm_CC: {
+       kernel = new algorithm::CC(run_params);
+       break;
+    }
+    case Algorithm_HASH_BUILD: {
+       kernel = new algorithm::HASH_BUILD(run_params);
+       break;
+    }
+    case Algorithm_HASH_PROBE: {
+       kernel = new algorithm::HASH_PROBE(run_params);
+       break;
+    }
     case Algorithm_SORT: {
        kernel = new algorithm::SORT(run_params);
        break;
@@ -72,6 +72,7 @@ enum KernelID {
 //
   Basic_DAXPY = 0,
   Basic_DAXPY_ATOMIC,
+  Basic_GATHER,
   Basic_IF_QUAD,
   Basic_INIT3,
   Basic_INIT_VIEW1D,
@@ -81,13 +82,19 @@ enum KernelID {
   Basic_NESTED_INIT,
   Basic_PI_ATOMIC,
   Basic_PI_REDUCE,
+  Basic_RANDOM_UPDATE,
   Basic_REDUCE3_INT,
+  Basic_SCATTER,
+  Basic_TRANSPOSE,
+  Basic_TRANSPOSE_INPLACE,
   Basic_TRAP_INT,
 
 //
 // Lcals kernels...
 //
+  Lcals_BANDED_LIN_EQ,
   Lcals_DIFF_PREDICT,
+  Lcals_DISC_ORD,
   Lcals_EOS,
   Lcals_FIRST_DIFF,
   Lcals_FIRST_MIN,
@@ -95,7 +102,14 @@ enum KernelID {
   Lcals_GEN_LIN_RECUR,
   Lcals_HYDRO_1D,
   Lcals_HYDRO_2D,
+  Lcals_HYDRO_2D_IMPLICIT,
+  Lcals_ICCG,
+  Lcals_IMPLICIT_COND,
   Lcals_INT_PREDICT,
+  Lcals_MAT_X_MAT,
+  Lcals_MONTE_CARLO,
+  Lcals_PIC_1D,
+  Lcals_PIC_2D,
   Lcals_PLANCKIAN,
   Lcals_TRIDIAG_ELIM,
 
@@ -106,6 +120,8 @@ enum KernelID {
   Polybench_3MM,
   Polybench_ADI,
   Polybench_ATAX,
+  Polybench_CHOLESKY,
+  Polybench_CORRELATION,
   Polybench_FDTD_2D,
   Polybench_FLOYD_WARSHALL,
   Polybench_GEMM,
@@ -114,7 +130,12 @@ enum KernelID {
   Polybench_HEAT_3D,
   Polybench_JACOBI_1D,
   Polybench_JACOBI_2D,
+  Polybench_LU,
   Polybench_MVT,
+  Polybench_SEIDEL_2D,
+  Polybench_SYR2K,
+  Polybench_SYRK,
+  Polybench_TRISOLV,
 
 //
 // Stream kernels...
@@ -128,23 +149,42 @@ enum KernelID {
 //
 // Apps kernels...
 //
+  Apps_BATCHED_GEMM,
+  Apps_BATCHED_LU,
+  Apps_BATCHED_SOLVE,
+  Apps_CG,
   Apps_COUPLE,
   Apps_DEL_DOT_VEC_2D,
   Apps_DIFFUSION3DPA,
+  Apps_EDGE_FLUX,
   Apps_ENERGY,
+  Apps_FFT_1D_BATCHED,
+  Apps_FFT_3D,
   Apps_FIR,
   Apps_HALOEXCHANGE,
   Apps_HALOEXCHANGE_FUSED,
   Apps_LTIMES,
   Apps_LTIMES_NOVIEW,
   Apps_MASS3DPA,
+#if defined(RAJA_PERFSUITE_ENABLE_MPI)
+  Apps_MPI_HALOEXCHANGE,
+  Apps_MPI_HALOEXCHANGE_FUSED,
+#endif
   Apps_NODAL_ACCUMULATION_3D,
+  Apps_PIC_DEPOSIT,
+  Apps_PIC_PUSH,
   Apps_PRESSURE,
+  Apps_STENCIL_27PT,
+  Apps_STENCIL_7PT,
   Apps_VOL3D,
 
 //
 // Algorithm kernels...
 //
+  Algorithm_BFS,
+  Algorithm_CC,
+  Algorithm_HASH_BUILD,
+  Algorithm_HASH_PROBE,
   Algorithm_SORT,
   Algorithm_SORTPAIRS,
 
@@ -218,11 +258,39 @@ enum FeatureID {
 
   View,
 
+  MPI,
+
   NumFeatures // Keep this one last and NEVER comment out (!!)
 
 };
 
 
+/*!
+ *******************************************************************************
+ *
+ * \brief Enumeration defining unique id for each floating point PRECISION
+ *        of kernels templated on their value type.
+ *
+ * These kernels run one tuning per precision, named after it, so that all
+ * precisions may be compared in a single run. Mixed precision stores data
+ * as float and accumulates in double.
+ *
+ *            IT MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE) WITH
+ *            ARRAY OF PRECISION NAMES IN IMPLEMENTATION FILE!!!
+ *
+ *******************************************************************************
+ */
+enum PrecisionID {
+
+  Precision_Float = 0,
+  Precision_Double,
+  Precision_Mixed,
+
+  NumPrecisions // Keep this one last and NEVER comment out (!!)
+
+};
+
+
 /*!
  *******************************************************************************
  *
@@ -282,6 +350,25 @@ bool isVariantAvailable(VariantID vid);
  */
 const std::string& getFeatureName(FeatureID vid);
 
+/*!
+ *******************************************************************************
+ *
+ * \brief Return precision name associated with PrecisionID enum value.
+ *
+ *******************************************************************************
+ */
+const std::string& getPrecisionName(PrecisionID pid);
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Return size in bytes of the data type of a precision (mixed
+ *        precision stores float data).
+ *
+ *******************************************************************************
+ */
+size_t getPrecisionDataSize(PrecisionID pid);
+
 /*!
  *******************************************************************************
  *
@@ -95,10 +95,14 @@ using Checksum_type = long double;
 #if defined(RP_USE_DOUBLE)
 ///
 using Real_type = double;
+///
+#define Real_MPI_type MPI_DOUBLE
 
 #elif defined(RP_USE_FLOAT)
 ///
 using Real_type = float;
+///
+#define Real_MPI_type MPI_FLOAT
 
 #else
 #error Real_type is undefined!
@@ -115,6 +119,48 @@ using Complex_ptr = Complex_type*;
 #endif
 
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Floating point types of kernels templated on their value type.
+ *
+ * These kernels run a tuning for each precision in the same executable,
+ * independent of the choice of Real_type above.
+ *
+ ******************************************************************************
+ */
+using Float_type = float;
+using Float_ptr = Float_type*;
+
+using Double_type = double;
+using Double_ptr = Double_type*;
+
+/*!
+ ******************************************************************************
+ *
+ * \brief Data array of a kernel templated on its value type.
+ *
+ * Holds an array pointer for each floating point type; the tuning being
+ * run allocates and uses the one of its precision.
+ *
+ ******************************************************************************
+ */
+struct Precision_ptr
+{
+  Float_ptr float_ptr = nullptr;
+  Double_ptr double_ptr = nullptr;
+
+  template < typename Data_type >
+  Data_type*& get();
+};
+
+template < >
+inline Float_ptr& Precision_ptr::get<Float_type>() { return float_ptr; }
+
+template < >
+inline Double_ptr& Precision_ptr::get<Double_type>() { return double_ptr; }
+
+
 
 
 }  // closing brace for rajaperf namespace
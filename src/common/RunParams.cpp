@@ -9,10 +9,14 @@
 #include "RunParams.hpp"
 
 #include "KernelBase.hpp"
+#include "OutputUtils.hpp"
+#include "Annotation.hpp"
 
 #include <cstdlib>
 #include <cstdio>
 #include <iostream>
+#include <algorithm>
+#include <sstream>
 
 namespace rajaperf
 {
@@ -34,8 +38,12 @@ RunParams::RunParams(int argc, char** argv)
    size_meaning(SizeMeaning::Unset),
    size(0.0),
    size_factor(0.0),
+   scaling_mode(ScalingMode::Weak),
+   timer_id(Timer_Chrono),
    pf_tol(0.1),
    checkrun_reps(1),
+   per_rank_timing(false),
+   measure_energy(false),
    reference_variant(),
    kernel_input(),
    invalid_kernel_input(),
@@ -45,6 +53,12 @@ RunParams::RunParams(int argc, char** argv)
    invalid_variant_input(),
    exclude_variant_input(),
    invalid_exclude_variant_input(),
+   tuning_input(),
+   invalid_tuning_input(),
+   exclude_tuning_input(),
+   invalid_exclude_tuning_input(),
+   precision_input(),
+   invalid_precision_input(),
    feature_input(),
    invalid_feature_input(),
    exclude_feature_input(),
@@ -52,7 +66,10 @@ RunParams::RunParams(int argc, char** argv)
    npasses_combiner_input(),
    invalid_npasses_combiner_input(),
    outdir(),
-   outfile_prefix("RAJAPerf")
+   outfile_prefix("RAJAPerf"),
+   compare_dir(),
+   resume_log(),
+   annotation("none")
 {
   parseCommandLineOptions(argc, argv);
 }
@@ -97,11 +114,18 @@ void RunParams::print(std::ostream& str) const
   str << "\n size_meaning = " << SizeMeaningToStr(getSizeMeaning());
   str << "\n size = " << size;
   str << "\n size_factor = " << size_factor;
+  str << "\n scaling_mode = " << ScalingModeToStr(scaling_mode);
+  str << "\n timer = " << getTimerName(timer_id);
   str << "\n pf_tol = " << pf_tol;
   str << "\n checkrun_reps = " << checkrun_reps;
+  str << "\n per_rank_timing = " << per_rank_timing;
+  str << "\n measure_energy = " << measure_energy;
   str << "\n reference_variant = " << reference_variant;
   str << "\n outdir = " << outdir;
   str << "\n outfile_prefix = " << outfile_prefix;
+  str << "\n compare_dir = " << compare_dir;
+  str << "\n resume_log = " << resume_log;
+  str << "\n annotation = " << annotation;
 
   str << "\n kernel_input = ";
   for (size_t j = 0; j < kernel_input.size(); ++j) {
@@ -139,6 +163,33 @@ void RunParams::print(std::ostream& str) const
     str << "\n\t" << invalid_exclude_variant_input[j];
   }
 
+  str << "\n tuning_input = ";
+  for (size_t j = 0; j < tuning_input.size(); ++j) {
+    str << "\n\t" << tuning_input[j];
+  }
+  str << "\n invalid_tuning_input = ";
+  for (size_t j = 0; j < invalid_tuning_input.size(); ++j) {
+    str << "\n\t" << invalid_tuning_input[j];
+  }
+
+  str << "\n exclude_tuning_input = ";
+  for (size_t j = 0; j < exclude_tuning_input.size(); ++j) {
+    str << "\n\t" << exclude_tuning_input[j];
+  }
+  str << "\n invalid_exclude_tuning_input = ";
+  for (size_t j = 0; j < invalid_exclude_tuning_input.size(); ++j) {
+    str << "\n\t" << invalid_exclude_tuning_input[j];
+  }
+
+  str << "\n precision_input = ";
+  for (size_t j = 0; j < precision_input.size(); ++j) {
+    str << "\n\t" << precision_input[j];
+  }
+  str << "\n invalid_precision_input = ";
+  for (size_t j = 0; j < invalid_precision_input.size(); ++j) {
+    str << "\n\t" << invalid_precision_input[j];
+  }
+
   str << "\n feature_input = ";
   for (size_t j = 0; j < feature_input.size(); ++j) {
     str << "\n\t" << feature_input[j];
@@ -162,6 +213,66 @@ void RunParams::print(std::ostream& str) const
 }
 
 
+/*
+ *******************************************************************************
+ *
+ * Print run params data to given output stream as a JSON object, with
+ * nested lines preceded by given indentation.
+ *
+ *******************************************************************************
+ */
+void RunParams::printJSON(std::ostream& str, const std::string& indent) const
+{
+  auto json_list = [](const std::vector<std::string>& svec) {
+    std::string list("[");
+    for (size_t j = 0; j < svec.size(); ++j) {
+      list += (j > 0 ? ", " : "") + jsonString(svec[j]);
+    }
+    return list + "]";
+  };
+
+  std::vector<std::string> combiners;
+  for (size_t j = 0; j < npasses_combiners.size(); ++j) {
+    combiners.push_back(CombinerOptToStr(npasses_combiners[j]));
+  }
+
+  const std::string in = "\n" + indent + "  ";
+
+  str << "{";
+  str << in << "\"show_progress\": " << (show_progress ? "true" : "false") << ",";
+  str << in << "\"npasses\": " << npasses << ",";
+  str << in << "\"npasses_combiners\": " << json_list(combiners) << ",";
+  str << in << "\"rep_fact\": " << rep_fact << ",";
+  str << in << "\"size_meaning\": "
+      << jsonString(SizeMeaningToStr(size_meaning)) << ",";
+  str << in << "\"size\": " << size << ",";
+  str << in << "\"size_factor\": " << size_factor << ",";
+  str << in << "\"scaling_mode\": "
+      << jsonString(ScalingModeToStr(scaling_mode)) << ",";
+  str << in << "\"timer\": " << jsonString(getTimerName(timer_id)) << ",";
+  str << in << "\"pf_tol\": " << pf_tol << ",";
+  str << in << "\"checkrun_reps\": " << checkrun_reps << ",";
+  str << in << "\"per_rank_timing\": " << (per_rank_timing ? "true" : "false") << ",";
+  str << in << "\"measure_energy\": " << (measure_energy ? "true" : "false") << ",";
+  str << in << "\"reference_variant\": " << jsonString(reference_variant) << ",";
+  str << in << "\"outdir\": " << jsonString(outdir) << ",";
+  str << in << "\"outfile_prefix\": " << jsonString(outfile_prefix) << ",";
+  str << in << "\"compare_dir\": " << jsonString(compare_dir) << ",";
+  str << in << "\"resume_log\": " << jsonString(resume_log) << ",";
+  str << in << "\"annotation\": " << jsonString(annotation) << ",";
+  str << in << "\"kernel_input\": " << json_list(kernel_input) << ",";
+  str << in << "\"exclude_kernel_input\": " << json_list(exclude_kernel_input) << ",";
+  str << in << "\"variant_input\": " << json_list(variant_input) << ",";
+  str << in << "\"exclude_variant_input\": " << json_list(exclude_variant_input) << ",";
+  str << in << "\"tuning_input\": " << json_list(tuning_input) << ",";
+  str << in << "\"exclude_tuning_input\": " << json_list(exclude_tuning_input) << ",";
+  str << in << "\"precision_input\": " << json_list(precision_input) << ",";
+  str << in << "\"feature_input\": " << json_list(feature_input) << ",";
+  str << in << "\"exclude_feature_input\": " << json_list(exclude_feature_input);
+  str << "\n" << indent << "}";
+}
+
+
 /*
  *******************************************************************************
  *
@@ -311,6 +422,62 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         input_state = BadInput;
       }
 
+    } else if ( opt == std::string("--scaling") ) {
+
+      i++;
+      if ( i < argc ) {
+        std::string mode( argv[i] );
+        if ( mode == ScalingModeToStr(ScalingMode::Weak) ) {
+          scaling_mode = ScalingMode::Weak;
+        } else if ( mode == ScalingModeToStr(ScalingMode::Strong) ) {
+          scaling_mode = ScalingMode::Strong;
+        } else {
+          getCout() << "\nBad input:"
+                    << " must give --scaling one of weak or strong"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --scaling a value (weak or strong)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--timer") ) {
+
+      i++;
+      if ( i < argc ) {
+        std::string name( argv[i] );
+        size_t tid = 0;
+        while ( tid < NumTimers &&
+                name != getTimerName(static_cast<TimerID>(tid)) ) {
+          ++tid;
+        }
+        if ( tid == NumTimers ) {
+          getCout() << "\nBad input:"
+                    << " must give --timer one of";
+          for (size_t j = 0; j < NumTimers; ++j) {
+            getCout() << " " << getTimerName(static_cast<TimerID>(j));
+          }
+          getCout() << std::endl;
+          input_state = BadInput;
+        } else if ( !isTimerAvailable(static_cast<TimerID>(tid)) ) {
+          getCout() << "\nBad input:"
+                    << " timer " << name
+                    << " is not available on this machine"
+                    << std::endl;
+          input_state = BadInput;
+        } else {
+          timer_id = static_cast<TimerID>(tid);
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --timer a value (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
     } else if ( opt == std::string("--pass-fail-tol") ||
                 opt == std::string("-pftol") ) {
 
@@ -388,6 +555,61 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         }
       }
 
+    } else if ( std::string(argv[i]) == std::string("--tunings") ||
+                std::string(argv[i]) == std::string("-t") ) {
+
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          tuning_input.push_back(opt);
+          ++i;
+        }
+      }
+
+    } else if ( std::string(argv[i]) == std::string("--exclude-tunings") ||
+                std::string(argv[i]) == std::string("-et") ) {
+
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          exclude_tuning_input.push_back(opt);
+          ++i;
+        }
+      }
+
+    } else if ( std::string(argv[i]) == std::string("--precisions") ||
+                std::string(argv[i]) == std::string("-pr") ) {
+
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          // also accept a comma-separated list, e.g., float,double
+          std::istringstream names(opt);
+          std::string name;
+          while ( std::getline(names, name, ',') ) {
+            if ( !name.empty() ) {
+              precision_input.push_back(name);
+            }
+          }
+          ++i;
+        }
+      }
+
     } else if ( std::string(argv[i]) == std::string("--features") ||
                 std::string(argv[i]) == std::string("-f") ) {
 
@@ -446,6 +668,49 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         }
       }
 
+    } else if ( std::string(argv[i]) == std::string("--compare-to") ||
+                std::string(argv[i]) == std::string("-ct") ) {
+
+      i++;
+      if ( i < argc && argv[i][0] != '-' ) {
+        compare_dir = std::string( argv[i] );
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --compare-to (or -ct) a directory name"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( std::string(argv[i]) == std::string("--resume") ) {
+
+      i++;
+      if ( i < argc && argv[i][0] != '-' ) {
+        resume_log = std::string( argv[i] );
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --resume a run log file name"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( std::string(argv[i]) == std::string("--annotate") ) {
+
+      i++;
+      const std::vector<std::string>& names = getAnnotationBackendNames();
+      if ( i < argc &&
+           std::find(names.begin(), names.end(), std::string(argv[i])) !=
+             names.end() ) {
+        annotation = std::string( argv[i] );
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --annotate one of";
+        for (size_t j = 0; j < names.size(); ++j) {
+          getCout() << " " << names[j];
+        }
+        getCout() << std::endl;
+        input_state = BadInput;
+      }
+
     } else if ( std::string(argv[i]) == std::string("--refvar") ||
                 std::string(argv[i]) == std::string("-rv") ) {
 
@@ -459,6 +724,15 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         }
       }
 
+    } else if ( std::string(argv[i]) == std::string("--per-rank-timing") ||
+                std::string(argv[i]) == std::string("-prt") ) {
+
+      per_rank_timing = true;
+
+    } else if ( std::string(argv[i]) == std::string("--energy") ) {
+
+      measure_energy = true;
+
     } else if ( std::string(argv[i]) == std::string("--dryrun") ) {
 
        if (input_state != BadInput) {
@@ -554,8 +828,25 @@ void RunParams::printHelpMessage(std::ostream& str) const
   str << "\t\t Example...\n"
       << "\t\t --size 1000000 (runs kernels with size ~1,000,000)\n\n";
 
+  str << "\t --scaling <string> [default is weak]\n"
+      << "\t      (how kernel sizes are split among MPI ranks; with weak\n"
+      << "\t       scaling each rank runs the full size, with strong scaling\n"
+      << "\t       the size is divided evenly among ranks; ignored without MPI)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --size 8000000 --scaling strong (each of 8 ranks runs ~1,000,000)\n\n";
+
+  str << "\t --timer <string> [default is chrono]\n"
+      << "\t      (clock source used to time kernels; one of chrono\n"
+      << "\t       (std::chrono::steady_clock), monotonic_raw\n"
+      << "\t       (clock_gettime(CLOCK_MONOTONIC_RAW)) or tsc (invariant time\n"
+      << "\t       stamp counter, x86 only); times less than 100 times the\n"
+      << "\t       measured timer resolution are flagged in reports)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --timer tsc\n\n";
+
   str << "\t --pass-fail-tol, -pftol <double> [default is 0.1; i.e., 10%]\n"
-      << "\t      (slowdown tolerance for RAJA vs. Base variants in FOM report)\n";
+      << "\t      (slowdown tolerance for RAJA vs. Base variants in FOM report,\n"
+      << "\t       and for regressions when using --compare-to)\n";
   str << "\t\t Example...\n"
       << "\t\t -pftol 0.2 (RAJA kernel variants that run 20% or more slower than Base variants will be reported as OVER_TOL in FOM report)\n\n";
 
@@ -585,6 +876,26 @@ void RunParams::printHelpMessage(std::ostream& str) const
       << "\t\t --exclude-variants RAJA_CUDA (exclude all RAJA_CUDA kernel variants)\n"
       << "\t\t -ev Base_Seq RAJA_CUDA (exclude Base_Seq and  RAJA_CUDA variants)\n\n";
 
+  str << "\t --tunings, -t <space-separated strings> [Default is run all]\n"
+      << "\t      (names of kernel variant tunings to run; kernels without\n"
+      << "\t       multiple tunings run a single tuning named 'default')\n";
+  str << "\t\t Examples...\n"
+      << "\t\t --tunings p3 (run polynomial order 3 tuning of FEM kernels)\n"
+      << "\t\t -t default p1 p2 (run default tunings and orders 1 and 2)\n\n";
+
+  str << "\t --exclude-tunings, -et <space-separated strings> [Default is exclude none]\n"
+      << "\t      (names of kernel variant tunings to exclude)\n";
+  str << "\t\t Examples...\n"
+      << "\t\t --exclude-tunings p7 p8 (exclude polynomial order 7 and 8 tunings)\n\n";
+
+  str << "\t --precisions, -pr <space or comma-separated strings> [Default is run all]\n"
+      << "\t      (floating point precisions to run for kernels templated on\n"
+      << "\t       their value type: float, double, mixed; mixed stores float\n"
+      << "\t       data and accumulates in double)\n";
+  str << "\t\t Examples...\n"
+      << "\t\t --precisions float,double (run float and double tunings)\n"
+      << "\t\t -pr double (run only double tunings of these kernels)\n\n";
+
   str << "\t --features, -f <space-separated strings> [Default is run all]\n"
       << "\t      (names of features to run)\n";
   str << "\t\t Examples...\n"
@@ -609,11 +920,45 @@ void RunParams::printHelpMessage(std::ostream& str) const
       << "\t\t --outfile mydata (output data will be in files 'mydata*')\n"
       << "\t\t -of dat (output data will be in files 'dat*')\n\n";
 
+  str << "\t --compare-to, -ct <string> [Default is none]\n"
+      << "\t      (directory holding output files of a previous run, with the\n"
+      << "\t       same file name prefix, to compare mean times against;\n"
+      << "\t       variants that run slower by more than the pass-fail\n"
+      << "\t       tolerance are reported as regressions and the Suite\n"
+      << "\t       exits with a non-zero status)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --compare-to nightly/yesterday -pftol 0.05 (flag kernels 5% or more slower)\n\n";
+
+  str << "\t --resume <string> [Default is none]\n"
+      << "\t      (run log file of an interrupted run, '<outfile>-run.log' in\n"
+      << "\t       its output directory; kernel variant passes recorded in it\n"
+      << "\t       are not run again and new results are appended to it;\n"
+      << "\t       give the same options as the interrupted run; a log\n"
+      << "\t       from a run with other sizes, reps, kernels, variants, or\n"
+      << "\t       tunings is rejected)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --npasses 3 -od sweep --resume sweep/RAJAPerf-run.log\n\n";
+
+  str << "\t --annotate <string> [Default is none]\n"
+      << "\t      (report suite passes, kernel variant runs and their setUp,\n"
+      << "\t       run, checksum, tearDown and timed regions to a tool;\n"
+      << "\t       'chrome' writes a trace file '<outfile>-trace.json' that\n"
+      << "\t       can be viewed in chrome://tracing or Perfetto)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --annotate chrome\n\n";
+
   str << "\t --refvar, -rv <string> [Default is none]\n"
       << "\t      (reference variant for speedup calculation)\n\n";
   str << "\t\t Example...\n"
       << "\t\t --refvar Base_Seq (speedups reported relative to Base_Seq variants)\n\n";
 
+  str << "\t --per-rank-timing, -prt (output mean time of each kernel variant\n"
+      << "\t      on each MPI rank to a separate file; ignored without MPI)\n\n";
+
+  str << "\t --energy (measure energy used in the timed region of each kernel\n"
+      << "\t      variant with RAPL counters, if they can be read through\n"
+      << "\t      /sys/class/powercap, and output it to a separate file)\n\n";
+
   str << "\t --dryrun (print summary of how Suite will run without running it)\n\n";
 
   str << "\t --checkrun <int> [default is 1]\n"
@@ -631,10 +976,7 @@ void RunParams::printKernelNames(std::ostream& str) const
   str << "\nAvailable kernels:";
   str << "\n------------------\n";
   for (int kid = 0; kid < NumKernels; ++kid) {
-/// RDH DISABLE COUPLE KERNEL
-    if (static_cast<KernelID>(kid) != Apps_COUPLE) {
-      str << getKernelName(static_cast<KernelID>(kid)) << std::endl;
-    }
+    str << getKernelName(static_cast<KernelID>(kid)) << std::endl;
   }
   str.flush();
 }
@@ -645,10 +987,7 @@ void RunParams::printFullKernelNames(std::ostream& str) const
   str << "\nAvailable kernels (<group name>_<kernel name>):";
   str << "\n-----------------------------------------\n";
   for (int kid = 0; kid < NumKernels; ++kid) {
-/// RDH DISABLE COUPLE KERNEL
-    if (static_cast<KernelID>(kid) != Apps_COUPLE) {
-      str << getFullKernelName(static_cast<KernelID>(kid)) << std::endl;
-    }
+    str << getFullKernelName(static_cast<KernelID>(kid)) << std::endl;
   }
   str.flush();
 }
@@ -694,14 +1033,11 @@ void RunParams::printFeatureKernels(std::ostream& str) const
     str << getFeatureName(tfid) << std::endl;
     for (int kid = 0; kid < NumKernels; ++kid) {
       KernelID tkid = static_cast<KernelID>(kid);
-///   RDH DISABLE COUPLE KERNEL
-      if (tkid != Apps_COUPLE) {
-         KernelBase* kern = getKernelObject(tkid, *this);
-         if ( kern->usesFeature(tfid) ) {
-           str << "\t" << getFullKernelName(tkid) << std::endl;
-         }
-         delete kern;
+      KernelBase* kern = getKernelObject(tkid, *this);
+      if ( kern->usesFeature(tfid) ) {
+        str << "\t" << getFullKernelName(tkid) << std::endl;
       }
+      delete kern;
     }  // loop over kernels
     str << std::endl;
   }  // loop over features
@@ -714,18 +1050,15 @@ void RunParams::printKernelFeatures(std::ostream& str) const
   str << "\n-----------------------------------------\n";
   for (int kid = 0; kid < NumKernels; ++kid) {
     KernelID tkid = static_cast<KernelID>(kid);
-/// RDH DISABLE COUPLE KERNEL
-    if (tkid != Apps_COUPLE) {
-      str << getFullKernelName(tkid) << std::endl;
-      KernelBase* kern = getKernelObject(tkid, *this);
-      for (int fid = 0; fid < NumFeatures; ++fid) {
-        FeatureID tfid = static_cast<FeatureID>(fid);
-        if ( kern->usesFeature(tfid) ) {
-           str << "\t" << getFeatureName(tfid) << std::endl;
-        }
-      }  // loop over features
-      delete kern;
-    }
+    str << getFullKernelName(tkid) << std::endl;
+    KernelBase* kern = getKernelObject(tkid, *this);
+    for (int fid = 0; fid < NumFeatures; ++fid) {
+      FeatureID tfid = static_cast<FeatureID>(fid);
+      if ( kern->usesFeature(tfid) ) {
+         str << "\t" << getFeatureName(tfid) << std::endl;
+      }
+    }  // loop over features
+    delete kern;
   }  // loop over kernels
   str.flush();
 }
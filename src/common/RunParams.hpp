@@ -14,6 +14,7 @@
 #include <iosfwd>
 
 #include "RAJAPerfSuite.hpp"
+#include "Timer.hpp"
 
 namespace rajaperf
 {
@@ -91,6 +92,26 @@ public:
     }
   }
 
+  /*!
+   * \brief Enumeration indicating how kernel sizes scale with MPI ranks
+   */
+  enum ScalingMode {
+    Weak,     /*!< each rank runs the full kernel size */
+    Strong,   /*!< kernel size is divided among ranks */
+  };
+
+  static std::string ScalingModeToStr(ScalingMode sm)
+  {
+    switch (sm) {
+      case ScalingMode::Weak:
+        return "weak";
+      case ScalingMode::Strong:
+        return "strong";
+      default:
+        return "Unknown";
+    }
+  }
+
 //@{
 //! @name Methods to get/set input state
 
@@ -125,10 +146,18 @@ public:
 
   double getSizeFactor() const { return size_factor; }
 
+  ScalingMode getScalingMode() const { return scaling_mode; }
+
+  TimerID getTimerID() const { return timer_id; }
+
   double getPFTolerance() const { return pf_tol; }
 
   int getCheckRunReps() const { return checkrun_reps; }
 
+  bool perRankTiming() const { return per_rank_timing; }
+
+  bool measureEnergy() const { return measure_energy; }
+
   const std::string& getReferenceVariant() const { return reference_variant; }
 
   const std::vector<std::string>& getKernelInput() const
@@ -159,6 +188,27 @@ public:
   const std::vector<std::string>& getInvalidExcludeVariantInput() const
                                   { return invalid_exclude_variant_input; }
 
+  const std::vector<std::string>& getTuningInput() const
+                                  { return tuning_input; }
+  void setInvalidTuningInput( std::vector<std::string>& svec )
+                              { invalid_tuning_input = svec; }
+  const std::vector<std::string>& getInvalidTuningInput() const
+                                  { return invalid_tuning_input; }
+
+  const std::vector<std::string>& getExcludeTuningInput() const
+                                  { return exclude_tuning_input; }
+  void setInvalidExcludeTuningInput( std::vector<std::string>& svec )
+                              { invalid_exclude_tuning_input = svec; }
+  const std::vector<std::string>& getInvalidExcludeTuningInput() const
+                                  { return invalid_exclude_tuning_input; }
+
+  const std::vector<std::string>& getPrecisionInput() const
+                                  { return precision_input; }
+  void setInvalidPrecisionInput( std::vector<std::string>& svec )
+                                 { invalid_precision_input = svec; }
+  const std::vector<std::string>& getInvalidPrecisionInput() const
+                                  { return invalid_precision_input; }
+
   const std::vector<std::string>& getFeatureInput() const
                                   { return feature_input; }
   void setInvalidFeatureInput( std::vector<std::string>& svec )
@@ -183,6 +233,12 @@ public:
   const std::string& getOutputDirName() const { return outdir; }
   const std::string& getOutputFilePrefix() const { return outfile_prefix; }
 
+  const std::string& getCompareDirName() const { return compare_dir; }
+
+  const std::string& getResumeLogName() const { return resume_log; }
+
+  const std::string& getAnnotationName() const { return annotation; }
+
 //@}
 
   /*!
@@ -190,6 +246,11 @@ public:
    */
   void print(std::ostream& str) const;
 
+  /*!
+   * \brief Print run params data to given output stream as a JSON object.
+   */
+  void printJSON(std::ostream& str, const std::string& indent) const;
+
 
 private:
   RunParams() = delete;
@@ -221,12 +282,18 @@ private:
   SizeMeaning size_meaning; /*!< meaning of size value */
   double size;           /*!< kernel size to run (input option) */
   double size_factor;    /*!< default kernel size multipier (input option) */
+  ScalingMode scaling_mode; /*!< how kernel size is split among MPI ranks */
+  TimerID timer_id;      /*!< clock source used to time kernels */
 
   double pf_tol;         /*!< pct RAJA variant run time can exceed base for
                               each PM case to pass/fail acceptance */
 
   int checkrun_reps;     /*!< Num reps each kernel is run in check run */
 
+  bool per_rank_timing;  /*!< true -> output timing for each MPI rank */
+
+  bool measure_energy;   /*!< true -> measure energy used by kernels */
+
   std::string reference_variant;   /*!< Name of reference variant for speedup
                                         calculations */
 
@@ -242,6 +309,12 @@ private:
   std::vector<std::string> invalid_variant_input;
   std::vector<std::string> exclude_variant_input;
   std::vector<std::string> invalid_exclude_variant_input;
+  std::vector<std::string> tuning_input;
+  std::vector<std::string> invalid_tuning_input;
+  std::vector<std::string> exclude_tuning_input;
+  std::vector<std::string> invalid_exclude_tuning_input;
+  std::vector<std::string> precision_input;
+  std::vector<std::string> invalid_precision_input;
   std::vector<std::string> feature_input;
   std::vector<std::string> invalid_feature_input;
   std::vector<std::string> exclude_feature_input;
@@ -253,6 +326,14 @@ private:
   std::string outdir;          /*!< Output directory name. */
   std::string outfile_prefix;  /*!< Prefix for output data file names. */
 
+  std::string compare_dir;     /*!< Directory of previous run output files
+                                    to compare results against. */
+  std::string resume_log;      /*!< Run log of an interrupted run to
+                                    resume. */
+
+  std::string annotation;      /*!< Name of backend suite regions are
+                                    reported to. */
+
 };
 
 
@@ -0,0 +1,196 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "Timer.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#if defined(RAJAPERF_HAVE_TSC_TIMER)
+#include <cpuid.h>
+#endif
+
+namespace rajaperf
+{
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Array of names for each clock source in TimerID enum.
+ *
+ * IMPORTANT: This is only modified when a clock source is added or removed.
+ *
+ *            ENUM VALUES MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE)
+ *            WITH ARRAY OF TIMER NAMES BELOW!!!
+ *
+ *******************************************************************************
+ */
+static const std::string TimerNames [] =
+{
+
+  std::string("chrono"),
+  std::string("monotonic_raw"),
+  std::string("tsc"),
+
+  std::string("Unknown Timer")  // Keep this at the end and DO NOT remove....
+
+}; // END TimerNames
+
+
+namespace detail
+{
+TimerID timer_id = Timer_Chrono;
+double timer_tick_period =
+  static_cast<double>(std::chrono::steady_clock::period::num) /
+  static_cast<double>(std::chrono::steady_clock::period::den);
+}
+
+static TimerCalibration timer_calibration = { detail::timer_tick_period,
+                                              0.0, 0.0 };
+
+/*
+ * Seconds per tick of the time stamp counter, measured against the
+ * steady clock.
+ */
+static double measureTSCTickPeriod()
+{
+  using clock = std::chrono::steady_clock;
+  const std::chrono::milliseconds interval(50);
+
+  clock::time_point cstart = clock::now();
+  uint64_t tstart = readTimerTicks();
+  clock::time_point cstop;
+  do {
+    cstop = clock::now();
+  } while ( cstop - cstart < interval );
+  uint64_t tstop = readTimerTicks();
+
+  std::chrono::duration<double> elapsed = cstop - cstart;
+  return elapsed.count() / static_cast<double>(tstop - tstart);
+}
+
+
+const std::string& getTimerName(TimerID tid)
+{
+  return TimerNames[tid];
+}
+
+bool isTimerAvailable(TimerID tid)
+{
+  bool ret_val = false;
+
+  switch ( tid ) {
+
+    case Timer_Chrono : {
+      ret_val = true;
+      break;
+    }
+
+    case Timer_MonotonicRaw : {
+#if defined(CLOCK_MONOTONIC_RAW)
+      struct timespec ts;
+      ret_val = ( clock_gettime(CLOCK_MONOTONIC_RAW, &ts) == 0 );
+#endif
+      break;
+    }
+
+    case Timer_TSC : {
+#if defined(RAJAPERF_HAVE_TSC_TIMER)
+      //
+      // Need rdtscp (CPUID 0x80000001 EDX bit 27) and an invariant TSC
+      // (CPUID 0x80000007 EDX bit 8).
+      //
+      unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+      if ( __get_cpuid_max(0x80000000, nullptr) >= 0x80000007 ) {
+        __get_cpuid(0x80000001, &eax, &ebx, &ecx, &edx);
+        bool have_rdtscp = ( edx & (1u << 27) ) != 0;
+        __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx);
+        bool invariant_tsc = ( edx & (1u << 8) ) != 0;
+        ret_val = have_rdtscp && invariant_tsc;
+      }
+#endif
+      break;
+    }
+
+    default : break;
+
+  }
+
+  return ret_val;
+}
+
+void setTimer(TimerID tid)
+{
+  detail::timer_id = tid;
+
+  switch ( tid ) {
+
+    case Timer_MonotonicRaw : {
+      detail::timer_tick_period = 1.0e-9;
+      break;
+    }
+
+    case Timer_TSC : {
+      detail::timer_tick_period = measureTSCTickPeriod();
+      break;
+    }
+
+    default : {
+      detail::timer_tick_period =
+        static_cast<double>(std::chrono::steady_clock::period::num) /
+        static_cast<double>(std::chrono::steady_clock::period::den);
+    }
+
+  }
+
+  timer_calibration.tick_period = detail::timer_tick_period;
+
+  //
+  // Resolution is the smallest step seen between successive readings.
+  //
+  const int num_samples = 100;
+  uint64_t min_step = std::numeric_limits<uint64_t>::max();
+  for (int i = 0; i < num_samples; ++i) {
+    uint64_t t0 = readTimerTicks();
+    uint64_t t1;
+    do {
+      t1 = readTimerTicks();
+    } while ( t1 == t0 );
+    min_step = std::min(min_step, t1 - t0);
+  }
+  timer_calibration.resolution =
+    static_cast<double>(min_step) * detail::timer_tick_period;
+
+  //
+  // Overhead is the mean time measured for a region with nothing in it.
+  //
+  const int num_trials = 10000;
+  Timer timer;
+  for (int i = 0; i < num_trials; ++i) {
+    timer.start();
+    timer.stop();
+  }
+  timer_calibration.overhead = timer.elapsed() / num_trials;
+}
+
+TimerID getTimer()
+{
+  return detail::timer_id;
+}
+
+const TimerCalibration& getTimerCalibration()
+{
+  return timer_calibration;
+}
+
+void setTimerCalibration(const TimerCalibration& calibration)
+{
+  timer_calibration = calibration;
+}
+
+}  // closing brace for rajaperf namespace
@@ -0,0 +1,182 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Timer used to time kernel runs, with selectable clock sources.
+///
+
+#ifndef RAJAPerf_Timer_HPP
+#define RAJAPerf_Timer_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define RAJAPERF_HAVE_TSC_TIMER
+#endif
+
+namespace rajaperf
+{
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Enumeration defining unique id for each clock source the timer
+ *        may read.
+ *
+ * IMPORTANT: This is only modified when a clock source is added or removed.
+ *
+ *            ENUM VALUES MUST BE KEPT CONSISTENT (CORRESPONDING ONE-TO-ONE)
+ *            WITH ARRAY OF TIMER NAMES IN IMPLEMENTATION FILE!!!
+ *
+ *******************************************************************************
+ */
+enum TimerID {
+
+  Timer_Chrono = 0,      /*!< std::chrono::steady_clock */
+  Timer_MonotonicRaw,    /*!< clock_gettime(CLOCK_MONOTONIC_RAW) */
+  Timer_TSC,             /*!< invariant time stamp counter read with rdtscp */
+
+  NumTimers // Keep this one last and NEVER comment out (!!)
+
+};
+
+/*!
+ * \brief Return name associated with timer id.
+ */
+const std::string& getTimerName(TimerID tid);
+
+/*!
+ * \brief Return true if clock source with given id can be used on the
+ *        machine the Suite is running on; e.g., the time stamp counter
+ *        must be invariant (constant rate, not stopped in sleep states).
+ */
+bool isTimerAvailable(TimerID tid);
+
+/*!
+ * \brief Properties of the selected clock source measured at startup.
+ */
+struct TimerCalibration
+{
+  double tick_period;  /*!< seconds per clock tick */
+  double resolution;   /*!< smallest nonzero time between two readings (sec) */
+  double overhead;     /*!< mean time measured for an empty timed region
+                            (sec) */
+};
+
+/*!
+ * \brief Select clock source that timers read and measure its tick period,
+ *        resolution and overhead.
+ *
+ * This must be called before any timer is started.
+ */
+void setTimer(TimerID tid);
+
+/*!
+ * \brief Return id of selected clock source.
+ */
+TimerID getTimer();
+
+/*!
+ * \brief Return calibration of selected clock source.
+ */
+const TimerCalibration& getTimerCalibration();
+
+/*!
+ * \brief Set calibration of selected clock source; e.g., to use the same
+ *        values on all MPI ranks.
+ */
+void setTimerCalibration(const TimerCalibration& calibration);
+
+namespace detail
+{
+extern TimerID timer_id;
+extern double timer_tick_period;
+}
+
+/*!
+ * \brief Read current tick count of selected clock source.
+ */
+inline uint64_t readTimerTicks()
+{
+  switch ( detail::timer_id ) {
+
+    case Timer_MonotonicRaw : {
+#if defined(CLOCK_MONOTONIC_RAW)
+      struct timespec ts;
+      clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+      return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull +
+             static_cast<uint64_t>(ts.tv_nsec);
+#else
+      break;
+#endif
+    }
+
+    case Timer_TSC : {
+#if defined(RAJAPERF_HAVE_TSC_TIMER)
+      //
+      // rdtscp waits for earlier instructions to finish; the fence keeps
+      // later ones from starting before the counter is read.
+      //
+      unsigned int aux;
+      uint64_t ticks = __rdtscp(&aux);
+      _mm_lfence();
+      return ticks;
+#else
+      break;
+#endif
+    }
+
+    default : break;
+
+  }
+
+  return static_cast<uint64_t>(
+    std::chrono::steady_clock::now().time_since_epoch().count() );
+}
+
+/*!
+ *******************************************************************************
+ *
+ * \brief Timer that accumulates time between start and stop calls, reading
+ *        the selected clock source.
+ *
+ *******************************************************************************
+ */
+class Timer
+{
+public:
+  using ElapsedType = double;
+
+  Timer() : tstart(0), telapsed(0.0) { }
+
+  void start() { tstart = readTimerTicks(); }
+
+  void stop()
+  {
+    uint64_t tstop = readTimerTicks();
+    telapsed += static_cast<ElapsedType>(tstop - tstart) *
+                detail::timer_tick_period;
+  }
+
+  ElapsedType elapsed() const { return telapsed; }
+
+  void reset() { telapsed = 0.0; }
+
+private:
+  uint64_t tstart;
+  ElapsedType telapsed;
+};
+
+}  // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
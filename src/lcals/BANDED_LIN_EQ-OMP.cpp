@@ -0,0 +1,132 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "BANDED_LIN_EQ.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+template < typename Data_type >
+void BANDED_LIN_EQ::runOpenMPVariantPrecision(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  BANDED_LIN_EQ_DATA_SETUP_TYPED(Data_type);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = 6; k < n; k += kstride) {
+
+          Data_type sum = 0.0;
+
+          #pragma omp parallel for reduction(+:sum)
+          for (Index_type jj = 0; jj < jjend; ++jj ) {
+            BANDED_LIN_EQ_BODY;
+          }
+
+          BANDED_LIN_EQ_BODY_FINAL;
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = 6; k < n; k += kstride) {
+
+          auto banded_lin_eq_lam = [=](Index_type jj) -> Data_type {
+                                     return x[k - 6 + jj] * y[4 + 5*jj];
+                                   };
+
+          Data_type sum = 0.0;
+
+          #pragma omp parallel for reduction(+:sum)
+          for (Index_type jj = 0; jj < jjend; ++jj ) {
+            sum += banded_lin_eq_lam(jj);
+          }
+
+          BANDED_LIN_EQ_BODY_FINAL;
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = 6; k < n; k += kstride) {
+
+          RAJA::ReduceSum<RAJA::omp_reduce, Data_type> sum(0.0);
+
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(0, jjend), [=](Index_type jj) {
+            BANDED_LIN_EQ_BODY;
+          });
+
+          x[k-1] = y[4] * ( x[k-1] - static_cast<Data_type>(sum.get()) );
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  BANDED_LIN_EQ : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void BANDED_LIN_EQ::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
@@ -0,0 +1,123 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "BANDED_LIN_EQ.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+template < typename Data_type >
+void BANDED_LIN_EQ::runSeqVariantPrecision(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  BANDED_LIN_EQ_DATA_SETUP_TYPED(Data_type);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = 6; k < n; k += kstride) {
+
+          Data_type sum = 0.0;
+
+          for (Index_type jj = 0; jj < jjend; ++jj ) {
+            BANDED_LIN_EQ_BODY;
+          }
+
+          BANDED_LIN_EQ_BODY_FINAL;
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = 6; k < n; k += kstride) {
+
+          auto banded_lin_eq_lam = [=](Index_type jj) -> Data_type {
+                                     return x[k - 6 + jj] * y[4 + 5*jj];
+                                   };
+
+          Data_type sum = 0.0;
+
+          for (Index_type jj = 0; jj < jjend; ++jj ) {
+            sum += banded_lin_eq_lam(jj);
+          }
+
+          BANDED_LIN_EQ_BODY_FINAL;
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = 6; k < n; k += kstride) {
+
+          RAJA::ReduceSum<RAJA::seq_reduce, Data_type> sum(0.0);
+
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(0, jjend), [=](Index_type jj) {
+            BANDED_LIN_EQ_BODY;
+          });
+
+          x[k-1] = y[4] * ( x[k-1] - static_cast<Data_type>(sum.get()) );
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  BANDED_LIN_EQ : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void BANDED_LIN_EQ::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
@@ -0,0 +1,98 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "BANDED_LIN_EQ.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <vector>
+
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+BANDED_LIN_EQ::BANDED_LIN_EQ(const RunParams& params)
+  : KernelBase(rajaperf::Lcals_BANDED_LIN_EQ, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(500);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_n = RAJA_MAX(getActualProblemSize(), 10);
+  m_array_length = m_n + m_n / 5;
+
+  const Index_type kstride = (m_n - 7) / 2;
+  const Index_type nk = (m_n - 6 + kstride - 1) / kstride;
+  const Index_type jjend = m_n / 5;
+
+  setItsPerRep( nk * jjend );
+  setKernelsPerRep( nk );
+  setBytesPerRep( (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * nk +
+                  (0*sizeof(Real_type ) + 2*sizeof(Real_type )) * nk * jjend );
+  setFLOPsPerRep( (2 * jjend + 2) * nk );
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+  setUsesFeature(Reduction);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (1*data_size + 1*data_size) * nk +
+                    (0*data_size + 2*data_size) * nk * jjend );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
+}
+
+BANDED_LIN_EQ::~BANDED_LIN_EQ()
+{
+}
+
+void BANDED_LIN_EQ::setUp(VariantID vid)
+{
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitData(m_x, m_array_length, pid, vid);
+  allocAndInitData(m_y, m_n, pid, vid);
+}
+
+void BANDED_LIN_EQ::updateChecksum(VariantID vid)
+{
+  checksum[vid] += calcChecksum(m_x, m_n, checksum_scale_factor );
+}
+
+void BANDED_LIN_EQ::tearDown(VariantID vid)
+{
+  (void) vid;
+  deallocData(m_x);
+  deallocData(m_y);
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
@@ -0,0 +1,100 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// BANDED_LIN_EQ kernel reference implementation (Livermore loop 4):
+///
+/// Index_type m = (n-7)/2;
+/// for (Index_type k = 6 ; k < n ; k += m) {
+///   Index_type lw = k - 6;
+///   Real_type temp = x[k-1];
+///   for (Index_type j = 4 ; j < n ; j += 5) {
+///     temp -= x[lw]*y[j];
+///     lw++;
+///   }
+///   x[k-1] = y[4]*temp;
+/// }
+///
+/// The inner loop is a dot product, written below as a sum reduction
+/// over jj with j = 4 + 5*jj and lw = k - 6 + jj.
+///
+
+#ifndef RAJAPerf_Lcals_BANDED_LIN_EQ_HPP
+#define RAJAPerf_Lcals_BANDED_LIN_EQ_HPP
+
+
+#define BANDED_LIN_EQ_DATA_SETUP_TYPED(Data_type) \
+  Data_type* x = m_x.get<Data_type>(); \
+  Data_type* y = m_y.get<Data_type>(); \
+\
+  const Index_type n = m_n; \
+  const Index_type kstride = (n - 7) / 2; \
+  const Index_type jjend = n / 5;
+
+#define BANDED_LIN_EQ_DATA_SETUP BANDED_LIN_EQ_DATA_SETUP_TYPED(Real_type)
+
+#define BANDED_LIN_EQ_BODY  \
+  sum += x[k - 6 + jj] * y[4 + 5*jj];
+
+#define BANDED_LIN_EQ_BODY_FINAL  \
+  x[k-1] = y[4] * ( x[k-1] - sum );
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace lcals
+{
+
+class BANDED_LIN_EQ : public KernelBase
+{
+public:
+
+  BANDED_LIN_EQ(const RunParams& params);
+
+  ~BANDED_LIN_EQ();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  BANDED_LIN_EQ : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  BANDED_LIN_EQ : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  BANDED_LIN_EQ : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_x;
+  Precision_ptr m_y;
+
+  Index_type m_n;
+  Index_type m_array_length;
+};
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
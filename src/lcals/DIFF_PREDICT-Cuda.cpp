@@ -28,11 +28,11 @@ namespace lcals
 
 
 #define DIFF_PREDICT_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(px, m_px, m_array_length); \
-  allocAndInitCudaDeviceData(cx, m_cx, m_array_length);
+  allocAndInitCudaDeviceData(px, m_px.get<Real_type>(), m_array_length); \
+  allocAndInitCudaDeviceData(cx, m_cx.get<Real_type>(), m_array_length);
 
 #define DIFF_PREDICT_DATA_TEARDOWN_CUDA \
-  getCudaDeviceData(m_px, px, m_array_length); \
+  getCudaDeviceData(m_px.get<Real_type>(), px, m_array_length); \
   deallocCudaDeviceData(px); \
   deallocCudaDeviceData(cx);
 
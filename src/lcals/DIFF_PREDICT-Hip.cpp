@@ -28,11 +28,11 @@ namespace lcals
 
 
 #define DIFF_PREDICT_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(px, m_px, m_array_length); \
-  allocAndInitHipDeviceData(cx, m_cx, m_array_length);
+  allocAndInitHipDeviceData(px, m_px.get<Real_type>(), m_array_length); \
+  allocAndInitHipDeviceData(cx, m_cx.get<Real_type>(), m_array_length);
 
 #define DIFF_PREDICT_DATA_TEARDOWN_HIP \
-  getHipDeviceData(m_px, px, m_array_length); \
+  getHipDeviceData(m_px.get<Real_type>(), px, m_array_length); \
   deallocHipDeviceData(px); \
   deallocHipDeviceData(cx);
 
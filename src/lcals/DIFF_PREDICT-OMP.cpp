@@ -18,18 +18,19 @@ namespace lcals
 {
 
 
-void DIFF_PREDICT::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void DIFF_PREDICT::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  DIFF_PREDICT_DATA_SETUP;
+  DIFF_PREDICT_DATA_SETUP_TYPED(Data_type);
 
   auto diffpredict_lam = [=](Index_type i) {
-                           DIFF_PREDICT_BODY;
+                           DIFF_PREDICT_BODY_TYPED(Data_type);
                          };
 
   switch ( vid ) {
@@ -41,7 +42,7 @@ void DIFF_PREDICT::runOpenMPVariant(VariantID vid)
 
         #pragma omp parallel for
         for (Index_type i = ibegin; i < iend; ++i ) {
-          DIFF_PREDICT_BODY;
+          DIFF_PREDICT_BODY_TYPED(Data_type);
         }
 
       }
@@ -85,6 +86,18 @@ void DIFF_PREDICT::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void DIFF_PREDICT::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
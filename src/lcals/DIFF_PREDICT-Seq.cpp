@@ -18,16 +18,17 @@ namespace lcals
 {
 
 
-void DIFF_PREDICT::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void DIFF_PREDICT::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  DIFF_PREDICT_DATA_SETUP;
+  DIFF_PREDICT_DATA_SETUP_TYPED(Data_type);
 
   auto diffpredict_lam = [=](Index_type i) {
-                           DIFF_PREDICT_BODY;
+                           DIFF_PREDICT_BODY_TYPED(Data_type);
                          };
 
   switch ( vid ) {
@@ -38,7 +39,7 @@ void DIFF_PREDICT::runSeqVariant(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         for (Index_type i = ibegin; i < iend; ++i ) {
-          DIFF_PREDICT_BODY;
+          DIFF_PREDICT_BODY_TYPED(Data_type);
         }
 
       }
@@ -86,5 +87,13 @@ void DIFF_PREDICT::runSeqVariant(VariantID vid)
 
 }
 
+void DIFF_PREDICT::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -11,6 +11,8 @@
 #include "RAJA/RAJA.hpp"
 
 #include "common/DataUtils.hpp"
+
+#include <vector>
 namespace rajaperf
 {
 namespace lcals
@@ -49,6 +51,17 @@ DIFF_PREDICT::DIFF_PREDICT(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (10*data_size + 10*data_size) * getActualProblemSize() );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 DIFF_PREDICT::~DIFF_PREDICT()
@@ -57,11 +70,13 @@ DIFF_PREDICT::~DIFF_PREDICT()
 
 void DIFF_PREDICT::setUp(VariantID vid)
 {
+  const PrecisionID pid = getRunningPrecision();
+
   m_array_length = getActualProblemSize() * 14;
   m_offset = getActualProblemSize();
 
-  allocAndInitDataConst(m_px, m_array_length, 0.0, vid);
-  allocAndInitData(m_cx, m_array_length, vid);
+  allocAndInitDataConst(m_px, m_array_length, 0.0, pid, vid);
+  allocAndInitData(m_cx, m_array_length, pid, vid);
 }
 
 void DIFF_PREDICT::updateChecksum(VariantID vid)
@@ -38,13 +38,15 @@
 #define RAJAPerf_Lcals_DIFF_PREDICT_HPP
 
 
-#define DIFF_PREDICT_DATA_SETUP \
-  Real_ptr px = m_px; \
-  Real_ptr cx = m_cx; \
+#define DIFF_PREDICT_DATA_SETUP_TYPED(Data_type) \
+  Data_type* px = m_px.get<Data_type>(); \
+  Data_type* cx = m_cx.get<Data_type>(); \
   const Index_type offset = m_offset;
 
-#define DIFF_PREDICT_BODY  \
-  Real_type ar, br, cr; \
+#define DIFF_PREDICT_DATA_SETUP DIFF_PREDICT_DATA_SETUP_TYPED(Real_type)
+
+#define DIFF_PREDICT_BODY_TYPED(Data_type)  \
+  Data_type ar, br, cr; \
 \
   ar                  = cx[i + offset * 4];       \
   br                  = ar - px[i + offset * 4];  \
@@ -66,6 +68,8 @@
   px[i + offset * 13] = cr - px[i + offset * 12]; \
   px[i + offset * 12] = cr;
 
+#define DIFF_PREDICT_BODY DIFF_PREDICT_BODY_TYPED(Real_type)
+
 
 #include "common/KernelBase.hpp"
 
@@ -95,8 +99,13 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
-  Real_ptr m_px;
-  Real_ptr m_cx;
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_px;
+  Precision_ptr m_cx;
 
   Index_type m_array_length;
   Index_type m_offset;
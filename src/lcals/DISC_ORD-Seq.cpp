@@ -0,0 +1,105 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "DISC_ORD.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+template < typename Data_type >
+void DISC_ORD::runSeqVariantPrecision(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  DISC_ORD_DATA_SETUP_TYPED(Data_type);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type c = 0; c < nchains; ++c ) {
+          for (Index_type kk = 0; kk < len; ++kk ) {
+            DISC_ORD_BODY_TYPED(Data_type);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto disc_ord_lam = [=](Index_type c) {
+                            for (Index_type kk = 0; kk < len; ++kk ) {
+                              DISC_ORD_BODY_TYPED(Data_type);
+                            }
+                          };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type c = 0; c < nchains; ++c ) {
+          disc_ord_lam(c);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nchains), [=](Index_type c) {
+          for (Index_type kk = 0; kk < len; ++kk ) {
+            DISC_ORD_BODY_TYPED(Data_type);
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  DISC_ORD : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void DISC_ORD::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
@@ -0,0 +1,112 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "DISC_ORD.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <vector>
+
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+DISC_ORD::DISC_ORD(const RunParams& params)
+  : KernelBase(rajaperf::Lcals_DISC_ORD, params)
+{
+  m_chain_len = 1000;
+
+  m_s = 0.1;
+  m_t = 0.5;
+
+  setDefaultProblemSize(1000000);
+  setDefaultReps(200);
+
+  m_nchains = RAJA_MAX(getTargetProblemSize() / m_chain_len, 1);
+
+  setActualProblemSize( m_nchains * m_chain_len );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (2*sizeof(Real_type ) + 8*sizeof(Real_type )) * getActualProblemSize() );
+  setFLOPsPerRep(15 * getActualProblemSize());
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (2*data_size + 8*data_size) * getActualProblemSize() );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
+}
+
+DISC_ORD::~DISC_ORD()
+{
+}
+
+void DISC_ORD::setUp(VariantID vid)
+{
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitDataConst(m_x, getActualProblemSize(), 0.0, pid, vid);
+  allocAndInitData(m_y, getActualProblemSize(), pid, vid);
+  allocAndInitData(m_z, getActualProblemSize(), pid, vid);
+  allocAndInitData(m_u, getActualProblemSize(), pid, vid);
+  allocAndInitData(m_v, getActualProblemSize(), pid, vid);
+  allocAndInitData(m_w, getActualProblemSize(), pid, vid);
+  allocAndInitData(m_g, getActualProblemSize(), pid, vid);
+  allocAndInitData(m_vx, getActualProblemSize(), pid, vid);
+  allocAndInitData(m_xx, m_nchains * (m_chain_len+1), pid, vid);
+
+  initData(m_dk, vid);
+}
+
+void DISC_ORD::updateChecksum(VariantID vid)
+{
+  checksum[vid] += calcChecksum(m_x, getActualProblemSize(), checksum_scale_factor );
+  checksum[vid] += calcChecksum(m_xx, m_nchains * (m_chain_len+1), checksum_scale_factor );
+}
+
+void DISC_ORD::tearDown(VariantID vid)
+{
+  (void) vid;
+  deallocData(m_x);
+  deallocData(m_y);
+  deallocData(m_z);
+  deallocData(m_u);
+  deallocData(m_v);
+  deallocData(m_w);
+  deallocData(m_g);
+  deallocData(m_vx);
+  deallocData(m_xx);
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
@@ -0,0 +1,132 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// DISC_ORD kernel reference implementation (Livermore loop 20):
+///
+/// for (Index_type k = 0 ; k < len ; k++) {
+///   Real_type di = y[k] - g[k] / ( xx[k] + dk );
+///   Real_type dn = 0.2;
+///   if ( di ) {
+///     dn = z[k] / di;
+///     if ( t < dn ) dn = t;
+///     if ( s > dn ) dn = s;
+///   }
+///   x[k] = ( ( w[k] + v[k]*dn ) * xx[k] + u[k] ) / ( vx[k] + v[k]*dn );
+///   xx[k+1] = ( x[k] - xx[k] ) * dn + xx[k];
+/// }
+///
+/// Each sweep carries a recurrence through xx, so the kernel runs a batch
+/// of independent sweeps (one per discrete ordinate) of length len. The
+/// sweeps are processed in parallel; xx holds len+1 entries per sweep.
+///
+
+#ifndef RAJAPerf_Lcals_DISC_ORD_HPP
+#define RAJAPerf_Lcals_DISC_ORD_HPP
+
+
+#define DISC_ORD_DATA_SETUP_TYPED(Data_type) \
+  Data_type* x = m_x.get<Data_type>(); \
+  Data_type* y = m_y.get<Data_type>(); \
+  Data_type* z = m_z.get<Data_type>(); \
+  Data_type* u = m_u.get<Data_type>(); \
+  Data_type* v = m_v.get<Data_type>(); \
+  Data_type* w = m_w.get<Data_type>(); \
+  Data_type* g = m_g.get<Data_type>(); \
+  Data_type* vx = m_vx.get<Data_type>(); \
+  Data_type* xx = m_xx.get<Data_type>(); \
+\
+  const Data_type dk = m_dk; \
+  const Data_type s = m_s; \
+  const Data_type t = m_t; \
+\
+  const Index_type len = m_chain_len; \
+  const Index_type nchains = m_nchains;
+
+#define DISC_ORD_DATA_SETUP DISC_ORD_DATA_SETUP_TYPED(Real_type)
+
+#define DISC_ORD_BODY_TYPED(Data_type)  \
+  const Index_type k = c*len + kk; \
+  const Index_type kx = c*(len+1) + kk; \
+  Data_type di = y[k] - g[k] / ( xx[kx] + dk ); \
+  Data_type dn = 0.2; \
+  if ( di ) { \
+    dn = z[k] / di; \
+    if ( t < dn ) dn = t; \
+    if ( s > dn ) dn = s; \
+  } \
+  x[k] = ( ( w[k] + v[k]*dn ) * xx[kx] + u[k] ) / ( vx[k] + v[k]*dn ); \
+  xx[kx+1] = ( x[k] - xx[kx] ) * dn + xx[kx];
+
+#define DISC_ORD_BODY DISC_ORD_BODY_TYPED(Real_type)
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace lcals
+{
+
+class DISC_ORD : public KernelBase
+{
+public:
+
+  DISC_ORD(const RunParams& params);
+
+  ~DISC_ORD();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  DISC_ORD : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  DISC_ORD : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  DISC_ORD : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_x;
+  Precision_ptr m_y;
+  Precision_ptr m_z;
+  Precision_ptr m_u;
+  Precision_ptr m_v;
+  Precision_ptr m_w;
+  Precision_ptr m_g;
+  Precision_ptr m_vx;
+  Precision_ptr m_xx;
+
+  Real_type m_dk;
+  Real_type m_s;
+  Real_type m_t;
+
+  Index_type m_chain_len;
+  Index_type m_nchains;
+};
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
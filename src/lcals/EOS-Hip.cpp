@@ -28,13 +28,13 @@ namespace lcals
 
 
 #define EOS_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(x, m_x, m_array_length); \
-  allocAndInitHipDeviceData(y, m_y, m_array_length); \
-  allocAndInitHipDeviceData(z, m_z, m_array_length); \
-  allocAndInitHipDeviceData(u, m_u, m_array_length);
+  allocAndInitHipDeviceData(x, m_x.get<Real_type>(), m_array_length); \
+  allocAndInitHipDeviceData(y, m_y.get<Real_type>(), m_array_length); \
+  allocAndInitHipDeviceData(z, m_z.get<Real_type>(), m_array_length); \
+  allocAndInitHipDeviceData(u, m_u.get<Real_type>(), m_array_length);
 
 #define EOS_DATA_TEARDOWN_HIP \
-  getHipDeviceData(m_x, x, m_array_length); \
+  getHipDeviceData(m_x.get<Real_type>(), x, m_array_length); \
   deallocHipDeviceData(x); \
   deallocHipDeviceData(y); \
   deallocHipDeviceData(z); \
@@ -18,13 +18,14 @@ namespace lcals
 {
 
 
-void EOS::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void EOS::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  EOS_DATA_SETUP;
+  EOS_DATA_SETUP_TYPED(Data_type);
 
   auto eos_lam = [=](Index_type i) {
                    EOS_BODY;
@@ -86,5 +87,13 @@ void EOS::runSeqVariant(VariantID vid)
 
 }
 
+void EOS::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
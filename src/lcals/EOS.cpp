@@ -12,6 +12,8 @@
 
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 namespace lcals
@@ -57,6 +59,18 @@ EOS::EOS(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (1*data_size + 2*data_size) * getActualProblemSize() +
+                    (0*data_size + 1*data_size) * m_array_length );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 EOS::~EOS()
@@ -65,10 +79,12 @@ EOS::~EOS()
 
 void EOS::setUp(VariantID vid)
 {
-  allocAndInitDataConst(m_x, m_array_length, 0.0, vid);
-  allocAndInitData(m_y, m_array_length, vid);
-  allocAndInitData(m_z, m_array_length, vid);
-  allocAndInitData(m_u, m_array_length, vid);
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitDataConst(m_x, m_array_length, 0.0, pid, vid);
+  allocAndInitData(m_y, m_array_length, pid, vid);
+  allocAndInitData(m_z, m_array_length, pid, vid);
+  allocAndInitData(m_u, m_array_length, pid, vid);
 
   initData(m_q, vid);
   initData(m_r, vid);
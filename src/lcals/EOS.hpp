@@ -20,15 +20,17 @@
 #define RAJAPerf_Lcals_EOS_HPP
 
 
-#define EOS_DATA_SETUP \
-  Real_ptr x = m_x; \
-  Real_ptr y = m_y; \
-  Real_ptr z = m_z; \
-  Real_ptr u = m_u; \
+#define EOS_DATA_SETUP_TYPED(Data_type) \
+  Data_type* x = m_x.get<Data_type>(); \
+  Data_type* y = m_y.get<Data_type>(); \
+  Data_type* z = m_z.get<Data_type>(); \
+  Data_type* u = m_u.get<Data_type>(); \
 \
-  const Real_type q = m_q; \
-  const Real_type r = m_r; \
-  const Real_type t = m_t;
+  const Data_type q = m_q; \
+  const Data_type r = m_r; \
+  const Data_type t = m_t;
+
+#define EOS_DATA_SETUP EOS_DATA_SETUP_TYPED(Real_type)
 
 #define EOS_BODY  \
   x[i] = u[i] + r*( z[i] + r*y[i] ) + \
@@ -64,10 +66,15 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
-  Real_ptr m_x;
-  Real_ptr m_y;
-  Real_ptr m_z;
-  Real_ptr m_u;
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_x;
+  Precision_ptr m_y;
+  Precision_ptr m_z;
+  Precision_ptr m_u;
 
   Real_type m_q;
   Real_type m_r;
@@ -28,11 +28,11 @@ namespace lcals
 
 
 #define FIRST_DIFF_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(x, m_x, m_N); \
-  allocAndInitHipDeviceData(y, m_y, m_N);
+  allocAndInitHipDeviceData(x, m_x.get<Real_type>(), m_N); \
+  allocAndInitHipDeviceData(y, m_y.get<Real_type>(), m_N);
 
 #define FIRST_DIFF_DATA_TEARDOWN_HIP \
-  getHipDeviceData(m_x, x, m_N); \
+  getHipDeviceData(m_x.get<Real_type>(), x, m_N); \
   deallocHipDeviceData(x); \
   deallocHipDeviceData(y);
 
@@ -30,11 +30,11 @@ namespace lcals
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(x, m_x, m_N, did, hid); \
-  allocAndInitOpenMPDeviceData(y, m_y, m_N, did, hid);
+  allocAndInitOpenMPDeviceData(x, m_x.get<Real_type>(), m_N, did, hid); \
+  allocAndInitOpenMPDeviceData(y, m_y.get<Real_type>(), m_N, did, hid);
 
 #define FIRST_DIFF_DATA_TEARDOWN_OMP_TARGET \
-  getOpenMPDeviceData(m_x, x, iend, hid, did); \
+  getOpenMPDeviceData(m_x.get<Real_type>(), x, iend, hid, did); \
   deallocOpenMPDeviceData(x, did); \
   deallocOpenMPDeviceData(y, did);
 
@@ -18,13 +18,14 @@ namespace lcals
 {
 
 
-void FIRST_DIFF::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void FIRST_DIFF::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  FIRST_DIFF_DATA_SETUP;
+  FIRST_DIFF_DATA_SETUP_TYPED(Data_type);
 
   auto firstdiff_lam = [=](Index_type i) {
                          FIRST_DIFF_BODY;
@@ -86,5 +87,13 @@ void FIRST_DIFF::runSeqVariant(VariantID vid)
 
 }
 
+void FIRST_DIFF::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
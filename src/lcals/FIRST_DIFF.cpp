@@ -12,6 +12,8 @@
 
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 namespace lcals
@@ -53,6 +55,18 @@ FIRST_DIFF::FIRST_DIFF(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (1*data_size + 0*data_size) * getActualProblemSize() +
+                    (0*data_size + 1*data_size) * m_N );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 FIRST_DIFF::~FIRST_DIFF()
@@ -61,8 +75,10 @@ FIRST_DIFF::~FIRST_DIFF()
 
 void FIRST_DIFF::setUp(VariantID vid)
 {
-  allocAndInitDataConst(m_x, m_N, 0.0, vid);
-  allocAndInitData(m_y, m_N, vid);
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitDataConst(m_x, m_N, 0.0, pid, vid);
+  allocAndInitData(m_y, m_N, pid, vid);
 }
 
 void FIRST_DIFF::updateChecksum(VariantID vid)
@@ -18,9 +18,11 @@
 #define RAJAPerf_Lcals_FIRST_DIFF_HPP
 
 
-#define FIRST_DIFF_DATA_SETUP \
-  Real_ptr x = m_x; \
-  Real_ptr y = m_y;
+#define FIRST_DIFF_DATA_SETUP_TYPED(Data_type) \
+  Data_type* x = m_x.get<Data_type>(); \
+  Data_type* y = m_y.get<Data_type>();
+
+#define FIRST_DIFF_DATA_SETUP FIRST_DIFF_DATA_SETUP_TYPED(Real_type)
 
 #define FIRST_DIFF_BODY  \
   x[i] = y[i+1] - y[i];
@@ -54,8 +56,13 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
-  Real_ptr m_x;
-  Real_ptr m_y;
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_x;
+  Precision_ptr m_y;
 
   Index_type m_N;
 };
@@ -28,7 +28,7 @@ namespace lcals
 
 
 #define FIRST_MIN_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(x, m_x, m_N);
+  allocAndInitCudaDeviceData(x, m_x.get<Real_type>(), m_N);
 
 #define FIRST_MIN_DATA_TEARDOWN_CUDA \
   deallocCudaDeviceData(x);
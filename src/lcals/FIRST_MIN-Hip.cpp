@@ -28,7 +28,7 @@ namespace lcals
 
 
 #define FIRST_MIN_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(x, m_x, m_N);
+  allocAndInitHipDeviceData(x, m_x.get<Real_type>(), m_N);
 
 #define FIRST_MIN_DATA_TEARDOWN_HIP \
   deallocHipDeviceData(x);
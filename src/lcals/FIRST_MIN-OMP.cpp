@@ -19,15 +19,16 @@ namespace lcals
 
 FIRST_MIN_MINLOC_COMPARE;
 
-void FIRST_MIN::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void FIRST_MIN::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  FIRST_MIN_DATA_SETUP;
+  FIRST_MIN_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -56,7 +57,7 @@ void FIRST_MIN::runOpenMPVariant(VariantID vid)
 
     case Lambda_OpenMP : {
 
-      auto firstmin_base_lam = [=](Index_type i) -> Real_type {
+      auto firstmin_base_lam = [=](Index_type i) -> Data_type {
                                  return x[i];
                                };
 
@@ -89,7 +90,7 @@ void FIRST_MIN::runOpenMPVariant(VariantID vid)
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::ReduceMinLoc<RAJA::omp_reduce, Real_type, Index_type> loc(
+        RAJA::ReduceMinLoc<RAJA::omp_reduce, Data_type, Index_type> loc(
                                                         m_xmin_init, m_initloc);
 
         RAJA::forall<RAJA::omp_parallel_for_exec>(
@@ -110,6 +111,18 @@ void FIRST_MIN::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void FIRST_MIN::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
@@ -30,7 +30,7 @@ namespace lcals
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(x, m_x, m_N, did, hid);
+  allocAndInitOpenMPDeviceData(x, m_x.get<Real_type>(), m_N, did, hid);
 
 #define FIRST_MIN_DATA_TEARDOWN_OMP_TARGET \
   deallocOpenMPDeviceData(x, did);
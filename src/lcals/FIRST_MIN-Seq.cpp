@@ -18,13 +18,14 @@ namespace lcals
 {
 
 
-void FIRST_MIN::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void FIRST_MIN::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  FIRST_MIN_DATA_SETUP;
+  FIRST_MIN_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -50,7 +51,7 @@ void FIRST_MIN::runSeqVariant(VariantID vid)
 #if defined(RUN_RAJA_SEQ)
     case Lambda_Seq : {
 
-      auto firstmin_base_lam = [=](Index_type i) -> Real_type {
+      auto firstmin_base_lam = [=](Index_type i) -> Data_type {
                                  return x[i];
                                };
 
@@ -79,7 +80,7 @@ void FIRST_MIN::runSeqVariant(VariantID vid)
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::ReduceMinLoc<RAJA::seq_reduce, Real_type, Index_type> loc(
+        RAJA::ReduceMinLoc<RAJA::seq_reduce, Data_type, Index_type> loc(
                                                         m_xmin_init, m_initloc);
 
         RAJA::forall<RAJA::loop_exec>(
@@ -104,5 +105,13 @@ void FIRST_MIN::runSeqVariant(VariantID vid)
 
 }
 
+void FIRST_MIN::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
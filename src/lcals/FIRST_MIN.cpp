@@ -12,6 +12,8 @@
 
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 namespace lcals
@@ -57,6 +59,19 @@ FIRST_MIN::FIRST_MIN(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (1*data_size + 1*data_size) +
+                    (1*sizeof(Index_type) + 1*sizeof(Index_type)) +
+                    (0*data_size + 1*data_size) * m_N );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 FIRST_MIN::~FIRST_MIN()
@@ -65,9 +80,18 @@ FIRST_MIN::~FIRST_MIN()
 
 void FIRST_MIN::setUp(VariantID vid)
 {
-  allocAndInitDataConst(m_x, m_N, 0.0, vid);
-  m_x[ m_N / 2 ] = -1.0e+10;
-  m_xmin_init = m_x[0];
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitDataConst(m_x, m_N, 0.0, pid, vid);
+  if ( pid == Precision_Float ) {
+    Float_ptr x = m_x.get<Float_type>();
+    x[ m_N / 2 ] = -1.0e+10;
+    m_xmin_init = x[0];
+  } else {
+    Double_ptr x = m_x.get<Double_type>();
+    x[ m_N / 2 ] = -1.0e+10;
+    m_xmin_init = x[0];
+  }
   m_initloc = 0;
   m_minloc = -1;
 }
@@ -23,8 +23,10 @@
 
 #include "RAJA/util/macros.hpp"
 
-#define FIRST_MIN_DATA_SETUP \
-  Real_ptr x = m_x;
+#define FIRST_MIN_DATA_SETUP_TYPED(Data_type) \
+  Data_type* x = m_x.get<Data_type>();
+
+#define FIRST_MIN_DATA_SETUP FIRST_MIN_DATA_SETUP_TYPED(Real_type)
 
 #define FIRST_MIN_BODY  \
   if ( x[i] < mymin.val ) { \
@@ -83,7 +85,12 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
-  Real_ptr m_x;
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_x;
   Real_type m_xmin_init;
   Index_type m_initloc;
   Index_type m_minloc;
@@ -28,11 +28,11 @@ namespace lcals
 
 
 #define FIRST_SUM_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(x, m_x, m_N); \
-  allocAndInitCudaDeviceData(y, m_y, m_N);
+  allocAndInitCudaDeviceData(x, m_x.get<Real_type>(), m_N); \
+  allocAndInitCudaDeviceData(y, m_y.get<Real_type>(), m_N);
 
 #define FIRST_SUM_DATA_TEARDOWN_CUDA \
-  getCudaDeviceData(m_x, x, m_N); \
+  getCudaDeviceData(m_x.get<Real_type>(), x, m_N); \
   deallocCudaDeviceData(x); \
   deallocCudaDeviceData(y);
 
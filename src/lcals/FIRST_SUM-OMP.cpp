@@ -18,15 +18,16 @@ namespace lcals
 {
 
 
-void FIRST_SUM::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void FIRST_SUM::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 1;
   const Index_type iend = getActualProblemSize();
 
-  FIRST_SUM_DATA_SETUP;
+  FIRST_SUM_DATA_SETUP_TYPED(Data_type);
 
   auto firstsum_lam = [=](Index_type i) {
                         FIRST_SUM_BODY;
@@ -85,6 +86,18 @@ void FIRST_SUM::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void FIRST_SUM::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
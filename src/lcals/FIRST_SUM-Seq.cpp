@@ -18,13 +18,14 @@ namespace lcals
 {
 
 
-void FIRST_SUM::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void FIRST_SUM::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 1;
   const Index_type iend = getActualProblemSize();
 
-  FIRST_SUM_DATA_SETUP;
+  FIRST_SUM_DATA_SETUP_TYPED(Data_type);
 
   auto firstsum_lam = [=](Index_type i) {
                         FIRST_SUM_BODY;
@@ -86,5 +87,13 @@ void FIRST_SUM::runSeqVariant(VariantID vid)
 
 }
 
+void FIRST_SUM::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
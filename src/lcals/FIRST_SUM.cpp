@@ -12,6 +12,8 @@
 
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 namespace lcals
@@ -52,6 +54,18 @@ FIRST_SUM::FIRST_SUM(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (1*data_size + 0*data_size) * (m_N-1) +
+                    (0*data_size + 1*data_size) * m_N );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 FIRST_SUM::~FIRST_SUM()
@@ -60,8 +74,10 @@ FIRST_SUM::~FIRST_SUM()
 
 void FIRST_SUM::setUp(VariantID vid)
 {
-  allocAndInitDataConst(m_x, m_N, 0.0, vid);
-  allocAndInitData(m_y, m_N, vid);
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitDataConst(m_x, m_N, 0.0, pid, vid);
+  allocAndInitData(m_y, m_N, pid, vid);
 }
 
 void FIRST_SUM::updateChecksum(VariantID vid)
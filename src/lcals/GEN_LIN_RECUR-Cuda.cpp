@@ -28,13 +28,13 @@ namespace lcals
 
 
 #define GEN_LIN_RECUR_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(b5, m_b5, m_N); \
-  allocAndInitCudaDeviceData(stb5, m_stb5, m_N); \
-  allocAndInitCudaDeviceData(sa, m_sa, m_N); \
-  allocAndInitCudaDeviceData(sb, m_sb, m_N);
+  allocAndInitCudaDeviceData(b5, m_b5.get<Real_type>(), m_N); \
+  allocAndInitCudaDeviceData(stb5, m_stb5.get<Real_type>(), m_N); \
+  allocAndInitCudaDeviceData(sa, m_sa.get<Real_type>(), m_N); \
+  allocAndInitCudaDeviceData(sb, m_sb.get<Real_type>(), m_N);
 
 #define GEN_LIN_RECUR_DATA_TEARDOWN_CUDA \
-  getCudaDeviceData(m_b5, b5, m_N); \
+  getCudaDeviceData(m_b5.get<Real_type>(), b5, m_N); \
   deallocCudaDeviceData(b5); \
   deallocCudaDeviceData(stb5); \
   deallocCudaDeviceData(sa); \
@@ -28,13 +28,13 @@ namespace lcals
 
 
 #define GEN_LIN_RECUR_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(b5, m_b5, m_N); \
-  allocAndInitHipDeviceData(stb5, m_stb5, m_N); \
-  allocAndInitHipDeviceData(sa, m_sa, m_N); \
-  allocAndInitHipDeviceData(sb, m_sb, m_N);
+  allocAndInitHipDeviceData(b5, m_b5.get<Real_type>(), m_N); \
+  allocAndInitHipDeviceData(stb5, m_stb5.get<Real_type>(), m_N); \
+  allocAndInitHipDeviceData(sa, m_sa.get<Real_type>(), m_N); \
+  allocAndInitHipDeviceData(sb, m_sb.get<Real_type>(), m_N);
 
 #define GEN_LIN_RECUR_DATA_TEARDOWN_HIP \
-  getHipDeviceData(m_b5, b5, m_N); \
+  getHipDeviceData(m_b5.get<Real_type>(), b5, m_N); \
   deallocHipDeviceData(b5); \
   deallocHipDeviceData(stb5); \
   deallocHipDeviceData(sa); \
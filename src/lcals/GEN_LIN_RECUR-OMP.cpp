@@ -18,13 +18,14 @@ namespace lcals
 {
 
 
-void GEN_LIN_RECUR::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void GEN_LIN_RECUR::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps = getRunReps();
 
-  GEN_LIN_RECUR_DATA_SETUP;
+  GEN_LIN_RECUR_DATA_SETUP_TYPED(Data_type);
 
   auto genlinrecur_lam1 = [=](Index_type k) {
                             GEN_LIN_RECUR_BODY1;
@@ -99,6 +100,18 @@ void GEN_LIN_RECUR::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void GEN_LIN_RECUR::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
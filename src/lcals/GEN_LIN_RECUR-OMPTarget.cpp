@@ -30,13 +30,13 @@ namespace lcals
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(b5, m_b5, m_N, did, hid); \
-  allocAndInitOpenMPDeviceData(stb5, m_stb5, m_N, did, hid); \
-  allocAndInitOpenMPDeviceData(sa, m_sa, m_N, did, hid); \
-  allocAndInitOpenMPDeviceData(sb, m_sb, m_N, did, hid);
+  allocAndInitOpenMPDeviceData(b5, m_b5.get<Real_type>(), m_N, did, hid); \
+  allocAndInitOpenMPDeviceData(stb5, m_stb5.get<Real_type>(), m_N, did, hid); \
+  allocAndInitOpenMPDeviceData(sa, m_sa.get<Real_type>(), m_N, did, hid); \
+  allocAndInitOpenMPDeviceData(sb, m_sb.get<Real_type>(), m_N, did, hid);
 
 #define GEN_LIN_RECUR_DATA_TEARDOWN_OMP_TARGET \
-  getOpenMPDeviceData(m_b5, b5, m_N, hid, did); \
+  getOpenMPDeviceData(m_b5.get<Real_type>(), b5, m_N, hid, did); \
   deallocOpenMPDeviceData(b5, did); \
   deallocOpenMPDeviceData(stb5, did); \
   deallocOpenMPDeviceData(sa, did); \
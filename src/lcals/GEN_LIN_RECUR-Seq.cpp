@@ -18,11 +18,12 @@ namespace lcals
 {
 
 
-void GEN_LIN_RECUR::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void GEN_LIN_RECUR::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
 
-  GEN_LIN_RECUR_DATA_SETUP;
+  GEN_LIN_RECUR_DATA_SETUP_TYPED(Data_type);
 
   auto genlinrecur_lam1 = [=](Index_type k) {
                             GEN_LIN_RECUR_BODY1;
@@ -98,5 +99,13 @@ void GEN_LIN_RECUR::runSeqVariant(VariantID vid)
 
 }
 
+void GEN_LIN_RECUR::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -12,6 +12,8 @@
 
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 namespace lcals
@@ -57,6 +59,18 @@ GEN_LIN_RECUR::GEN_LIN_RECUR(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (2*data_size + 3*data_size) * m_N +
+                    (2*data_size + 3*data_size) * m_N );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 GEN_LIN_RECUR::~GEN_LIN_RECUR()
@@ -65,12 +79,14 @@ GEN_LIN_RECUR::~GEN_LIN_RECUR()
 
 void GEN_LIN_RECUR::setUp(VariantID vid)
 {
+  const PrecisionID pid = getRunningPrecision();
+
   m_kb5i = 0;
 
-  allocAndInitDataConst(m_b5, m_N, 0.0, vid);
-  allocAndInitData(m_stb5, m_N, vid);
-  allocAndInitData(m_sa, m_N, vid);
-  allocAndInitData(m_sb, m_N, vid);
+  allocAndInitDataConst(m_b5, m_N, 0.0, pid, vid);
+  allocAndInitData(m_stb5, m_N, pid, vid);
+  allocAndInitData(m_sa, m_N, pid, vid);
+  allocAndInitData(m_sb, m_N, pid, vid);
 }
 
 void GEN_LIN_RECUR::updateChecksum(VariantID vid)
@@ -31,15 +31,17 @@
 #define RAJAPerf_Lcals_GEN_LIN_RECUR_HPP
 
 
-#define GEN_LIN_RECUR_DATA_SETUP \
-  Real_ptr b5 = m_b5; \
-  Real_ptr sa = m_sa; \
-  Real_ptr sb = m_sb; \
-  Real_ptr stb5 = m_stb5; \
+#define GEN_LIN_RECUR_DATA_SETUP_TYPED(Data_type) \
+  Data_type* b5 = m_b5.get<Data_type>(); \
+  Data_type* sa = m_sa.get<Data_type>(); \
+  Data_type* sb = m_sb.get<Data_type>(); \
+  Data_type* stb5 = m_stb5.get<Data_type>(); \
 \
   Index_type kb5i = m_kb5i; \
   Index_type N = m_N;
 
+#define GEN_LIN_RECUR_DATA_SETUP GEN_LIN_RECUR_DATA_SETUP_TYPED(Real_type)
+
 #define GEN_LIN_RECUR_BODY1  \
   b5[k+kb5i] = sa[k] + stb5[k]*sb[k]; \
   stb5[k] = b5[k+kb5i] - stb5[k];
@@ -78,10 +80,15 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
-  Real_ptr m_b5;
-  Real_ptr m_sa;
-  Real_ptr m_sb;
-  Real_ptr m_stb5;
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_b5;
+  Precision_ptr m_sa;
+  Precision_ptr m_sb;
+  Precision_ptr m_stb5;
   Index_type m_kb5i;
 
   Index_type m_N;
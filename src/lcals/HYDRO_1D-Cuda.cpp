@@ -28,12 +28,12 @@ namespace lcals
 
 
 #define HYDRO_1D_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(x, m_x, m_array_length); \
-  allocAndInitCudaDeviceData(y, m_y, m_array_length); \
-  allocAndInitCudaDeviceData(z, m_z, m_array_length);
+  allocAndInitCudaDeviceData(x, m_x.get<Real_type>(), m_array_length); \
+  allocAndInitCudaDeviceData(y, m_y.get<Real_type>(), m_array_length); \
+  allocAndInitCudaDeviceData(z, m_z.get<Real_type>(), m_array_length);
 
 #define HYDRO_1D_DATA_TEARDOWN_CUDA \
-  getCudaDeviceData(m_x, x, m_array_length); \
+  getCudaDeviceData(m_x.get<Real_type>(), x, m_array_length); \
   deallocCudaDeviceData(x); \
   deallocCudaDeviceData(y); \
   deallocCudaDeviceData(z); \
@@ -18,15 +18,16 @@ namespace lcals
 {
 
 
-void HYDRO_1D::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void HYDRO_1D::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  HYDRO_1D_DATA_SETUP;
+  HYDRO_1D_DATA_SETUP_TYPED(Data_type);
 
   auto hydro1d_lam = [=](Index_type i) {
                        HYDRO_1D_BODY;
@@ -86,6 +87,18 @@ void HYDRO_1D::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void HYDRO_1D::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
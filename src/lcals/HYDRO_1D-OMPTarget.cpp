@@ -30,12 +30,12 @@ namespace lcals
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(x, m_x, m_array_length, did, hid); \
-  allocAndInitOpenMPDeviceData(y, m_y, m_array_length, did, hid); \
-  allocAndInitOpenMPDeviceData(z, m_z, m_array_length, did, hid);
+  allocAndInitOpenMPDeviceData(x, m_x.get<Real_type>(), m_array_length, did, hid); \
+  allocAndInitOpenMPDeviceData(y, m_y.get<Real_type>(), m_array_length, did, hid); \
+  allocAndInitOpenMPDeviceData(z, m_z.get<Real_type>(), m_array_length, did, hid);
 
 #define HYDRO_1D_DATA_TEARDOWN_OMP_TARGET \
-  getOpenMPDeviceData(m_x, x, m_array_length, hid, did); \
+  getOpenMPDeviceData(m_x.get<Real_type>(), x, m_array_length, hid, did); \
   deallocOpenMPDeviceData(x, did); \
   deallocOpenMPDeviceData(y, did); \
   deallocOpenMPDeviceData(z, did); \
@@ -18,13 +18,14 @@ namespace lcals
 {
 
 
-void HYDRO_1D::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void HYDRO_1D::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  HYDRO_1D_DATA_SETUP;
+  HYDRO_1D_DATA_SETUP_TYPED(Data_type);
 
   auto hydro1d_lam = [=](Index_type i) {
                        HYDRO_1D_BODY;
@@ -86,5 +87,13 @@ void HYDRO_1D::runSeqVariant(VariantID vid)
 
 }
 
+void HYDRO_1D::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -12,6 +12,8 @@
 
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 namespace lcals
@@ -56,6 +58,18 @@ HYDRO_1D::HYDRO_1D(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (1*data_size + 1*data_size) * getActualProblemSize() +
+                    (0*data_size + 1*data_size) * (getActualProblemSize()+1) );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 HYDRO_1D::~HYDRO_1D()
@@ -64,9 +78,11 @@ HYDRO_1D::~HYDRO_1D()
 
 void HYDRO_1D::setUp(VariantID vid)
 {
-  allocAndInitDataConst(m_x, m_array_length, 0.0, vid);
-  allocAndInitData(m_y, m_array_length, vid);
-  allocAndInitData(m_z, m_array_length, vid);
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitDataConst(m_x, m_array_length, 0.0, pid, vid);
+  allocAndInitData(m_y, m_array_length, pid, vid);
+  allocAndInitData(m_z, m_array_length, pid, vid);
 
   initData(m_q, vid);
   initData(m_r, vid);
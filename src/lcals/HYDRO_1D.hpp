@@ -18,14 +18,16 @@
 #define RAJAPerf_Lcals_HYDRO_1D_HPP
 
 
-#define HYDRO_1D_DATA_SETUP \
-  Real_ptr x = m_x; \
-  Real_ptr y = m_y; \
-  Real_ptr z = m_z; \
+#define HYDRO_1D_DATA_SETUP_TYPED(Data_type) \
+  Data_type* x = m_x.get<Data_type>(); \
+  Data_type* y = m_y.get<Data_type>(); \
+  Data_type* z = m_z.get<Data_type>(); \
 \
-  const Real_type q = m_q; \
-  const Real_type r = m_r; \
-  const Real_type t = m_t;
+  const Data_type q = m_q; \
+  const Data_type r = m_r; \
+  const Data_type t = m_t;
+
+#define HYDRO_1D_DATA_SETUP HYDRO_1D_DATA_SETUP_TYPED(Real_type)
 
 #define HYDRO_1D_BODY  \
   x[i] = q + y[i]*( r*z[i+10] + t*z[i+11] );
@@ -59,9 +61,14 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
-  Real_ptr m_x;
-  Real_ptr m_y;
-  Real_ptr m_z;
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_x;
+  Precision_ptr m_y;
+  Precision_ptr m_z;
 
   Real_type m_q;
   Real_type m_r;
@@ -38,22 +38,22 @@ namespace lcals
 
 #define HYDRO_2D_DATA_SETUP_CUDA \
 \
-  allocAndInitCudaDeviceData(zadat, m_za, m_array_length); \
-  allocAndInitCudaDeviceData(zbdat, m_zb, m_array_length); \
-  allocAndInitCudaDeviceData(zmdat, m_zm, m_array_length); \
-  allocAndInitCudaDeviceData(zpdat, m_zp, m_array_length); \
-  allocAndInitCudaDeviceData(zqdat, m_zq, m_array_length); \
-  allocAndInitCudaDeviceData(zrdat, m_zr, m_array_length); \
-  allocAndInitCudaDeviceData(zudat, m_zu, m_array_length); \
-  allocAndInitCudaDeviceData(zvdat, m_zv, m_array_length); \
-  allocAndInitCudaDeviceData(zzdat, m_zz, m_array_length); \
-  allocAndInitCudaDeviceData(zroutdat, m_zrout, m_array_length); \
-  allocAndInitCudaDeviceData(zzoutdat, m_zzout, m_array_length);
+  allocAndInitCudaDeviceData(zadat, m_za.get<Real_type>(), m_array_length); \
+  allocAndInitCudaDeviceData(zbdat, m_zb.get<Real_type>(), m_array_length); \
+  allocAndInitCudaDeviceData(zmdat, m_zm.get<Real_type>(), m_array_length); \
+  allocAndInitCudaDeviceData(zpdat, m_zp.get<Real_type>(), m_array_length); \
+  allocAndInitCudaDeviceData(zqdat, m_zq.get<Real_type>(), m_array_length); \
+  allocAndInitCudaDeviceData(zrdat, m_zr.get<Real_type>(), m_array_length); \
+  allocAndInitCudaDeviceData(zudat, m_zu.get<Real_type>(), m_array_length); \
+  allocAndInitCudaDeviceData(zvdat, m_zv.get<Real_type>(), m_array_length); \
+  allocAndInitCudaDeviceData(zzdat, m_zz.get<Real_type>(), m_array_length); \
+  allocAndInitCudaDeviceData(zroutdat, m_zrout.get<Real_type>(), m_array_length); \
+  allocAndInitCudaDeviceData(zzoutdat, m_zzout.get<Real_type>(), m_array_length);
 
 
 #define HYDRO_2D_DATA_TEARDOWN_CUDA \
-  getCudaDeviceData(m_zrout, zroutdat, m_array_length); \
-  getCudaDeviceData(m_zzout, zzoutdat, m_array_length); \
+  getCudaDeviceData(m_zrout.get<Real_type>(), zroutdat, m_array_length); \
+  getCudaDeviceData(m_zzout.get<Real_type>(), zzoutdat, m_array_length); \
   deallocCudaDeviceData(zadat); \
   deallocCudaDeviceData(zbdat); \
   deallocCudaDeviceData(zmdat); \
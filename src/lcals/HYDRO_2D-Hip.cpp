@@ -37,22 +37,22 @@ namespace lcals
 
 
 #define HYDRO_2D_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(zadat, m_za, m_array_length); \
-  allocAndInitHipDeviceData(zbdat, m_zb, m_array_length); \
-  allocAndInitHipDeviceData(zmdat, m_zm, m_array_length); \
-  allocAndInitHipDeviceData(zpdat, m_zp, m_array_length); \
-  allocAndInitHipDeviceData(zqdat, m_zq, m_array_length); \
-  allocAndInitHipDeviceData(zrdat, m_zr, m_array_length); \
-  allocAndInitHipDeviceData(zudat, m_zu, m_array_length); \
-  allocAndInitHipDeviceData(zvdat, m_zv, m_array_length); \
-  allocAndInitHipDeviceData(zzdat, m_zz, m_array_length); \
-  allocAndInitHipDeviceData(zroutdat, m_zrout, m_array_length); \
-  allocAndInitHipDeviceData(zzoutdat, m_zzout, m_array_length);
+  allocAndInitHipDeviceData(zadat, m_za.get<Real_type>(), m_array_length); \
+  allocAndInitHipDeviceData(zbdat, m_zb.get<Real_type>(), m_array_length); \
+  allocAndInitHipDeviceData(zmdat, m_zm.get<Real_type>(), m_array_length); \
+  allocAndInitHipDeviceData(zpdat, m_zp.get<Real_type>(), m_array_length); \
+  allocAndInitHipDeviceData(zqdat, m_zq.get<Real_type>(), m_array_length); \
+  allocAndInitHipDeviceData(zrdat, m_zr.get<Real_type>(), m_array_length); \
+  allocAndInitHipDeviceData(zudat, m_zu.get<Real_type>(), m_array_length); \
+  allocAndInitHipDeviceData(zvdat, m_zv.get<Real_type>(), m_array_length); \
+  allocAndInitHipDeviceData(zzdat, m_zz.get<Real_type>(), m_array_length); \
+  allocAndInitHipDeviceData(zroutdat, m_zrout.get<Real_type>(), m_array_length); \
+  allocAndInitHipDeviceData(zzoutdat, m_zzout.get<Real_type>(), m_array_length);
 
 
 #define HYDRO_2D_DATA_TEARDOWN_HIP \
-  getHipDeviceData(m_zrout, zroutdat, m_array_length); \
-  getHipDeviceData(m_zzout, zzoutdat, m_array_length); \
+  getHipDeviceData(m_zrout.get<Real_type>(), zroutdat, m_array_length); \
+  getHipDeviceData(m_zzout.get<Real_type>(), zzoutdat, m_array_length); \
   deallocHipDeviceData(zadat); \
   deallocHipDeviceData(zbdat); \
   deallocHipDeviceData(zmdat); \
@@ -18,17 +18,18 @@ namespace lcals
 {
 
 
-void HYDRO_2D::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void HYDRO_2D::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps = getRunReps();
   const Index_type kbeg = 1;
   const Index_type kend = m_kn - 1;
   const Index_type jbeg = 1;
   const Index_type jend = m_jn - 1;
 
-  HYDRO_2D_DATA_SETUP;
+  HYDRO_2D_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -118,7 +119,7 @@ void HYDRO_2D::runOpenMPVariant(VariantID vid)
 
     case RAJA_OpenMP : {
 
-      HYDRO_2D_VIEWS_RAJA;
+      HYDRO_2D_VIEWS_RAJA_TYPED(Data_type);
 
       auto hydro2d_lam1 = [=] (Index_type k, Index_type j) {
                             HYDRO_2D_BODY1_RAJA;
@@ -172,6 +173,18 @@ void HYDRO_2D::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void HYDRO_2D::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
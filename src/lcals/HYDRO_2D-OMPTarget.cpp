@@ -25,21 +25,21 @@ namespace lcals
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(zadat, m_za, m_array_length, did, hid); \
-  allocAndInitOpenMPDeviceData(zbdat, m_zb, m_array_length, did, hid); \
-  allocAndInitOpenMPDeviceData(zmdat, m_zm, m_array_length, did, hid); \
-  allocAndInitOpenMPDeviceData(zpdat, m_zp, m_array_length, did, hid); \
-  allocAndInitOpenMPDeviceData(zqdat, m_zq, m_array_length, did, hid); \
-  allocAndInitOpenMPDeviceData(zrdat, m_zr, m_array_length, did, hid); \
-  allocAndInitOpenMPDeviceData(zudat, m_zu, m_array_length, did, hid); \
-  allocAndInitOpenMPDeviceData(zvdat, m_zv, m_array_length, did, hid); \
-  allocAndInitOpenMPDeviceData(zzdat, m_zz, m_array_length, did, hid); \
-  allocAndInitOpenMPDeviceData(zroutdat, m_zrout, m_array_length, did, hid); \
-  allocAndInitOpenMPDeviceData(zzoutdat, m_zzout, m_array_length, did, hid);
+  allocAndInitOpenMPDeviceData(zadat, m_za.get<Real_type>(), m_array_length, did, hid); \
+  allocAndInitOpenMPDeviceData(zbdat, m_zb.get<Real_type>(), m_array_length, did, hid); \
+  allocAndInitOpenMPDeviceData(zmdat, m_zm.get<Real_type>(), m_array_length, did, hid); \
+  allocAndInitOpenMPDeviceData(zpdat, m_zp.get<Real_type>(), m_array_length, did, hid); \
+  allocAndInitOpenMPDeviceData(zqdat, m_zq.get<Real_type>(), m_array_length, did, hid); \
+  allocAndInitOpenMPDeviceData(zrdat, m_zr.get<Real_type>(), m_array_length, did, hid); \
+  allocAndInitOpenMPDeviceData(zudat, m_zu.get<Real_type>(), m_array_length, did, hid); \
+  allocAndInitOpenMPDeviceData(zvdat, m_zv.get<Real_type>(), m_array_length, did, hid); \
+  allocAndInitOpenMPDeviceData(zzdat, m_zz.get<Real_type>(), m_array_length, did, hid); \
+  allocAndInitOpenMPDeviceData(zroutdat, m_zrout.get<Real_type>(), m_array_length, did, hid); \
+  allocAndInitOpenMPDeviceData(zzoutdat, m_zzout.get<Real_type>(), m_array_length, did, hid);
 
 #define HYDRO_2D_DATA_TEARDOWN_OMP_TARGET \
-  getOpenMPDeviceData(m_zrout, zroutdat, m_array_length, hid, did); \
-  getOpenMPDeviceData(m_zzout, zzoutdat, m_array_length, hid, did); \
+  getOpenMPDeviceData(m_zrout.get<Real_type>(), zroutdat, m_array_length, hid, did); \
+  getOpenMPDeviceData(m_zzout.get<Real_type>(), zzoutdat, m_array_length, hid, did); \
   deallocOpenMPDeviceData(zadat, did); \
   deallocOpenMPDeviceData(zbdat, did); \
   deallocOpenMPDeviceData(zmdat, did); \
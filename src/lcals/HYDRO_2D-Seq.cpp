@@ -18,7 +18,8 @@ namespace lcals
 {
 
 
-void HYDRO_2D::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void HYDRO_2D::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type kbeg = 1;
@@ -26,7 +27,7 @@ void HYDRO_2D::runSeqVariant(VariantID vid)
   const Index_type jbeg = 1;
   const Index_type jend = m_jn - 1;
 
-  HYDRO_2D_DATA_SETUP;
+  HYDRO_2D_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -101,7 +102,7 @@ void HYDRO_2D::runSeqVariant(VariantID vid)
 
     case RAJA_Seq : {
 
-      HYDRO_2D_VIEWS_RAJA;
+      HYDRO_2D_VIEWS_RAJA_TYPED(Data_type);
 
       auto hydro2d_lam1 = [=] (Index_type k, Index_type j) {
                             HYDRO_2D_BODY1_RAJA;
@@ -155,5 +156,13 @@ void HYDRO_2D::runSeqVariant(VariantID vid)
 
 }
 
+void HYDRO_2D::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
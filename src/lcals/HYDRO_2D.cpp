@@ -12,6 +12,8 @@
 
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 #include <cmath>
 
 
@@ -71,6 +73,21 @@ HYDRO_2D::HYDRO_2D(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (2*data_size + 0*data_size) * (m_kn-2) * (m_jn-2) +
+                    (0*data_size + 4*data_size) * m_array_length +
+                    (2*data_size + 0*data_size) * (m_kn-2) * (m_jn-2) +
+                    (0*data_size + 4*data_size) * m_array_length +
+                    (2*data_size + 4*data_size) * (m_kn-2) * (m_jn-2) );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 HYDRO_2D::~HYDRO_2D()
@@ -79,17 +96,19 @@ HYDRO_2D::~HYDRO_2D()
 
 void HYDRO_2D::setUp(VariantID vid)
 {
-  allocAndInitDataConst(m_zrout, m_array_length, 0.0, vid);
-  allocAndInitDataConst(m_zzout, m_array_length, 0.0, vid);
-  allocAndInitData(m_za, m_array_length, vid);
-  allocAndInitData(m_zb, m_array_length, vid);
-  allocAndInitData(m_zm, m_array_length, vid);
-  allocAndInitData(m_zp, m_array_length, vid);
-  allocAndInitData(m_zq, m_array_length, vid);
-  allocAndInitData(m_zr, m_array_length, vid);
-  allocAndInitData(m_zu, m_array_length, vid);
-  allocAndInitData(m_zv, m_array_length, vid);
-  allocAndInitData(m_zz, m_array_length, vid);
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitDataConst(m_zrout, m_array_length, 0.0, pid, vid);
+  allocAndInitDataConst(m_zzout, m_array_length, 0.0, pid, vid);
+  allocAndInitData(m_za, m_array_length, pid, vid);
+  allocAndInitData(m_zb, m_array_length, pid, vid);
+  allocAndInitData(m_zm, m_array_length, pid, vid);
+  allocAndInitData(m_zp, m_array_length, pid, vid);
+  allocAndInitData(m_zq, m_array_length, pid, vid);
+  allocAndInitData(m_zr, m_array_length, pid, vid);
+  allocAndInitData(m_zu, m_array_length, pid, vid);
+  allocAndInitData(m_zv, m_array_length, pid, vid);
+  allocAndInitData(m_zz, m_array_length, pid, vid);
 }
 
 void HYDRO_2D::updateChecksum(VariantID vid)
@@ -43,26 +43,28 @@
 #define RAJAPerf_Lcals_HYDRO_2D_HPP
 
 
-#define HYDRO_2D_DATA_SETUP \
-  Real_ptr zadat = m_za; \
-  Real_ptr zbdat = m_zb; \
-  Real_ptr zmdat = m_zm; \
-  Real_ptr zpdat = m_zp; \
-  Real_ptr zqdat = m_zq; \
-  Real_ptr zrdat = m_zr; \
-  Real_ptr zudat = m_zu; \
-  Real_ptr zvdat = m_zv; \
-  Real_ptr zzdat = m_zz; \
+#define HYDRO_2D_DATA_SETUP_TYPED(Data_type) \
+  Data_type* zadat = m_za.get<Data_type>(); \
+  Data_type* zbdat = m_zb.get<Data_type>(); \
+  Data_type* zmdat = m_zm.get<Data_type>(); \
+  Data_type* zpdat = m_zp.get<Data_type>(); \
+  Data_type* zqdat = m_zq.get<Data_type>(); \
+  Data_type* zrdat = m_zr.get<Data_type>(); \
+  Data_type* zudat = m_zu.get<Data_type>(); \
+  Data_type* zvdat = m_zv.get<Data_type>(); \
+  Data_type* zzdat = m_zz.get<Data_type>(); \
 \
-  Real_ptr zroutdat = m_zrout; \
-  Real_ptr zzoutdat = m_zzout; \
+  Data_type* zroutdat = m_zrout.get<Data_type>(); \
+  Data_type* zzoutdat = m_zzout.get<Data_type>(); \
 \
-  const Real_type s = m_s; \
-  const Real_type t = m_t; \
+  const Data_type s = m_s; \
+  const Data_type t = m_t; \
 \
   const Index_type kn = m_kn; \
   const Index_type jn = m_jn;
 
+#define HYDRO_2D_DATA_SETUP HYDRO_2D_DATA_SETUP_TYPED(Real_type)
+
 #define HYDRO_2D_BODY1  \
   zadat[j+k*jn] = ( zpdat[j-1+(k+1)*jn] + zqdat[j-1+(k+1)*jn] - \
                     zpdat[j-1+k*jn] - zqdat[j-1+k*jn] ) * \
@@ -88,8 +90,8 @@
   zzoutdat[j+k*jn] = zzdat[j+k*jn] + t*zvdat[j+k*jn]; \
 
 
-#define HYDRO_2D_VIEWS_RAJA \
-  using VIEW_TYPE = RAJA::View<Real_type, RAJA::Layout<2, Index_type, 1> >; \
+#define HYDRO_2D_VIEWS_RAJA_TYPED(Data_type) \
+  using VIEW_TYPE = RAJA::View<Data_type, RAJA::Layout<2, Index_type, 1> >; \
 \
   std::array<RAJA::idx_t, 2> view_perm {{0, 1}}; \
 \
@@ -105,6 +107,8 @@
   VIEW_TYPE zrout(zroutdat, RAJA::make_permuted_layout({{kn, jn}}, view_perm));\
   VIEW_TYPE zzout(zzoutdat, RAJA::make_permuted_layout({{kn, jn}}, view_perm));
 
+#define HYDRO_2D_VIEWS_RAJA HYDRO_2D_VIEWS_RAJA_TYPED(Real_type)
+
 #define HYDRO_2D_BODY1_RAJA  \
   za(k,j) = ( zp(k+1,j-1) + zq(k+1,j-1) - zp(k,j-1) - zq(k,j-1) ) * \
             ( zr(k,j) + zr(k,j-1) ) / ( zm(k,j-1) + zm(k+1,j-1) ); \
@@ -155,18 +159,23 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
-  Real_ptr m_za;
-  Real_ptr m_zb;
-  Real_ptr m_zm;
-  Real_ptr m_zp;
-  Real_ptr m_zq;
-  Real_ptr m_zr;
-  Real_ptr m_zu;
-  Real_ptr m_zv;
-  Real_ptr m_zz;
-
-  Real_ptr m_zrout;
-  Real_ptr m_zzout;
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_za;
+  Precision_ptr m_zb;
+  Precision_ptr m_zm;
+  Precision_ptr m_zp;
+  Precision_ptr m_zq;
+  Precision_ptr m_zr;
+  Precision_ptr m_zu;
+  Precision_ptr m_zv;
+  Precision_ptr m_zz;
+
+  Precision_ptr m_zrout;
+  Precision_ptr m_zzout;
 
   Real_type m_s;
   Real_type m_t;
@@ -0,0 +1,137 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HYDRO_2D_IMPLICIT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+template < typename Data_type >
+void HYDRO_2D_IMPLICIT::runOpenMPVariantPrecision(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type kbeg = 1;
+  const Index_type kend = m_kn - 1;
+  const Index_type jbeg = 1;
+  const Index_type jend = m_jn - 1;
+
+  // anti-diagonals d = k + j
+  const Index_type dbeg = kbeg + jbeg;
+  const Index_type dend = kend + jend - 1;
+
+  HYDRO_2D_IMPLICIT_DATA_SETUP_TYPED(Data_type);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          for (Index_type d = dbeg; d < dend; ++d ) {
+            HYDRO_2D_IMPLICIT_DIAG_RANGE;
+            #pragma omp for schedule(static)
+            for (Index_type k = kfirst; k < klast; ++k ) {
+              const Index_type j = d - k;
+              HYDRO_2D_IMPLICIT_BODY_TYPED(Data_type);
+            }
+          }
+        } // end omp parallel region
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto hydro2d_implicit_lam = [=] (Index_type k, Index_type j) {
+                                    HYDRO_2D_IMPLICIT_BODY_TYPED(Data_type);
+                                  };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          for (Index_type d = dbeg; d < dend; ++d ) {
+            HYDRO_2D_IMPLICIT_DIAG_RANGE;
+            #pragma omp for schedule(static)
+            for (Index_type k = kfirst; k < klast; ++k ) {
+              hydro2d_implicit_lam(k, d - k);
+            }
+          }
+        } // end omp parallel region
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::region<RAJA::omp_parallel_region>( [=]() {
+
+          for (Index_type d = dbeg; d < dend; ++d ) {
+            HYDRO_2D_IMPLICIT_DIAG_RANGE;
+            RAJA::forall<RAJA::omp_for_exec>(
+              RAJA::RangeSegment(kfirst, klast), [=](Index_type k) {
+              const Index_type j = d - k;
+              HYDRO_2D_IMPLICIT_BODY_TYPED(Data_type);
+            });
+          }
+
+        }); // end omp parallel region
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  HYDRO_2D_IMPLICIT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void HYDRO_2D_IMPLICIT::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
@@ -0,0 +1,106 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HYDRO_2D_IMPLICIT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <vector>
+
+#include <cmath>
+
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+HYDRO_2D_IMPLICIT::HYDRO_2D_IMPLICIT(const RunParams& params)
+  : KernelBase(rajaperf::Lcals_HYDRO_2D_IMPLICIT, params)
+{
+  m_jn = 1000;
+  m_kn = 1000;
+
+  setDefaultProblemSize(m_kn * m_jn);
+  setDefaultReps(100);
+
+  m_jn = m_kn = RAJA_MAX(std::sqrt(getTargetProblemSize()), 3);
+  m_array_length = m_kn * m_jn;
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  setItsPerRep( (m_kn-2) * (m_jn-2) );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * (m_kn-2) * (m_jn-2) +
+                  (0*sizeof(Real_type ) + 5*sizeof(Real_type )) * (m_kn-2) * (m_jn-2) );
+  setFLOPsPerRep(12 * (m_kn-2) * (m_jn-2));
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (1*data_size + 1*data_size) * (m_kn-2) * (m_jn-2) +
+                    (0*data_size + 5*data_size) * (m_kn-2) * (m_jn-2) );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
+}
+
+HYDRO_2D_IMPLICIT::~HYDRO_2D_IMPLICIT()
+{
+}
+
+void HYDRO_2D_IMPLICIT::setUp(VariantID vid)
+{
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitData(m_za, m_array_length, pid, vid);
+  allocAndInitData(m_zb, m_array_length, pid, vid);
+  allocAndInitData(m_zr, m_array_length, pid, vid);
+  allocAndInitData(m_zu, m_array_length, pid, vid);
+  allocAndInitData(m_zv, m_array_length, pid, vid);
+  allocAndInitData(m_zz, m_array_length, pid, vid);
+}
+
+void HYDRO_2D_IMPLICIT::updateChecksum(VariantID vid)
+{
+  checksum[vid] += calcChecksum(m_za, m_array_length, checksum_scale_factor );
+}
+
+void HYDRO_2D_IMPLICIT::tearDown(VariantID vid)
+{
+  (void) vid;
+  deallocData(m_za);
+  deallocData(m_zb);
+  deallocData(m_zr);
+  deallocData(m_zu);
+  deallocData(m_zv);
+  deallocData(m_zz);
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
@@ -0,0 +1,114 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// HYDRO_2D_IMPLICIT kernel reference implementation (Livermore loop 23):
+///
+/// for (Index_type k=1 ; k<kn-1 ; k++) {
+///   for (Index_type j=1 ; j<jn-1 ; j++) {
+///     Real_type qa = za[k+1][j]*zr[k][j] + za[k-1][j]*zb[k][j] +
+///                    za[k][j+1]*zu[k][j] + za[k][j-1]*zv[k][j] + zz[k][j];
+///     za[k][j] += 0.175*( qa - za[k][j] );
+///   }
+/// }
+///
+/// The update reads za values already updated on the same sweep
+/// (za[k-1][j], za[k][j-1]), so it is a Gauss-Seidel sweep. All points
+/// on an anti-diagonal k+j = d are independent and depend only on
+/// diagonal d-1; the parallel variants sweep the diagonals in order and
+/// update each one in parallel, reproducing the sequential result.
+///
+
+#ifndef RAJAPerf_Lcals_HYDRO_2D_IMPLICIT_HPP
+#define RAJAPerf_Lcals_HYDRO_2D_IMPLICIT_HPP
+
+
+#define HYDRO_2D_IMPLICIT_DATA_SETUP_TYPED(Data_type) \
+  Data_type* za = m_za.get<Data_type>(); \
+  Data_type* zb = m_zb.get<Data_type>(); \
+  Data_type* zr = m_zr.get<Data_type>(); \
+  Data_type* zu = m_zu.get<Data_type>(); \
+  Data_type* zv = m_zv.get<Data_type>(); \
+  Data_type* zz = m_zz.get<Data_type>(); \
+\
+  const Index_type jn = m_jn;
+
+#define HYDRO_2D_IMPLICIT_DATA_SETUP HYDRO_2D_IMPLICIT_DATA_SETUP_TYPED(Real_type)
+
+#define HYDRO_2D_IMPLICIT_BODY_TYPED(Data_type)  \
+  Data_type qa = za[j+(k+1)*jn]*zr[j+k*jn] + za[j+(k-1)*jn]*zb[j+k*jn] + \
+                 za[j+1+k*jn]*zu[j+k*jn] + za[j-1+k*jn]*zv[j+k*jn] + \
+                 zz[j+k*jn]; \
+  za[j+k*jn] += 0.175*( qa - za[j+k*jn] );
+
+#define HYDRO_2D_IMPLICIT_BODY HYDRO_2D_IMPLICIT_BODY_TYPED(Real_type)
+
+#define HYDRO_2D_IMPLICIT_DIAG_RANGE  \
+  const Index_type kfirst = RAJA_MAX(kbeg, d - jend + 1); \
+  const Index_type klast = RAJA_MIN(kend, d - jbeg + 1);
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace lcals
+{
+
+class HYDRO_2D_IMPLICIT : public KernelBase
+{
+public:
+
+  HYDRO_2D_IMPLICIT(const RunParams& params);
+
+  ~HYDRO_2D_IMPLICIT();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  HYDRO_2D_IMPLICIT : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  HYDRO_2D_IMPLICIT : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  HYDRO_2D_IMPLICIT : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_za;
+  Precision_ptr m_zb;
+  Precision_ptr m_zr;
+  Precision_ptr m_zu;
+  Precision_ptr m_zv;
+  Precision_ptr m_zz;
+
+  Index_type m_jn;
+  Index_type m_kn;
+
+  Index_type m_array_length;
+};
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,134 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "ICCG.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+template < typename Data_type >
+void ICCG::runOpenMPVariantPrecision(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  ICCG_DATA_SETUP_TYPED(Data_type);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type ii = n;
+        Index_type ipntp = 0;
+        do {
+          const Index_type ipnt = ipntp;
+          ipntp += ii;
+          ii /= 2;
+          const Index_type mend = (ipntp - ipnt) / 2;
+          #pragma omp parallel for
+          for (Index_type m = 0; m < mend; ++m ) {
+            ICCG_BODY;
+          }
+        } while ( ii > 1 );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type ii = n;
+        Index_type ipntp = 0;
+        do {
+          const Index_type ipnt = ipntp;
+          ipntp += ii;
+          ii /= 2;
+          const Index_type mend = (ipntp - ipnt) / 2;
+
+          auto iccg_lam = [=](Index_type m) {
+                            ICCG_BODY;
+                          };
+
+          #pragma omp parallel for
+          for (Index_type m = 0; m < mend; ++m ) {
+            iccg_lam(m);
+          }
+        } while ( ii > 1 );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type ii = n;
+        Index_type ipntp = 0;
+        do {
+          const Index_type ipnt = ipntp;
+          ipntp += ii;
+          ii /= 2;
+          const Index_type mend = (ipntp - ipnt) / 2;
+
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment(0, mend), [=](Index_type m) {
+            ICCG_BODY;
+          });
+        } while ( ii > 1 );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  ICCG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void ICCG::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
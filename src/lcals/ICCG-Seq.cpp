@@ -0,0 +1,125 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "ICCG.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+template < typename Data_type >
+void ICCG::runSeqVariantPrecision(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  ICCG_DATA_SETUP_TYPED(Data_type);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type ii = n;
+        Index_type ipntp = 0;
+        do {
+          const Index_type ipnt = ipntp;
+          ipntp += ii;
+          ii /= 2;
+          const Index_type mend = (ipntp - ipnt) / 2;
+          for (Index_type m = 0; m < mend; ++m ) {
+            ICCG_BODY;
+          }
+        } while ( ii > 1 );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type ii = n;
+        Index_type ipntp = 0;
+        do {
+          const Index_type ipnt = ipntp;
+          ipntp += ii;
+          ii /= 2;
+          const Index_type mend = (ipntp - ipnt) / 2;
+
+          auto iccg_lam = [=](Index_type m) {
+                            ICCG_BODY;
+                          };
+
+          for (Index_type m = 0; m < mend; ++m ) {
+            iccg_lam(m);
+          }
+        } while ( ii > 1 );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type ii = n;
+        Index_type ipntp = 0;
+        do {
+          const Index_type ipnt = ipntp;
+          ipntp += ii;
+          ii /= 2;
+          const Index_type mend = (ipntp - ipnt) / 2;
+
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(0, mend), [=](Index_type m) {
+            ICCG_BODY;
+          });
+        } while ( ii > 1 );
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  ICCG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void ICCG::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
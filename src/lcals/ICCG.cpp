@@ -0,0 +1,104 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "ICCG.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <vector>
+
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+ICCG::ICCG(const RunParams& params)
+  : KernelBase(rajaperf::Lcals_ICCG, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(500);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_n = getActualProblemSize();
+  m_array_length = 2 * m_n + 2;
+
+  //
+  // Each level reads the values produced by the previous one and
+  // produces half as many; count the work over all levels.
+  //
+  Index_type nits = 0;
+  Index_type nlevels = 0;
+  for (Index_type ii = m_n; ii > 1; ii /= 2) {
+    nits += ii / 2;
+    nlevels++;
+  }
+
+  setItsPerRep( nits );
+  setKernelsPerRep( nlevels );
+  setBytesPerRep( (1*sizeof(Real_type ) + 0*sizeof(Real_type )) * nits +
+                  (0*sizeof(Real_type ) + 2*sizeof(Real_type )) * 2 * nits );
+  setFLOPsPerRep(4 * nits);
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (1*data_size + 0*data_size) * nits +
+                    (0*data_size + 2*data_size) * 2 * nits );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
+}
+
+ICCG::~ICCG()
+{
+}
+
+void ICCG::setUp(VariantID vid)
+{
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitData(m_x, m_array_length, pid, vid);
+  allocAndInitData(m_v, m_array_length, pid, vid);
+}
+
+void ICCG::updateChecksum(VariantID vid)
+{
+  checksum[vid] += calcChecksum(m_x, m_array_length, checksum_scale_factor );
+}
+
+void ICCG::tearDown(VariantID vid)
+{
+  (void) vid;
+  deallocData(m_x);
+  deallocData(m_v);
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
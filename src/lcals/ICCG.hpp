@@ -0,0 +1,98 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// ICCG kernel reference implementation (Livermore loop 2):
+///
+/// Index_type ii = n;
+/// Index_type ipntp = 0;
+/// do {
+///   Index_type ipnt = ipntp;
+///   ipntp += ii;
+///   ii /= 2;
+///   Index_type i = ipntp;
+///   for (Index_type k = ipnt+1 ; k < ipntp ; k = k+2) {
+///     i++;
+///     x[i] = x[k] - v[k]*x[k-1] - v[k+1]*x[k+1];
+///   }
+/// } while ( ii > 1 );
+///
+/// Each pass through the do-loop is one level of the incomplete Cholesky
+/// reduction; the iterations within a level are independent.
+///
+
+#ifndef RAJAPerf_Lcals_ICCG_HPP
+#define RAJAPerf_Lcals_ICCG_HPP
+
+
+#define ICCG_DATA_SETUP_TYPED(Data_type) \
+  Data_type* x = m_x.get<Data_type>(); \
+  Data_type* v = m_v.get<Data_type>(); \
+\
+  const Index_type n = m_n;
+
+#define ICCG_DATA_SETUP ICCG_DATA_SETUP_TYPED(Real_type)
+
+#define ICCG_BODY  \
+  Index_type k = ipnt + 1 + 2*m; \
+  x[ipntp + 1 + m] = x[k] - v[k]*x[k-1] - v[k+1]*x[k+1];
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace lcals
+{
+
+class ICCG : public KernelBase
+{
+public:
+
+  ICCG(const RunParams& params);
+
+  ~ICCG();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  ICCG : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  ICCG : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  ICCG : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_x;
+  Precision_ptr m_v;
+
+  Index_type m_n;
+  Index_type m_array_length;
+};
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
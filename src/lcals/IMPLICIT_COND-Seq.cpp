@@ -0,0 +1,108 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "IMPLICIT_COND.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+template < typename Data_type >
+void IMPLICIT_COND::runSeqVariantPrecision(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  IMPLICIT_COND_DATA_SETUP_TYPED(Data_type);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type c = 0; c < nchains; ++c ) {
+          IMPLICIT_COND_BODY_INIT_TYPED(Data_type);
+          for (Index_type kk = len-1; kk > 0; --kk ) {
+            IMPLICIT_COND_BODY_TYPED(Data_type);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto implicit_cond_lam = [=](Index_type c) {
+                                 IMPLICIT_COND_BODY_INIT_TYPED(Data_type);
+                                 for (Index_type kk = len-1; kk > 0; --kk ) {
+                                   IMPLICIT_COND_BODY_TYPED(Data_type);
+                                 }
+                               };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type c = 0; c < nchains; ++c ) {
+          implicit_cond_lam(c);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nchains), [=](Index_type c) {
+          IMPLICIT_COND_BODY_INIT_TYPED(Data_type);
+          for (Index_type kk = len-1; kk > 0; --kk ) {
+            IMPLICIT_COND_BODY_TYPED(Data_type);
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  IMPLICIT_COND : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void IMPLICIT_COND::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
@@ -0,0 +1,108 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "IMPLICIT_COND.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <vector>
+
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+IMPLICIT_COND::IMPLICIT_COND(const RunParams& params)
+  : KernelBase(rajaperf::Lcals_IMPLICIT_COND, params)
+{
+  m_chain_len = 101;
+
+  m_scale = 5.0 / 3.0;
+  m_xnm_init = 1.0 / 3.0;
+  m_e6_init = 1.03 / 3.07;
+
+  setDefaultProblemSize(1000000);
+  setDefaultReps(200);
+
+  m_nchains = RAJA_MAX(getTargetProblemSize() / m_chain_len, 1);
+
+  setActualProblemSize( m_nchains * m_chain_len );
+
+  setItsPerRep( m_nchains * (m_chain_len-1) );
+  setKernelsPerRep(1);
+  setBytesPerRep( (3*sizeof(Real_type ) + 5*sizeof(Real_type )) * m_nchains * (m_chain_len-1) );
+  setFLOPsPerRep(6 * m_nchains * (m_chain_len-1));
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (3*data_size + 5*data_size) * m_nchains * (m_chain_len-1) );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
+}
+
+IMPLICIT_COND::~IMPLICIT_COND()
+{
+}
+
+void IMPLICIT_COND::setUp(VariantID vid)
+{
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitData(m_vlr, getActualProblemSize(), pid, vid);
+  allocAndInitData(m_vlin, getActualProblemSize(), pid, vid);
+  allocAndInitData(m_vxne, getActualProblemSize(), pid, vid);
+  allocAndInitDataConst(m_vxnd, getActualProblemSize(), 0.0, pid, vid);
+  allocAndInitDataConst(m_ve3, getActualProblemSize(), 0.0, pid, vid);
+  allocAndInitData(m_vsp, getActualProblemSize(), pid, vid);
+  allocAndInitData(m_vstp, getActualProblemSize(), pid, vid);
+}
+
+void IMPLICIT_COND::updateChecksum(VariantID vid)
+{
+  checksum[vid] += calcChecksum(m_vxne, getActualProblemSize(), checksum_scale_factor );
+  checksum[vid] += calcChecksum(m_vxnd, getActualProblemSize(), checksum_scale_factor );
+  checksum[vid] += calcChecksum(m_ve3, getActualProblemSize(), checksum_scale_factor );
+}
+
+void IMPLICIT_COND::tearDown(VariantID vid)
+{
+  (void) vid;
+  deallocData(m_vlr);
+  deallocData(m_vlin);
+  deallocData(m_vxne);
+  deallocData(m_vxnd);
+  deallocData(m_ve3);
+  deallocData(m_vsp);
+  deallocData(m_vstp);
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
@@ -0,0 +1,147 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// IMPLICIT_COND kernel reference implementation (Livermore loop 17):
+///
+/// Real_type xnm = 1.0/3.0;
+/// Real_type e6 = 1.03/3.07;
+/// for (Index_type k = len-1 ; k > 0 ; k--) {
+///   Real_type e3 = xnm*vlr[k] + vlin[k];
+///   Real_type xnei = vxne[k];
+///   vxnd[k] = e6;
+///   Real_type xnc = scale*e3;
+///   if ( xnm > xnc || xnei > xnc ) {
+///     e6 = xnm*vsp[k] + vstp[k];
+///     vxne[k] = e6;
+///     xnm = e6;
+///     ve3[k] = e6;
+///   } else {
+///     ve3[k] = e3;
+///     e6 = e3 + e3 - xnm;
+///     vxne[k] = e3 + e3 - xnei;
+///     xnm = e6;
+///   }
+/// }
+///
+/// The recurrence through xnm and e6 makes each sweep inherently serial,
+/// so the kernel runs a batch of independent chains of length len laid
+/// out one after another; chains are processed in parallel.
+///
+
+#ifndef RAJAPerf_Lcals_IMPLICIT_COND_HPP
+#define RAJAPerf_Lcals_IMPLICIT_COND_HPP
+
+
+#define IMPLICIT_COND_DATA_SETUP_TYPED(Data_type) \
+  Data_type* vlr = m_vlr.get<Data_type>(); \
+  Data_type* vlin = m_vlin.get<Data_type>(); \
+  Data_type* vxne = m_vxne.get<Data_type>(); \
+  Data_type* vxnd = m_vxnd.get<Data_type>(); \
+  Data_type* ve3 = m_ve3.get<Data_type>(); \
+  Data_type* vsp = m_vsp.get<Data_type>(); \
+  Data_type* vstp = m_vstp.get<Data_type>(); \
+\
+  const Data_type scale = m_scale; \
+  const Data_type xnm_init = m_xnm_init; \
+  const Data_type e6_init = m_e6_init; \
+\
+  const Index_type len = m_chain_len; \
+  const Index_type nchains = m_nchains;
+
+#define IMPLICIT_COND_DATA_SETUP IMPLICIT_COND_DATA_SETUP_TYPED(Real_type)
+
+#define IMPLICIT_COND_BODY_INIT_TYPED(Data_type)  \
+  Data_type xnm = xnm_init; \
+  Data_type e6 = e6_init;
+
+#define IMPLICIT_COND_BODY_INIT IMPLICIT_COND_BODY_INIT_TYPED(Real_type)
+
+#define IMPLICIT_COND_BODY_TYPED(Data_type)  \
+  const Index_type k = c*len + kk; \
+  Data_type e3 = xnm*vlr[k] + vlin[k]; \
+  Data_type xnei = vxne[k]; \
+  vxnd[k] = e6; \
+  Data_type xnc = scale*e3; \
+  if ( xnm > xnc || xnei > xnc ) { \
+    e6 = xnm*vsp[k] + vstp[k]; \
+    vxne[k] = e6; \
+    xnm = e6; \
+    ve3[k] = e6; \
+  } else { \
+    ve3[k] = e3; \
+    e6 = e3 + e3 - xnm; \
+    vxne[k] = e3 + e3 - xnei; \
+    xnm = e6; \
+  }
+
+#define IMPLICIT_COND_BODY IMPLICIT_COND_BODY_TYPED(Real_type)
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace lcals
+{
+
+class IMPLICIT_COND : public KernelBase
+{
+public:
+
+  IMPLICIT_COND(const RunParams& params);
+
+  ~IMPLICIT_COND();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  IMPLICIT_COND : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  IMPLICIT_COND : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  IMPLICIT_COND : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_vlr;
+  Precision_ptr m_vlin;
+  Precision_ptr m_vxne;
+  Precision_ptr m_vxnd;
+  Precision_ptr m_ve3;
+  Precision_ptr m_vsp;
+  Precision_ptr m_vstp;
+
+  Real_type m_scale;
+  Real_type m_xnm_init;
+  Real_type m_e6_init;
+
+  Index_type m_chain_len;
+  Index_type m_nchains;
+};
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
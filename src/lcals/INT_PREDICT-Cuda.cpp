@@ -28,10 +28,10 @@ namespace lcals
 
 
 #define INT_PREDICT_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(px, m_px, m_array_length);
+  allocAndInitCudaDeviceData(px, m_px.get<Real_type>(), m_array_length);
 
 #define INT_PREDICT_DATA_TEARDOWN_CUDA \
-  getCudaDeviceData(m_px, px, m_array_length); \
+  getCudaDeviceData(m_px.get<Real_type>(), px, m_array_length); \
   deallocCudaDeviceData(px);
 
 __global__ void int_predict(Real_ptr px,
@@ -28,10 +28,10 @@ namespace lcals
 
 
 #define INT_PREDICT_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(px, m_px, m_array_length);
+  allocAndInitHipDeviceData(px, m_px.get<Real_type>(), m_array_length);
 
 #define INT_PREDICT_DATA_TEARDOWN_HIP \
-  getHipDeviceData(m_px, px, m_array_length); \
+  getHipDeviceData(m_px.get<Real_type>(), px, m_array_length); \
   deallocHipDeviceData(px);
 
 __global__ void int_predict(Real_ptr px,
@@ -30,10 +30,10 @@ namespace lcals
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(px, m_px, m_array_length, did, hid);
+  allocAndInitOpenMPDeviceData(px, m_px.get<Real_type>(), m_array_length, did, hid);
 
 #define INT_PREDICT_DATA_TEARDOWN_OMP_TARGET \
-  getOpenMPDeviceData(m_px, px, m_array_length, hid, did); \
+  getOpenMPDeviceData(m_px.get<Real_type>(), px, m_array_length, hid, did); \
   deallocOpenMPDeviceData(px, did);
 
 
@@ -18,13 +18,14 @@ namespace lcals
 {
 
 
-void INT_PREDICT::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void INT_PREDICT::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  INT_PREDICT_DATA_SETUP;
+  INT_PREDICT_DATA_SETUP_TYPED(Data_type);
 
   auto intpredict_lam = [=](Index_type i) {
                           INT_PREDICT_BODY;
@@ -86,5 +87,13 @@ void INT_PREDICT::runSeqVariant(VariantID vid)
 
 }
 
+void INT_PREDICT::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
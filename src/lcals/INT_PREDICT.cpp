@@ -12,6 +12,8 @@
 
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 namespace lcals
@@ -49,6 +51,17 @@ INT_PREDICT::INT_PREDICT(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (1*data_size + 10*data_size) * getActualProblemSize() );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 INT_PREDICT::~INT_PREDICT()
@@ -57,11 +70,13 @@ INT_PREDICT::~INT_PREDICT()
 
 void INT_PREDICT::setUp(VariantID vid)
 {
+  const PrecisionID pid = getRunningPrecision();
+
   m_array_length = getActualProblemSize() * 13;
   m_offset = getActualProblemSize();
 
   m_px_initval = 1.0;
-  allocAndInitDataConst(m_px, m_array_length, m_px_initval, vid);
+  allocAndInitDataConst(m_px, m_array_length, m_px_initval, pid, vid);
 
   initData(m_dm22);
   initData(m_dm23);
@@ -75,8 +90,16 @@ void INT_PREDICT::setUp(VariantID vid)
 
 void INT_PREDICT::updateChecksum(VariantID vid)
 {
-  for (Index_type i = 0; i < getActualProblemSize(); ++i) {
-    m_px[i] -= m_px_initval;
+  if ( getRunningPrecision() == Precision_Float ) {
+    Float_ptr px = m_px.get<Float_type>();
+    for (Index_type i = 0; i < getActualProblemSize(); ++i) {
+      px[i] -= m_px_initval;
+    }
+  } else {
+    Double_ptr px = m_px.get<Double_type>();
+    for (Index_type i = 0; i < getActualProblemSize(); ++i) {
+      px[i] -= m_px_initval;
+    }
   }
 
   checksum[vid] += calcChecksum(m_px, getActualProblemSize());
@@ -25,18 +25,20 @@
 #define RAJAPerf_Lcals_INT_PREDICT_HPP
 
 
-#define INT_PREDICT_DATA_SETUP \
-  Real_ptr px = m_px; \
-  Real_type dm22 = m_dm22; \
-  Real_type dm23 = m_dm23; \
-  Real_type dm24 = m_dm24; \
-  Real_type dm25 = m_dm25; \
-  Real_type dm26 = m_dm26; \
-  Real_type dm27 = m_dm27; \
-  Real_type dm28 = m_dm28; \
-  Real_type c0 = m_c0; \
+#define INT_PREDICT_DATA_SETUP_TYPED(Data_type) \
+  Data_type* px = m_px.get<Data_type>(); \
+  Data_type dm22 = m_dm22; \
+  Data_type dm23 = m_dm23; \
+  Data_type dm24 = m_dm24; \
+  Data_type dm25 = m_dm25; \
+  Data_type dm26 = m_dm26; \
+  Data_type dm27 = m_dm27; \
+  Data_type dm28 = m_dm28; \
+  Data_type c0 = m_c0; \
   const Index_type offset = m_offset;
 
+#define INT_PREDICT_DATA_SETUP INT_PREDICT_DATA_SETUP_TYPED(Real_type)
+
 #define INT_PREDICT_BODY  \
   px[i] = dm28*px[i + offset * 12] + dm27*px[i + offset * 11] + \
           dm26*px[i + offset * 10] + dm25*px[i + offset *  9] + \
@@ -74,10 +76,15 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
   Index_type m_array_length;
   Index_type m_offset;
 
-  Real_ptr m_px;
+  Precision_ptr m_px;
   Real_type m_px_initval;
 
   Real_type m_dm22;
@@ -0,0 +1,96 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MAT_X_MAT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <vector>
+
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+MAT_X_MAT::MAT_X_MAT(const RunParams& params)
+  : KernelBase(rajaperf::Lcals_MAT_X_MAT, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(50);
+
+  m_n = RAJA_MAX(getTargetProblemSize() / 25, 1);
+
+  setActualProblemSize( m_n * 25 );
+
+  setItsPerRep( 25 * getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_n * 25 +
+                  (0*sizeof(Real_type ) + 1*sizeof(Real_type )) * 25 * 25 +
+                  (0*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_n * 25 );
+  setFLOPsPerRep(2 * 25 * getActualProblemSize());
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Kernel);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (1*data_size + 1*data_size) * m_n * 25 +
+                    (0*data_size + 1*data_size) * 25 * 25 +
+                    (0*data_size + 1*data_size) * m_n * 25 );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
+}
+
+MAT_X_MAT::~MAT_X_MAT()
+{
+}
+
+void MAT_X_MAT::setUp(VariantID vid)
+{
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitDataConst(m_px, m_n * 25, 0.0, pid, vid);
+  allocAndInitData(m_vy, 25 * 25, pid, vid);
+  allocAndInitData(m_cx, m_n * 25, pid, vid);
+}
+
+void MAT_X_MAT::updateChecksum(VariantID vid)
+{
+  checksum[vid] += calcChecksum(m_px, m_n * 25, checksum_scale_factor );
+}
+
+void MAT_X_MAT::tearDown(VariantID vid)
+{
+  (void) vid;
+  deallocData(m_px);
+  deallocData(m_vy);
+  deallocData(m_cx);
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
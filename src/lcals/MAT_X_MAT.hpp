@@ -0,0 +1,94 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// MAT_X_MAT kernel reference implementation (Livermore loop 21):
+///
+/// for (Index_type k = 0 ; k < 25 ; k++) {
+///   for (Index_type i = 0 ; i < 25 ; i++) {
+///     for (Index_type j = 0 ; j < n ; j++) {
+///       px[j][i] += vy[k][i] * cx[j][k];
+///     }
+///   }
+/// }
+///
+/// The loops are reordered below so the j loop is outermost (and is the
+/// one run in parallel); the order in which the k terms are summed into
+/// each px entry is unchanged.
+///
+
+#ifndef RAJAPerf_Lcals_MAT_X_MAT_HPP
+#define RAJAPerf_Lcals_MAT_X_MAT_HPP
+
+
+#define MAT_X_MAT_DATA_SETUP_TYPED(Data_type) \
+  Data_type* px = m_px.get<Data_type>(); \
+  Data_type* vy = m_vy.get<Data_type>(); \
+  Data_type* cx = m_cx.get<Data_type>(); \
+\
+  const Index_type n = m_n;
+
+#define MAT_X_MAT_DATA_SETUP MAT_X_MAT_DATA_SETUP_TYPED(Real_type)
+
+#define MAT_X_MAT_BODY  \
+  px[i + j*25] += vy[i + k*25] * cx[k + j*25];
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace lcals
+{
+
+class MAT_X_MAT : public KernelBase
+{
+public:
+
+  MAT_X_MAT(const RunParams& params);
+
+  ~MAT_X_MAT();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  MAT_X_MAT : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  MAT_X_MAT : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  MAT_X_MAT : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_px;
+  Precision_ptr m_vy;
+  Precision_ptr m_cx;
+
+  Index_type m_n;
+};
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
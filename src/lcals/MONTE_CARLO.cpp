@@ -0,0 +1,124 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "MONTE_CARLO.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <vector>
+
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+MONTE_CARLO::MONTE_CARLO(const RunParams& params)
+  : KernelBase(rajaperf::Lcals_MONTE_CARLO, params)
+{
+  m_nplanes = 64;
+  m_ncells = 32;
+  m_nplan = 1000;
+  m_nd = 1500;
+
+  m_r = 0.75;
+  m_s = 0.5;
+  m_t = 0.25;
+
+  setDefaultProblemSize(100000);
+  setDefaultReps(100);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  //
+  // Search lengths are data dependent; the counts below assume a
+  // single zone test per particle.
+  //
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (3*sizeof(Int_type  ) + 0*sizeof(Int_type  )) * getActualProblemSize() +
+                  (0*sizeof(Int_type  ) + 2*sizeof(Int_type  ) + 1*sizeof(Real_type )) * getActualProblemSize() );
+  setFLOPsPerRep(1 * getActualProblemSize());
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (3*sizeof(Int_type  ) + 0*sizeof(Int_type  )) * getActualProblemSize() +
+                    (0*sizeof(Int_type  ) + 2*sizeof(Int_type  ) + 1*data_size) * getActualProblemSize() );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
+}
+
+MONTE_CARLO::~MONTE_CARLO()
+{
+}
+
+void MONTE_CARLO::setUp(VariantID vid)
+{
+  const PrecisionID pid = getRunningPrecision();
+
+  const Index_type nzones = m_nplanes * m_ncells;
+
+  //
+  // Even entries of zone hold the crossing direction (randomly signed,
+  // never zero), odd entries the index of the boundary to test against.
+  //
+  allocAndInitData(m_zone, 2*nzones, vid);
+  for (Index_type q = 0; q < nzones; ++q) {
+    m_zone[2*q+1] = 4 + (q * 97) % (m_nd - 4);
+  }
+
+  allocAndInitDataRandValue(m_plan, m_nplan, pid, vid);
+  allocAndInitDataRandValue(m_d, m_nd, pid, vid);
+
+  allocAndInitDataConst(m_steps, getActualProblemSize(), 0, vid);
+  allocAndInitDataConst(m_nexpensive, getActualProblemSize(), 0, vid);
+  allocAndInitDataConst(m_loc, getActualProblemSize(), 0, vid);
+}
+
+void MONTE_CARLO::updateChecksum(VariantID vid)
+{
+  checksum[vid] += calcChecksum(m_steps, getActualProblemSize(), checksum_scale_factor );
+  checksum[vid] += calcChecksum(m_nexpensive, getActualProblemSize(), checksum_scale_factor );
+  checksum[vid] += calcChecksum(m_loc, getActualProblemSize(), checksum_scale_factor );
+}
+
+void MONTE_CARLO::tearDown(VariantID vid)
+{
+  (void) vid;
+  deallocData(m_zone);
+  deallocData(m_plan);
+  deallocData(m_d);
+  deallocData(m_steps);
+  deallocData(m_nexpensive);
+  deallocData(m_loc);
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
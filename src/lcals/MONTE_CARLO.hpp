@@ -0,0 +1,186 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// MONTE_CARLO kernel reference implementation (Livermore loop 16):
+///
+/// Livermore loop 16 follows a single particle through the zones of a
+/// set of planes, testing its position against the zone boundaries and
+/// either moving to the next zone, jumping to the next plane, or
+/// stopping. Here each of n particles performs the same search
+/// independently, starting on plane i % nplanes:
+///
+/// for (Index_type i = 0 ; i < n ; i++) {
+///   Index_type m = i % nplanes;
+///   Index_type k = 0;
+///   Int_type nsteps = 0;
+///   Int_type nexp = 0;
+///   bool done = false;
+///   while ( !done ) {
+///     Index_type j4 = 2*(m*ncells + k);
+///     Index_type j5 = zone[j4+1];
+///     Real_type tst;
+///     nsteps++;
+///     if      ( j5 < nlo )   { tst = plan[j5] - t; }
+///     else if ( j5 < nmid )  { tst = plan[j5] - s; }
+///     else if ( j5 < nplan ) { tst = plan[j5] - r; }
+///     else {
+///       nexp++;
+///       tst = d[j5] - ( d[j5-1]*(t - d[j5-2])*(t - d[j5-2]) +
+///                       (s - d[j5-3])*(s - d[j5-3]) +
+///                       (r - d[j5-4])*(r - d[j5-4]) );
+///     }
+///     if ( tst == 0.0 || zone[j4] == 0 ) {
+///       done = true;                                   // hit
+///     } else if ( (tst < 0.0) == (zone[j4] < 0) ) {
+///       k++;                                           // next zone
+///       done = ( k == ncells );
+///     } else {
+///       m = ( m+1 == nplanes ? 0 : m+1 );              // next plane
+///       k = 0;
+///       done = ( m == i % nplanes );
+///     }
+///   }
+///   steps[i] = nsteps;
+///   nexpensive[i] = nexp;
+///   loc[i] = m*ncells + k;
+/// }
+///
+/// Each plane is visited at most once per search, so every search
+/// terminates after at most nplanes*ncells steps.
+///
+
+#ifndef RAJAPerf_Lcals_MONTE_CARLO_HPP
+#define RAJAPerf_Lcals_MONTE_CARLO_HPP
+
+
+#define MONTE_CARLO_DATA_SETUP_TYPED(Data_type) \
+  Int_ptr zone = m_zone; \
+  Data_type* plan = m_plan.get<Data_type>(); \
+  Data_type* d = m_d.get<Data_type>(); \
+  Int_ptr steps = m_steps; \
+  Int_ptr nexpensive = m_nexpensive; \
+  Int_ptr loc = m_loc; \
+\
+  const Data_type r = m_r; \
+  const Data_type s = m_s; \
+  const Data_type t = m_t; \
+\
+  const Index_type nplanes = m_nplanes; \
+  const Index_type ncells = m_ncells; \
+  const Index_type nplan = m_nplan; \
+  const Index_type nlo = nplan / 3; \
+  const Index_type nmid = 2 * nplan / 3;
+
+#define MONTE_CARLO_DATA_SETUP MONTE_CARLO_DATA_SETUP_TYPED(Real_type)
+
+#define MONTE_CARLO_BODY_TYPED(Data_type)  \
+  const Index_type mstart = i % nplanes; \
+  Index_type m = mstart; \
+  Index_type k = 0; \
+  Int_type nsteps = 0; \
+  Int_type nexp = 0; \
+  bool done = false; \
+  while ( !done ) { \
+    const Index_type j4 = 2*(m*ncells + k); \
+    const Index_type j5 = zone[j4+1]; \
+    Data_type tst; \
+    nsteps++; \
+    if ( j5 < nlo ) { \
+      tst = plan[j5] - t; \
+    } else if ( j5 < nmid ) { \
+      tst = plan[j5] - s; \
+    } else if ( j5 < nplan ) { \
+      tst = plan[j5] - r; \
+    } else { \
+      nexp++; \
+      tst = d[j5] - ( d[j5-1]*(t - d[j5-2])*(t - d[j5-2]) + \
+                      (s - d[j5-3])*(s - d[j5-3]) + \
+                      (r - d[j5-4])*(r - d[j5-4]) ); \
+    } \
+    if ( tst == 0.0 || zone[j4] == 0 ) { \
+      done = true; \
+    } else if ( (tst < 0.0) == (zone[j4] < 0) ) { \
+      k++; \
+      done = ( k == ncells ); \
+    } else { \
+      m = ( m+1 == nplanes ? 0 : m+1 ); \
+      k = 0; \
+      done = ( m == mstart ); \
+    } \
+  } \
+  steps[i] = nsteps; \
+  nexpensive[i] = nexp; \
+  loc[i] = m*ncells + k;
+
+#define MONTE_CARLO_BODY MONTE_CARLO_BODY_TYPED(Real_type)
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace lcals
+{
+
+class MONTE_CARLO : public KernelBase
+{
+public:
+
+  MONTE_CARLO(const RunParams& params);
+
+  ~MONTE_CARLO();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  MONTE_CARLO : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  MONTE_CARLO : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  MONTE_CARLO : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Int_ptr m_zone;
+  Precision_ptr m_plan;
+  Precision_ptr m_d;
+  Int_ptr m_steps;
+  Int_ptr m_nexpensive;
+  Int_ptr m_loc;
+
+  Real_type m_r;
+  Real_type m_s;
+  Real_type m_t;
+
+  Index_type m_nplanes;
+  Index_type m_ncells;
+  Index_type m_nplan;
+  Index_type m_nd;
+};
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,145 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PIC_1D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <vector>
+
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+template < typename Data_type >
+static void scatterParticles(Data_type* grd, Index_type n,
+                             Index_type grid_size)
+{
+  for (Index_type i = 0; i < n; ++i) {
+    grd[i] += 1.0 + static_cast<Data_type>( (i * 1021) % grid_size );
+  }
+}
+
+
+PIC_1D::PIC_1D(const RunParams& params)
+  : KernelBase(rajaperf::Lcals_PIC_1D, params)
+{
+  m_grid_size = 2048;
+
+  setDefaultProblemSize(1000000);
+  setDefaultReps(100);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  setItsPerRep( 3 * getActualProblemSize() );
+  setKernelsPerRep(3);
+  setBytesPerRep( (5*sizeof(Real_type ) + 1*sizeof(Int_type  )) * getActualProblemSize() +
+                  (3*sizeof(Real_type ) + 0*sizeof(Int_type  )) * getActualProblemSize() +
+                  (3*sizeof(Real_type ) + 1*sizeof(Int_type  )) * getActualProblemSize() +
+                  (5*sizeof(Real_type ) + 0*sizeof(Int_type  )) * getActualProblemSize() +
+                  (1*sizeof(Real_type ) + 1*sizeof(Int_type  )) * getActualProblemSize() +
+                  (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * (m_grid_size+1) );
+  setFLOPsPerRep(11 * getActualProblemSize());
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+  setUsesFeature(Atomic);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (5*data_size + 1*sizeof(Int_type  )) * getActualProblemSize() +
+                    (3*data_size + 0*sizeof(Int_type  )) * getActualProblemSize() +
+                    (3*data_size + 1*sizeof(Int_type  )) * getActualProblemSize() +
+                    (5*data_size + 0*sizeof(Int_type  )) * getActualProblemSize() +
+                    (1*data_size + 1*sizeof(Int_type  )) * getActualProblemSize() +
+                    (1*data_size + 1*data_size) * (m_grid_size+1) );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
+}
+
+PIC_1D::~PIC_1D()
+{
+}
+
+void PIC_1D::setUp(VariantID vid)
+{
+  const PrecisionID pid = getRunningPrecision();
+
+  const Index_type n = getActualProblemSize();
+
+  allocAndInitDataConst(m_vx, n, 0.0, pid, vid);
+  allocAndInitDataConst(m_xx, n, 0.0, pid, vid);
+  allocAndInitDataConst(m_xi, n, 0.0, pid, vid);
+  allocAndInitDataConst(m_ex1, n, 0.0, pid, vid);
+  allocAndInitDataConst(m_dex1, n, 0.0, pid, vid);
+  allocAndInitDataConst(m_rx, n, 0.0, pid, vid);
+  allocAndInitDataConst(m_ix, n, 0, vid);
+  allocAndInitDataConst(m_ir, n, 0, vid);
+
+  allocAndInitData(m_ex, m_grid_size, pid, vid);
+  allocAndInitData(m_dex, m_grid_size, pid, vid);
+  allocAndInitDataConst(m_rh, m_grid_size+1, 0.0, pid, vid);
+
+  //
+  // Scatter particle positions over the grid, (1.0, m_grid_size+1.0).
+  //
+  allocAndInitData(m_grd, n, pid, vid);
+  if ( pid == Precision_Float ) {
+    scatterParticles(m_grd.get<Float_type>(), n, m_grid_size);
+  } else {
+    scatterParticles(m_grd.get<Double_type>(), n, m_grid_size);
+  }
+
+  initData(m_flx, vid);
+}
+
+void PIC_1D::updateChecksum(VariantID vid)
+{
+  checksum[vid] += calcChecksum(m_xx, getActualProblemSize(), checksum_scale_factor );
+  checksum[vid] += calcChecksum(m_rh, m_grid_size+1, checksum_scale_factor );
+}
+
+void PIC_1D::tearDown(VariantID vid)
+{
+  (void) vid;
+  deallocData(m_vx);
+  deallocData(m_xx);
+  deallocData(m_xi);
+  deallocData(m_ex1);
+  deallocData(m_dex1);
+  deallocData(m_rx);
+  deallocData(m_ix);
+  deallocData(m_ir);
+  deallocData(m_ex);
+  deallocData(m_dex);
+  deallocData(m_rh);
+  deallocData(m_grd);
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
@@ -0,0 +1,154 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// PIC_1D kernel reference implementation (Livermore loop 14):
+///
+/// for (Index_type i = 0 ; i < n ; i++) {
+///   vx[i] = 0.0;
+///   xx[i] = 0.0;
+///   ix[i] = (Int_type) grd[i];
+///   xi[i] = (Real_type) ix[i];
+///   ex1[i] = ex[ ix[i] - 1 ];
+///   dex1[i] = dex[ ix[i] - 1 ];
+/// }
+///
+/// for (Index_type i = 0 ; i < n ; i++) {
+///   vx[i] = vx[i] + ex1[i] + ( xx[i] - xi[i] )*dex1[i];
+///   xx[i] = xx[i] + vx[i] + flx;
+///   ir[i] = (Int_type) xx[i];
+///   rx[i] = xx[i] - ir[i];
+///   ir[i] = ( ir[i] & 2047 ) + 1;
+///   xx[i] = rx[i] + ir[i];
+/// }
+///
+/// for (Index_type i = 0 ; i < n ; i++) {
+///   rh[ ir[i] - 1 ] += 1.0 - rx[i];
+///   rh[ ir[i] ] += rx[i];
+/// }
+///
+/// The first loop gathers field values from the grid, the last one
+/// scatters charge back to it. Several particles may deposit to the
+/// same grid cell, so parallel variants use atomics in the last loop.
+///
+
+#ifndef RAJAPerf_Lcals_PIC_1D_HPP
+#define RAJAPerf_Lcals_PIC_1D_HPP
+
+
+#define PIC_1D_DATA_SETUP_TYPED(Data_type) \
+  Data_type* vx = m_vx.get<Data_type>(); \
+  Data_type* xx = m_xx.get<Data_type>(); \
+  Data_type* xi = m_xi.get<Data_type>(); \
+  Data_type* ex1 = m_ex1.get<Data_type>(); \
+  Data_type* dex1 = m_dex1.get<Data_type>(); \
+  Data_type* rx = m_rx.get<Data_type>(); \
+  Data_type* grd = m_grd.get<Data_type>(); \
+  Data_type* ex = m_ex.get<Data_type>(); \
+  Data_type* dex = m_dex.get<Data_type>(); \
+  Data_type* rh = m_rh.get<Data_type>(); \
+  Int_ptr ix = m_ix; \
+  Int_ptr ir = m_ir; \
+\
+  const Data_type flx = m_flx;
+
+#define PIC_1D_DATA_SETUP PIC_1D_DATA_SETUP_TYPED(Real_type)
+
+#define PIC_1D_BODY1_TYPED(Data_type)  \
+  vx[i] = 0.0; \
+  xx[i] = 0.0; \
+  ix[i] = static_cast<Int_type>( grd[i] ); \
+  xi[i] = static_cast<Data_type>( ix[i] ); \
+  ex1[i] = ex[ ix[i] - 1 ]; \
+  dex1[i] = dex[ ix[i] - 1 ];
+
+#define PIC_1D_BODY1 PIC_1D_BODY1_TYPED(Real_type)
+
+#define PIC_1D_BODY2  \
+  vx[i] = vx[i] + ex1[i] + ( xx[i] - xi[i] )*dex1[i]; \
+  xx[i] = xx[i] + vx[i] + flx; \
+  ir[i] = static_cast<Int_type>( xx[i] ); \
+  rx[i] = xx[i] - ir[i]; \
+  ir[i] = ( ir[i] & 2047 ) + 1; \
+  xx[i] = rx[i] + ir[i];
+
+#define PIC_1D_BODY3  \
+  rh[ ir[i] - 1 ] += 1.0 - rx[i]; \
+  rh[ ir[i] ] += rx[i];
+
+#define PIC_1D_BODY3_ATOMIC_TYPED(Data_type, policy)  \
+  RAJA::atomicAdd<policy>(&rh[ ir[i] - 1 ], Data_type(1.0) - rx[i]); \
+  RAJA::atomicAdd<policy>(&rh[ ir[i] ], rx[i]);
+
+#define PIC_1D_BODY3_ATOMIC(policy) PIC_1D_BODY3_ATOMIC_TYPED(Real_type, policy)
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace lcals
+{
+
+class PIC_1D : public KernelBase
+{
+public:
+
+  PIC_1D(const RunParams& params);
+
+  ~PIC_1D();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  PIC_1D : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  PIC_1D : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  PIC_1D : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_vx;
+  Precision_ptr m_xx;
+  Precision_ptr m_xi;
+  Precision_ptr m_ex1;
+  Precision_ptr m_dex1;
+  Precision_ptr m_rx;
+  Precision_ptr m_grd;
+  Precision_ptr m_ex;
+  Precision_ptr m_dex;
+  Precision_ptr m_rh;
+  Int_ptr m_ix;
+  Int_ptr m_ir;
+
+  Real_type m_flx;
+
+  Index_type m_grid_size;
+};
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,126 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PIC_2D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <vector>
+
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+template < typename Data_type >
+static void spreadParticles(Data_type* p, Index_type n)
+{
+  for (Index_type ip = 0; ip < n; ++ip) {
+    p[4*ip]   += static_cast<Data_type>( (ip * 37) % 64 );
+    p[4*ip+1] += static_cast<Data_type>( (ip * 23 + ip / 64) % 64 );
+  }
+}
+
+
+PIC_2D::PIC_2D(const RunParams& params)
+  : KernelBase(rajaperf::Lcals_PIC_2D, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(100);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (4*sizeof(Real_type ) + 4*sizeof(Real_type )) * getActualProblemSize() +
+                  (0*sizeof(Real_type ) + 4*sizeof(Real_type ) + 2*sizeof(Int_type  )) * getActualProblemSize() +
+                  (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * getActualProblemSize() );
+  setFLOPsPerRep(7 * getActualProblemSize());
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+  setUsesFeature(Atomic);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (4*data_size + 4*data_size) * getActualProblemSize() +
+                    (0*data_size + 4*data_size + 2*sizeof(Int_type  )) * getActualProblemSize() +
+                    (1*data_size + 1*data_size) * getActualProblemSize() );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
+}
+
+PIC_2D::~PIC_2D()
+{
+}
+
+void PIC_2D::setUp(VariantID vid)
+{
+  const PrecisionID pid = getRunningPrecision();
+
+  const Index_type n = getActualProblemSize();
+
+  //
+  // Spread the initial particle positions over the 64x64 grid.
+  //
+  allocAndInitData(m_p, 4*n, pid, vid);
+  if ( pid == Precision_Float ) {
+    spreadParticles(m_p.get<Float_type>(), n);
+  } else {
+    spreadParticles(m_p.get<Double_type>(), n);
+  }
+
+  allocAndInitData(m_b, 64*64, pid, vid);
+  allocAndInitData(m_c, 64*64, pid, vid);
+  allocAndInitData(m_y, 96, pid, vid);
+  allocAndInitData(m_z, 96, pid, vid);
+  allocAndInitData(m_e, 96, vid);
+  allocAndInitData(m_f, 96, vid);
+  allocAndInitDataConst(m_h, 64*64, 0.0, pid, vid);
+}
+
+void PIC_2D::updateChecksum(VariantID vid)
+{
+  checksum[vid] += calcChecksum(m_p, 4*getActualProblemSize(), checksum_scale_factor );
+  checksum[vid] += calcChecksum(m_h, 64*64, checksum_scale_factor );
+}
+
+void PIC_2D::tearDown(VariantID vid)
+{
+  (void) vid;
+  deallocData(m_p);
+  deallocData(m_b);
+  deallocData(m_c);
+  deallocData(m_y);
+  deallocData(m_z);
+  deallocData(m_e);
+  deallocData(m_f);
+  deallocData(m_h);
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
@@ -0,0 +1,128 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// PIC_2D kernel reference implementation (Livermore loop 13):
+///
+/// for (Index_type ip = 0 ; ip < n ; ip++) {
+///   Index_type i1 = (Index_type) p[ip][0] & 63;
+///   Index_type j1 = (Index_type) p[ip][1] & 63;
+///   p[ip][2] += b[j1][i1];
+///   p[ip][3] += c[j1][i1];
+///   p[ip][0] += p[ip][2];
+///   p[ip][1] += p[ip][3];
+///   Index_type i2 = (Index_type) p[ip][0] & 63;
+///   Index_type j2 = (Index_type) p[ip][1] & 63;
+///   p[ip][0] += y[i2+32];
+///   p[ip][1] += z[j2+32];
+///   i2 = ( i2 + e[i2+32] ) & 63;
+///   j2 = ( j2 + f[j2+32] ) & 63;
+///   h[j2][i2] += 1.0;
+/// }
+///
+/// The original loop relies on e and f keeping the deposit on the 64x64
+/// grid; here the shifted cell index is wrapped explicitly. Several
+/// particles may deposit to the same cell, so parallel variants update
+/// h atomically.
+///
+
+#ifndef RAJAPerf_Lcals_PIC_2D_HPP
+#define RAJAPerf_Lcals_PIC_2D_HPP
+
+
+#define PIC_2D_DATA_SETUP_TYPED(Data_type) \
+  Data_type* p = m_p.get<Data_type>(); \
+  Data_type* b = m_b.get<Data_type>(); \
+  Data_type* c = m_c.get<Data_type>(); \
+  Data_type* y = m_y.get<Data_type>(); \
+  Data_type* z = m_z.get<Data_type>(); \
+  Data_type* h = m_h.get<Data_type>(); \
+  Int_ptr e = m_e; \
+  Int_ptr f = m_f;
+
+#define PIC_2D_DATA_SETUP PIC_2D_DATA_SETUP_TYPED(Real_type)
+
+#define PIC_2D_BODY1  \
+  Index_type i1 = static_cast<Index_type>( p[4*ip] ) & 63; \
+  Index_type j1 = static_cast<Index_type>( p[4*ip+1] ) & 63; \
+  p[4*ip+2] += b[i1 + 64*j1]; \
+  p[4*ip+3] += c[i1 + 64*j1]; \
+  p[4*ip] += p[4*ip+2]; \
+  p[4*ip+1] += p[4*ip+3]; \
+  Index_type i2 = static_cast<Index_type>( p[4*ip] ) & 63; \
+  Index_type j2 = static_cast<Index_type>( p[4*ip+1] ) & 63; \
+  p[4*ip] += y[i2+32]; \
+  p[4*ip+1] += z[j2+32]; \
+  i2 = ( i2 + e[i2+32] ) & 63; \
+  j2 = ( j2 + f[j2+32] ) & 63;
+
+#define PIC_2D_BODY2  \
+  h[i2 + 64*j2] += 1.0;
+
+#define PIC_2D_BODY2_ATOMIC_TYPED(Data_type, policy)  \
+  RAJA::atomicAdd<policy>(&h[i2 + 64*j2], Data_type(1.0));
+
+#define PIC_2D_BODY2_ATOMIC(policy) PIC_2D_BODY2_ATOMIC_TYPED(Real_type, policy)
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace lcals
+{
+
+class PIC_2D : public KernelBase
+{
+public:
+
+  PIC_2D(const RunParams& params);
+
+  ~PIC_2D();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  PIC_2D : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  PIC_2D : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  PIC_2D : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_p;
+  Precision_ptr m_b;
+  Precision_ptr m_c;
+  Precision_ptr m_y;
+  Precision_ptr m_z;
+  Precision_ptr m_h;
+  Int_ptr m_e;
+  Int_ptr m_f;
+};
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -29,14 +29,14 @@ namespace lcals
 
 
 #define PLANCKIAN_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(x, m_x, iend); \
-  allocAndInitCudaDeviceData(y, m_y, iend); \
-  allocAndInitCudaDeviceData(u, m_u, iend); \
-  allocAndInitCudaDeviceData(v, m_v, iend); \
-  allocAndInitCudaDeviceData(w, m_w, iend);
+  allocAndInitCudaDeviceData(x, m_x.get<Real_type>(), iend); \
+  allocAndInitCudaDeviceData(y, m_y.get<Real_type>(), iend); \
+  allocAndInitCudaDeviceData(u, m_u.get<Real_type>(), iend); \
+  allocAndInitCudaDeviceData(v, m_v.get<Real_type>(), iend); \
+  allocAndInitCudaDeviceData(w, m_w.get<Real_type>(), iend);
 
 #define PLANCKIAN_DATA_TEARDOWN_CUDA \
-  getCudaDeviceData(m_w, w, iend); \
+  getCudaDeviceData(m_w.get<Real_type>(), w, iend); \
   deallocCudaDeviceData(x); \
   deallocCudaDeviceData(y); \
   deallocCudaDeviceData(u); \
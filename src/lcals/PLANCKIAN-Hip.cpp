@@ -29,14 +29,14 @@ namespace lcals
 
 
 #define PLANCKIAN_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(x, m_x, iend); \
-  allocAndInitHipDeviceData(y, m_y, iend); \
-  allocAndInitHipDeviceData(u, m_u, iend); \
-  allocAndInitHipDeviceData(v, m_v, iend); \
-  allocAndInitHipDeviceData(w, m_w, iend);
+  allocAndInitHipDeviceData(x, m_x.get<Real_type>(), iend); \
+  allocAndInitHipDeviceData(y, m_y.get<Real_type>(), iend); \
+  allocAndInitHipDeviceData(u, m_u.get<Real_type>(), iend); \
+  allocAndInitHipDeviceData(v, m_v.get<Real_type>(), iend); \
+  allocAndInitHipDeviceData(w, m_w.get<Real_type>(), iend);
 
 #define PLANCKIAN_DATA_TEARDOWN_HIP \
-  getHipDeviceData(m_w, w, iend); \
+  getHipDeviceData(m_w.get<Real_type>(), w, iend); \
   deallocHipDeviceData(x); \
   deallocHipDeviceData(y); \
   deallocHipDeviceData(u); \
@@ -31,14 +31,14 @@ namespace lcals
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(x, m_x, iend, did, hid); \
-  allocAndInitOpenMPDeviceData(y, m_y, iend, did, hid); \
-  allocAndInitOpenMPDeviceData(u, m_u, iend, did, hid); \
-  allocAndInitOpenMPDeviceData(v, m_v, iend, did, hid); \
-  allocAndInitOpenMPDeviceData(w, m_w, iend, did, hid);
+  allocAndInitOpenMPDeviceData(x, m_x.get<Real_type>(), iend, did, hid); \
+  allocAndInitOpenMPDeviceData(y, m_y.get<Real_type>(), iend, did, hid); \
+  allocAndInitOpenMPDeviceData(u, m_u.get<Real_type>(), iend, did, hid); \
+  allocAndInitOpenMPDeviceData(v, m_v.get<Real_type>(), iend, did, hid); \
+  allocAndInitOpenMPDeviceData(w, m_w.get<Real_type>(), iend, did, hid);
 
 #define PLANCKIAN_DATA_TEARDOWN_OMP_TARGET \
-  getOpenMPDeviceData(m_w, w, iend, hid, did); \
+  getOpenMPDeviceData(m_w.get<Real_type>(), w, iend, hid, did); \
   deallocOpenMPDeviceData(x, did); \
   deallocOpenMPDeviceData(y, did); \
   deallocOpenMPDeviceData(u, did); \
@@ -19,13 +19,14 @@ namespace lcals
 {
 
 
-void PLANCKIAN::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void PLANCKIAN::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  PLANCKIAN_DATA_SETUP;
+  PLANCKIAN_DATA_SETUP_TYPED(Data_type);
 
   auto planckian_lam = [=](Index_type i) {
                          PLANCKIAN_BODY;
@@ -87,5 +88,13 @@ void PLANCKIAN::runSeqVariant(VariantID vid)
 
 }
 
+void PLANCKIAN::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
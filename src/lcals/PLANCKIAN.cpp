@@ -12,6 +12,8 @@
 
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 namespace lcals
@@ -49,6 +51,17 @@ PLANCKIAN::PLANCKIAN(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (2*data_size + 3*data_size) * getActualProblemSize() );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 PLANCKIAN::~PLANCKIAN()
@@ -57,11 +70,13 @@ PLANCKIAN::~PLANCKIAN()
 
 void PLANCKIAN::setUp(VariantID vid)
 {
-  allocAndInitData(m_x, getActualProblemSize(), vid);
-  allocAndInitData(m_y, getActualProblemSize(), vid);
-  allocAndInitData(m_u, getActualProblemSize(), vid);
-  allocAndInitData(m_v, getActualProblemSize(), vid);
-  allocAndInitDataConst(m_w, getActualProblemSize(), 0.0, vid);
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitData(m_x, getActualProblemSize(), pid, vid);
+  allocAndInitData(m_y, getActualProblemSize(), pid, vid);
+  allocAndInitData(m_u, getActualProblemSize(), pid, vid);
+  allocAndInitData(m_v, getActualProblemSize(), pid, vid);
+  allocAndInitDataConst(m_w, getActualProblemSize(), 0.0, pid, vid);
 }
 
 void PLANCKIAN::updateChecksum(VariantID vid)
@@ -19,12 +19,14 @@
 #define RAJAPerf_Lcals_PLANCKIAN_HPP
 
 
-#define PLANCKIAN_DATA_SETUP \
-  Real_ptr x = m_x; \
-  Real_ptr y = m_y; \
-  Real_ptr u = m_u; \
-  Real_ptr v = m_v; \
-  Real_ptr w = m_w;
+#define PLANCKIAN_DATA_SETUP_TYPED(Data_type) \
+  Data_type* x = m_x.get<Data_type>(); \
+  Data_type* y = m_y.get<Data_type>(); \
+  Data_type* u = m_u.get<Data_type>(); \
+  Data_type* v = m_v.get<Data_type>(); \
+  Data_type* w = m_w.get<Data_type>();
+
+#define PLANCKIAN_DATA_SETUP PLANCKIAN_DATA_SETUP_TYPED(Real_type)
 
 #define PLANCKIAN_BODY  \
   y[i] = u[i] / v[i]; \
@@ -59,11 +61,16 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
-  Real_ptr m_x;
-  Real_ptr m_y;
-  Real_ptr m_u;
-  Real_ptr m_v;
-  Real_ptr m_w;
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_x;
+  Precision_ptr m_y;
+  Precision_ptr m_u;
+  Precision_ptr m_v;
+  Precision_ptr m_w;
 };
 
 } // end namespace lcals
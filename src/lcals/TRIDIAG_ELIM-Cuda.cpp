@@ -28,13 +28,13 @@ namespace lcals
 
 
 #define TRIDIAG_ELIM_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(xout, m_xout, m_N); \
-  allocAndInitCudaDeviceData(xin, m_xin, m_N); \
-  allocAndInitCudaDeviceData(y, m_y, m_N); \
-  allocAndInitCudaDeviceData(z, m_z, m_N);
+  allocAndInitCudaDeviceData(xout, m_xout.get<Real_type>(), m_N); \
+  allocAndInitCudaDeviceData(xin, m_xin.get<Real_type>(), m_N); \
+  allocAndInitCudaDeviceData(y, m_y.get<Real_type>(), m_N); \
+  allocAndInitCudaDeviceData(z, m_z.get<Real_type>(), m_N);
 
 #define TRIDIAG_ELIM_DATA_TEARDOWN_CUDA \
-  getCudaDeviceData(m_xout, xout, m_N); \
+  getCudaDeviceData(m_xout.get<Real_type>(), xout, m_N); \
   deallocCudaDeviceData(xout); \
   deallocCudaDeviceData(xin); \
   deallocCudaDeviceData(y); \
@@ -28,13 +28,13 @@ namespace lcals
 
 
 #define TRIDIAG_ELIM_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(xout, m_xout, m_N); \
-  allocAndInitHipDeviceData(xin, m_xin, m_N); \
-  allocAndInitHipDeviceData(y, m_y, m_N); \
-  allocAndInitHipDeviceData(z, m_z, m_N);
+  allocAndInitHipDeviceData(xout, m_xout.get<Real_type>(), m_N); \
+  allocAndInitHipDeviceData(xin, m_xin.get<Real_type>(), m_N); \
+  allocAndInitHipDeviceData(y, m_y.get<Real_type>(), m_N); \
+  allocAndInitHipDeviceData(z, m_z.get<Real_type>(), m_N);
 
 #define TRIDIAG_ELIM_DATA_TEARDOWN_HIP \
-  getHipDeviceData(m_xout, xout, m_N); \
+  getHipDeviceData(m_xout.get<Real_type>(), xout, m_N); \
   deallocHipDeviceData(xout); \
   deallocHipDeviceData(xin); \
   deallocHipDeviceData(y); \
@@ -18,15 +18,16 @@ namespace lcals
 {
 
 
-void TRIDIAG_ELIM::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void TRIDIAG_ELIM::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 1;
   const Index_type iend = m_N;
 
-  TRIDIAG_ELIM_DATA_SETUP;
+  TRIDIAG_ELIM_DATA_SETUP_TYPED(Data_type);
 
   auto tridiag_elim_lam = [=](Index_type i) {
                             TRIDIAG_ELIM_BODY;
@@ -85,6 +86,18 @@ void TRIDIAG_ELIM::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void TRIDIAG_ELIM::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
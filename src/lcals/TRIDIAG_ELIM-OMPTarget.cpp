@@ -30,13 +30,13 @@ namespace lcals
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(xout, m_xout, m_N, did, hid); \
-  allocAndInitOpenMPDeviceData(xin, m_xin, m_N, did, hid); \
-  allocAndInitOpenMPDeviceData(y, m_y, m_N, did, hid); \
-  allocAndInitOpenMPDeviceData(z, m_z, m_N, did, hid);
+  allocAndInitOpenMPDeviceData(xout, m_xout.get<Real_type>(), m_N, did, hid); \
+  allocAndInitOpenMPDeviceData(xin, m_xin.get<Real_type>(), m_N, did, hid); \
+  allocAndInitOpenMPDeviceData(y, m_y.get<Real_type>(), m_N, did, hid); \
+  allocAndInitOpenMPDeviceData(z, m_z.get<Real_type>(), m_N, did, hid);
 
 #define TRIDIAG_ELIM_DATA_TEARDOWN_OMP_TARGET \
-  getOpenMPDeviceData(m_xout, xout, m_N, hid, did); \
+  getOpenMPDeviceData(m_xout.get<Real_type>(), xout, m_N, hid, did); \
   deallocOpenMPDeviceData(xout, did); \
   deallocOpenMPDeviceData(xin, did); \
   deallocOpenMPDeviceData(y, did); \
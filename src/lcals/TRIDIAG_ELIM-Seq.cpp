@@ -18,13 +18,14 @@ namespace lcals
 {
 
 
-void TRIDIAG_ELIM::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void TRIDIAG_ELIM::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 1;
   const Index_type iend = m_N;
 
-  TRIDIAG_ELIM_DATA_SETUP;
+  TRIDIAG_ELIM_DATA_SETUP_TYPED(Data_type);
 
   auto tridiag_elim_lam = [=](Index_type i) {
                             TRIDIAG_ELIM_BODY;
@@ -86,5 +87,13 @@ void TRIDIAG_ELIM::runSeqVariant(VariantID vid)
 
 }
 
+void TRIDIAG_ELIM::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
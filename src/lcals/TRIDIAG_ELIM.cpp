@@ -12,6 +12,8 @@
 
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 namespace lcals
@@ -51,6 +53,17 @@ TRIDIAG_ELIM::TRIDIAG_ELIM(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (1*data_size + 3*data_size) * (m_N-1) );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 TRIDIAG_ELIM::~TRIDIAG_ELIM()
@@ -59,10 +72,12 @@ TRIDIAG_ELIM::~TRIDIAG_ELIM()
 
 void TRIDIAG_ELIM::setUp(VariantID vid)
 {
-  allocAndInitDataConst(m_xout, m_N, 0.0, vid);
-  allocAndInitData(m_xin, m_N, vid);
-  allocAndInitData(m_y, m_N, vid);
-  allocAndInitData(m_z, m_N, vid);
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitDataConst(m_xout, m_N, 0.0, pid, vid);
+  allocAndInitData(m_xin, m_N, pid, vid);
+  allocAndInitData(m_y, m_N, pid, vid);
+  allocAndInitData(m_z, m_N, pid, vid);
 }
 
 void TRIDIAG_ELIM::updateChecksum(VariantID vid)
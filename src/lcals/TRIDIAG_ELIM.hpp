@@ -21,11 +21,13 @@
 #define RAJAPerf_Lcals_TRIDIAG_ELIM_HPP
 
 
-#define TRIDIAG_ELIM_DATA_SETUP \
-  Real_ptr xout = m_xout; \
-  Real_ptr xin = m_xin; \
-  Real_ptr y = m_y; \
-  Real_ptr z = m_z;
+#define TRIDIAG_ELIM_DATA_SETUP_TYPED(Data_type) \
+  Data_type* xout = m_xout.get<Data_type>(); \
+  Data_type* xin = m_xin.get<Data_type>(); \
+  Data_type* y = m_y.get<Data_type>(); \
+  Data_type* z = m_z.get<Data_type>();
+
+#define TRIDIAG_ELIM_DATA_SETUP TRIDIAG_ELIM_DATA_SETUP_TYPED(Real_type)
 
 #define TRIDIAG_ELIM_BODY  \
   xout[i] = z[i] * ( y[i] - xin[i-1] );
@@ -59,10 +61,15 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
-  Real_ptr m_xout;
-  Real_ptr m_xin;
-  Real_ptr m_y;
-  Real_ptr m_z;
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_xout;
+  Precision_ptr m_xin;
+  Precision_ptr m_y;
+  Precision_ptr m_z;
 
   Index_type m_N;
 };
@@ -42,15 +42,15 @@ constexpr size_t in_block_sz = 32;
 
 
 #define POLYBENCH_2MM_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(tmp, m_tmp, m_ni * m_nj); \
-  allocAndInitCudaDeviceData(A, m_A, m_ni * m_nk); \
-  allocAndInitCudaDeviceData(B, m_B, m_nk * m_nj); \
-  allocAndInitCudaDeviceData(C, m_C, m_nj * m_nl); \
-  allocAndInitCudaDeviceData(D, m_D, m_ni * m_nl);
+  allocAndInitCudaDeviceData(tmp, m_tmp.get<Real_type>(), m_ni * m_nj); \
+  allocAndInitCudaDeviceData(A, m_A.get<Real_type>(), m_ni * m_nk); \
+  allocAndInitCudaDeviceData(B, m_B.get<Real_type>(), m_nk * m_nj); \
+  allocAndInitCudaDeviceData(C, m_C.get<Real_type>(), m_nj * m_nl); \
+  allocAndInitCudaDeviceData(D, m_D.get<Real_type>(), m_ni * m_nl);
 
 
 #define POLYBENCH_2MM_TEARDOWN_CUDA \
-  getCudaDeviceData(m_D, D, m_ni * m_nl); \
+  getCudaDeviceData(m_D.get<Real_type>(), D, m_ni * m_nl); \
   deallocCudaDeviceData(tmp); \
   deallocCudaDeviceData(A); \
   deallocCudaDeviceData(B); \
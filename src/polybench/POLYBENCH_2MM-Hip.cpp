@@ -42,15 +42,15 @@ constexpr size_t in_block_sz = 32;
 
 
 #define POLYBENCH_2MM_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(tmp, m_tmp, m_ni * m_nj); \
-  allocAndInitHipDeviceData(A, m_A, m_ni * m_nk); \
-  allocAndInitHipDeviceData(B, m_B, m_nk * m_nj); \
-  allocAndInitHipDeviceData(C, m_C, m_nj * m_nl); \
-  allocAndInitHipDeviceData(D, m_D, m_ni * m_nl);
+  allocAndInitHipDeviceData(tmp, m_tmp.get<Real_type>(), m_ni * m_nj); \
+  allocAndInitHipDeviceData(A, m_A.get<Real_type>(), m_ni * m_nk); \
+  allocAndInitHipDeviceData(B, m_B.get<Real_type>(), m_nk * m_nj); \
+  allocAndInitHipDeviceData(C, m_C.get<Real_type>(), m_nj * m_nl); \
+  allocAndInitHipDeviceData(D, m_D.get<Real_type>(), m_ni * m_nl);
 
 
 #define POLYBENCH_2MM_TEARDOWN_HIP \
-  getHipDeviceData(m_D, D, m_ni * m_nl); \
+  getHipDeviceData(m_D.get<Real_type>(), D, m_ni * m_nl); \
   deallocHipDeviceData(tmp); \
   deallocHipDeviceData(A); \
   deallocHipDeviceData(B); \
@@ -26,13 +26,14 @@ namespace polybench
 {
 
 
-void POLYBENCH_2MM::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void POLYBENCH_2MM::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps= getRunReps();
 
-  POLYBENCH_2MM_DATA_SETUP;
+  POLYBENCH_2MM_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -48,7 +49,7 @@ void POLYBENCH_2MM::runOpenMPVariant(VariantID vid)
 #endif
         for (Index_type i = 0; i < ni; i++ ) {
           for(Index_type j = 0; j < nj; j++) {
-            POLYBENCH_2MM_BODY1;
+            POLYBENCH_2MM_BODY1_TYPED(Data_type);
             for (Index_type k = 0; k < nk; k++) {
               POLYBENCH_2MM_BODY2;
             }
@@ -63,7 +64,7 @@ void POLYBENCH_2MM::runOpenMPVariant(VariantID vid)
 #endif
         for(Index_type i = 0; i < ni; i++) {
           for(Index_type l = 0; l < nl; l++) {
-            POLYBENCH_2MM_BODY4;
+            POLYBENCH_2MM_BODY4_TYPED(Data_type);
             for (Index_type j = 0; j < nj; j++) {
               POLYBENCH_2MM_BODY5;
             }
@@ -80,19 +81,19 @@ void POLYBENCH_2MM::runOpenMPVariant(VariantID vid)
     case Lambda_OpenMP : {
 
       auto poly_2mm_base_lam2 = [=](Index_type i, Index_type j,
-                                    Index_type k, Real_type &dot) {
+                                    Index_type k, Data_type &dot) {
                                   POLYBENCH_2MM_BODY2;
                                 };
       auto poly_2mm_base_lam3 = [=](Index_type i, Index_type j,
-                                    Real_type &dot) {
+                                    Data_type &dot) {
                                   POLYBENCH_2MM_BODY3;
                                 };
       auto poly_2mm_base_lam5 = [=](Index_type i, Index_type l,
-                                    Index_type j, Real_type &dot) {
+                                    Index_type j, Data_type &dot) {
                                   POLYBENCH_2MM_BODY5;
                                 };
       auto poly_2mm_base_lam6 = [=](Index_type i, Index_type l,
-                                    Real_type &dot) {
+                                    Data_type &dot) {
                                   POLYBENCH_2MM_BODY6;
                                 };
 
@@ -106,7 +107,7 @@ void POLYBENCH_2MM::runOpenMPVariant(VariantID vid)
 #endif
         for (Index_type i = 0; i < ni; i++ ) {
           for(Index_type j = 0; j < nj; j++) {
-            POLYBENCH_2MM_BODY1;
+            POLYBENCH_2MM_BODY1_TYPED(Data_type);
             for (Index_type k = 0; k < nk; k++) {
               poly_2mm_base_lam2(i, j, k, dot);
             }
@@ -121,7 +122,7 @@ void POLYBENCH_2MM::runOpenMPVariant(VariantID vid)
 #endif
         for(Index_type i = 0; i < ni; i++) {
           for(Index_type l = 0; l < nl; l++) {
-            POLYBENCH_2MM_BODY4;
+            POLYBENCH_2MM_BODY4_TYPED(Data_type);
             for (Index_type j = 0; j < nj; j++) {
               poly_2mm_base_lam5(i, l, j, dot);
             }
@@ -137,28 +138,28 @@ void POLYBENCH_2MM::runOpenMPVariant(VariantID vid)
 
     case RAJA_OpenMP : {
 
-      POLYBENCH_2MM_VIEWS_RAJA;
+      POLYBENCH_2MM_VIEWS_RAJA_TYPED(Data_type);
 
-      auto poly_2mm_lam1 = [=](Real_type &dot) {
+      auto poly_2mm_lam1 = [=](Data_type &dot) {
                              POLYBENCH_2MM_BODY1_RAJA;
                            };
       auto poly_2mm_lam2 = [=](Index_type i, Index_type j, Index_type k,
-                               Real_type &dot) {
+                               Data_type &dot) {
                              POLYBENCH_2MM_BODY2_RAJA;
                            };
       auto poly_2mm_lam3 = [=](Index_type i, Index_type j,
-                               Real_type &dot) {
+                               Data_type &dot) {
                              POLYBENCH_2MM_BODY3_RAJA;
                            };
-      auto poly_2mm_lam4 = [=](Real_type &dot) {
+      auto poly_2mm_lam4 = [=](Data_type &dot) {
                              POLYBENCH_2MM_BODY4_RAJA;
                            };
       auto poly_2mm_lam5 = [=](Index_type i, Index_type l, Index_type j,
-                               Real_type &dot) {
+                               Data_type &dot) {
                              POLYBENCH_2MM_BODY5_RAJA;
                            };
       auto poly_2mm_lam6 = [=](Index_type i, Index_type l,
-                               Real_type &dot) {
+                               Data_type &dot) {
                              POLYBENCH_2MM_BODY6_RAJA;
                            };
 
@@ -196,7 +197,7 @@ void POLYBENCH_2MM::runOpenMPVariant(VariantID vid)
           RAJA::make_tuple(RAJA::RangeSegment{0, ni},
                            RAJA::RangeSegment{0, nj},
                            RAJA::RangeSegment{0, nk}),
-          RAJA::tuple<Real_type>{0.0},
+          RAJA::tuple<Data_type>{0.0},
 
           poly_2mm_lam1,
           poly_2mm_lam2,
@@ -207,7 +208,7 @@ void POLYBENCH_2MM::runOpenMPVariant(VariantID vid)
           RAJA::make_tuple(RAJA::RangeSegment{0, ni},
                            RAJA::RangeSegment{0, nl},
                            RAJA::RangeSegment{0, nj}),
-          RAJA::tuple<Real_type>{0.0},
+          RAJA::tuple<Data_type>{0.0},
 
           poly_2mm_lam4,
           poly_2mm_lam5,
@@ -225,6 +226,18 @@ void POLYBENCH_2MM::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void POLYBENCH_2MM::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
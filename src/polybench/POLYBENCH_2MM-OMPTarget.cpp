@@ -25,15 +25,15 @@ namespace polybench
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(tmp, m_tmp, m_ni * m_nj, did, hid); \
-  allocAndInitOpenMPDeviceData(A, m_A, m_ni * m_nk, did, hid); \
-  allocAndInitOpenMPDeviceData(B, m_B, m_nk * m_nj, did, hid); \
-  allocAndInitOpenMPDeviceData(C, m_C, m_nj * m_nl, did, hid); \
-  allocAndInitOpenMPDeviceData(D, m_D, m_ni * m_nl, did, hid);
+  allocAndInitOpenMPDeviceData(tmp, m_tmp.get<Real_type>(), m_ni * m_nj, did, hid); \
+  allocAndInitOpenMPDeviceData(A, m_A.get<Real_type>(), m_ni * m_nk, did, hid); \
+  allocAndInitOpenMPDeviceData(B, m_B.get<Real_type>(), m_nk * m_nj, did, hid); \
+  allocAndInitOpenMPDeviceData(C, m_C.get<Real_type>(), m_nj * m_nl, did, hid); \
+  allocAndInitOpenMPDeviceData(D, m_D.get<Real_type>(), m_ni * m_nl, did, hid);
 
 
 #define POLYBENCH_2MM_DATA_TEARDOWN_OMP_TARGET \
-  getOpenMPDeviceData(m_D, D, m_ni * m_nl, hid, did); \
+  getOpenMPDeviceData(m_D.get<Real_type>(), D, m_ni * m_nl, hid, did); \
   deallocOpenMPDeviceData(tmp, did); \
   deallocOpenMPDeviceData(A, did); \
   deallocOpenMPDeviceData(B, did); \
@@ -18,11 +18,12 @@ namespace rajaperf
 namespace polybench
 {
 
-void POLYBENCH_2MM::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void POLYBENCH_2MM::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps= getRunReps();
 
-  POLYBENCH_2MM_DATA_SETUP;
+  POLYBENCH_2MM_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -33,7 +34,7 @@ void POLYBENCH_2MM::runSeqVariant(VariantID vid)
 
         for (Index_type i = 0; i < ni; i++ ) {
           for (Index_type j = 0; j < nj; j++) {
-            POLYBENCH_2MM_BODY1;
+            POLYBENCH_2MM_BODY1_TYPED(Data_type);
             for (Index_type k = 0; k < nk; k++) {
               POLYBENCH_2MM_BODY2;
             }
@@ -43,7 +44,7 @@ void POLYBENCH_2MM::runSeqVariant(VariantID vid)
 
         for (Index_type i = 0; i < ni; i++) {
           for (Index_type l = 0; l < nl; l++) {
-            POLYBENCH_2MM_BODY4;
+            POLYBENCH_2MM_BODY4_TYPED(Data_type);
             for (Index_type j = 0; j < nj; j++) {
               POLYBENCH_2MM_BODY5;
             }
@@ -62,19 +63,19 @@ void POLYBENCH_2MM::runSeqVariant(VariantID vid)
     case Lambda_Seq : {
 
       auto poly_2mm_base_lam2 = [=](Index_type i, Index_type j,
-                                    Index_type k, Real_type &dot) {
+                                    Index_type k, Data_type &dot) {
                                   POLYBENCH_2MM_BODY2;
                                 };
       auto poly_2mm_base_lam3 = [=](Index_type i, Index_type j,
-                                    Real_type &dot) {
+                                    Data_type &dot) {
                                   POLYBENCH_2MM_BODY3;
                                 };
       auto poly_2mm_base_lam5 = [=](Index_type i, Index_type l,
-                                    Index_type j, Real_type &dot) {
+                                    Index_type j, Data_type &dot) {
                                   POLYBENCH_2MM_BODY5;
                                 };
       auto poly_2mm_base_lam6 = [=](Index_type i, Index_type l,
-                                    Real_type &dot) {
+                                    Data_type &dot) {
                                   POLYBENCH_2MM_BODY6;
                                 };
 
@@ -83,7 +84,7 @@ void POLYBENCH_2MM::runSeqVariant(VariantID vid)
 
         for (Index_type i = 0; i < ni; i++ ) {
           for(Index_type j = 0; j < nj; j++) {
-            POLYBENCH_2MM_BODY1;
+            POLYBENCH_2MM_BODY1_TYPED(Data_type);
             for (Index_type k = 0; k < nk; k++) {
               poly_2mm_base_lam2(i, j, k, dot);
             }
@@ -93,7 +94,7 @@ void POLYBENCH_2MM::runSeqVariant(VariantID vid)
 
         for(Index_type i = 0; i < ni; i++) {
           for(Index_type l = 0; l < nl; l++) {
-            POLYBENCH_2MM_BODY4;
+            POLYBENCH_2MM_BODY4_TYPED(Data_type);
             for (Index_type j = 0; j < nj; j++) {
               poly_2mm_base_lam5(i, l, j, dot);
             }
@@ -109,28 +110,28 @@ void POLYBENCH_2MM::runSeqVariant(VariantID vid)
 
     case RAJA_Seq : {
 
-      POLYBENCH_2MM_VIEWS_RAJA;
+      POLYBENCH_2MM_VIEWS_RAJA_TYPED(Data_type);
 
-      auto poly_2mm_lam1 = [=](Real_type &dot) {
+      auto poly_2mm_lam1 = [=](Data_type &dot) {
                              POLYBENCH_2MM_BODY1_RAJA;
                            };
       auto poly_2mm_lam2 = [=](Index_type i, Index_type j, Index_type k,
-                               Real_type &dot) {
+                               Data_type &dot) {
                              POLYBENCH_2MM_BODY2_RAJA;
                            };
       auto poly_2mm_lam3 = [=](Index_type i, Index_type j,
-                               Real_type &dot) {
+                               Data_type &dot) {
                              POLYBENCH_2MM_BODY3_RAJA;
                            };
-      auto poly_2mm_lam4 = [=](Real_type &dot) {
+      auto poly_2mm_lam4 = [=](Data_type &dot) {
                              POLYBENCH_2MM_BODY4_RAJA;
                            };
       auto poly_2mm_lam5 = [=](Index_type i, Index_type l, Index_type j,
-                               Real_type &dot) {
+                               Data_type &dot) {
                              POLYBENCH_2MM_BODY5_RAJA;
                            };
       auto poly_2mm_lam6 = [=](Index_type i, Index_type l,
-                               Real_type &dot) {
+                               Data_type &dot) {
                              POLYBENCH_2MM_BODY6_RAJA;
                            };
 
@@ -154,7 +155,7 @@ void POLYBENCH_2MM::runSeqVariant(VariantID vid)
           RAJA::make_tuple(RAJA::RangeSegment{0, ni},
                            RAJA::RangeSegment{0, nj},
                            RAJA::RangeSegment{0, nk}),
-          RAJA::tuple<Real_type>{0.0},
+          RAJA::tuple<Data_type>{0.0},
 
           poly_2mm_lam1,
           poly_2mm_lam2,
@@ -165,7 +166,7 @@ void POLYBENCH_2MM::runSeqVariant(VariantID vid)
           RAJA::make_tuple(RAJA::RangeSegment{0, ni},
                            RAJA::RangeSegment{0, nl},
                            RAJA::RangeSegment{0, nj}),
-          RAJA::tuple<Real_type>{0.0},
+          RAJA::tuple<Data_type>{0.0},
 
           poly_2mm_lam4,
           poly_2mm_lam5,
@@ -187,5 +188,13 @@ void POLYBENCH_2MM::runSeqVariant(VariantID vid)
 
 }
 
+void POLYBENCH_2MM::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -11,6 +11,8 @@
 #include "RAJA/RAJA.hpp"
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 #include <algorithm>
 
 
@@ -78,6 +80,23 @@ POLYBENCH_2MM::POLYBENCH_2MM(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (1*data_size + 0*data_size) * m_ni * m_nj +
+                    (0*data_size + 1*data_size) * m_ni * m_nk +
+                    (0*data_size + 1*data_size) * m_nj * m_nk +
+  
+                    (1*data_size + 0*data_size) * m_ni * m_nl +
+                    (0*data_size + 1*data_size) * m_ni * m_nj +
+                    (0*data_size + 1*data_size) * m_nj * m_nl );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 POLYBENCH_2MM::~POLYBENCH_2MM()
@@ -87,11 +106,13 @@ POLYBENCH_2MM::~POLYBENCH_2MM()
 void POLYBENCH_2MM::setUp(VariantID vid)
 {
   (void) vid;
-  allocAndInitData(m_tmp, m_ni * m_nj, vid);
-  allocAndInitData(m_A, m_ni * m_nk, vid);
-  allocAndInitData(m_B, m_nk * m_nj, vid);
-  allocAndInitData(m_C, m_nj * m_nl, vid);
-  allocAndInitDataConst(m_D, m_ni * m_nl, 0.0, vid);
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitData(m_tmp, m_ni * m_nj, pid, vid);
+  allocAndInitData(m_A, m_ni * m_nk, pid, vid);
+  allocAndInitData(m_B, m_nk * m_nj, pid, vid);
+  allocAndInitData(m_C, m_nj * m_nl, pid, vid);
+  allocAndInitDataConst(m_D, m_ni * m_nl, 0.0, pid, vid);
 }
 
 void POLYBENCH_2MM::updateChecksum(VariantID vid)
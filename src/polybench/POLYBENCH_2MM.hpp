@@ -36,23 +36,27 @@
 #define RAJAPerf_POLYBENCH_2MM_HPP
 
 
-#define POLYBENCH_2MM_DATA_SETUP \
-  Real_ptr tmp = m_tmp; \
-  Real_ptr A = m_A; \
-  Real_ptr B = m_B; \
-  Real_ptr C = m_C; \
-  Real_ptr D = m_D; \
-  Real_type alpha = m_alpha; \
-  Real_type beta = m_beta; \
+#define POLYBENCH_2MM_DATA_SETUP_TYPED(Data_type) \
+  Data_type* tmp = m_tmp.get<Data_type>(); \
+  Data_type* A = m_A.get<Data_type>(); \
+  Data_type* B = m_B.get<Data_type>(); \
+  Data_type* C = m_C.get<Data_type>(); \
+  Data_type* D = m_D.get<Data_type>(); \
+  Data_type alpha = m_alpha; \
+  Data_type beta = m_beta; \
 \
   const Index_type ni = m_ni; \
   const Index_type nj = m_nj; \
   const Index_type nk = m_nk; \
   const Index_type nl = m_nl;
 
+#define POLYBENCH_2MM_DATA_SETUP POLYBENCH_2MM_DATA_SETUP_TYPED(Real_type)
 
-#define POLYBENCH_2MM_BODY1 \
-  Real_type dot = 0.0;
+
+#define POLYBENCH_2MM_BODY1_TYPED(Data_type) \
+  Data_type dot = 0.0;
+
+#define POLYBENCH_2MM_BODY1 POLYBENCH_2MM_BODY1_TYPED(Real_type)
 
 #define POLYBENCH_2MM_BODY2 \
   dot += alpha * A[k + i*nk] * B[j + k*nj];
@@ -60,8 +64,10 @@
 #define POLYBENCH_2MM_BODY3 \
   tmp[j + i*nj] = dot;
 
-#define POLYBENCH_2MM_BODY4 \
-  Real_type dot = beta;
+#define POLYBENCH_2MM_BODY4_TYPED(Data_type) \
+  Data_type dot = beta;
+
+#define POLYBENCH_2MM_BODY4 POLYBENCH_2MM_BODY4_TYPED(Real_type)
 
 #define POLYBENCH_2MM_BODY5 \
   dot += tmp[j + i*nj] * C[l + j*nl];
@@ -89,8 +95,8 @@
   Dview(i,l) = dot;
 
 
-#define POLYBENCH_2MM_VIEWS_RAJA \
-using VIEW_TYPE = RAJA::View<Real_type, \
+#define POLYBENCH_2MM_VIEWS_RAJA_TYPED(Data_type) \
+using VIEW_TYPE = RAJA::View<Data_type, \
                              RAJA::Layout<2, Index_type, 1>>; \
 \
   VIEW_TYPE tmpview(tmp, RAJA::Layout<2>(ni, nj)); \
@@ -99,6 +105,8 @@ using VIEW_TYPE = RAJA::View<Real_type, \
   VIEW_TYPE Cview(C, RAJA::Layout<2>(nj, nl)); \
   VIEW_TYPE Dview(D, RAJA::Layout<2>(ni, nl));
 
+#define POLYBENCH_2MM_VIEWS_RAJA POLYBENCH_2MM_VIEWS_RAJA_TYPED(Real_type)
+
 
 #include "common/KernelBase.hpp"
 
@@ -129,17 +137,22 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
   Index_type m_ni;
   Index_type m_nj;
   Index_type m_nk;
   Index_type m_nl;
   Real_type m_alpha;
   Real_type m_beta;
-  Real_ptr m_tmp;
-  Real_ptr m_A;
-  Real_ptr m_B;
-  Real_ptr m_C;
-  Real_ptr m_D;
+  Precision_ptr m_tmp;
+  Precision_ptr m_A;
+  Precision_ptr m_B;
+  Precision_ptr m_C;
+  Precision_ptr m_D;
 };
 
 } // end namespace polybench
@@ -47,17 +47,17 @@ constexpr size_t in_block_sz = 32;
 
 
 #define POLYBENCH_3MM_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(A, m_A, m_ni * m_nk); \
-  allocAndInitHipDeviceData(B, m_B, m_nk * m_nj); \
-  allocAndInitHipDeviceData(C, m_C, m_nj * m_nm); \
-  allocAndInitHipDeviceData(D, m_D, m_nm * m_nl); \
-  allocAndInitHipDeviceData(E, m_E, m_ni * m_nj); \
-  allocAndInitHipDeviceData(F, m_F, m_nj * m_nl); \
-  allocAndInitHipDeviceData(G, m_G, m_ni * m_nl);
+  allocAndInitHipDeviceData(A, m_A.get<Real_type>(), m_ni * m_nk); \
+  allocAndInitHipDeviceData(B, m_B.get<Real_type>(), m_nk * m_nj); \
+  allocAndInitHipDeviceData(C, m_C.get<Real_type>(), m_nj * m_nm); \
+  allocAndInitHipDeviceData(D, m_D.get<Real_type>(), m_nm * m_nl); \
+  allocAndInitHipDeviceData(E, m_E.get<Real_type>(), m_ni * m_nj); \
+  allocAndInitHipDeviceData(F, m_F.get<Real_type>(), m_nj * m_nl); \
+  allocAndInitHipDeviceData(G, m_G.get<Real_type>(), m_ni * m_nl);
 
 
 #define POLYBENCH_3MM_TEARDOWN_HIP \
-  getHipDeviceData(m_G, G, m_ni * m_nl); \
+  getHipDeviceData(m_G.get<Real_type>(), G, m_ni * m_nl); \
   deallocHipDeviceData(A); \
   deallocHipDeviceData(B); \
   deallocHipDeviceData(C); \
@@ -27,13 +27,14 @@ namespace polybench
 {
 
 
-void POLYBENCH_3MM::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void POLYBENCH_3MM::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps = getRunReps();
 
-  POLYBENCH_3MM_DATA_SETUP;
+  POLYBENCH_3MM_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -49,7 +50,7 @@ void POLYBENCH_3MM::runOpenMPVariant(VariantID vid)
 #endif
         for (Index_type i = 0; i < ni; i++ )  {
           for (Index_type j = 0; j < nj; j++) {
-            POLYBENCH_3MM_BODY1;
+            POLYBENCH_3MM_BODY1_TYPED(Data_type);
             for (Index_type k = 0; k < nk; k++) {
               POLYBENCH_3MM_BODY2;
             }
@@ -64,7 +65,7 @@ void POLYBENCH_3MM::runOpenMPVariant(VariantID vid)
 #endif
         for (Index_type j = 0; j < nj; j++) {
           for (Index_type l = 0; l < nl; l++) {
-            POLYBENCH_3MM_BODY4;
+            POLYBENCH_3MM_BODY4_TYPED(Data_type);
             for (Index_type m = 0; m < nm; m++) {
               POLYBENCH_3MM_BODY5;
             }
@@ -79,7 +80,7 @@ void POLYBENCH_3MM::runOpenMPVariant(VariantID vid)
 #endif
         for (Index_type i = 0; i < ni; i++) {
           for (Index_type l = 0; l < nl; l++) {
-            POLYBENCH_3MM_BODY7;
+            POLYBENCH_3MM_BODY7_TYPED(Data_type);
             for (Index_type j = 0; j < nj; j++) {
               POLYBENCH_3MM_BODY8;
             }
@@ -96,27 +97,27 @@ void POLYBENCH_3MM::runOpenMPVariant(VariantID vid)
     case Lambda_OpenMP : {
 
       auto poly_3mm_base_lam2 = [=] (Index_type i, Index_type j, Index_type k,
-                                     Real_type &dot) {
+                                     Data_type &dot) {
                                   POLYBENCH_3MM_BODY2;
                                 };
       auto poly_3mm_base_lam3 = [=] (Index_type i, Index_type j,
-                                     Real_type &dot) {
+                                     Data_type &dot) {
                                   POLYBENCH_3MM_BODY3;
                                 };
       auto poly_3mm_base_lam5 = [=] (Index_type j, Index_type l, Index_type m,
-                                     Real_type &dot) {
+                                     Data_type &dot) {
                                    POLYBENCH_3MM_BODY5;
                                 };
       auto poly_3mm_base_lam6 = [=] (Index_type j, Index_type l,
-                                     Real_type &dot) {
+                                     Data_type &dot) {
                                   POLYBENCH_3MM_BODY6;
                                 };
       auto poly_3mm_base_lam8 = [=] (Index_type i, Index_type l, Index_type j,
-                                     Real_type &dot) {
+                                     Data_type &dot) {
                                   POLYBENCH_3MM_BODY8;
                                 };
       auto poly_3mm_base_lam9 = [=] (Index_type i, Index_type l,
-                                     Real_type &dot) {
+                                     Data_type &dot) {
                                   POLYBENCH_3MM_BODY9;
                                 };
 
@@ -130,7 +131,7 @@ void POLYBENCH_3MM::runOpenMPVariant(VariantID vid)
 #endif
         for (Index_type i = 0; i < ni; i++ )  {
           for (Index_type j = 0; j < nj; j++) {
-            POLYBENCH_3MM_BODY1;
+            POLYBENCH_3MM_BODY1_TYPED(Data_type);
             for (Index_type k = 0; k < nk; k++) {
               poly_3mm_base_lam2(i, j, k, dot);
             }
@@ -145,7 +146,7 @@ void POLYBENCH_3MM::runOpenMPVariant(VariantID vid)
 #endif
         for (Index_type j = 0; j < nj; j++) {
           for (Index_type l = 0; l < nl; l++) {
-            POLYBENCH_3MM_BODY4;
+            POLYBENCH_3MM_BODY4_TYPED(Data_type);
             for (Index_type m = 0; m < nm; m++) {
               poly_3mm_base_lam5(j, l, m, dot);
             }
@@ -160,7 +161,7 @@ void POLYBENCH_3MM::runOpenMPVariant(VariantID vid)
 #endif
         for (Index_type i = 0; i < ni; i++) {
           for (Index_type l = 0; l < nl; l++) {
-            POLYBENCH_3MM_BODY7;
+            POLYBENCH_3MM_BODY7_TYPED(Data_type);
             for (Index_type j = 0; j < nj; j++) {
               poly_3mm_base_lam8(i, l, j, dot);
             }
@@ -176,39 +177,39 @@ void POLYBENCH_3MM::runOpenMPVariant(VariantID vid)
 
     case RAJA_OpenMP : {
 
-      POLYBENCH_3MM_VIEWS_RAJA;
+      POLYBENCH_3MM_VIEWS_RAJA_TYPED(Data_type);
 
-      auto poly_3mm_lam1 = [=] (Real_type &dot) {
+      auto poly_3mm_lam1 = [=] (Data_type &dot) {
                                   POLYBENCH_3MM_BODY1_RAJA;
                                 };
       auto poly_3mm_lam2 = [=] (Index_type i, Index_type j, Index_type k,
-                                Real_type &dot) {
+                                Data_type &dot) {
                                   POLYBENCH_3MM_BODY2_RAJA;
                                 };
       auto poly_3mm_lam3 = [=] (Index_type i, Index_type j,
-                                Real_type &dot) {
+                                Data_type &dot) {
                                   POLYBENCH_3MM_BODY3_RAJA;
                                 };
-      auto poly_3mm_lam4 = [=] (Real_type &dot) {
+      auto poly_3mm_lam4 = [=] (Data_type &dot) {
                                   POLYBENCH_3MM_BODY4_RAJA;
                                 };
       auto poly_3mm_lam5 = [=] (Index_type j, Index_type l, Index_type m,
-                                Real_type &dot) {
+                                Data_type &dot) {
                                   POLYBENCH_3MM_BODY5_RAJA;
                                 };
       auto poly_3mm_lam6 = [=] (Index_type j, Index_type l,
-                                Real_type &dot) {
+                                Data_type &dot) {
                                   POLYBENCH_3MM_BODY6_RAJA;
                                 };
-      auto poly_3mm_lam7 = [=] (Real_type &dot) {
+      auto poly_3mm_lam7 = [=] (Data_type &dot) {
                                   POLYBENCH_3MM_BODY7_RAJA;
                                 };
       auto poly_3mm_lam8 = [=] (Index_type i, Index_type l, Index_type j,
-                                Real_type &dot) {
+                                Data_type &dot) {
                                   POLYBENCH_3MM_BODY8_RAJA;
                                 };
       auto poly_3mm_lam9 = [=] (Index_type i, Index_type l,
-                                Real_type &dot) {
+                                Data_type &dot) {
                                   POLYBENCH_3MM_BODY9_RAJA;
                                 };
 
@@ -246,7 +247,7 @@ void POLYBENCH_3MM::runOpenMPVariant(VariantID vid)
           RAJA::make_tuple(RAJA::RangeSegment{0, ni},
                            RAJA::RangeSegment{0, nj},
                            RAJA::RangeSegment{0, nk}),
-          RAJA::tuple<Real_type>{0.0},
+          RAJA::tuple<Data_type>{0.0},
 
           poly_3mm_lam1,
           poly_3mm_lam2,
@@ -258,7 +259,7 @@ void POLYBENCH_3MM::runOpenMPVariant(VariantID vid)
           RAJA::make_tuple(RAJA::RangeSegment{0, nj},
                            RAJA::RangeSegment{0, nl},
                            RAJA::RangeSegment{0, nm}),
-          RAJA::tuple<Real_type>{0.0},
+          RAJA::tuple<Data_type>{0.0},
 
           poly_3mm_lam4,
           poly_3mm_lam5,
@@ -270,7 +271,7 @@ void POLYBENCH_3MM::runOpenMPVariant(VariantID vid)
           RAJA::make_tuple(RAJA::RangeSegment{0, ni},
                            RAJA::RangeSegment{0, nl},
                            RAJA::RangeSegment{0, nj}),
-          RAJA::tuple<Real_type>{0.0},
+          RAJA::tuple<Data_type>{0.0},
 
           poly_3mm_lam7,
           poly_3mm_lam8,
@@ -289,6 +290,18 @@ void POLYBENCH_3MM::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void POLYBENCH_3MM::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
@@ -25,17 +25,17 @@ namespace polybench
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(A, m_A, m_ni * m_nk, did, hid); \
-  allocAndInitOpenMPDeviceData(B, m_B, m_nk * m_nj, did, hid); \
-  allocAndInitOpenMPDeviceData(C, m_C, m_nj * m_nm, did, hid); \
-  allocAndInitOpenMPDeviceData(D, m_D, m_nm * m_nl, did, hid); \
-  allocAndInitOpenMPDeviceData(E, m_E, m_ni * m_nj, did, hid); \
-  allocAndInitOpenMPDeviceData(F, m_F, m_nj * m_nl, did, hid); \
-  allocAndInitOpenMPDeviceData(G, m_G, m_ni * m_nl, did, hid);
+  allocAndInitOpenMPDeviceData(A, m_A.get<Real_type>(), m_ni * m_nk, did, hid); \
+  allocAndInitOpenMPDeviceData(B, m_B.get<Real_type>(), m_nk * m_nj, did, hid); \
+  allocAndInitOpenMPDeviceData(C, m_C.get<Real_type>(), m_nj * m_nm, did, hid); \
+  allocAndInitOpenMPDeviceData(D, m_D.get<Real_type>(), m_nm * m_nl, did, hid); \
+  allocAndInitOpenMPDeviceData(E, m_E.get<Real_type>(), m_ni * m_nj, did, hid); \
+  allocAndInitOpenMPDeviceData(F, m_F.get<Real_type>(), m_nj * m_nl, did, hid); \
+  allocAndInitOpenMPDeviceData(G, m_G.get<Real_type>(), m_ni * m_nl, did, hid);
 
 
 #define POLYBENCH_3MM_DATA_TEARDOWN_OMP_TARGET \
-  getOpenMPDeviceData(m_G, G, m_ni * m_nl, hid, did); \
+  getOpenMPDeviceData(m_G.get<Real_type>(), G, m_ni * m_nl, hid, did); \
   deallocOpenMPDeviceData(A, did); \
   deallocOpenMPDeviceData(B, did); \
   deallocOpenMPDeviceData(C, did); \
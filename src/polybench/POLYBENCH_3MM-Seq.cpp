@@ -20,11 +20,12 @@ namespace polybench
 {
 
 
-void POLYBENCH_3MM::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void POLYBENCH_3MM::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
 
-  POLYBENCH_3MM_DATA_SETUP;
+  POLYBENCH_3MM_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -35,7 +36,7 @@ void POLYBENCH_3MM::runSeqVariant(VariantID vid)
 
         for (Index_type i = 0; i < ni; i++ ) {
           for (Index_type j = 0; j < nj; j++) {
-            POLYBENCH_3MM_BODY1;
+            POLYBENCH_3MM_BODY1_TYPED(Data_type);
             for (Index_type k = 0; k < nk; k++) {
               POLYBENCH_3MM_BODY2;
             }
@@ -45,7 +46,7 @@ void POLYBENCH_3MM::runSeqVariant(VariantID vid)
 
         for (Index_type j = 0; j < nj; j++) {
           for (Index_type l = 0; l < nl; l++) {
-            POLYBENCH_3MM_BODY4;
+            POLYBENCH_3MM_BODY4_TYPED(Data_type);
             for (Index_type m = 0; m < nm; m++) {
               POLYBENCH_3MM_BODY5;
             }
@@ -55,7 +56,7 @@ void POLYBENCH_3MM::runSeqVariant(VariantID vid)
 
         for (Index_type i = 0; i < ni; i++) {
           for (Index_type l = 0; l < nl; l++) {
-            POLYBENCH_3MM_BODY7;
+            POLYBENCH_3MM_BODY7_TYPED(Data_type);
             for (Index_type j = 0; j < nj; j++) {
               POLYBENCH_3MM_BODY8;
             }
@@ -73,27 +74,27 @@ void POLYBENCH_3MM::runSeqVariant(VariantID vid)
     case Lambda_Seq : {
 
       auto poly_3mm_base_lam2 = [=] (Index_type i, Index_type j, Index_type k,
-                                     Real_type &dot) {
+                                     Data_type &dot) {
                                   POLYBENCH_3MM_BODY2;
                                 };
       auto poly_3mm_base_lam3 = [=] (Index_type i, Index_type j,
-                                     Real_type &dot) {
+                                     Data_type &dot) {
                                   POLYBENCH_3MM_BODY3;
                                 };
       auto poly_3mm_base_lam5 = [=] (Index_type j, Index_type l, Index_type m,
-                                     Real_type &dot) {
+                                     Data_type &dot) {
                                    POLYBENCH_3MM_BODY5;
                                 };
       auto poly_3mm_base_lam6 = [=] (Index_type j, Index_type l,
-                                     Real_type &dot) {
+                                     Data_type &dot) {
                                   POLYBENCH_3MM_BODY6;
                                 };
       auto poly_3mm_base_lam8 = [=] (Index_type i, Index_type l, Index_type j,
-                                     Real_type &dot) {
+                                     Data_type &dot) {
                                   POLYBENCH_3MM_BODY8;
                                 };
       auto poly_3mm_base_lam9 = [=] (Index_type i, Index_type l,
-                                     Real_type &dot) {
+                                     Data_type &dot) {
                                   POLYBENCH_3MM_BODY9;
                                 };
 
@@ -102,7 +103,7 @@ void POLYBENCH_3MM::runSeqVariant(VariantID vid)
 
         for (Index_type i = 0; i < ni; i++ )  {
           for (Index_type j = 0; j < nj; j++) {
-            POLYBENCH_3MM_BODY1;
+            POLYBENCH_3MM_BODY1_TYPED(Data_type);
             for (Index_type k = 0; k < nk; k++) {
               poly_3mm_base_lam2(i, j, k, dot);
             }
@@ -112,7 +113,7 @@ void POLYBENCH_3MM::runSeqVariant(VariantID vid)
 
         for (Index_type j = 0; j < nj; j++) {
           for (Index_type l = 0; l < nl; l++) {
-            POLYBENCH_3MM_BODY4;
+            POLYBENCH_3MM_BODY4_TYPED(Data_type);
             for (Index_type m = 0; m < nm; m++) {
               poly_3mm_base_lam5(j, l, m, dot);
             }
@@ -122,7 +123,7 @@ void POLYBENCH_3MM::runSeqVariant(VariantID vid)
 
         for (Index_type i = 0; i < ni; i++) {
           for (Index_type l = 0; l < nl; l++) {
-            POLYBENCH_3MM_BODY7;
+            POLYBENCH_3MM_BODY7_TYPED(Data_type);
             for (Index_type j = 0; j < nj; j++) {
               poly_3mm_base_lam8(i, l, j, dot);
             }
@@ -138,39 +139,39 @@ void POLYBENCH_3MM::runSeqVariant(VariantID vid)
 
     case RAJA_Seq : {
 
-      POLYBENCH_3MM_VIEWS_RAJA;
+      POLYBENCH_3MM_VIEWS_RAJA_TYPED(Data_type);
 
-      auto poly_3mm_lam1 = [=] (Real_type &dot) {
+      auto poly_3mm_lam1 = [=] (Data_type &dot) {
                                   POLYBENCH_3MM_BODY1_RAJA;
                                 };
       auto poly_3mm_lam2 = [=] (Index_type i, Index_type j, Index_type k,
-                                Real_type &dot) {
+                                Data_type &dot) {
                                   POLYBENCH_3MM_BODY2_RAJA;
                                 };
       auto poly_3mm_lam3 = [=] (Index_type i, Index_type j,
-                                Real_type &dot) {
+                                Data_type &dot) {
                                   POLYBENCH_3MM_BODY3_RAJA;
                                 };
-      auto poly_3mm_lam4 = [=] (Real_type &dot) {
+      auto poly_3mm_lam4 = [=] (Data_type &dot) {
                                   POLYBENCH_3MM_BODY4_RAJA;
                                 };
       auto poly_3mm_lam5 = [=] (Index_type j, Index_type l, Index_type m,
-                                Real_type &dot) {
+                                Data_type &dot) {
                                   POLYBENCH_3MM_BODY5_RAJA;
                                 };
       auto poly_3mm_lam6 = [=] (Index_type j, Index_type l,
-                                Real_type &dot) {
+                                Data_type &dot) {
                                   POLYBENCH_3MM_BODY6_RAJA;
                                 };
-      auto poly_3mm_lam7 = [=] (Real_type &dot) {
+      auto poly_3mm_lam7 = [=] (Data_type &dot) {
                                   POLYBENCH_3MM_BODY7_RAJA;
                                 };
       auto poly_3mm_lam8 = [=] (Index_type i, Index_type l, Index_type j,
-                                Real_type &dot) {
+                                Data_type &dot) {
                                   POLYBENCH_3MM_BODY8_RAJA;
                                 };
       auto poly_3mm_lam9 = [=] (Index_type i, Index_type l,
-                                Real_type &dot) {
+                                Data_type &dot) {
                                   POLYBENCH_3MM_BODY9_RAJA;
                                 };
 
@@ -194,7 +195,7 @@ void POLYBENCH_3MM::runSeqVariant(VariantID vid)
           RAJA::make_tuple(RAJA::RangeSegment{0, ni},
                            RAJA::RangeSegment{0, nj},
                            RAJA::RangeSegment{0, nk}),
-          RAJA::tuple<Real_type>{0.0},
+          RAJA::tuple<Data_type>{0.0},
 
           poly_3mm_lam1,
           poly_3mm_lam2,
@@ -206,7 +207,7 @@ void POLYBENCH_3MM::runSeqVariant(VariantID vid)
           RAJA::make_tuple(RAJA::RangeSegment{0, nj},
                            RAJA::RangeSegment{0, nl},
                            RAJA::RangeSegment{0, nm}),
-          RAJA::tuple<Real_type>{0.0},
+          RAJA::tuple<Data_type>{0.0},
 
           poly_3mm_lam4,
           poly_3mm_lam5,
@@ -218,7 +219,7 @@ void POLYBENCH_3MM::runSeqVariant(VariantID vid)
           RAJA::make_tuple(RAJA::RangeSegment{0, ni},
                            RAJA::RangeSegment{0, nl},
                            RAJA::RangeSegment{0, nj}),
-          RAJA::tuple<Real_type>{0.0},
+          RAJA::tuple<Data_type>{0.0},
 
           poly_3mm_lam7,
           poly_3mm_lam8,
@@ -241,5 +242,13 @@ void POLYBENCH_3MM::runSeqVariant(VariantID vid)
 
 }
 
+void POLYBENCH_3MM::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
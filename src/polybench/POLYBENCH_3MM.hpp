@@ -42,14 +42,14 @@
 #ifndef RAJAPerf_POLYBENCH_3MM_HPP
 #define RAJAPerf_POLYBENCH_3MM_HPP
 
-#define POLYBENCH_3MM_DATA_SETUP \
-  Real_ptr A = m_A; \
-  Real_ptr B = m_B; \
-  Real_ptr C = m_C; \
-  Real_ptr D = m_D; \
-  Real_ptr E = m_E; \
-  Real_ptr F = m_F; \
-  Real_ptr G = m_G; \
+#define POLYBENCH_3MM_DATA_SETUP_TYPED(Data_type) \
+  Data_type* A = m_A.get<Data_type>(); \
+  Data_type* B = m_B.get<Data_type>(); \
+  Data_type* C = m_C.get<Data_type>(); \
+  Data_type* D = m_D.get<Data_type>(); \
+  Data_type* E = m_E.get<Data_type>(); \
+  Data_type* F = m_F.get<Data_type>(); \
+  Data_type* G = m_G.get<Data_type>(); \
 \
   const Index_type ni = m_ni; \
   const Index_type nj = m_nj; \
@@ -57,9 +57,13 @@
   const Index_type nl = m_nl; \
   const Index_type nm = m_nm;
 
+#define POLYBENCH_3MM_DATA_SETUP POLYBENCH_3MM_DATA_SETUP_TYPED(Real_type)
 
-#define POLYBENCH_3MM_BODY1 \
-  Real_type dot = 0.0;
+
+#define POLYBENCH_3MM_BODY1_TYPED(Data_type) \
+  Data_type dot = 0.0;
+
+#define POLYBENCH_3MM_BODY1 POLYBENCH_3MM_BODY1_TYPED(Real_type)
 
 #define POLYBENCH_3MM_BODY2 \
   dot += A[k + i*nk] * B[j + k*nj];
@@ -67,8 +71,10 @@
 #define POLYBENCH_3MM_BODY3 \
   E[j + i*nj] = dot;
 
-#define POLYBENCH_3MM_BODY4 \
-  Real_type dot = 0.0;
+#define POLYBENCH_3MM_BODY4_TYPED(Data_type) \
+  Data_type dot = 0.0;
+
+#define POLYBENCH_3MM_BODY4 POLYBENCH_3MM_BODY4_TYPED(Real_type)
 
 #define POLYBENCH_3MM_BODY5 \
   dot += C[m + j*nm] * D[l + m*nl];
@@ -76,8 +82,10 @@
 #define POLYBENCH_3MM_BODY6 \
   F[l + j*nl] = dot;
 
-#define POLYBENCH_3MM_BODY7 \
-  Real_type dot = 0.0;
+#define POLYBENCH_3MM_BODY7_TYPED(Data_type) \
+  Data_type dot = 0.0;
+
+#define POLYBENCH_3MM_BODY7 POLYBENCH_3MM_BODY7_TYPED(Real_type)
 
 #define POLYBENCH_3MM_BODY8 \
   dot += E[j + i*nj] * F[l + j*nl];
@@ -114,8 +122,8 @@
   Gview(i,l) = dot;
 
 
-#define POLYBENCH_3MM_VIEWS_RAJA \
-using VIEW_TYPE = RAJA::View<Real_type, \
+#define POLYBENCH_3MM_VIEWS_RAJA_TYPED(Data_type) \
+using VIEW_TYPE = RAJA::View<Data_type, \
                              RAJA::Layout<2, Index_type, 1>>; \
 \
   VIEW_TYPE Aview(A, RAJA::Layout<2>(ni, nk)); \
@@ -126,6 +134,8 @@ using VIEW_TYPE = RAJA::View<Real_type, \
   VIEW_TYPE Fview(F, RAJA::Layout<2>(nj, nl)); \
   VIEW_TYPE Gview(G, RAJA::Layout<2>(ni, nl));
 
+#define POLYBENCH_3MM_VIEWS_RAJA POLYBENCH_3MM_VIEWS_RAJA_TYPED(Real_type)
+
 #include "common/KernelBase.hpp"
 
 namespace rajaperf
@@ -155,19 +165,24 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
   Index_type m_ni;
   Index_type m_nj;
   Index_type m_nk;
   Index_type m_nl;
   Index_type m_nm;
   Index_type m_run_reps;
-  Real_ptr m_A;
-  Real_ptr m_B;
-  Real_ptr m_C;
-  Real_ptr m_D;
-  Real_ptr m_E;
-  Real_ptr m_F;
-  Real_ptr m_G;
+  Precision_ptr m_A;
+  Precision_ptr m_B;
+  Precision_ptr m_C;
+  Precision_ptr m_D;
+  Precision_ptr m_E;
+  Precision_ptr m_F;
+  Precision_ptr m_G;
 };
 
 } // end namespace polybench
@@ -27,13 +27,13 @@ namespace polybench
 const size_t block_size = 256;
 
 #define POLYBENCH_ADI_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(U, m_U, m_n * m_n); \
-  allocAndInitCudaDeviceData(V, m_V, m_n * m_n); \
-  allocAndInitCudaDeviceData(P, m_P, m_n * m_n); \
-  allocAndInitCudaDeviceData(Q, m_Q, m_n * m_n);
+  allocAndInitCudaDeviceData(U, m_U.get<Real_type>(), m_n * m_n); \
+  allocAndInitCudaDeviceData(V, m_V.get<Real_type>(), m_n * m_n); \
+  allocAndInitCudaDeviceData(P, m_P.get<Real_type>(), m_n * m_n); \
+  allocAndInitCudaDeviceData(Q, m_Q.get<Real_type>(), m_n * m_n);
 
 #define POLYBENCH_ADI_TEARDOWN_CUDA \
-  getCudaDeviceData(m_U, U, m_n * m_n); \
+  getCudaDeviceData(m_U.get<Real_type>(), U, m_n * m_n); \
   deallocCudaDeviceData(U); \
   deallocCudaDeviceData(V); \
   deallocCudaDeviceData(P); \
@@ -27,14 +27,14 @@ namespace polybench
 const size_t block_size = 256;
 
 #define POLYBENCH_ADI_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(U, m_U, m_n * m_n); \
-  allocAndInitHipDeviceData(V, m_V, m_n * m_n); \
-  allocAndInitHipDeviceData(P, m_P, m_n * m_n); \
-  allocAndInitHipDeviceData(Q, m_Q, m_n * m_n);
+  allocAndInitHipDeviceData(U, m_U.get<Real_type>(), m_n * m_n); \
+  allocAndInitHipDeviceData(V, m_V.get<Real_type>(), m_n * m_n); \
+  allocAndInitHipDeviceData(P, m_P.get<Real_type>(), m_n * m_n); \
+  allocAndInitHipDeviceData(Q, m_Q.get<Real_type>(), m_n * m_n);
 
 
 #define POLYBENCH_ADI_TEARDOWN_HIP \
-  getHipDeviceData(m_U, U, m_n * m_n); \
+  getHipDeviceData(m_U.get<Real_type>(), U, m_n * m_n); \
   deallocHipDeviceData(U); \
   deallocHipDeviceData(V); \
   deallocHipDeviceData(P); \
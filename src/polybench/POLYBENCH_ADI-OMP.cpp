@@ -19,13 +19,14 @@ namespace polybench
 {
 
 
-void POLYBENCH_ADI::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void POLYBENCH_ADI::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps = getRunReps();
 
-  POLYBENCH_ADI_DATA_SETUP;
+  POLYBENCH_ADI_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -134,7 +135,7 @@ void POLYBENCH_ADI::runOpenMPVariant(VariantID vid)
 
     case RAJA_OpenMP : {
 
-      POLYBENCH_ADI_VIEWS_RAJA;
+      POLYBENCH_ADI_VIEWS_RAJA_TYPED(Data_type);
 
       auto poly_adi_lam2 = [=](Index_type i) {
                              POLYBENCH_ADI_BODY2_RAJA;
@@ -217,6 +218,18 @@ void POLYBENCH_ADI::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void POLYBENCH_ADI::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
@@ -30,13 +30,13 @@ namespace polybench
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(U, m_U, m_n * m_n, did, hid); \
-  allocAndInitOpenMPDeviceData(V, m_V, m_n * m_n, did, hid); \
-  allocAndInitOpenMPDeviceData(P, m_P, m_n * m_n, did, hid); \
-  allocAndInitOpenMPDeviceData(Q, m_Q, m_n * m_n, did, hid);
+  allocAndInitOpenMPDeviceData(U, m_U.get<Real_type>(), m_n * m_n, did, hid); \
+  allocAndInitOpenMPDeviceData(V, m_V.get<Real_type>(), m_n * m_n, did, hid); \
+  allocAndInitOpenMPDeviceData(P, m_P.get<Real_type>(), m_n * m_n, did, hid); \
+  allocAndInitOpenMPDeviceData(Q, m_Q.get<Real_type>(), m_n * m_n, did, hid);
 
 #define POLYBENCH_ADI_DATA_TEARDOWN_OMP_TARGET \
-  getOpenMPDeviceData(m_U, U, m_n * m_n, hid, did); \
+  getOpenMPDeviceData(m_U.get<Real_type>(), U, m_n * m_n, hid, did); \
   deallocOpenMPDeviceData(U, did); \
   deallocOpenMPDeviceData(V, did); \
   deallocOpenMPDeviceData(P, did); \
@@ -18,11 +18,12 @@ namespace rajaperf
 namespace polybench
 {
 
-void POLYBENCH_ADI::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void POLYBENCH_ADI::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
 
-  POLYBENCH_ADI_DATA_SETUP;
+  POLYBENCH_ADI_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -128,7 +129,7 @@ void POLYBENCH_ADI::runSeqVariant(VariantID vid)
 
     case RAJA_Seq : {
 
-      POLYBENCH_ADI_VIEWS_RAJA;
+      POLYBENCH_ADI_VIEWS_RAJA_TYPED(Data_type);
 
       auto poly_adi_lam2 = [=](Index_type i) {
                              POLYBENCH_ADI_BODY2_RAJA;
@@ -215,5 +216,13 @@ void POLYBENCH_ADI::runSeqVariant(VariantID vid)
 
 }
 
+void POLYBENCH_ADI::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -11,6 +11,8 @@
 #include "RAJA/RAJA.hpp"
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 namespace polybench
@@ -63,6 +65,18 @@ POLYBENCH_ADI::POLYBENCH_ADI(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    m_tsteps * ( (3*data_size + 3*data_size) * m_n * (m_n-2) +
+                                 (3*data_size + 3*data_size) * m_n * (m_n-2) ) );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 POLYBENCH_ADI::~POLYBENCH_ADI()
@@ -71,10 +85,12 @@ POLYBENCH_ADI::~POLYBENCH_ADI()
 
 void POLYBENCH_ADI::setUp(VariantID vid)
 {
-  allocAndInitDataConst(m_U, m_n * m_n, 0.0, vid);
-  allocAndInitData(m_V, m_n * m_n, vid);
-  allocAndInitData(m_P, m_n * m_n, vid);
-  allocAndInitData(m_Q, m_n * m_n, vid);
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitDataConst(m_U, m_n * m_n, 0.0, pid, vid);
+  allocAndInitData(m_V, m_n * m_n, pid, vid);
+  allocAndInitData(m_P, m_n * m_n, pid, vid);
+  allocAndInitData(m_Q, m_n * m_n, pid, vid);
 }
 
 void POLYBENCH_ADI::updateChecksum(VariantID vid)
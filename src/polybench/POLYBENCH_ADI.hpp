@@ -64,28 +64,30 @@
 #define RAJAPerf_POLYBENCH_ADI_HPP
 
 
-#define POLYBENCH_ADI_DATA_SETUP \
+#define POLYBENCH_ADI_DATA_SETUP_TYPED(Data_type) \
   const Index_type n = m_n; \
   const Index_type tsteps = m_tsteps; \
 \
-  Real_type DX = 1.0/(Real_type)n; \
-  Real_type DY = 1.0/(Real_type)n; \
-  Real_type DT = 1.0/(Real_type)tsteps; \
-  Real_type B1 = 2.0; \
-  Real_type B2 = 1.0; \
-  Real_type mul1 = B1 * DT / (DX * DX); \
-  Real_type mul2 = B2 * DT / (DY * DY); \
-  Real_type a = -mul1 / 2.0; \
-  Real_type b = 1.0 + mul1; \
-  Real_type c = a; \
-  Real_type d = -mul2 /2.0; \
-  Real_type e = 1.0 + mul2; \
-  Real_type f = d; \
+  Data_type DX = 1.0/(Data_type)n; \
+  Data_type DY = 1.0/(Data_type)n; \
+  Data_type DT = 1.0/(Data_type)tsteps; \
+  Data_type B1 = 2.0; \
+  Data_type B2 = 1.0; \
+  Data_type mul1 = B1 * DT / (DX * DX); \
+  Data_type mul2 = B2 * DT / (DY * DY); \
+  Data_type a = -mul1 / 2.0; \
+  Data_type b = 1.0 + mul1; \
+  Data_type c = a; \
+  Data_type d = -mul2 /2.0; \
+  Data_type e = 1.0 + mul2; \
+  Data_type f = d; \
 \
-  Real_ptr U = m_U; \
-  Real_ptr V = m_V; \
-  Real_ptr P = m_P; \
-  Real_ptr Q = m_Q;
+  Data_type* U = m_U.get<Data_type>(); \
+  Data_type* V = m_V.get<Data_type>(); \
+  Data_type* P = m_P.get<Data_type>(); \
+  Data_type* Q = m_Q.get<Data_type>();
+
+#define POLYBENCH_ADI_DATA_SETUP POLYBENCH_ADI_DATA_SETUP_TYPED(Real_type)
 
 
 #define POLYBENCH_ADI_BODY2 \
@@ -158,8 +160,8 @@
   Uview(i, k) = Pview(i, k) * Uview(i, k+1) + Qview(i, k);
 
 
-#define POLYBENCH_ADI_VIEWS_RAJA \
-  using VIEW_TYPE = RAJA::View<Real_type, \
+#define POLYBENCH_ADI_VIEWS_RAJA_TYPED(Data_type) \
+  using VIEW_TYPE = RAJA::View<Data_type, \
                           RAJA::Layout<2, Index_type, 1>>; \
 \
   VIEW_TYPE Uview(U, RAJA::Layout<2>(n, n)); \
@@ -167,6 +169,8 @@
   VIEW_TYPE Pview(P, RAJA::Layout<2>(n, n)); \
   VIEW_TYPE Qview(Q, RAJA::Layout<2>(n, n));
 
+#define POLYBENCH_ADI_VIEWS_RAJA POLYBENCH_ADI_VIEWS_RAJA_TYPED(Real_type)
+
 
 #include "common/KernelBase.hpp"
 
@@ -197,13 +201,18 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
   Index_type m_n;
   Index_type m_tsteps;
 
-  Real_ptr m_U;
-  Real_ptr m_V;
-  Real_ptr m_P;
-  Real_ptr m_Q;
+  Precision_ptr m_U;
+  Precision_ptr m_V;
+  Precision_ptr m_P;
+  Precision_ptr m_Q;
 };
 
 } // end namespace polybench
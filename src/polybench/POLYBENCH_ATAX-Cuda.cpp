@@ -27,14 +27,14 @@ namespace polybench
   const size_t block_size = 256;
 
 #define POLYBENCH_ATAX_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(tmp, m_tmp, N); \
-  allocAndInitCudaDeviceData(y, m_y, N); \
-  allocAndInitCudaDeviceData(x, m_x, N); \
-  allocAndInitCudaDeviceData(A, m_A, N * N);
+  allocAndInitCudaDeviceData(tmp, m_tmp.get<Real_type>(), N); \
+  allocAndInitCudaDeviceData(y, m_y.get<Real_type>(), N); \
+  allocAndInitCudaDeviceData(x, m_x.get<Real_type>(), N); \
+  allocAndInitCudaDeviceData(A, m_A.get<Real_type>(), N * N);
 
 
 #define POLYBENCH_ATAX_TEARDOWN_CUDA \
-  getCudaDeviceData(m_y, y, N); \
+  getCudaDeviceData(m_y.get<Real_type>(), y, N); \
   deallocCudaDeviceData(tmp); \
   deallocCudaDeviceData(y); \
   deallocCudaDeviceData(x); \
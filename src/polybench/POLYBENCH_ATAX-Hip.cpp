@@ -27,14 +27,14 @@ namespace polybench
   const size_t block_size = 256;
 
 #define POLYBENCH_ATAX_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(tmp, m_tmp, N); \
-  allocAndInitHipDeviceData(y, m_y, N); \
-  allocAndInitHipDeviceData(x, m_x, N); \
-  allocAndInitHipDeviceData(A, m_A, N * N);
+  allocAndInitHipDeviceData(tmp, m_tmp.get<Real_type>(), N); \
+  allocAndInitHipDeviceData(y, m_y.get<Real_type>(), N); \
+  allocAndInitHipDeviceData(x, m_x.get<Real_type>(), N); \
+  allocAndInitHipDeviceData(A, m_A.get<Real_type>(), N * N);
 
 
 #define POLYBENCH_ATAX_TEARDOWN_HIP \
-  getHipDeviceData(m_y, y, N); \
+  getHipDeviceData(m_y.get<Real_type>(), y, N); \
   deallocHipDeviceData(tmp); \
   deallocHipDeviceData(y); \
   deallocHipDeviceData(x); \
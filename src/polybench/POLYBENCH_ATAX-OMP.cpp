@@ -19,13 +19,14 @@ namespace polybench
 {
 
 
-void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void POLYBENCH_ATAX::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps= getRunReps();
 
-  POLYBENCH_ATAX_DATA_SETUP;
+  POLYBENCH_ATAX_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -36,7 +37,7 @@ void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid)
 
         #pragma omp parallel for
         for (Index_type i = 0; i < N; ++i ) {
-          POLYBENCH_ATAX_BODY1;
+          POLYBENCH_ATAX_BODY1_TYPED(Data_type);
           for (Index_type j = 0; j < N; ++j ) {
             POLYBENCH_ATAX_BODY2;
           }
@@ -45,7 +46,7 @@ void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid)
 
         #pragma omp parallel for
         for (Index_type j = 0; j < N; ++j ) {
-          POLYBENCH_ATAX_BODY4;
+          POLYBENCH_ATAX_BODY4_TYPED(Data_type);
           for (Index_type i = 0; i < N; ++i ) {
             POLYBENCH_ATAX_BODY5;
           }
@@ -61,19 +62,19 @@ void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid)
     case Lambda_OpenMP : {
 
       auto poly_atax_base_lam2 = [=] (Index_type i, Index_type j,
-                                      Real_type &dot) {
+                                      Data_type &dot) {
                                    POLYBENCH_ATAX_BODY2;
                                  };
       auto poly_atax_base_lam3 = [=] (Index_type i,
-                                      Real_type &dot) {
+                                      Data_type &dot) {
                                    POLYBENCH_ATAX_BODY3;
                                   };
       auto poly_atax_base_lam5 = [=] (Index_type i, Index_type j ,
-                                      Real_type &dot) {
+                                      Data_type &dot) {
                                    POLYBENCH_ATAX_BODY5;
                                   };
       auto poly_atax_base_lam6 = [=] (Index_type j,
-                                      Real_type &dot) {
+                                      Data_type &dot) {
                                    POLYBENCH_ATAX_BODY6;
                                   };
 
@@ -82,7 +83,7 @@ void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid)
 
         #pragma omp parallel for
         for (Index_type i = 0; i < N; ++i ) {
-          POLYBENCH_ATAX_BODY1;
+          POLYBENCH_ATAX_BODY1_TYPED(Data_type);
           for (Index_type j = 0; j < N; ++j ) {
             poly_atax_base_lam2(i, j, dot);
           }
@@ -91,7 +92,7 @@ void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid)
 
         #pragma omp parallel for
         for (Index_type j = 0; j < N; ++j ) {
-          POLYBENCH_ATAX_BODY4;
+          POLYBENCH_ATAX_BODY4_TYPED(Data_type);
           for (Index_type i = 0; i < N; ++i ) {
             poly_atax_base_lam5(i, j, dot);
           }
@@ -106,24 +107,24 @@ void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid)
 
     case RAJA_OpenMP : {
 
-      POLYBENCH_ATAX_VIEWS_RAJA;
+      POLYBENCH_ATAX_VIEWS_RAJA_TYPED(Data_type);
 
-      auto poly_atax_lam1 = [=] (Index_type i, Real_type &dot) {
+      auto poly_atax_lam1 = [=] (Index_type i, Data_type &dot) {
                               POLYBENCH_ATAX_BODY1_RAJA;
                              };
-      auto poly_atax_lam2 = [=] (Index_type i, Index_type j, Real_type &dot) {
+      auto poly_atax_lam2 = [=] (Index_type i, Index_type j, Data_type &dot) {
                               POLYBENCH_ATAX_BODY2_RAJA;
                              };
-      auto poly_atax_lam3 = [=] (Index_type i, Real_type &dot) {
+      auto poly_atax_lam3 = [=] (Index_type i, Data_type &dot) {
                               POLYBENCH_ATAX_BODY3_RAJA;
                              };
-      auto poly_atax_lam4 = [=] (Index_type j, Real_type &dot) {
+      auto poly_atax_lam4 = [=] (Index_type j, Data_type &dot) {
                               POLYBENCH_ATAX_BODY4_RAJA;
                              };
-      auto poly_atax_lam5 = [=] (Index_type i, Index_type j , Real_type &dot) {
+      auto poly_atax_lam5 = [=] (Index_type i, Index_type j , Data_type &dot) {
                               POLYBENCH_ATAX_BODY5_RAJA;
                              };
-      auto poly_atax_lam6 = [=] (Index_type j, Real_type &dot) {
+      auto poly_atax_lam6 = [=] (Index_type j, Data_type &dot) {
                               POLYBENCH_ATAX_BODY6_RAJA;
                              };
       using EXEC_POL1 =
@@ -155,7 +156,7 @@ void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid)
         RAJA::kernel_param<EXEC_POL1>(
           RAJA::make_tuple(RAJA::RangeSegment{0, N},
                            RAJA::RangeSegment{0, N}),
-          RAJA::tuple<Real_type>{0.0},
+          RAJA::tuple<Data_type>{0.0},
 
           poly_atax_lam1,
           poly_atax_lam2,
@@ -166,7 +167,7 @@ void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid)
         RAJA::kernel_param<EXEC_POL2>(
           RAJA::make_tuple(RAJA::RangeSegment{0, N},
                            RAJA::RangeSegment{0, N}),
-          RAJA::tuple<Real_type>{0.0},
+          RAJA::tuple<Data_type>{0.0},
 
           poly_atax_lam4,
           poly_atax_lam5,
@@ -185,6 +186,18 @@ void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void POLYBENCH_ATAX::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
@@ -30,14 +30,14 @@ namespace polybench
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(tmp, m_tmp, N, did, hid); \
-  allocAndInitOpenMPDeviceData(y, m_y, N, did, hid); \
-  allocAndInitOpenMPDeviceData(x, m_x, N, did, hid); \
-  allocAndInitOpenMPDeviceData(A, m_A, N * N, did, hid);
+  allocAndInitOpenMPDeviceData(tmp, m_tmp.get<Real_type>(), N, did, hid); \
+  allocAndInitOpenMPDeviceData(y, m_y.get<Real_type>(), N, did, hid); \
+  allocAndInitOpenMPDeviceData(x, m_x.get<Real_type>(), N, did, hid); \
+  allocAndInitOpenMPDeviceData(A, m_A.get<Real_type>(), N * N, did, hid);
 
 
 #define POLYBENCH_ATAX_TEARDOWN_OMP_TARGET \
-  getOpenMPDeviceData(m_y, y, N, hid, did); \
+  getOpenMPDeviceData(m_y.get<Real_type>(), y, N, hid, did); \
   deallocOpenMPDeviceData(tmp, did); \
   deallocOpenMPDeviceData(y, did); \
   deallocOpenMPDeviceData(x, did); \
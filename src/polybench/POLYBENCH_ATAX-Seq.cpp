@@ -18,11 +18,12 @@ namespace rajaperf
 namespace polybench
 {
 
-void POLYBENCH_ATAX::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void POLYBENCH_ATAX::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps= getRunReps();
 
-  POLYBENCH_ATAX_DATA_SETUP;
+  POLYBENCH_ATAX_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -32,7 +33,7 @@ void POLYBENCH_ATAX::runSeqVariant(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         for (Index_type i = 0; i < N; ++i ) {
-          POLYBENCH_ATAX_BODY1;
+          POLYBENCH_ATAX_BODY1_TYPED(Data_type);
           for (Index_type j = 0; j < N; ++j ) {
             POLYBENCH_ATAX_BODY2;
           }
@@ -40,7 +41,7 @@ void POLYBENCH_ATAX::runSeqVariant(VariantID vid)
         }
 
         for (Index_type j = 0; j < N; ++j ) {
-          POLYBENCH_ATAX_BODY4;
+          POLYBENCH_ATAX_BODY4_TYPED(Data_type);
           for (Index_type i = 0; i < N; ++i ) {
             POLYBENCH_ATAX_BODY5;
           }
@@ -58,19 +59,19 @@ void POLYBENCH_ATAX::runSeqVariant(VariantID vid)
     case Lambda_Seq : {
 
       auto poly_atax_base_lam2 = [=] (Index_type i, Index_type j,
-                                      Real_type &dot) {
+                                      Data_type &dot) {
                                    POLYBENCH_ATAX_BODY2;
                                  };
       auto poly_atax_base_lam3 = [=] (Index_type i,
-                                      Real_type &dot) {
+                                      Data_type &dot) {
                                    POLYBENCH_ATAX_BODY3;
                                   };
       auto poly_atax_base_lam5 = [=] (Index_type i, Index_type j ,
-                                      Real_type &dot) {
+                                      Data_type &dot) {
                                    POLYBENCH_ATAX_BODY5;
                                   };
       auto poly_atax_base_lam6 = [=] (Index_type j,
-                                      Real_type &dot) {
+                                      Data_type &dot) {
                                    POLYBENCH_ATAX_BODY6;
                                   };
 
@@ -78,7 +79,7 @@ void POLYBENCH_ATAX::runSeqVariant(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         for (Index_type i = 0; i < N; ++i ) {
-          POLYBENCH_ATAX_BODY1;
+          POLYBENCH_ATAX_BODY1_TYPED(Data_type);
           for (Index_type j = 0; j < N; ++j ) {
             poly_atax_base_lam2(i, j, dot);
           }
@@ -86,7 +87,7 @@ void POLYBENCH_ATAX::runSeqVariant(VariantID vid)
         }
 
         for (Index_type j = 0; j < N; ++j ) {
-          POLYBENCH_ATAX_BODY4;
+          POLYBENCH_ATAX_BODY4_TYPED(Data_type);
           for (Index_type i = 0; i < N; ++i ) {
             poly_atax_base_lam5(i, j, dot);
           }
@@ -101,24 +102,24 @@ void POLYBENCH_ATAX::runSeqVariant(VariantID vid)
 
     case RAJA_Seq : {
 
-      POLYBENCH_ATAX_VIEWS_RAJA;
+      POLYBENCH_ATAX_VIEWS_RAJA_TYPED(Data_type);
 
-      auto poly_atax_lam1 = [=] (Index_type i, Real_type &dot) {
+      auto poly_atax_lam1 = [=] (Index_type i, Data_type &dot) {
                               POLYBENCH_ATAX_BODY1_RAJA;
                              };
-      auto poly_atax_lam2 = [=] (Index_type i, Index_type j, Real_type &dot) {
+      auto poly_atax_lam2 = [=] (Index_type i, Index_type j, Data_type &dot) {
                               POLYBENCH_ATAX_BODY2_RAJA;
                              };
-      auto poly_atax_lam3 = [=] (Index_type i, Real_type &dot) {
+      auto poly_atax_lam3 = [=] (Index_type i, Data_type &dot) {
                               POLYBENCH_ATAX_BODY3_RAJA;
                              };
-      auto poly_atax_lam4 = [=] (Index_type j, Real_type &dot) {
+      auto poly_atax_lam4 = [=] (Index_type j, Data_type &dot) {
                               POLYBENCH_ATAX_BODY4_RAJA;
                              };
-      auto poly_atax_lam5 = [=] (Index_type i, Index_type j , Real_type &dot) {
+      auto poly_atax_lam5 = [=] (Index_type i, Index_type j , Data_type &dot) {
                               POLYBENCH_ATAX_BODY5_RAJA;
                              };
-      auto poly_atax_lam6 = [=] (Index_type j, Real_type &dot) {
+      auto poly_atax_lam6 = [=] (Index_type j, Data_type &dot) {
                               POLYBENCH_ATAX_BODY6_RAJA;
                              };
 
@@ -151,7 +152,7 @@ void POLYBENCH_ATAX::runSeqVariant(VariantID vid)
         RAJA::kernel_param<EXEC_POL1>(
           RAJA::make_tuple(RAJA::RangeSegment{0, N},
                            RAJA::RangeSegment{0, N}),
-          RAJA::tuple<Real_type>{0.0},
+          RAJA::tuple<Data_type>{0.0},
 
           poly_atax_lam1,
           poly_atax_lam2,
@@ -162,7 +163,7 @@ void POLYBENCH_ATAX::runSeqVariant(VariantID vid)
         RAJA::kernel_param<EXEC_POL2>(
           RAJA::make_tuple(RAJA::RangeSegment{0, N},
                            RAJA::RangeSegment{0, N}),
-          RAJA::tuple<Real_type>{0.0},
+          RAJA::tuple<Data_type>{0.0},
 
           poly_atax_lam4,
           poly_atax_lam5,
@@ -185,5 +186,13 @@ void POLYBENCH_ATAX::runSeqVariant(VariantID vid)
 
 }
 
+void POLYBENCH_ATAX::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
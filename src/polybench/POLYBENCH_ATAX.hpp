@@ -26,18 +26,22 @@
 #ifndef RAJAPerf_POLYBENCH_ATAX_HPP
 #define RAJAPerf_POLYBENCH_ATAX_HPP
 
-#define POLYBENCH_ATAX_DATA_SETUP \
-  Real_ptr tmp = m_tmp; \
-  Real_ptr y = m_y; \
-  Real_ptr x = m_x; \
-  Real_ptr A = m_A; \
+#define POLYBENCH_ATAX_DATA_SETUP_TYPED(Data_type) \
+  Data_type* tmp = m_tmp.get<Data_type>(); \
+  Data_type* y = m_y.get<Data_type>(); \
+  Data_type* x = m_x.get<Data_type>(); \
+  Data_type* A = m_A.get<Data_type>(); \
 \
   const Index_type N = m_N;
 
+#define POLYBENCH_ATAX_DATA_SETUP POLYBENCH_ATAX_DATA_SETUP_TYPED(Real_type)
 
-#define POLYBENCH_ATAX_BODY1 \
+
+#define POLYBENCH_ATAX_BODY1_TYPED(Data_type) \
   y[i] = 0.0; \
-  Real_type dot = 0.0;
+  Data_type dot = 0.0;
+
+#define POLYBENCH_ATAX_BODY1 POLYBENCH_ATAX_BODY1_TYPED(Real_type)
 
 #define POLYBENCH_ATAX_BODY2 \
   dot += A[j + i*N] * x[j];
@@ -45,8 +49,10 @@
 #define POLYBENCH_ATAX_BODY3 \
   tmp[i] = dot;
 
-#define POLYBENCH_ATAX_BODY4 \
-  Real_type dot = y[j];
+#define POLYBENCH_ATAX_BODY4_TYPED(Data_type) \
+  Data_type dot = y[j];
+
+#define POLYBENCH_ATAX_BODY4 POLYBENCH_ATAX_BODY4_TYPED(Real_type)
 
 #define POLYBENCH_ATAX_BODY5 \
   dot += A[j + i*N] * tmp[i];
@@ -75,11 +81,11 @@
   yview(j) = dot;
 
 
-#define POLYBENCH_ATAX_VIEWS_RAJA \
-  using VIEW_1 = RAJA::View<Real_type, \
+#define POLYBENCH_ATAX_VIEWS_RAJA_TYPED(Data_type) \
+  using VIEW_1 = RAJA::View<Data_type, \
                             RAJA::Layout<1, Index_type, 0>>; \
 \
-  using VIEW_2 = RAJA::View<Real_type, \
+  using VIEW_2 = RAJA::View<Data_type, \
                             RAJA::Layout<2, Index_type, 1>>; \
 \
   VIEW_1 tmpview(tmp, RAJA::Layout<1>(N)); \
@@ -87,6 +93,8 @@
   VIEW_1 yview(y, RAJA::Layout<1>(N)); \
   VIEW_2 Aview(A, RAJA::Layout<2>(N, N));
 
+#define POLYBENCH_ATAX_VIEWS_RAJA POLYBENCH_ATAX_VIEWS_RAJA_TYPED(Real_type)
+
 
 #include "common/KernelBase.hpp"
 
@@ -117,11 +125,16 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
   Index_type m_N;
-  Real_ptr m_tmp;
-  Real_ptr m_y;
-  Real_ptr m_x;
-  Real_ptr m_A;
+  Precision_ptr m_tmp;
+  Precision_ptr m_y;
+  Precision_ptr m_x;
+  Precision_ptr m_A;
 };
 
 } // end namespace polybench
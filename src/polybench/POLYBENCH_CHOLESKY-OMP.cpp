@@ -0,0 +1,202 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_CHOLESKY.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cmath>
+#include <iostream>
+
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+template < typename Data_type >
+void POLYBENCH_CHOLESKY::runOpenMPVariantPrecision(VariantID vid)
+{
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_CHOLESKY_DATA_SETUP_TYPED(Data_type);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+
+          #pragma omp for
+          for (Index_type i = 0; i < N; ++i ) {
+            for (Index_type j = 0; j < N; ++j ) {
+              POLYBENCH_CHOLESKY_BODY1;
+            }
+          }
+
+          for (Index_type j = 0; j < N; ++j ) {
+            #pragma omp single
+            {
+              POLYBENCH_CHOLESKY_BODY2;
+            }
+            #pragma omp for schedule(static)
+            for (Index_type i = j+1; i < N; ++i ) {
+              POLYBENCH_CHOLESKY_BODY3;
+            }
+            #pragma omp for schedule(static, 1)
+            for (Index_type i = j+1; i < N; ++i ) {
+              for (Index_type l = j+1; l <= i; ++l ) {
+                POLYBENCH_CHOLESKY_BODY4;
+              }
+            }
+          }
+
+        } // end omp parallel region
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto poly_cholesky_base_lam1 = [=](Index_type i, Index_type j) {
+                                       POLYBENCH_CHOLESKY_BODY1;
+                                     };
+      auto poly_cholesky_base_lam2 = [=](Index_type j) {
+                                       POLYBENCH_CHOLESKY_BODY2;
+                                     };
+      auto poly_cholesky_base_lam3 = [=](Index_type i, Index_type j) {
+                                       POLYBENCH_CHOLESKY_BODY3;
+                                     };
+      auto poly_cholesky_base_lam4 = [=](Index_type i, Index_type j,
+                                         Index_type l) {
+                                       POLYBENCH_CHOLESKY_BODY4;
+                                     };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+
+          #pragma omp for
+          for (Index_type i = 0; i < N; ++i ) {
+            for (Index_type j = 0; j < N; ++j ) {
+              poly_cholesky_base_lam1(i, j);
+            }
+          }
+
+          for (Index_type j = 0; j < N; ++j ) {
+            #pragma omp single
+            {
+              poly_cholesky_base_lam2(j);
+            }
+            #pragma omp for schedule(static)
+            for (Index_type i = j+1; i < N; ++i ) {
+              poly_cholesky_base_lam3(i, j);
+            }
+            #pragma omp for schedule(static, 1)
+            for (Index_type i = j+1; i < N; ++i ) {
+              for (Index_type l = j+1; l <= i; ++l ) {
+                poly_cholesky_base_lam4(i, j, l);
+              }
+            }
+          }
+
+        } // end omp parallel region
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      POLYBENCH_CHOLESKY_VIEWS_RAJA_TYPED(Data_type);
+
+      auto poly_cholesky_lam1 = [=](Index_type i, Index_type j) {
+                                  POLYBENCH_CHOLESKY_BODY1_RAJA;
+                                };
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<0, RAJA::omp_parallel_for_exec,
+            RAJA::statement::For<1, RAJA::loop_exec,
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>(
+          RAJA::make_tuple( RAJA::RangeSegment{0, N},
+                            RAJA::RangeSegment{0, N} ),
+          poly_cholesky_lam1
+        );
+
+        for (Index_type j = 0; j < N; ++j ) {
+
+          POLYBENCH_CHOLESKY_BODY2_RAJA;
+
+          RAJA::forall<RAJA::omp_parallel_for_exec>(
+            RAJA::RangeSegment{j+1, N}, [=](Index_type i) {
+            POLYBENCH_CHOLESKY_BODY3_RAJA;
+          });
+
+          RAJA::forall<RAJA::omp_parallel_for_static_exec<1>>(
+            RAJA::RangeSegment{j+1, N}, [=](Index_type i) {
+            for (Index_type l = j+1; l <= i; ++l ) {
+              POLYBENCH_CHOLESKY_BODY4_RAJA;
+            }
+          });
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_CHOLESKY : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void POLYBENCH_CHOLESKY::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
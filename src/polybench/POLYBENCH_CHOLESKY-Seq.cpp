@@ -0,0 +1,173 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_CHOLESKY.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cmath>
+#include <iostream>
+
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+template < typename Data_type >
+void POLYBENCH_CHOLESKY::runSeqVariantPrecision(VariantID vid)
+{
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_CHOLESKY_DATA_SETUP_TYPED(Data_type);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < N; ++i ) {
+          for (Index_type j = 0; j < N; ++j ) {
+            POLYBENCH_CHOLESKY_BODY1;
+          }
+        }
+
+        for (Index_type j = 0; j < N; ++j ) {
+          POLYBENCH_CHOLESKY_BODY2;
+          for (Index_type i = j+1; i < N; ++i ) {
+            POLYBENCH_CHOLESKY_BODY3;
+          }
+          for (Index_type i = j+1; i < N; ++i ) {
+            for (Index_type l = j+1; l <= i; ++l ) {
+              POLYBENCH_CHOLESKY_BODY4;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto poly_cholesky_base_lam1 = [=](Index_type i, Index_type j) {
+                                       POLYBENCH_CHOLESKY_BODY1;
+                                     };
+      auto poly_cholesky_base_lam2 = [=](Index_type j) {
+                                       POLYBENCH_CHOLESKY_BODY2;
+                                     };
+      auto poly_cholesky_base_lam3 = [=](Index_type i, Index_type j) {
+                                       POLYBENCH_CHOLESKY_BODY3;
+                                     };
+      auto poly_cholesky_base_lam4 = [=](Index_type i, Index_type j,
+                                         Index_type l) {
+                                       POLYBENCH_CHOLESKY_BODY4;
+                                     };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < N; ++i ) {
+          for (Index_type j = 0; j < N; ++j ) {
+            poly_cholesky_base_lam1(i, j);
+          }
+        }
+
+        for (Index_type j = 0; j < N; ++j ) {
+          poly_cholesky_base_lam2(j);
+          for (Index_type i = j+1; i < N; ++i ) {
+            poly_cholesky_base_lam3(i, j);
+          }
+          for (Index_type i = j+1; i < N; ++i ) {
+            for (Index_type l = j+1; l <= i; ++l ) {
+              poly_cholesky_base_lam4(i, j, l);
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      POLYBENCH_CHOLESKY_VIEWS_RAJA_TYPED(Data_type);
+
+      auto poly_cholesky_lam1 = [=](Index_type i, Index_type j) {
+                                  POLYBENCH_CHOLESKY_BODY1_RAJA;
+                                };
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<0, RAJA::loop_exec,
+            RAJA::statement::For<1, RAJA::loop_exec,
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>(
+          RAJA::make_tuple( RAJA::RangeSegment{0, N},
+                            RAJA::RangeSegment{0, N} ),
+          poly_cholesky_lam1
+        );
+
+        for (Index_type j = 0; j < N; ++j ) {
+
+          POLYBENCH_CHOLESKY_BODY2_RAJA;
+
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment{j+1, N}, [=](Index_type i) {
+            POLYBENCH_CHOLESKY_BODY3_RAJA;
+          });
+
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment{j+1, N}, [=](Index_type i) {
+            for (Index_type l = j+1; l <= i; ++l ) {
+              POLYBENCH_CHOLESKY_BODY4_RAJA;
+            }
+          });
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  POLYBENCH_CHOLESKY : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void POLYBENCH_CHOLESKY::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
@@ -0,0 +1,139 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// POLYBENCH_CHOLESKY kernel reference implementation:
+///
+/// for (Index_type i = 0; i < N; i++) {
+///   for (Index_type j = 0; j < N; j++) {
+///     A[i][j] = Ainit[i][j];
+///   }
+/// }
+///
+/// for (Index_type j = 0; j < N; j++) {
+///   A[j][j] = std::sqrt(A[j][j]);
+///   for (Index_type i = j+1; i < N; i++) {
+///     A[i][j] /= A[j][j];
+///   }
+///   for (Index_type i = j+1; i < N; i++) {
+///     for (Index_type l = j+1; l <= i; l++) {
+///       A[i][l] -= A[i][j] * A[l][j];
+///     }
+///   }
+/// }
+///
+/// This is the right-looking form of the Polybench Cholesky factorization
+/// of the lower triangle. Every entry receives the same updates in the
+/// same order as in the Polybench loop nest; for a given column j the
+/// scaling of the column and the update of the trailing triangle are each
+/// parallel over rows. The matrix is restored from the symmetric positive
+/// definite Ainit at the start of each repetition.
+///
+
+
+#ifndef RAJAPerf_POLYBENCH_CHOLESKY_HPP
+#define RAJAPerf_POLYBENCH_CHOLESKY_HPP
+
+#define POLYBENCH_CHOLESKY_DATA_SETUP_TYPED(Data_type) \
+  Data_type* A = m_A.get<Data_type>(); \
+  Data_type* Ainit = m_Ainit.get<Data_type>(); \
+\
+  const Index_type N = m_N;
+
+#define POLYBENCH_CHOLESKY_DATA_SETUP POLYBENCH_CHOLESKY_DATA_SETUP_TYPED(Real_type)
+
+
+#define POLYBENCH_CHOLESKY_BODY1 \
+  A[j + i*N] = Ainit[j + i*N];
+
+#define POLYBENCH_CHOLESKY_BODY2 \
+  A[j + j*N] = std::sqrt(A[j + j*N]);
+
+#define POLYBENCH_CHOLESKY_BODY3 \
+  A[j + i*N] /= A[j + j*N];
+
+#define POLYBENCH_CHOLESKY_BODY4 \
+  A[l + i*N] -= A[j + i*N] * A[j + l*N];
+
+
+#define POLYBENCH_CHOLESKY_BODY1_RAJA \
+  Aview(i, j) = Ainitview(i, j);
+
+#define POLYBENCH_CHOLESKY_BODY2_RAJA \
+  Aview(j, j) = std::sqrt(Aview(j, j));
+
+#define POLYBENCH_CHOLESKY_BODY3_RAJA \
+  Aview(i, j) /= Aview(j, j);
+
+#define POLYBENCH_CHOLESKY_BODY4_RAJA \
+  Aview(i, l) -= Aview(i, j) * Aview(l, j);
+
+
+#define POLYBENCH_CHOLESKY_VIEWS_RAJA_TYPED(Data_type) \
+  using VIEW_TYPE = RAJA::View<Data_type, \
+                               RAJA::Layout<2, Index_type, 1>>; \
+\
+  VIEW_TYPE Aview(A, RAJA::Layout<2>(N, N)); \
+  VIEW_TYPE Ainitview(Ainit, RAJA::Layout<2>(N, N));
+
+#define POLYBENCH_CHOLESKY_VIEWS_RAJA POLYBENCH_CHOLESKY_VIEWS_RAJA_TYPED(Real_type)
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+
+class RunParams;
+
+namespace polybench
+{
+
+class POLYBENCH_CHOLESKY : public KernelBase
+{
+public:
+
+  POLYBENCH_CHOLESKY(const RunParams& params);
+
+  ~POLYBENCH_CHOLESKY();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  POLYBENCH_CHOLESKY : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  POLYBENCH_CHOLESKY : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  POLYBENCH_CHOLESKY : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Index_type m_N;
+
+  Precision_ptr m_A;
+  Precision_ptr m_Ainit;
+};
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
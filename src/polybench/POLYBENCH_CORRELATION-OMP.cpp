@@ -0,0 +1,233 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_CORRELATION.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <cmath>
+#include <iostream>
+
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+template < typename Data_type >
+void POLYBENCH_CORRELATION::runOpenMPVariantPrecision(VariantID vid)
+{
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_CORRELATION_DATA_SETUP_TYPED(Data_type);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type j = 0; j < M; ++j ) {
+          POLYBENCH_CORRELATION_BODY1;
+          for (Index_type i = 0; i < N; ++i ) {
+            POLYBENCH_CORRELATION_BODY2;
+          }
+          POLYBENCH_CORRELATION_BODY3;
+          for (Index_type i = 0; i < N; ++i ) {
+            POLYBENCH_CORRELATION_BODY4;
+          }
+          POLYBENCH_CORRELATION_BODY5;
+        }
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < N; ++i ) {
+          for (Index_type j = 0; j < M; ++j ) {
+            POLYBENCH_CORRELATION_BODY6;
+          }
+        }
+
+        #pragma omp parallel for schedule(static, 1)
+        for (Index_type i = 0; i < M; ++i ) {
+          POLYBENCH_CORRELATION_BODY7;
+          for (Index_type j = i+1; j < M; ++j ) {
+            POLYBENCH_CORRELATION_BODY8_TYPED(Data_type);
+            for (Index_type k = 0; k < N; ++k ) {
+              POLYBENCH_CORRELATION_BODY9;
+            }
+            POLYBENCH_CORRELATION_BODY10;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto poly_correlation_base_lam1 = [=](Index_type j) {
+                                          POLYBENCH_CORRELATION_BODY1;
+                                        };
+      auto poly_correlation_base_lam2 = [=](Index_type i, Index_type j) {
+                                          POLYBENCH_CORRELATION_BODY2;
+                                        };
+      auto poly_correlation_base_lam3 = [=](Index_type j) {
+                                          POLYBENCH_CORRELATION_BODY3;
+                                        };
+      auto poly_correlation_base_lam4 = [=](Index_type i, Index_type j) {
+                                          POLYBENCH_CORRELATION_BODY4;
+                                        };
+      auto poly_correlation_base_lam5 = [=](Index_type j) {
+                                          POLYBENCH_CORRELATION_BODY5;
+                                        };
+      auto poly_correlation_base_lam6 = [=](Index_type i, Index_type j) {
+                                          POLYBENCH_CORRELATION_BODY6;
+                                        };
+      auto poly_correlation_base_lam7 = [=](Index_type i) {
+                                          POLYBENCH_CORRELATION_BODY7;
+                                        };
+      auto poly_correlation_base_lam9 = [=](Index_type i, Index_type j,
+                                            Index_type k, Data_type& dot) {
+                                          POLYBENCH_CORRELATION_BODY9;
+                                        };
+      auto poly_correlation_base_lam10 = [=](Index_type i, Index_type j,
+                                             Data_type dot) {
+                                           POLYBENCH_CORRELATION_BODY10;
+                                         };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type j = 0; j < M; ++j ) {
+          poly_correlation_base_lam1(j);
+          for (Index_type i = 0; i < N; ++i ) {
+            poly_correlation_base_lam2(i, j);
+          }
+          poly_correlation_base_lam3(j);
+          for (Index_type i = 0; i < N; ++i ) {
+            poly_correlation_base_lam4(i, j);
+          }
+          poly_correlation_base_lam5(j);
+        }
+
+        #pragma omp parallel for
+        for (Index_type i = 0; i < N; ++i ) {
+          for (Index_type j = 0; j < M; ++j ) {
+            poly_correlation_base_lam6(i, j);
+          }
+        }
+
+        #pragma omp parallel for schedule(static, 1)
+        for (Index_type i = 0; i < M; ++i ) {
+          poly_correlation_base_lam7(i);
+          for (Index_type j = i+1; j < M; ++j ) {
+            POLYBENCH_CORRELATION_BODY8_TYPED(Data_type);
+            for (Index_type k = 0; k < N; ++k ) {
+              poly_correlation_base_lam9(i, j, k, dot);
+            }
+            poly_correlation_base_lam10(i, j, dot);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      POLYBENCH_CORRELATION_VIEWS_RAJA_TYPED(Data_type);
+
+      auto poly_correlation_lam1 = [=](Index_type j) {
+                                     POLYBENCH_CORRELATION_BODY1_RAJA;
+                                     for (Index_type i = 0; i < N; ++i ) {
+                                       POLYBENCH_CORRELATION_BODY2_RAJA;
+                                     }
+                                     POLYBENCH_CORRELATION_BODY3_RAJA;
+                                     for (Index_type i = 0; i < N; ++i ) {
+                                       POLYBENCH_CORRELATION_BODY4_RAJA;
+                                     }
+                                     POLYBENCH_CORRELATION_BODY5_RAJA;
+                                   };
+      auto poly_correlation_lam2 = [=](Index_type i, Index_type j) {
+                                     POLYBENCH_CORRELATION_BODY6_RAJA;
+                                   };
+      auto poly_correlation_lam3 = [=](Index_type i) {
+                                     POLYBENCH_CORRELATION_BODY7_RAJA;
+                                     for (Index_type j = i+1; j < M; ++j ) {
+                                       POLYBENCH_CORRELATION_BODY8_TYPED(Data_type);
+                                       for (Index_type k = 0; k < N; ++k ) {
+                                         POLYBENCH_CORRELATION_BODY9_RAJA;
+                                       }
+                                       POLYBENCH_CORRELATION_BODY10_RAJA;
+                                     }
+                                   };
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<0, RAJA::omp_parallel_for_exec,
+            RAJA::statement::For<1, RAJA::loop_exec,
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment{0, M}, poly_correlation_lam1);
+
+        RAJA::kernel<EXEC_POL>(
+          RAJA::make_tuple( RAJA::RangeSegment{0, N},
+                            RAJA::RangeSegment{0, M} ),
+          poly_correlation_lam2
+        );
+
+        RAJA::forall<RAJA::omp_parallel_for_static_exec<1>>(
+          RAJA::RangeSegment{0, M}, poly_correlation_lam3);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_CORRELATION : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void POLYBENCH_CORRELATION::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
@@ -0,0 +1,113 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_CORRELATION.hpp"
+
+#include "RAJA/RAJA.hpp"
+#include "common/DataUtils.hpp"
+
+#include <vector>
+
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+POLYBENCH_CORRELATION::POLYBENCH_CORRELATION(const RunParams& params)
+  : KernelBase(rajaperf::Polybench_CORRELATION, params)
+{
+  Index_type M_default = 1000;
+  Index_type N_default = 1200;
+
+  setDefaultProblemSize( M_default * M_default );
+  setDefaultReps(2);
+
+  m_M = std::sqrt( getTargetProblemSize() ) + 1;
+  m_N = N_default;
+
+  m_eps = 0.1;
+
+
+  setActualProblemSize( m_M * m_M );
+
+  setItsPerRep( 2 * m_M +
+                m_N * m_M +
+                m_M * (m_M + 1) / 2 );
+  setKernelsPerRep(3);
+  setBytesPerRep( (2*sizeof(Real_type ) + 0*sizeof(Real_type )) * m_M +
+                  (0*sizeof(Real_type ) + 2*sizeof(Real_type )) * m_N * m_M +
+                  (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_N * m_M +
+                  (1*sizeof(Real_type ) + 0*sizeof(Real_type )) * m_M * m_M );
+  setFLOPsPerRep( (4 * m_N + 3) * m_M +
+                  4 * m_N * m_M +
+                  2 * m_N * m_M * (m_M - 1) / 2 );
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Kernel);
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (2*data_size + 0*data_size) * m_M +
+                    (0*data_size + 2*data_size) * m_N * m_M +
+                    (1*data_size + 1*data_size) * m_N * m_M +
+                    (1*data_size + 0*data_size) * m_M * m_M );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
+}
+
+POLYBENCH_CORRELATION::~POLYBENCH_CORRELATION()
+{
+}
+
+void POLYBENCH_CORRELATION::setUp(VariantID vid)
+{
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitDataRandValue(m_data, m_N * m_M, pid, vid);
+  allocAndInitDataConst(m_dnorm, m_N * m_M, 0.0, pid, vid);
+  allocAndInitDataConst(m_mean, m_M, 0.0, pid, vid);
+  allocAndInitDataConst(m_stddev, m_M, 0.0, pid, vid);
+  allocAndInitDataConst(m_corr, m_M * m_M, 0.0, pid, vid);
+}
+
+void POLYBENCH_CORRELATION::updateChecksum(VariantID vid)
+{
+  checksum[vid] += calcChecksum(m_corr, m_M * m_M, checksum_scale_factor );
+}
+
+void POLYBENCH_CORRELATION::tearDown(VariantID vid)
+{
+  (void) vid;
+  deallocData(m_data);
+  deallocData(m_dnorm);
+  deallocData(m_mean);
+  deallocData(m_stddev);
+  deallocData(m_corr);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
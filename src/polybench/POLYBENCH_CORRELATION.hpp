@@ -0,0 +1,209 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// POLYBENCH_CORRELATION kernel reference implementation:
+///
+/// for (j = 0; j < M; j++) {
+///   mean[j] = 0.0;
+///   for (i = 0; i < N; i++) {
+///     mean[j] += data[i][j];
+///   }
+///   mean[j] /= float_n;
+///   stddev[j] = 0.0;
+///   for (i = 0; i < N; i++) {
+///     stddev[j] += (data[i][j] - mean[j]) * (data[i][j] - mean[j]);
+///   }
+///   stddev[j] = sqrt(stddev[j] / float_n);
+///   stddev[j] = stddev[j] <= eps ? 1.0 : stddev[j];
+/// }
+///
+/// for (i = 0; i < N; i++) {
+///   for (j = 0; j < M; j++) {
+///     dnorm[i][j] = (data[i][j] - mean[j]) / (sqrt(float_n) * stddev[j]);
+///   }
+/// }
+///
+/// for (i = 0; i < M; i++) {
+///   corr[i][i] = 1.0;
+///   for (j = i+1; j < M; j++) {
+///     Real_type dot = 0.0;
+///     for (k = 0; k < N; k++) {
+///       dot += dnorm[k][i] * dnorm[k][j];
+///     }
+///     corr[i][j] = dot;
+///     corr[j][i] = dot;
+///   }
+/// }
+///
+/// Unlike Polybench, the centered and scaled data is written to dnorm
+/// rather than back into data, so every repetition sees the same input.
+///
+
+
+#ifndef RAJAPerf_POLYBENCH_CORRELATION_HPP
+#define RAJAPerf_POLYBENCH_CORRELATION_HPP
+
+#define POLYBENCH_CORRELATION_DATA_SETUP_TYPED(Data_type) \
+  Data_type* data = m_data.get<Data_type>(); \
+  Data_type* dnorm = m_dnorm.get<Data_type>(); \
+  Data_type* mean = m_mean.get<Data_type>(); \
+  Data_type* stddev = m_stddev.get<Data_type>(); \
+  Data_type* corr = m_corr.get<Data_type>(); \
+\
+  const Index_type N = m_N; \
+  const Index_type M = m_M; \
+\
+  const Data_type float_n = static_cast<Data_type>(N); \
+  const Data_type eps = m_eps;
+
+#define POLYBENCH_CORRELATION_DATA_SETUP POLYBENCH_CORRELATION_DATA_SETUP_TYPED(Real_type)
+
+
+#define POLYBENCH_CORRELATION_BODY1 \
+  mean[j] = 0.0;
+
+#define POLYBENCH_CORRELATION_BODY2 \
+  mean[j] += data[j + i*M];
+
+#define POLYBENCH_CORRELATION_BODY3 \
+  mean[j] /= float_n; \
+  stddev[j] = 0.0;
+
+#define POLYBENCH_CORRELATION_BODY4 \
+  stddev[j] += (data[j + i*M] - mean[j]) * (data[j + i*M] - mean[j]);
+
+#define POLYBENCH_CORRELATION_BODY5 \
+  stddev[j] = std::sqrt(stddev[j] / float_n); \
+  stddev[j] = stddev[j] <= eps ? 1.0 : stddev[j];
+
+#define POLYBENCH_CORRELATION_BODY6 \
+  dnorm[j + i*M] = (data[j + i*M] - mean[j]) / (std::sqrt(float_n) * stddev[j]);
+
+#define POLYBENCH_CORRELATION_BODY7 \
+  corr[i + i*M] = 1.0;
+
+#define POLYBENCH_CORRELATION_BODY8_TYPED(Data_type) \
+  Data_type dot = 0.0;
+
+#define POLYBENCH_CORRELATION_BODY8 POLYBENCH_CORRELATION_BODY8_TYPED(Real_type)
+
+#define POLYBENCH_CORRELATION_BODY9 \
+  dot += dnorm[i + k*M] * dnorm[j + k*M];
+
+#define POLYBENCH_CORRELATION_BODY10 \
+  corr[j + i*M] = dot; \
+  corr[i + j*M] = dot;
+
+
+#define POLYBENCH_CORRELATION_BODY1_RAJA \
+  meanview(j) = 0.0;
+
+#define POLYBENCH_CORRELATION_BODY2_RAJA \
+  meanview(j) += dataview(i, j);
+
+#define POLYBENCH_CORRELATION_BODY3_RAJA \
+  meanview(j) /= float_n; \
+  stddevview(j) = 0.0;
+
+#define POLYBENCH_CORRELATION_BODY4_RAJA \
+  stddevview(j) += (dataview(i, j) - meanview(j)) * (dataview(i, j) - meanview(j));
+
+#define POLYBENCH_CORRELATION_BODY5_RAJA \
+  stddevview(j) = std::sqrt(stddevview(j) / float_n); \
+  stddevview(j) = stddevview(j) <= eps ? 1.0 : stddevview(j);
+
+#define POLYBENCH_CORRELATION_BODY6_RAJA \
+  dnormview(i, j) = (dataview(i, j) - meanview(j)) / (std::sqrt(float_n) * stddevview(j));
+
+#define POLYBENCH_CORRELATION_BODY7_RAJA \
+  corrview(i, i) = 1.0;
+
+#define POLYBENCH_CORRELATION_BODY9_RAJA \
+  dot += dnormview(k, i) * dnormview(k, j);
+
+#define POLYBENCH_CORRELATION_BODY10_RAJA \
+  corrview(i, j) = dot; \
+  corrview(j, i) = dot;
+
+
+#define POLYBENCH_CORRELATION_VIEWS_RAJA_TYPED(Data_type) \
+  using VIEW_1 = RAJA::View<Data_type, \
+                            RAJA::Layout<1, Index_type, 0>>; \
+\
+  using VIEW_2 = RAJA::View<Data_type, \
+                            RAJA::Layout<2, Index_type, 1>>; \
+\
+  VIEW_2 dataview(data, RAJA::Layout<2>(N, M)); \
+  VIEW_2 dnormview(dnorm, RAJA::Layout<2>(N, M)); \
+  VIEW_1 meanview(mean, RAJA::Layout<1>(M)); \
+  VIEW_1 stddevview(stddev, RAJA::Layout<1>(M)); \
+  VIEW_2 corrview(corr, RAJA::Layout<2>(M, M));
+
+#define POLYBENCH_CORRELATION_VIEWS_RAJA POLYBENCH_CORRELATION_VIEWS_RAJA_TYPED(Real_type)
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+
+class RunParams;
+
+namespace polybench
+{
+
+class POLYBENCH_CORRELATION : public KernelBase
+{
+public:
+
+  POLYBENCH_CORRELATION(const RunParams& params);
+
+  ~POLYBENCH_CORRELATION();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  POLYBENCH_CORRELATION : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  POLYBENCH_CORRELATION : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  POLYBENCH_CORRELATION : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Index_type m_N;
+  Index_type m_M;
+
+  Real_type m_eps;
+
+  Precision_ptr m_data;
+  Precision_ptr m_dnorm;
+  Precision_ptr m_mean;
+  Precision_ptr m_stddev;
+  Precision_ptr m_corr;
+};
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
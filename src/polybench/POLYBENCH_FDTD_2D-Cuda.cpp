@@ -39,14 +39,14 @@ namespace polybench
 
 
 #define POLYBENCH_FDTD_2D_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(hz, m_hz, m_nx * m_ny); \
-  allocAndInitCudaDeviceData(ex, m_ex, m_nx * m_ny); \
-  allocAndInitCudaDeviceData(ey, m_ey, m_nx * m_ny); \
-  allocAndInitCudaDeviceData(fict, m_fict, m_tsteps);
+  allocAndInitCudaDeviceData(hz, m_hz.get<Real_type>(), m_nx * m_ny); \
+  allocAndInitCudaDeviceData(ex, m_ex.get<Real_type>(), m_nx * m_ny); \
+  allocAndInitCudaDeviceData(ey, m_ey.get<Real_type>(), m_nx * m_ny); \
+  allocAndInitCudaDeviceData(fict, m_fict.get<Real_type>(), m_tsteps);
 
 
 #define POLYBENCH_FDTD_2D_TEARDOWN_CUDA \
-  getCudaDeviceData(m_hz, hz, m_nx * m_ny); \
+  getCudaDeviceData(m_hz.get<Real_type>(), hz, m_nx * m_ny); \
   deallocCudaDeviceData(ex); \
   deallocCudaDeviceData(ey); \
   deallocCudaDeviceData(fict);
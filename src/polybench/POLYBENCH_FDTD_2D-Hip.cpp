@@ -38,14 +38,14 @@ namespace polybench
                   static_cast<size_t>(1));
 
 #define POLYBENCH_FDTD_2D_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(hz, m_hz, m_nx * m_ny); \
-  allocAndInitHipDeviceData(ex, m_ex, m_nx * m_ny); \
-  allocAndInitHipDeviceData(ey, m_ey, m_nx * m_ny); \
-  allocAndInitHipDeviceData(fict, m_fict, m_tsteps);
+  allocAndInitHipDeviceData(hz, m_hz.get<Real_type>(), m_nx * m_ny); \
+  allocAndInitHipDeviceData(ex, m_ex.get<Real_type>(), m_nx * m_ny); \
+  allocAndInitHipDeviceData(ey, m_ey.get<Real_type>(), m_nx * m_ny); \
+  allocAndInitHipDeviceData(fict, m_fict.get<Real_type>(), m_tsteps);
 
 
 #define POLYBENCH_FDTD_2D_TEARDOWN_HIP \
-  getHipDeviceData(m_hz, hz, m_nx * m_ny); \
+  getHipDeviceData(m_hz.get<Real_type>(), hz, m_nx * m_ny); \
   deallocHipDeviceData(ex); \
   deallocHipDeviceData(ey); \
   deallocHipDeviceData(fict);
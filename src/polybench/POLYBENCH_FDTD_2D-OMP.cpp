@@ -18,13 +18,14 @@ namespace polybench
 {
 
 
-void POLYBENCH_FDTD_2D::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void POLYBENCH_FDTD_2D::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps = getRunReps();
 
-  POLYBENCH_FDTD_2D_DATA_SETUP;
+  POLYBENCH_FDTD_2D_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -124,7 +125,7 @@ void POLYBENCH_FDTD_2D::runOpenMPVariant(VariantID vid)
 
     case RAJA_OpenMP : {
 
-      POLYBENCH_FDTD_2D_VIEWS_RAJA;
+      POLYBENCH_FDTD_2D_VIEWS_RAJA_TYPED(Data_type);
 
       //
       // Note: first lambda must use capture by reference so that the
@@ -195,6 +196,18 @@ void POLYBENCH_FDTD_2D::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void POLYBENCH_FDTD_2D::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
@@ -30,14 +30,14 @@ namespace polybench
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(hz, m_hz, m_nx * m_ny, did, hid); \
-  allocAndInitOpenMPDeviceData(ex, m_ex, m_nx * m_ny, did, hid); \
-  allocAndInitOpenMPDeviceData(ey, m_ey, m_nx * m_ny, did, hid); \
-  allocAndInitOpenMPDeviceData(fict, m_fict, m_tsteps, did, hid);
+  allocAndInitOpenMPDeviceData(hz, m_hz.get<Real_type>(), m_nx * m_ny, did, hid); \
+  allocAndInitOpenMPDeviceData(ex, m_ex.get<Real_type>(), m_nx * m_ny, did, hid); \
+  allocAndInitOpenMPDeviceData(ey, m_ey.get<Real_type>(), m_nx * m_ny, did, hid); \
+  allocAndInitOpenMPDeviceData(fict, m_fict.get<Real_type>(), m_tsteps, did, hid);
 
 
 #define POLYBENCH_FDTD_2D_TEARDOWN_OMP_TARGET  \
-  getOpenMPDeviceData(m_hz, hz, m_nx * m_ny, hid, did); \
+  getOpenMPDeviceData(m_hz.get<Real_type>(), hz, m_nx * m_ny, hid, did); \
   deallocOpenMPDeviceData(ex, did); \
   deallocOpenMPDeviceData(ey, did); \
   deallocOpenMPDeviceData(fict, did);
@@ -18,11 +18,12 @@ namespace polybench
 {
 
 
-void POLYBENCH_FDTD_2D::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void POLYBENCH_FDTD_2D::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
 
-  POLYBENCH_FDTD_2D_DATA_SETUP;
+  POLYBENCH_FDTD_2D_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -115,7 +116,7 @@ void POLYBENCH_FDTD_2D::runSeqVariant(VariantID vid)
 
     case RAJA_Seq : {
 
-      POLYBENCH_FDTD_2D_VIEWS_RAJA;
+      POLYBENCH_FDTD_2D_VIEWS_RAJA_TYPED(Data_type);
 
       //
       // Note: first lambda must use capture by reference so that the
@@ -191,5 +192,13 @@ void POLYBENCH_FDTD_2D::runSeqVariant(VariantID vid)
 
 }
 
+void POLYBENCH_FDTD_2D::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
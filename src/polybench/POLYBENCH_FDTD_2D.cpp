@@ -11,6 +11,8 @@
 #include "RAJA/RAJA.hpp"
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 #include <algorithm>
 #include <iostream>
 #include <cstring>
@@ -84,6 +86,28 @@ POLYBENCH_FDTD_2D::POLYBENCH_FDTD_2D(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    m_tsteps * ( (0*data_size + 1*data_size) +
+                                 (1*data_size + 0*data_size) * m_ny +
+  
+                                 (1*data_size + 1*data_size) * (m_nx-1) * m_ny +
+                                 (0*data_size + 1*data_size) * m_nx * m_ny +
+  
+                                 (1*data_size + 1*data_size) * m_nx * (m_ny-1) +
+                                 (0*data_size + 1*data_size) * m_nx * m_ny +
+  
+                                 (1*data_size + 1*data_size) * (m_nx-1) * (m_ny-1) +
+                                 (0*data_size + 1*data_size) * (m_nx-1) * m_ny +
+                                 (0*data_size + 1*data_size) * m_nx * (m_ny-1) ) );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 POLYBENCH_FDTD_2D::~POLYBENCH_FDTD_2D()
@@ -92,10 +116,12 @@ POLYBENCH_FDTD_2D::~POLYBENCH_FDTD_2D()
 
 void POLYBENCH_FDTD_2D::setUp(VariantID vid)
 {
-  allocAndInitDataConst(m_hz, m_nx * m_ny, 0.0, vid);
-  allocAndInitData(m_ex, m_nx * m_ny, vid);
-  allocAndInitData(m_ey, m_nx * m_ny, vid);
-  allocAndInitData(m_fict, m_tsteps, vid);
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitDataConst(m_hz, m_nx * m_ny, 0.0, pid, vid);
+  allocAndInitData(m_ex, m_nx * m_ny, pid, vid);
+  allocAndInitData(m_ey, m_nx * m_ny, pid, vid);
+  allocAndInitData(m_fict, m_tsteps, pid, vid);
 }
 
 void POLYBENCH_FDTD_2D::updateChecksum(VariantID vid)
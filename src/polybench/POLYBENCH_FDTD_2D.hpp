@@ -37,16 +37,18 @@
 #define RAJAPerf_POLYBENCH_FDTD_2D_HPP
 
 
-#define POLYBENCH_FDTD_2D_DATA_SETUP \
+#define POLYBENCH_FDTD_2D_DATA_SETUP_TYPED(Data_type) \
   Index_type t = 0; \
   const Index_type nx = m_nx; \
   const Index_type ny = m_ny; \
   const Index_type tsteps = m_tsteps; \
 \
-  Real_ptr fict = m_fict; \
-  Real_ptr ex = m_ex; \
-  Real_ptr ey = m_ey; \
-  Real_ptr hz = m_hz;
+  Data_type* fict = m_fict.get<Data_type>(); \
+  Data_type* ex = m_ex.get<Data_type>(); \
+  Data_type* ey = m_ey.get<Data_type>(); \
+  Data_type* hz = m_hz.get<Data_type>();
+
+#define POLYBENCH_FDTD_2D_DATA_SETUP POLYBENCH_FDTD_2D_DATA_SETUP_TYPED(Real_type)
 
 
 #define POLYBENCH_FDTD_2D_BODY1 \
@@ -77,14 +79,16 @@
                                      eyview(i+1, j) - eyview(i, j));
 
 
-#define POLYBENCH_FDTD_2D_VIEWS_RAJA \
-using VIEW_TYPE = RAJA::View<Real_type, \
+#define POLYBENCH_FDTD_2D_VIEWS_RAJA_TYPED(Data_type) \
+using VIEW_TYPE = RAJA::View<Data_type, \
                              RAJA::Layout<2, Index_type, 1>>; \
 \
   VIEW_TYPE exview(ex, RAJA::Layout<2>(nx, ny)); \
   VIEW_TYPE eyview(ey, RAJA::Layout<2>(nx, ny)); \
   VIEW_TYPE hzview(hz, RAJA::Layout<2>(nx, ny));
 
+#define POLYBENCH_FDTD_2D_VIEWS_RAJA POLYBENCH_FDTD_2D_VIEWS_RAJA_TYPED(Real_type)
+
 
 #include "common/KernelBase.hpp"
 
@@ -115,14 +119,19 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
   Index_type m_nx;
   Index_type m_ny;
   Index_type m_tsteps;
 
-  Real_ptr m_fict;
-  Real_ptr m_ex;
-  Real_ptr m_ey;
-  Real_ptr m_hz;
+  Precision_ptr m_fict;
+  Precision_ptr m_ex;
+  Precision_ptr m_ey;
+  Precision_ptr m_hz;
 };
 
 } // end namespace polybench
@@ -35,12 +35,12 @@ constexpr size_t j_block_sz = 32;
 
 
 #define POLYBENCH_FLOYD_WARSHALL_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(pin, m_pin, m_N * m_N); \
-  allocAndInitCudaDeviceData(pout, m_pout, m_N * m_N);
+  allocAndInitCudaDeviceData(pin, m_pin.get<Real_type>(), m_N * m_N); \
+  allocAndInitCudaDeviceData(pout, m_pout.get<Real_type>(), m_N * m_N);
 
 
 #define POLYBENCH_FLOYD_WARSHALL_TEARDOWN_CUDA \
-  getCudaDeviceData(m_pout, pout, m_N * m_N); \
+  getCudaDeviceData(m_pout.get<Real_type>(), pout, m_N * m_N); \
   deallocCudaDeviceData(pin); \
   deallocCudaDeviceData(pout);
 
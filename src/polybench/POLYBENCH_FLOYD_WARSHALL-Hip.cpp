@@ -35,12 +35,12 @@ constexpr size_t j_block_sz = 32;
 
 
 #define POLYBENCH_FLOYD_WARSHALL_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(pin, m_pin, m_N * m_N); \
-  allocAndInitHipDeviceData(pout, m_pout, m_N * m_N);
+  allocAndInitHipDeviceData(pin, m_pin.get<Real_type>(), m_N * m_N); \
+  allocAndInitHipDeviceData(pout, m_pout.get<Real_type>(), m_N * m_N);
 
 
 #define POLYBENCH_FLOYD_WARSHALL_TEARDOWN_HIP \
-  getHipDeviceData(m_pout, pout, m_N * m_N); \
+  getHipDeviceData(m_pout.get<Real_type>(), pout, m_N * m_N); \
   deallocHipDeviceData(pin); \
   deallocHipDeviceData(pout);
 
@@ -24,13 +24,14 @@ namespace polybench
 {
 
 
-void POLYBENCH_FLOYD_WARSHALL::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void POLYBENCH_FLOYD_WARSHALL::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps= getRunReps();
 
-  POLYBENCH_FLOYD_WARSHALL_DATA_SETUP;
+  POLYBENCH_FLOYD_WARSHALL_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -89,7 +90,7 @@ void POLYBENCH_FLOYD_WARSHALL::runOpenMPVariant(VariantID vid)
 
     case RAJA_OpenMP : {
 
-      POLYBENCH_FLOYD_WARSHALL_VIEWS_RAJA;
+      POLYBENCH_FLOYD_WARSHALL_VIEWS_RAJA_TYPED(Data_type);
 
       auto poly_floydwarshall_lam = [=](Index_type k, Index_type i,
                                         Index_type j) {
@@ -139,6 +140,18 @@ void POLYBENCH_FLOYD_WARSHALL::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void POLYBENCH_FLOYD_WARSHALL::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
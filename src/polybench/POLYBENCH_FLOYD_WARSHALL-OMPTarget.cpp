@@ -25,12 +25,12 @@ namespace polybench
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(pin, m_pin, m_N * m_N, did, hid); \
-  allocAndInitOpenMPDeviceData(pout, m_pout, m_N * m_N, did, hid);
+  allocAndInitOpenMPDeviceData(pin, m_pin.get<Real_type>(), m_N * m_N, did, hid); \
+  allocAndInitOpenMPDeviceData(pout, m_pout.get<Real_type>(), m_N * m_N, did, hid);
 
 
 #define POLYBENCH_FLOYD_WARSHALL_TEARDOWN_OMP_TARGET \
-  getOpenMPDeviceData(m_pout, pout, m_N * m_N, hid, did); \
+  getOpenMPDeviceData(m_pout.get<Real_type>(), pout, m_N * m_N, hid, did); \
   deallocOpenMPDeviceData(pin, did); \
   deallocOpenMPDeviceData(pout, did);
 
@@ -18,11 +18,12 @@ namespace polybench
 {
 
 
-void POLYBENCH_FLOYD_WARSHALL::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void POLYBENCH_FLOYD_WARSHALL::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps= getRunReps();
 
-  POLYBENCH_FLOYD_WARSHALL_DATA_SETUP;
+  POLYBENCH_FLOYD_WARSHALL_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -73,7 +74,7 @@ void POLYBENCH_FLOYD_WARSHALL::runSeqVariant(VariantID vid)
 
     case RAJA_Seq : {
 
-      POLYBENCH_FLOYD_WARSHALL_VIEWS_RAJA;
+      POLYBENCH_FLOYD_WARSHALL_VIEWS_RAJA_TYPED(Data_type);
 
       auto poly_floydwarshall_lam = [=](Index_type k, Index_type i,
                                         Index_type j) {
@@ -115,5 +116,13 @@ void POLYBENCH_FLOYD_WARSHALL::runSeqVariant(VariantID vid)
 
 }
 
+void POLYBENCH_FLOYD_WARSHALL::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -11,6 +11,8 @@
 #include "RAJA/RAJA.hpp"
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 
 namespace rajaperf
 {
@@ -60,6 +62,17 @@ POLYBENCH_FLOYD_WARSHALL::POLYBENCH_FLOYD_WARSHALL(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (1*data_size + 1*data_size) * m_N * m_N );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 POLYBENCH_FLOYD_WARSHALL::~POLYBENCH_FLOYD_WARSHALL()
@@ -69,8 +82,10 @@ POLYBENCH_FLOYD_WARSHALL::~POLYBENCH_FLOYD_WARSHALL()
 void POLYBENCH_FLOYD_WARSHALL::setUp(VariantID vid)
 {
   (void) vid;
-  allocAndInitDataRandSign(m_pin, m_N*m_N, vid);
-  allocAndInitDataConst(m_pout, m_N*m_N, 0.0, vid);
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitDataRandSign(m_pin, m_N*m_N, pid, vid);
+  allocAndInitDataConst(m_pout, m_N*m_N, 0.0, pid, vid);
 }
 
 void POLYBENCH_FLOYD_WARSHALL::updateChecksum(VariantID vid)
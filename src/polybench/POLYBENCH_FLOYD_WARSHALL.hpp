@@ -25,11 +25,13 @@
 #ifndef RAJAPerf_POLYBENCH_FLOYD_WARSHALL_HPP
 #define RAJAPerf_POLYBENCH_FLOYD_WARSHALL_HPP
 
-#define POLYBENCH_FLOYD_WARSHALL_DATA_SETUP \
-  Real_ptr pin = m_pin; \
-  Real_ptr pout = m_pout; \
+#define POLYBENCH_FLOYD_WARSHALL_DATA_SETUP_TYPED(Data_type) \
+  Data_type* pin = m_pin.get<Data_type>(); \
+  Data_type* pout = m_pout.get<Data_type>(); \
   const Index_type N = m_N;
 
+#define POLYBENCH_FLOYD_WARSHALL_DATA_SETUP POLYBENCH_FLOYD_WARSHALL_DATA_SETUP_TYPED(Real_type)
+
 
 #define POLYBENCH_FLOYD_WARSHALL_BODY \
   pout[j + i*N] = pin[j + i*N] < pin[k + i*N] + pin[j + k*N] ? \
@@ -41,13 +43,15 @@
                    pinview(i, j) : pinview(i, k) + pinview(k, j);
 
 
-#define POLYBENCH_FLOYD_WARSHALL_VIEWS_RAJA \
-  using VIEW_TYPE = RAJA::View<Real_type, \
+#define POLYBENCH_FLOYD_WARSHALL_VIEWS_RAJA_TYPED(Data_type) \
+  using VIEW_TYPE = RAJA::View<Data_type, \
                                RAJA::Layout<2, Index_type, 1>>; \
 \
   VIEW_TYPE pinview(pin, RAJA::Layout<2>(N, N)); \
   VIEW_TYPE poutview(pout, RAJA::Layout<2>(N, N));
 
+#define POLYBENCH_FLOYD_WARSHALL_VIEWS_RAJA POLYBENCH_FLOYD_WARSHALL_VIEWS_RAJA_TYPED(Real_type)
+
 
 #include "common/KernelBase.hpp"
 
@@ -78,10 +82,15 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
   Index_type m_N;
 
-  Real_ptr m_pin;
-  Real_ptr m_pout;
+  Precision_ptr m_pin;
+  Precision_ptr m_pout;
 };
 
 } // end namespace polybench
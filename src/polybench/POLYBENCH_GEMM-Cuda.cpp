@@ -37,13 +37,13 @@ constexpr size_t j_block_sz = 32;
 
 
 #define POLYBENCH_GEMM_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(A, m_A, ni*nk); \
-  allocAndInitCudaDeviceData(B, m_B, nk*nj); \
-  allocAndInitCudaDeviceData(C, m_C, ni*nj);
+  allocAndInitCudaDeviceData(A, m_A.get<Real_type>(), ni*nk); \
+  allocAndInitCudaDeviceData(B, m_B.get<Real_type>(), nk*nj); \
+  allocAndInitCudaDeviceData(C, m_C.get<Real_type>(), ni*nj);
 
 
 #define POLYBENCH_GEMM_TEARDOWN_CUDA \
-  getCudaDeviceData(m_C, C, ni*nj); \
+  getCudaDeviceData(m_C.get<Real_type>(), C, ni*nj); \
   deallocCudaDeviceData(A); \
   deallocCudaDeviceData(B); \
   deallocCudaDeviceData(C);
@@ -37,13 +37,13 @@ constexpr size_t j_block_sz = 32;
 
 
 #define POLYBENCH_GEMM_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(A, m_A, ni*nk); \
-  allocAndInitHipDeviceData(B, m_B, nk*nj); \
-  allocAndInitHipDeviceData(C, m_C, ni*nj);
+  allocAndInitHipDeviceData(A, m_A.get<Real_type>(), ni*nk); \
+  allocAndInitHipDeviceData(B, m_B.get<Real_type>(), nk*nj); \
+  allocAndInitHipDeviceData(C, m_C.get<Real_type>(), ni*nj);
 
 
 #define POLYBENCH_GEMM_TEARDOWN_HIP \
-  getHipDeviceData(m_C, C, ni*nj); \
+  getHipDeviceData(m_C.get<Real_type>(), C, ni*nj); \
   deallocHipDeviceData(A); \
   deallocHipDeviceData(B); \
   deallocHipDeviceData(C);
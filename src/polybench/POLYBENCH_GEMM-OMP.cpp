@@ -19,13 +19,14 @@ namespace polybench
 {
 
 
-void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void POLYBENCH_GEMM::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps= getRunReps();
 
-  POLYBENCH_GEMM_DATA_SETUP;
+  POLYBENCH_GEMM_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -37,7 +38,7 @@ void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid)
         #pragma omp parallel for collapse(2)
         for (Index_type i = 0; i < ni; ++i ) {
           for (Index_type j = 0; j < nj; ++j ) {
-            POLYBENCH_GEMM_BODY1;
+            POLYBENCH_GEMM_BODY1_TYPED(Data_type);
             POLYBENCH_GEMM_BODY2;
             for (Index_type k = 0; k < nk; ++k ) {
               POLYBENCH_GEMM_BODY3;
@@ -58,11 +59,11 @@ void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid)
                                    POLYBENCH_GEMM_BODY2;
                                  };
       auto poly_gemm_base_lam3 = [=](Index_type i, Index_type j, Index_type k,
-                                     Real_type& dot) {
+                                     Data_type& dot) {
                                    POLYBENCH_GEMM_BODY3;
                                   };
       auto poly_gemm_base_lam4 = [=](Index_type i, Index_type j,
-                                     Real_type& dot) {
+                                     Data_type& dot) {
                                    POLYBENCH_GEMM_BODY4;
                                   };
 
@@ -72,7 +73,7 @@ void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid)
         #pragma omp parallel for collapse(2)
         for (Index_type i = 0; i < ni; ++i ) {
           for (Index_type j = 0; j < nj; ++j ) {
-            POLYBENCH_GEMM_BODY1;
+            POLYBENCH_GEMM_BODY1_TYPED(Data_type);
             poly_gemm_base_lam2(i, j);
             for (Index_type k = 0; k < nk; ++k ) {
               poly_gemm_base_lam3(i, j, k, dot);
@@ -89,20 +90,20 @@ void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid)
 
     case RAJA_OpenMP : {
 
-      POLYBENCH_GEMM_VIEWS_RAJA;
+      POLYBENCH_GEMM_VIEWS_RAJA_TYPED(Data_type);
 
-      auto poly_gemm_lam1 = [=](Real_type& dot) {
+      auto poly_gemm_lam1 = [=](Data_type& dot) {
                                 POLYBENCH_GEMM_BODY1_RAJA;
                                };
       auto poly_gemm_lam2 = [=](Index_type i, Index_type j) {
                                 POLYBENCH_GEMM_BODY2_RAJA;
                                };
       auto poly_gemm_lam3 = [=](Index_type i, Index_type j, Index_type k,
-                                Real_type& dot) {
+                                Data_type& dot) {
                                 POLYBENCH_GEMM_BODY3_RAJA;
                                };
       auto poly_gemm_lam4 = [=](Index_type i, Index_type j,
-                                Real_type& dot) {
+                                Data_type& dot) {
                                 POLYBENCH_GEMM_BODY4_RAJA;
                                };
 
@@ -127,7 +128,7 @@ void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid)
           RAJA::make_tuple( RAJA::RangeSegment{0, ni},
                             RAJA::RangeSegment{0, nj},
                             RAJA::RangeSegment{0, nk} ),
-          RAJA::tuple<Real_type>{0.0},  // variable for dot
+          RAJA::tuple<Data_type>{0.0},  // variable for dot
 
           poly_gemm_lam1,
           poly_gemm_lam2,
@@ -147,6 +148,18 @@ void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
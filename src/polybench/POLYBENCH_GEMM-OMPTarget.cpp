@@ -25,13 +25,13 @@ namespace polybench
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(A, m_A, ni*nk, did, hid); \
-  allocAndInitOpenMPDeviceData(B, m_B, nk*nj, did, hid); \
-  allocAndInitOpenMPDeviceData(C, m_C, ni*nj, did, hid);
+  allocAndInitOpenMPDeviceData(A, m_A.get<Real_type>(), ni*nk, did, hid); \
+  allocAndInitOpenMPDeviceData(B, m_B.get<Real_type>(), nk*nj, did, hid); \
+  allocAndInitOpenMPDeviceData(C, m_C.get<Real_type>(), ni*nj, did, hid);
 
 
 #define POLYBENCH_GEMM_TEARDOWN_OMP_TARGET \
-  getOpenMPDeviceData(m_C, C, ni*nj, hid, did); \
+  getOpenMPDeviceData(m_C.get<Real_type>(), C, ni*nj, hid, did); \
   deallocOpenMPDeviceData(A, did); \
   deallocOpenMPDeviceData(B, did); \
   deallocOpenMPDeviceData(C, did);
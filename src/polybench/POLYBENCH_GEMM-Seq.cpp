@@ -19,11 +19,12 @@ namespace polybench
 {
 
 
-void POLYBENCH_GEMM::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void POLYBENCH_GEMM::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps= getRunReps();
 
-  POLYBENCH_GEMM_DATA_SETUP;
+  POLYBENCH_GEMM_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -34,7 +35,7 @@ void POLYBENCH_GEMM::runSeqVariant(VariantID vid)
 
         for (Index_type i = 0; i < ni; ++i ) {
           for (Index_type j = 0; j < nj; ++j ) {
-            POLYBENCH_GEMM_BODY1;
+            POLYBENCH_GEMM_BODY1_TYPED(Data_type);
             POLYBENCH_GEMM_BODY2;
             for (Index_type k = 0; k < nk; ++k ) {
                POLYBENCH_GEMM_BODY3;
@@ -56,11 +57,11 @@ void POLYBENCH_GEMM::runSeqVariant(VariantID vid)
                                    POLYBENCH_GEMM_BODY2;
                                  };
       auto poly_gemm_base_lam3 = [=](Index_type i, Index_type j, Index_type k,
-                                     Real_type& dot) {
+                                     Data_type& dot) {
                                    POLYBENCH_GEMM_BODY3;
                                   };
       auto poly_gemm_base_lam4 = [=](Index_type i, Index_type j,
-                                     Real_type& dot) {
+                                     Data_type& dot) {
                                    POLYBENCH_GEMM_BODY4;
                                   };
 
@@ -69,7 +70,7 @@ void POLYBENCH_GEMM::runSeqVariant(VariantID vid)
 
         for (Index_type i = 0; i < ni; ++i ) {
           for (Index_type j = 0; j < nj; ++j ) {
-            POLYBENCH_GEMM_BODY1;
+            POLYBENCH_GEMM_BODY1_TYPED(Data_type);
             poly_gemm_base_lam2(i, j);
             for (Index_type k = 0; k < nk; ++k ) {
               poly_gemm_base_lam3(i, j, k, dot);
@@ -86,20 +87,20 @@ void POLYBENCH_GEMM::runSeqVariant(VariantID vid)
 
     case RAJA_Seq : {
 
-      POLYBENCH_GEMM_VIEWS_RAJA;
+      POLYBENCH_GEMM_VIEWS_RAJA_TYPED(Data_type);
 
-      auto poly_gemm_lam1 = [=](Real_type& dot) {
+      auto poly_gemm_lam1 = [=](Data_type& dot) {
                                 POLYBENCH_GEMM_BODY1_RAJA;
                                };
       auto poly_gemm_lam2 = [=](Index_type i, Index_type j) {
                                 POLYBENCH_GEMM_BODY2_RAJA;
                                };
       auto poly_gemm_lam3 = [=](Index_type i, Index_type j, Index_type k,
-                                Real_type& dot) {
+                                Data_type& dot) {
                                 POLYBENCH_GEMM_BODY3_RAJA;
                                };
       auto poly_gemm_lam4 = [=](Index_type i, Index_type j,
-                                Real_type& dot) {
+                                Data_type& dot) {
                                 POLYBENCH_GEMM_BODY4_RAJA;
                                };
 
@@ -125,7 +126,7 @@ void POLYBENCH_GEMM::runSeqVariant(VariantID vid)
           RAJA::make_tuple( RAJA::RangeSegment{0, ni},
                             RAJA::RangeSegment{0, nj},
                             RAJA::RangeSegment{0, nk} ),
-          RAJA::tuple<Real_type>{0.0},  // variable for dot
+          RAJA::tuple<Data_type>{0.0},  // variable for dot
 
           poly_gemm_lam1,
           poly_gemm_lam2,
@@ -149,5 +150,13 @@ void POLYBENCH_GEMM::runSeqVariant(VariantID vid)
 
 }
 
+void POLYBENCH_GEMM::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -11,6 +11,8 @@
 #include "RAJA/RAJA.hpp"
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 
 namespace rajaperf
 {
@@ -70,6 +72,19 @@ POLYBENCH_GEMM::POLYBENCH_GEMM(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (1*data_size + 0*data_size) * m_ni * m_nj +
+                    (0*data_size + 1*data_size) * m_ni * m_nk +
+                    (0*data_size + 1*data_size) * m_nj * m_nk );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 POLYBENCH_GEMM::~POLYBENCH_GEMM()
@@ -79,9 +94,11 @@ POLYBENCH_GEMM::~POLYBENCH_GEMM()
 void POLYBENCH_GEMM::setUp(VariantID vid)
 {
   (void) vid;
-  allocAndInitData(m_A, m_ni * m_nk, vid);
-  allocAndInitData(m_B, m_nk * m_nj, vid);
-  allocAndInitDataConst(m_C, m_ni * m_nj, 0.0, vid);
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitData(m_A, m_ni * m_nk, pid, vid);
+  allocAndInitData(m_B, m_nk * m_nj, pid, vid);
+  allocAndInitDataConst(m_C, m_ni * m_nj, 0.0, pid, vid);
 }
 
 void POLYBENCH_GEMM::updateChecksum(VariantID vid)
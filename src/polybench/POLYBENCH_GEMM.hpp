@@ -24,21 +24,25 @@
 #ifndef RAJAPerf_POLYBENCH_GEMM_HPP
 #define RAJAPerf_POLYBENCH_GEMM_HPP
 
-#define POLYBENCH_GEMM_DATA_SETUP \
+#define POLYBENCH_GEMM_DATA_SETUP_TYPED(Data_type) \
   const Index_type ni = m_ni; \
   const Index_type nj = m_nj; \
   const Index_type nk = m_nk; \
 \
-  Real_type alpha = m_alpha; \
-  Real_type beta = m_beta; \
+  Data_type alpha = m_alpha; \
+  Data_type beta = m_beta; \
 \
-  Real_ptr A = m_A; \
-  Real_ptr B = m_B; \
-  Real_ptr C = m_C;
+  Data_type* A = m_A.get<Data_type>(); \
+  Data_type* B = m_B.get<Data_type>(); \
+  Data_type* C = m_C.get<Data_type>();
 
+#define POLYBENCH_GEMM_DATA_SETUP POLYBENCH_GEMM_DATA_SETUP_TYPED(Real_type)
 
-#define POLYBENCH_GEMM_BODY1 \
-  Real_type dot = 0.0;
+
+#define POLYBENCH_GEMM_BODY1_TYPED(Data_type) \
+  Data_type dot = 0.0;
+
+#define POLYBENCH_GEMM_BODY1 POLYBENCH_GEMM_BODY1_TYPED(Real_type)
 
 #define POLYBENCH_GEMM_BODY2 \
   C[j + i*nj] *= beta;
@@ -63,14 +67,16 @@
   Cview(i, j) = dot;
 
 
-#define POLYBENCH_GEMM_VIEWS_RAJA \
-  using VIEW_TYPE = RAJA::View<Real_type, \
+#define POLYBENCH_GEMM_VIEWS_RAJA_TYPED(Data_type) \
+  using VIEW_TYPE = RAJA::View<Data_type, \
                                RAJA::Layout<2, Index_type, 1>>; \
 \
   VIEW_TYPE Aview(A, RAJA::Layout<2>(ni, nk)); \
   VIEW_TYPE Bview(B, RAJA::Layout<2>(nk, nj)); \
   VIEW_TYPE Cview(C, RAJA::Layout<2>(ni, nj));
 
+#define POLYBENCH_GEMM_VIEWS_RAJA POLYBENCH_GEMM_VIEWS_RAJA_TYPED(Real_type)
+
 
 #include "common/KernelBase.hpp"
 
@@ -101,15 +107,20 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
   Index_type m_ni;
   Index_type m_nj;
   Index_type m_nk;
 
   Real_type m_alpha;
   Real_type m_beta;
-  Real_ptr m_A;
-  Real_ptr m_B;
-  Real_ptr m_C;
+  Precision_ptr m_A;
+  Precision_ptr m_B;
+  Precision_ptr m_C;
 };
 
 } // end namespace polybench
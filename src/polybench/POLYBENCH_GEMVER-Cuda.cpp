@@ -39,19 +39,19 @@ constexpr size_t j_block_sz = 32;
 
 
 #define POLYBENCH_GEMVER_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(A, m_A, m_n * m_n); \
-  allocAndInitCudaDeviceData(u1, m_u1, m_n); \
-  allocAndInitCudaDeviceData(v1, m_v1, m_n); \
-  allocAndInitCudaDeviceData(u2, m_u2, m_n); \
-  allocAndInitCudaDeviceData(v2, m_v2, m_n); \
-  allocAndInitCudaDeviceData(w, m_w, m_n); \
-  allocAndInitCudaDeviceData(x, m_x, m_n); \
-  allocAndInitCudaDeviceData(y, m_y, m_n); \
-  allocAndInitCudaDeviceData(z, m_z, m_n);
+  allocAndInitCudaDeviceData(A, m_A.get<Real_type>(), m_n * m_n); \
+  allocAndInitCudaDeviceData(u1, m_u1.get<Real_type>(), m_n); \
+  allocAndInitCudaDeviceData(v1, m_v1.get<Real_type>(), m_n); \
+  allocAndInitCudaDeviceData(u2, m_u2.get<Real_type>(), m_n); \
+  allocAndInitCudaDeviceData(v2, m_v2.get<Real_type>(), m_n); \
+  allocAndInitCudaDeviceData(w, m_w.get<Real_type>(), m_n); \
+  allocAndInitCudaDeviceData(x, m_x.get<Real_type>(), m_n); \
+  allocAndInitCudaDeviceData(y, m_y.get<Real_type>(), m_n); \
+  allocAndInitCudaDeviceData(z, m_z.get<Real_type>(), m_n);
 
 
 #define POLYBENCH_GEMVER_TEARDOWN_CUDA \
-  getCudaDeviceData(m_w, w, m_n); \
+  getCudaDeviceData(m_w.get<Real_type>(), w, m_n); \
   deallocCudaDeviceData(A); \
   deallocCudaDeviceData(u1); \
   deallocCudaDeviceData(v1); \
@@ -39,19 +39,19 @@ constexpr size_t j_block_sz = 32;
 
 
 #define POLYBENCH_GEMVER_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(A, m_A, m_n * m_n); \
-  allocAndInitHipDeviceData(u1, m_u1, m_n); \
-  allocAndInitHipDeviceData(v1, m_v1, m_n); \
-  allocAndInitHipDeviceData(u2, m_u2, m_n); \
-  allocAndInitHipDeviceData(v2, m_v2, m_n); \
-  allocAndInitHipDeviceData(w, m_w, m_n); \
-  allocAndInitHipDeviceData(x, m_x, m_n); \
-  allocAndInitHipDeviceData(y, m_y, m_n); \
-  allocAndInitHipDeviceData(z, m_z, m_n);
+  allocAndInitHipDeviceData(A, m_A.get<Real_type>(), m_n * m_n); \
+  allocAndInitHipDeviceData(u1, m_u1.get<Real_type>(), m_n); \
+  allocAndInitHipDeviceData(v1, m_v1.get<Real_type>(), m_n); \
+  allocAndInitHipDeviceData(u2, m_u2.get<Real_type>(), m_n); \
+  allocAndInitHipDeviceData(v2, m_v2.get<Real_type>(), m_n); \
+  allocAndInitHipDeviceData(w, m_w.get<Real_type>(), m_n); \
+  allocAndInitHipDeviceData(x, m_x.get<Real_type>(), m_n); \
+  allocAndInitHipDeviceData(y, m_y.get<Real_type>(), m_n); \
+  allocAndInitHipDeviceData(z, m_z.get<Real_type>(), m_n);
 
 
 #define POLYBENCH_GEMVER_TEARDOWN_HIP \
-  getHipDeviceData(m_w, w, m_n); \
+  getHipDeviceData(m_w.get<Real_type>(), w, m_n); \
   deallocHipDeviceData(A); \
   deallocHipDeviceData(u1); \
   deallocHipDeviceData(v1); \
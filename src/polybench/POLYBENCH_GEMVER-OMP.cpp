@@ -20,13 +20,14 @@ namespace polybench
 {
 
 
-void POLYBENCH_GEMVER::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void POLYBENCH_GEMVER::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps = getRunReps();
 
-  POLYBENCH_GEMVER_DATA_SETUP;
+  POLYBENCH_GEMVER_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -44,7 +45,7 @@ void POLYBENCH_GEMVER::runOpenMPVariant(VariantID vid)
 
         #pragma omp parallel for
         for (Index_type i = 0; i < n; i++ ) {
-          POLYBENCH_GEMVER_BODY2;
+          POLYBENCH_GEMVER_BODY2_TYPED(Data_type);
           for (Index_type j = 0; j < n; j++) {
             POLYBENCH_GEMVER_BODY3;
           }
@@ -58,7 +59,7 @@ void POLYBENCH_GEMVER::runOpenMPVariant(VariantID vid)
 
         #pragma omp parallel for
         for (Index_type i = 0; i < n; i++ ) {
-          POLYBENCH_GEMVER_BODY6;
+          POLYBENCH_GEMVER_BODY6_TYPED(Data_type);
           for (Index_type j = 0; j < n; j++) {
             POLYBENCH_GEMVER_BODY7;
           }
@@ -77,20 +78,20 @@ void POLYBENCH_GEMVER::runOpenMPVariant(VariantID vid)
                                      POLYBENCH_GEMVER_BODY1;
                                    };
       auto poly_gemver_base_lam3 = [=](Index_type i, Index_type j,
-                                       Real_type &dot) {
+                                       Data_type &dot) {
                                      POLYBENCH_GEMVER_BODY3;
                                    };
-      auto poly_gemver_base_lam4 = [=](Index_type i, Real_type &dot) {
+      auto poly_gemver_base_lam4 = [=](Index_type i, Data_type &dot) {
                                      POLYBENCH_GEMVER_BODY4;
                                    };
       auto poly_gemver_base_lam5 = [=](Index_type i) {
                                      POLYBENCH_GEMVER_BODY5;
                                    };
       auto poly_gemver_base_lam7 = [=](Index_type i, Index_type j,
-                                       Real_type &dot) {
+                                       Data_type &dot) {
                                      POLYBENCH_GEMVER_BODY7;
                                     };
-      auto poly_gemver_base_lam8 = [=](Index_type i, Real_type &dot) {
+      auto poly_gemver_base_lam8 = [=](Index_type i, Data_type &dot) {
                                      POLYBENCH_GEMVER_BODY8;
                                    };
 
@@ -106,7 +107,7 @@ void POLYBENCH_GEMVER::runOpenMPVariant(VariantID vid)
 
         #pragma omp parallel for
         for (Index_type i = 0; i < n; i++ ) {
-          POLYBENCH_GEMVER_BODY2;
+          POLYBENCH_GEMVER_BODY2_TYPED(Data_type);
           for (Index_type j = 0; j < n; j++) {
             poly_gemver_base_lam3(i, j, dot);
           }
@@ -120,7 +121,7 @@ void POLYBENCH_GEMVER::runOpenMPVariant(VariantID vid)
 
         #pragma omp parallel for
         for (Index_type i = 0; i < n; i++ ) {
-          POLYBENCH_GEMVER_BODY6;
+          POLYBENCH_GEMVER_BODY6_TYPED(Data_type);
           for (Index_type j = 0; j < n; j++) {
             poly_gemver_base_lam7(i, j, dot);
           }
@@ -135,30 +136,30 @@ void POLYBENCH_GEMVER::runOpenMPVariant(VariantID vid)
 
     case RAJA_OpenMP : {
 
-      POLYBENCH_GEMVER_VIEWS_RAJA;
+      POLYBENCH_GEMVER_VIEWS_RAJA_TYPED(Data_type);
 
       auto poly_gemver_lam1 = [=] (Index_type i, Index_type j) {
                                    POLYBENCH_GEMVER_BODY1_RAJA;
                                   };
-      auto poly_gemver_lam2 = [=] (Index_type /* i */, Real_type &dot) {
+      auto poly_gemver_lam2 = [=] (Index_type /* i */, Data_type &dot) {
                                    POLYBENCH_GEMVER_BODY2_RAJA;
                                   };
-      auto poly_gemver_lam3 = [=] (Index_type i, Index_type j, Real_type &dot) {
+      auto poly_gemver_lam3 = [=] (Index_type i, Index_type j, Data_type &dot) {
                                    POLYBENCH_GEMVER_BODY3_RAJA;
                                   };
-      auto poly_gemver_lam4 = [=] (Index_type i, Real_type &dot) {
+      auto poly_gemver_lam4 = [=] (Index_type i, Data_type &dot) {
                                    POLYBENCH_GEMVER_BODY4_RAJA;
                                   };
       auto poly_gemver_lam5 = [=] (Index_type i) {
                                    POLYBENCH_GEMVER_BODY5_RAJA;
                                   };
-      auto poly_gemver_lam6 = [=] (Index_type i, Real_type &dot) {
+      auto poly_gemver_lam6 = [=] (Index_type i, Data_type &dot) {
                                    POLYBENCH_GEMVER_BODY6_RAJA;
                                   };
-      auto poly_gemver_lam7 = [=] (Index_type i, Index_type j, Real_type &dot) {
+      auto poly_gemver_lam7 = [=] (Index_type i, Index_type j, Data_type &dot) {
                                    POLYBENCH_GEMVER_BODY7_RAJA;
                                   };
-      auto poly_gemver_lam8 = [=] (Index_type i, Real_type &dot) {
+      auto poly_gemver_lam8 = [=] (Index_type i, Data_type &dot) {
                                    POLYBENCH_GEMVER_BODY8_RAJA;
                                   };
 
@@ -195,7 +196,7 @@ void POLYBENCH_GEMVER::runOpenMPVariant(VariantID vid)
         RAJA::kernel_param<EXEC_POL24>(
           RAJA::make_tuple(RAJA::RangeSegment{0, n},
                            RAJA::RangeSegment{0, n}),
-          RAJA::tuple<Real_type>{0.0},
+          RAJA::tuple<Data_type>{0.0},
 
           poly_gemver_lam2,
           poly_gemver_lam3,
@@ -209,7 +210,7 @@ void POLYBENCH_GEMVER::runOpenMPVariant(VariantID vid)
         RAJA::kernel_param<EXEC_POL24>(
           RAJA::make_tuple(RAJA::RangeSegment{0, n},
                            RAJA::RangeSegment{0, n}),
-          RAJA::tuple<Real_type>{0.0},
+          RAJA::tuple<Data_type>{0.0},
 
           poly_gemver_lam6,
           poly_gemver_lam7,
@@ -228,6 +229,18 @@ void POLYBENCH_GEMVER::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void POLYBENCH_GEMVER::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
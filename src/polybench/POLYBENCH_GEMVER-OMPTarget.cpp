@@ -30,18 +30,18 @@ namespace polybench
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(A, m_A, m_n * m_n, did, hid); \
-  allocAndInitOpenMPDeviceData(u1, m_u1, m_n, did, hid); \
-  allocAndInitOpenMPDeviceData(v1, m_v1, m_n, did, hid); \
-  allocAndInitOpenMPDeviceData(u2, m_u2, m_n, did, hid); \
-  allocAndInitOpenMPDeviceData(v2, m_v2, m_n, did, hid); \
-  allocAndInitOpenMPDeviceData(w, m_w, m_n, did, hid); \
-  allocAndInitOpenMPDeviceData(x, m_x, m_n, did, hid); \
-  allocAndInitOpenMPDeviceData(y, m_y, m_n, did, hid); \
-  allocAndInitOpenMPDeviceData(z, m_z, m_n, did, hid);
+  allocAndInitOpenMPDeviceData(A, m_A.get<Real_type>(), m_n * m_n, did, hid); \
+  allocAndInitOpenMPDeviceData(u1, m_u1.get<Real_type>(), m_n, did, hid); \
+  allocAndInitOpenMPDeviceData(v1, m_v1.get<Real_type>(), m_n, did, hid); \
+  allocAndInitOpenMPDeviceData(u2, m_u2.get<Real_type>(), m_n, did, hid); \
+  allocAndInitOpenMPDeviceData(v2, m_v2.get<Real_type>(), m_n, did, hid); \
+  allocAndInitOpenMPDeviceData(w, m_w.get<Real_type>(), m_n, did, hid); \
+  allocAndInitOpenMPDeviceData(x, m_x.get<Real_type>(), m_n, did, hid); \
+  allocAndInitOpenMPDeviceData(y, m_y.get<Real_type>(), m_n, did, hid); \
+  allocAndInitOpenMPDeviceData(z, m_z.get<Real_type>(), m_n, did, hid);
 
 #define POLYBENCH_GEMVER_DATA_TEARDOWN_OMP_TARGET \
-  getOpenMPDeviceData(m_w, w, m_n, hid, did); \
+  getOpenMPDeviceData(m_w.get<Real_type>(), w, m_n, hid, did); \
   deallocOpenMPDeviceData(A, did); \
   deallocOpenMPDeviceData(u1, did); \
   deallocOpenMPDeviceData(v1, did); \
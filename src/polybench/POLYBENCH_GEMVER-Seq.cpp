@@ -20,11 +20,12 @@ namespace polybench
 {
 
 
-void POLYBENCH_GEMVER::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void POLYBENCH_GEMVER::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
 
-  POLYBENCH_GEMVER_DATA_SETUP;
+  POLYBENCH_GEMVER_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -40,7 +41,7 @@ void POLYBENCH_GEMVER::runSeqVariant(VariantID vid)
         }
 
         for (Index_type i = 0; i < n; i++ ) {
-          POLYBENCH_GEMVER_BODY2;
+          POLYBENCH_GEMVER_BODY2_TYPED(Data_type);
           for (Index_type j = 0; j < n; j++) {
             POLYBENCH_GEMVER_BODY3;
           }
@@ -52,7 +53,7 @@ void POLYBENCH_GEMVER::runSeqVariant(VariantID vid)
         }
 
         for (Index_type i = 0; i < n; i++ ) {
-          POLYBENCH_GEMVER_BODY6;
+          POLYBENCH_GEMVER_BODY6_TYPED(Data_type);
           for (Index_type j = 0; j < n; j++) {
             POLYBENCH_GEMVER_BODY7;
           }
@@ -72,20 +73,20 @@ void POLYBENCH_GEMVER::runSeqVariant(VariantID vid)
                                      POLYBENCH_GEMVER_BODY1;
                                    };
       auto poly_gemver_base_lam3 = [=](Index_type i, Index_type j,
-                                       Real_type &dot) {
+                                       Data_type &dot) {
                                      POLYBENCH_GEMVER_BODY3;
                                    };
-      auto poly_gemver_base_lam4 = [=](Index_type i, Real_type &dot) {
+      auto poly_gemver_base_lam4 = [=](Index_type i, Data_type &dot) {
                                      POLYBENCH_GEMVER_BODY4;
                                    };
       auto poly_gemver_base_lam5 = [=](Index_type i) {
                                      POLYBENCH_GEMVER_BODY5;
                                    };
       auto poly_gemver_base_lam7 = [=](Index_type i, Index_type j,
-                                       Real_type &dot) {
+                                       Data_type &dot) {
                                      POLYBENCH_GEMVER_BODY7;
                                     };
-      auto poly_gemver_base_lam8 = [=](Index_type i, Real_type &dot) {
+      auto poly_gemver_base_lam8 = [=](Index_type i, Data_type &dot) {
                                      POLYBENCH_GEMVER_BODY8;
                                    };
 
@@ -99,7 +100,7 @@ void POLYBENCH_GEMVER::runSeqVariant(VariantID vid)
         }
 
         for (Index_type i = 0; i < n; i++ ) {
-          POLYBENCH_GEMVER_BODY2;
+          POLYBENCH_GEMVER_BODY2_TYPED(Data_type);
           for (Index_type j = 0; j < n; j++) {
             poly_gemver_base_lam3(i, j, dot);
           }
@@ -111,7 +112,7 @@ void POLYBENCH_GEMVER::runSeqVariant(VariantID vid)
         }
 
         for (Index_type i = 0; i < n; i++ ) {
-          POLYBENCH_GEMVER_BODY6;
+          POLYBENCH_GEMVER_BODY6_TYPED(Data_type);
           for (Index_type j = 0; j < n; j++) {
             poly_gemver_base_lam7(i, j, dot);
           }
@@ -126,30 +127,30 @@ void POLYBENCH_GEMVER::runSeqVariant(VariantID vid)
 
     case RAJA_Seq : {
 
-      POLYBENCH_GEMVER_VIEWS_RAJA;
+      POLYBENCH_GEMVER_VIEWS_RAJA_TYPED(Data_type);
 
       auto poly_gemver_lam1 = [=] (Index_type i, Index_type j) {
                                    POLYBENCH_GEMVER_BODY1_RAJA;
                                   };
-      auto poly_gemver_lam2 = [=] (Index_type /* i */, Real_type &dot) {
+      auto poly_gemver_lam2 = [=] (Index_type /* i */, Data_type &dot) {
                                    POLYBENCH_GEMVER_BODY2_RAJA;
                                   };
-      auto poly_gemver_lam3 = [=] (Index_type i, Index_type j, Real_type &dot) {
+      auto poly_gemver_lam3 = [=] (Index_type i, Index_type j, Data_type &dot) {
                                    POLYBENCH_GEMVER_BODY3_RAJA;
                                   };
-      auto poly_gemver_lam4 = [=] (Index_type i, Real_type &dot) {
+      auto poly_gemver_lam4 = [=] (Index_type i, Data_type &dot) {
                                    POLYBENCH_GEMVER_BODY4_RAJA;
                                   };
       auto poly_gemver_lam5 = [=] (Index_type i) {
                                    POLYBENCH_GEMVER_BODY5_RAJA;
                                   };
-      auto poly_gemver_lam6 = [=] (Index_type i, Real_type &dot) {
+      auto poly_gemver_lam6 = [=] (Index_type i, Data_type &dot) {
                                    POLYBENCH_GEMVER_BODY6_RAJA;
                                   };
-      auto poly_gemver_lam7 = [=] (Index_type i, Index_type j, Real_type &dot) {
+      auto poly_gemver_lam7 = [=] (Index_type i, Index_type j, Data_type &dot) {
                                    POLYBENCH_GEMVER_BODY7_RAJA;
                                   };
-      auto poly_gemver_lam8 = [=] (Index_type i, Real_type &dot) {
+      auto poly_gemver_lam8 = [=] (Index_type i, Data_type &dot) {
                                    POLYBENCH_GEMVER_BODY8_RAJA;
                                   };
 
@@ -186,7 +187,7 @@ void POLYBENCH_GEMVER::runSeqVariant(VariantID vid)
         RAJA::kernel_param<EXEC_POL24>(
           RAJA::make_tuple(RAJA::RangeSegment{0, n},
                            RAJA::RangeSegment{0, n}),
-          RAJA::tuple<Real_type>{0.0},
+          RAJA::tuple<Data_type>{0.0},
 
           poly_gemver_lam2,
           poly_gemver_lam3,
@@ -200,7 +201,7 @@ void POLYBENCH_GEMVER::runSeqVariant(VariantID vid)
         RAJA::kernel_param<EXEC_POL24>(
           RAJA::make_tuple(RAJA::RangeSegment{0, n},
                            RAJA::RangeSegment{0, n}),
-          RAJA::tuple<Real_type>{0.0},
+          RAJA::tuple<Data_type>{0.0},
 
           poly_gemver_lam6,
           poly_gemver_lam7,
@@ -223,5 +224,13 @@ void POLYBENCH_GEMVER::runSeqVariant(VariantID vid)
 
 }
 
+void POLYBENCH_GEMVER::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -11,6 +11,8 @@
 #include "RAJA/RAJA.hpp"
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 
 namespace rajaperf
 {
@@ -79,6 +81,26 @@ POLYBENCH_GEMVER::POLYBENCH_GEMVER(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (1*data_size + 1*data_size) * m_n * m_n +
+                    (0*data_size + 4*data_size) * m_n +
+  
+                    (0*data_size + 1*data_size) * m_n * m_n +
+                    (1*data_size + 2*data_size) * m_n +
+  
+                    (1*data_size + 2*data_size) * m_n +
+  
+                    (0*data_size + 1*data_size) * m_n * m_n +
+                    (1*data_size + 2*data_size) * m_n );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 POLYBENCH_GEMVER::~POLYBENCH_GEMVER()
@@ -88,16 +110,18 @@ POLYBENCH_GEMVER::~POLYBENCH_GEMVER()
 void POLYBENCH_GEMVER::setUp(VariantID vid)
 {
   (void) vid;
-
-  allocAndInitData(m_A, m_n * m_n, vid);
-  allocAndInitData(m_u1, m_n, vid);
-  allocAndInitData(m_v1, m_n, vid);
-  allocAndInitData(m_u2, m_n, vid);
-  allocAndInitData(m_v2, m_n, vid);
-  allocAndInitDataConst(m_w, m_n, 0.0, vid);
-  allocAndInitData(m_x, m_n, vid);
-  allocAndInitData(m_y, m_n, vid);
-  allocAndInitData(m_z, m_n, vid);
+  const PrecisionID pid = getRunningPrecision();
+
+
+  allocAndInitData(m_A, m_n * m_n, pid, vid);
+  allocAndInitData(m_u1, m_n, pid, vid);
+  allocAndInitData(m_v1, m_n, pid, vid);
+  allocAndInitData(m_u2, m_n, pid, vid);
+  allocAndInitData(m_v2, m_n, pid, vid);
+  allocAndInitDataConst(m_w, m_n, 0.0, pid, vid);
+  allocAndInitData(m_x, m_n, pid, vid);
+  allocAndInitData(m_y, m_n, pid, vid);
+  allocAndInitData(m_z, m_n, pid, vid);
 }
 
 void POLYBENCH_GEMVER::updateChecksum(VariantID vid)
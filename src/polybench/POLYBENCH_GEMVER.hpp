@@ -41,27 +41,31 @@
 #ifndef RAJAPerf_POLYBENCH_GEMVER_HPP
 #define RAJAPerf_POLYBENCH_GEMVER_HPP
 
-#define POLYBENCH_GEMVER_DATA_SETUP \
-  Real_type alpha = m_alpha; \
-  Real_type beta = m_beta; \
-  Real_ptr A = m_A; \
-  Real_ptr u1 = m_u1; \
-  Real_ptr v1 = m_v1; \
-  Real_ptr u2 = m_u2; \
-  Real_ptr v2 = m_v2; \
-  Real_ptr w = m_w; \
-  Real_ptr x = m_x; \
-  Real_ptr y = m_y; \
-  Real_ptr z = m_z; \
+#define POLYBENCH_GEMVER_DATA_SETUP_TYPED(Data_type) \
+  Data_type alpha = m_alpha; \
+  Data_type beta = m_beta; \
+  Data_type* A = m_A.get<Data_type>(); \
+  Data_type* u1 = m_u1.get<Data_type>(); \
+  Data_type* v1 = m_v1.get<Data_type>(); \
+  Data_type* u2 = m_u2.get<Data_type>(); \
+  Data_type* v2 = m_v2.get<Data_type>(); \
+  Data_type* w = m_w.get<Data_type>(); \
+  Data_type* x = m_x.get<Data_type>(); \
+  Data_type* y = m_y.get<Data_type>(); \
+  Data_type* z = m_z.get<Data_type>(); \
 \
   const Index_type n = m_n;
 
+#define POLYBENCH_GEMVER_DATA_SETUP POLYBENCH_GEMVER_DATA_SETUP_TYPED(Real_type)
+
 
 #define POLYBENCH_GEMVER_BODY1 \
   A[j + i*n] += u1[i] * v1[j] + u2[i] * v2[j];
 
-#define POLYBENCH_GEMVER_BODY2 \
-  Real_type dot = 0.0;
+#define POLYBENCH_GEMVER_BODY2_TYPED(Data_type) \
+  Data_type dot = 0.0;
+
+#define POLYBENCH_GEMVER_BODY2 POLYBENCH_GEMVER_BODY2_TYPED(Real_type)
 
 #define POLYBENCH_GEMVER_BODY3 \
   dot +=  beta * A[i + j*n] * y[j];
@@ -72,8 +76,10 @@
 #define POLYBENCH_GEMVER_BODY5 \
   x[i] += z[i];
 
-#define POLYBENCH_GEMVER_BODY6 \
-  Real_type dot = w[i];
+#define POLYBENCH_GEMVER_BODY6_TYPED(Data_type) \
+  Data_type dot = w[i];
+
+#define POLYBENCH_GEMVER_BODY6 POLYBENCH_GEMVER_BODY6_TYPED(Real_type)
 
 #define POLYBENCH_GEMVER_BODY7 \
   dot +=  alpha * A[j + i*n] * x[j];
@@ -107,11 +113,11 @@
   wview(i) = dot;
 
 
-#define POLYBENCH_GEMVER_VIEWS_RAJA \
-  using VIEW_1 = RAJA::View<Real_type, \
+#define POLYBENCH_GEMVER_VIEWS_RAJA_TYPED(Data_type) \
+  using VIEW_1 = RAJA::View<Data_type, \
                             RAJA::Layout<1, Index_type, 0>>; \
 \
-  using VIEW_2 = RAJA::View<Real_type, \
+  using VIEW_2 = RAJA::View<Data_type, \
                             RAJA::Layout<2, Index_type, 1>>; \
 \
   VIEW_1 u1view(u1, RAJA::Layout<1>(n)); \
@@ -124,6 +130,8 @@
   VIEW_1 zview(z, RAJA::Layout<1>(n)); \
   VIEW_2 Aview(A, RAJA::Layout<2>(n, n));
 
+#define POLYBENCH_GEMVER_VIEWS_RAJA POLYBENCH_GEMVER_VIEWS_RAJA_TYPED(Real_type)
+
 
 #include "common/KernelBase.hpp"
 
@@ -154,18 +162,23 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
   Index_type m_n;
   Real_type m_alpha;
   Real_type m_beta;
-  Real_ptr m_A;
-  Real_ptr m_u1;
-  Real_ptr m_v1;
-  Real_ptr m_u2;
-  Real_ptr m_v2;
-  Real_ptr m_w;
-  Real_ptr m_x;
-  Real_ptr m_y;
-  Real_ptr m_z;
+  Precision_ptr m_A;
+  Precision_ptr m_u1;
+  Precision_ptr m_v1;
+  Precision_ptr m_u2;
+  Precision_ptr m_v2;
+  Precision_ptr m_w;
+  Precision_ptr m_x;
+  Precision_ptr m_y;
+  Precision_ptr m_z;
 };
 
 } // end namespace polybench
@@ -27,14 +27,14 @@ namespace polybench
   const size_t block_size = 256;
 
 #define POLYBENCH_GESUMMV_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(x, m_x, N); \
-  allocAndInitCudaDeviceData(y, m_y, N); \
-  allocAndInitCudaDeviceData(A, m_A, N*N); \
-  allocAndInitCudaDeviceData(B, m_B, N*N);
+  allocAndInitCudaDeviceData(x, m_x.get<Real_type>(), N); \
+  allocAndInitCudaDeviceData(y, m_y.get<Real_type>(), N); \
+  allocAndInitCudaDeviceData(A, m_A.get<Real_type>(), N*N); \
+  allocAndInitCudaDeviceData(B, m_B.get<Real_type>(), N*N);
 
 
 #define POLYBENCH_GESUMMV_TEARDOWN_CUDA \
-  getCudaDeviceData(m_y, y, N); \
+  getCudaDeviceData(m_y.get<Real_type>(), y, N); \
   deallocCudaDeviceData(x); \
   deallocCudaDeviceData(y); \
   deallocCudaDeviceData(A); \
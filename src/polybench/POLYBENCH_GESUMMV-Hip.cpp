@@ -27,14 +27,14 @@ namespace polybench
   const size_t block_size = 256;
 
 #define POLYBENCH_GESUMMV_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(x, m_x, N); \
-  allocAndInitHipDeviceData(y, m_y, N); \
-  allocAndInitHipDeviceData(A, m_A, N*N); \
-  allocAndInitHipDeviceData(B, m_B, N*N);
+  allocAndInitHipDeviceData(x, m_x.get<Real_type>(), N); \
+  allocAndInitHipDeviceData(y, m_y.get<Real_type>(), N); \
+  allocAndInitHipDeviceData(A, m_A.get<Real_type>(), N*N); \
+  allocAndInitHipDeviceData(B, m_B.get<Real_type>(), N*N);
 
 
 #define POLYBENCH_GESUMMV_TEARDOWN_HIP \
-  getHipDeviceData(m_y, y, N); \
+  getHipDeviceData(m_y.get<Real_type>(), y, N); \
   deallocHipDeviceData(x); \
   deallocHipDeviceData(y); \
   deallocHipDeviceData(A); \
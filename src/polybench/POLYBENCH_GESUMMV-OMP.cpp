@@ -19,13 +19,14 @@ namespace polybench
 {
 
 
-void POLYBENCH_GESUMMV::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void POLYBENCH_GESUMMV::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps= getRunReps();
 
-  POLYBENCH_GESUMMV_DATA_SETUP;
+  POLYBENCH_GESUMMV_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -36,7 +37,7 @@ void POLYBENCH_GESUMMV::runOpenMPVariant(VariantID vid)
 
         #pragma omp parallel for
         for (Index_type i = 0; i < N; ++i ) {
-          POLYBENCH_GESUMMV_BODY1;
+          POLYBENCH_GESUMMV_BODY1_TYPED(Data_type);
           for (Index_type j = 0; j < N; ++j ) {
             POLYBENCH_GESUMMV_BODY2;
           }
@@ -52,11 +53,11 @@ void POLYBENCH_GESUMMV::runOpenMPVariant(VariantID vid)
     case Lambda_OpenMP : {
 
       auto poly_gesummv_base_lam2 = [=](Index_type i, Index_type j,
-                                        Real_type& tmpdot, Real_type& ydot) {
+                                        Data_type& tmpdot, Data_type& ydot) {
                                       POLYBENCH_GESUMMV_BODY2;
                                     };
       auto poly_gesummv_base_lam3 = [=](Index_type i,
-                                        Real_type& tmpdot, Real_type& ydot) {
+                                        Data_type& tmpdot, Data_type& ydot) {
                                       POLYBENCH_GESUMMV_BODY3;
                                     };
 
@@ -65,7 +66,7 @@ void POLYBENCH_GESUMMV::runOpenMPVariant(VariantID vid)
 
         #pragma omp parallel for
         for (Index_type i = 0; i < N; ++i ) {
-          POLYBENCH_GESUMMV_BODY1;
+          POLYBENCH_GESUMMV_BODY1_TYPED(Data_type);
           for (Index_type j = 0; j < N; ++j ) {
             poly_gesummv_base_lam2(i, j, tmpdot, ydot);
           }
@@ -80,17 +81,17 @@ void POLYBENCH_GESUMMV::runOpenMPVariant(VariantID vid)
 
     case RAJA_OpenMP : {
 
-      POLYBENCH_GESUMMV_VIEWS_RAJA;
+      POLYBENCH_GESUMMV_VIEWS_RAJA_TYPED(Data_type);
 
-      auto poly_gesummv_lam1 = [=](Real_type& tmpdot, Real_type& ydot) {
+      auto poly_gesummv_lam1 = [=](Data_type& tmpdot, Data_type& ydot) {
                                    POLYBENCH_GESUMMV_BODY1_RAJA;
                                   };
       auto poly_gesummv_lam2 = [=](Index_type i, Index_type j,
-                                   Real_type& tmpdot, Real_type& ydot) {
+                                   Data_type& tmpdot, Data_type& ydot) {
                                    POLYBENCH_GESUMMV_BODY2_RAJA;
                                   };
       auto poly_gesummv_lam3 = [=](Index_type i,
-                                   Real_type& tmpdot, Real_type& ydot) {
+                                   Data_type& tmpdot, Data_type& ydot) {
                                    POLYBENCH_GESUMMV_BODY3_RAJA;
                                   };
 
@@ -111,8 +112,8 @@ void POLYBENCH_GESUMMV::runOpenMPVariant(VariantID vid)
         RAJA::kernel_param<EXEC_POL>(
           RAJA::make_tuple( RAJA::RangeSegment{0, N},
                             RAJA::RangeSegment{0, N} ),
-          RAJA::make_tuple(static_cast<Real_type>(0.0),
-                           static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Data_type>(0.0),
+                           static_cast<Data_type>(0.0)),
 
           poly_gesummv_lam1,
           poly_gesummv_lam2,
@@ -130,6 +131,18 @@ void POLYBENCH_GESUMMV::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void POLYBENCH_GESUMMV::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
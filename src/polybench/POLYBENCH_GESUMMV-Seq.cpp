@@ -18,11 +18,12 @@ namespace rajaperf
 namespace polybench
 {
 
-void POLYBENCH_GESUMMV::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void POLYBENCH_GESUMMV::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps= getRunReps();
 
-  POLYBENCH_GESUMMV_DATA_SETUP;
+  POLYBENCH_GESUMMV_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -32,7 +33,7 @@ void POLYBENCH_GESUMMV::runSeqVariant(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         for (Index_type i = 0; i < N; ++i ) {
-          POLYBENCH_GESUMMV_BODY1;
+          POLYBENCH_GESUMMV_BODY1_TYPED(Data_type);
           for (Index_type j = 0; j < N; ++j ) {
             POLYBENCH_GESUMMV_BODY2;
           }
@@ -50,11 +51,11 @@ void POLYBENCH_GESUMMV::runSeqVariant(VariantID vid)
     case Lambda_Seq : {
 
       auto poly_gesummv_base_lam2 = [=](Index_type i, Index_type j,
-                                        Real_type& tmpdot, Real_type& ydot) {
+                                        Data_type& tmpdot, Data_type& ydot) {
                                       POLYBENCH_GESUMMV_BODY2;
                                     };
       auto poly_gesummv_base_lam3 = [=](Index_type i,
-                                        Real_type& tmpdot, Real_type& ydot) {
+                                        Data_type& tmpdot, Data_type& ydot) {
                                       POLYBENCH_GESUMMV_BODY3;
                                     };
 
@@ -62,7 +63,7 @@ void POLYBENCH_GESUMMV::runSeqVariant(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         for (Index_type i = 0; i < N; ++i ) {
-          POLYBENCH_GESUMMV_BODY1;
+          POLYBENCH_GESUMMV_BODY1_TYPED(Data_type);
           for (Index_type j = 0; j < N; ++j ) {
             poly_gesummv_base_lam2(i, j, tmpdot, ydot);
           }
@@ -77,17 +78,17 @@ void POLYBENCH_GESUMMV::runSeqVariant(VariantID vid)
 
     case RAJA_Seq : {
 
-      POLYBENCH_GESUMMV_VIEWS_RAJA;
+      POLYBENCH_GESUMMV_VIEWS_RAJA_TYPED(Data_type);
 
-      auto poly_gesummv_lam1 = [=](Real_type& tmpdot, Real_type& ydot) {
+      auto poly_gesummv_lam1 = [=](Data_type& tmpdot, Data_type& ydot) {
                                    POLYBENCH_GESUMMV_BODY1_RAJA;
                                   };
       auto poly_gesummv_lam2 = [=](Index_type i, Index_type j,
-                                   Real_type& tmpdot, Real_type& ydot) {
+                                   Data_type& tmpdot, Data_type& ydot) {
                                    POLYBENCH_GESUMMV_BODY2_RAJA;
                                   };
       auto poly_gesummv_lam3 = [=](Index_type i,
-                                   Real_type& tmpdot, Real_type& ydot) {
+                                   Data_type& tmpdot, Data_type& ydot) {
                                    POLYBENCH_GESUMMV_BODY3_RAJA;
                                   };
 
@@ -108,8 +109,8 @@ void POLYBENCH_GESUMMV::runSeqVariant(VariantID vid)
         RAJA::kernel_param<EXEC_POL>(
           RAJA::make_tuple( RAJA::RangeSegment{0, N},
                             RAJA::RangeSegment{0, N} ),
-          RAJA::make_tuple(static_cast<Real_type>(0.0),
-                           static_cast<Real_type>(0.0)),
+          RAJA::make_tuple(static_cast<Data_type>(0.0),
+                           static_cast<Data_type>(0.0)),
 
           poly_gesummv_lam1,
           poly_gesummv_lam2,
@@ -131,5 +132,13 @@ void POLYBENCH_GESUMMV::runSeqVariant(VariantID vid)
 
 }
 
+void POLYBENCH_GESUMMV::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
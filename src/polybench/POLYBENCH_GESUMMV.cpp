@@ -11,6 +11,8 @@
 #include "RAJA/RAJA.hpp"
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 
 namespace rajaperf
 {
@@ -59,6 +61,18 @@ POLYBENCH_GESUMMV::POLYBENCH_GESUMMV(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (2*data_size + 1*data_size) * m_N +
+                    (0*data_size + 2*data_size) * m_N * m_N );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 POLYBENCH_GESUMMV::~POLYBENCH_GESUMMV()
@@ -68,10 +82,12 @@ POLYBENCH_GESUMMV::~POLYBENCH_GESUMMV()
 void POLYBENCH_GESUMMV::setUp(VariantID vid)
 {
   (void) vid;
-  allocAndInitData(m_x, m_N, vid);
-  allocAndInitDataConst(m_y, m_N, 0.0, vid);
-  allocAndInitData(m_A, m_N * m_N, vid);
-  allocAndInitData(m_B, m_N * m_N, vid);
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitData(m_x, m_N, pid, vid);
+  allocAndInitDataConst(m_y, m_N, 0.0, pid, vid);
+  allocAndInitData(m_A, m_N * m_N, pid, vid);
+  allocAndInitData(m_B, m_N * m_N, pid, vid);
 }
 
 void POLYBENCH_GESUMMV::updateChecksum(VariantID vid)
@@ -23,21 +23,25 @@
 #ifndef RAJAPerf_POLYBENCH_GESUMMV_HPP
 #define RAJAPerf_POLYBENCH_GESUMMV_HPP
 
-#define POLYBENCH_GESUMMV_DATA_SETUP \
+#define POLYBENCH_GESUMMV_DATA_SETUP_TYPED(Data_type) \
   const Index_type N = m_N; \
 \
-  Real_type alpha = m_alpha; \
-  Real_type beta = m_beta; \
+  Data_type alpha = m_alpha; \
+  Data_type beta = m_beta; \
 \
-  Real_ptr x = m_x; \
-  Real_ptr y = m_y; \
-  Real_ptr A = m_A; \
-  Real_ptr B = m_B;
+  Data_type* x = m_x.get<Data_type>(); \
+  Data_type* y = m_y.get<Data_type>(); \
+  Data_type* A = m_A.get<Data_type>(); \
+  Data_type* B = m_B.get<Data_type>();
 
+#define POLYBENCH_GESUMMV_DATA_SETUP POLYBENCH_GESUMMV_DATA_SETUP_TYPED(Real_type)
 
-#define POLYBENCH_GESUMMV_BODY1 \
-  Real_type tmpdot = 0.0; \
-  Real_type ydot = 0.0;
+
+#define POLYBENCH_GESUMMV_BODY1_TYPED(Data_type) \
+  Data_type tmpdot = 0.0; \
+  Data_type ydot = 0.0;
+
+#define POLYBENCH_GESUMMV_BODY1 POLYBENCH_GESUMMV_BODY1_TYPED(Real_type)
 
 #define POLYBENCH_GESUMMV_BODY2 \
   tmpdot += A[j + i*N] * x[j]; \
@@ -59,10 +63,10 @@
   yview(i) = alpha * tmpdot + beta * ydot;
 
 
-#define POLYBENCH_GESUMMV_VIEWS_RAJA \
-  using VIEW1_TYPE = RAJA::View<Real_type, \
+#define POLYBENCH_GESUMMV_VIEWS_RAJA_TYPED(Data_type) \
+  using VIEW1_TYPE = RAJA::View<Data_type, \
                                  RAJA::Layout<1, Index_type, 0>>; \
-  using VIEW2_TYPE = RAJA::View<Real_type, \
+  using VIEW2_TYPE = RAJA::View<Data_type, \
                                  RAJA::Layout<2, Index_type, 1>>; \
 \
   VIEW1_TYPE xview(x, RAJA::Layout<1>(N)); \
@@ -70,6 +74,8 @@
   VIEW2_TYPE Aview(A, RAJA::Layout<2>(N, N)); \
   VIEW2_TYPE Bview(B, RAJA::Layout<2>(N, N));
 
+#define POLYBENCH_GESUMMV_VIEWS_RAJA POLYBENCH_GESUMMV_VIEWS_RAJA_TYPED(Real_type)
+
 
 #include "common/KernelBase.hpp"
 
@@ -100,14 +106,19 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
   Index_type m_N;
 
   Real_type m_alpha;
   Real_type m_beta;
-  Real_ptr m_x;
-  Real_ptr m_y;
-  Real_ptr m_A;
-  Real_ptr m_B;
+  Precision_ptr m_x;
+  Precision_ptr m_y;
+  Precision_ptr m_A;
+  Precision_ptr m_B;
 };
 
 } // end namespace polybench
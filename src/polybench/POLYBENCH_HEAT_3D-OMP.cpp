@@ -19,13 +19,14 @@ namespace polybench
 {
 
 
-void POLYBENCH_HEAT_3D::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void POLYBENCH_HEAT_3D::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps= getRunReps();
 
-  POLYBENCH_HEAT_3D_DATA_SETUP;
+  POLYBENCH_HEAT_3D_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -59,7 +60,7 @@ void POLYBENCH_HEAT_3D::runOpenMPVariant(VariantID vid)
       }
       stopTimer();
 
-      POLYBENCH_HEAT_3D_DATA_RESET;
+      POLYBENCH_HEAT_3D_DATA_RESET_TYPED(Data_type);
 
       break;
     }
@@ -103,14 +104,14 @@ void POLYBENCH_HEAT_3D::runOpenMPVariant(VariantID vid)
       }
       stopTimer();
 
-      POLYBENCH_HEAT_3D_DATA_RESET;
+      POLYBENCH_HEAT_3D_DATA_RESET_TYPED(Data_type);
 
       break;
     }
 
     case RAJA_OpenMP : {
 
-      POLYBENCH_HEAT_3D_VIEWS_RAJA;
+      POLYBENCH_HEAT_3D_VIEWS_RAJA_TYPED(Data_type);
 
       using EXEC_POL =
         RAJA::KernelPolicy<
@@ -148,7 +149,7 @@ void POLYBENCH_HEAT_3D::runOpenMPVariant(VariantID vid)
       }
       stopTimer();
 
-      POLYBENCH_HEAT_3D_DATA_RESET;
+      POLYBENCH_HEAT_3D_DATA_RESET_TYPED(Data_type);
 
       break;
     }
@@ -158,6 +159,18 @@ void POLYBENCH_HEAT_3D::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void POLYBENCH_HEAT_3D::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
@@ -25,13 +25,13 @@ namespace polybench
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(A, m_Ainit, m_N*m_N*m_N, did, hid); \
-  allocAndInitOpenMPDeviceData(B, m_Binit, m_N*m_N*m_N, did, hid);
+  allocAndInitOpenMPDeviceData(A, m_Ainit.get<Real_type>(), m_N*m_N*m_N, did, hid); \
+  allocAndInitOpenMPDeviceData(B, m_Binit.get<Real_type>(), m_N*m_N*m_N, did, hid);
 
 
 #define POLYBENCH_HEAT_3D_TEARDOWN_OMP_TARGET \
-  getOpenMPDeviceData(m_A, A, m_N*m_N*m_N, hid, did); \
-  getOpenMPDeviceData(m_B, B, m_N*m_N*m_N, hid, did); \
+  getOpenMPDeviceData(m_A.get<Real_type>(), A, m_N*m_N*m_N, hid, did); \
+  getOpenMPDeviceData(m_B.get<Real_type>(), B, m_N*m_N*m_N, hid, did); \
   deallocOpenMPDeviceData(A, did); \
   deallocOpenMPDeviceData(B, did);
 
@@ -19,11 +19,12 @@ namespace polybench
 {
 
 
-void POLYBENCH_HEAT_3D::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void POLYBENCH_HEAT_3D::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps= getRunReps();
 
-  POLYBENCH_HEAT_3D_DATA_SETUP;
+  POLYBENCH_HEAT_3D_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -55,7 +56,7 @@ void POLYBENCH_HEAT_3D::runSeqVariant(VariantID vid)
       }
       stopTimer();
 
-      POLYBENCH_HEAT_3D_DATA_RESET;
+      POLYBENCH_HEAT_3D_DATA_RESET_TYPED(Data_type);
 
       break;
     }
@@ -98,14 +99,14 @@ void POLYBENCH_HEAT_3D::runSeqVariant(VariantID vid)
       }
       stopTimer();
 
-      POLYBENCH_HEAT_3D_DATA_RESET;
+      POLYBENCH_HEAT_3D_DATA_RESET_TYPED(Data_type);
 
       break;
     }
 
     case RAJA_Seq : {
 
-      POLYBENCH_HEAT_3D_VIEWS_RAJA;
+      POLYBENCH_HEAT_3D_VIEWS_RAJA_TYPED(Data_type);
 
       using EXEC_POL =
         RAJA::KernelPolicy<
@@ -148,7 +149,7 @@ void POLYBENCH_HEAT_3D::runSeqVariant(VariantID vid)
       }
       stopTimer();
 
-      POLYBENCH_HEAT_3D_DATA_RESET;
+      POLYBENCH_HEAT_3D_DATA_RESET_TYPED(Data_type);
 
       break;
     }
@@ -162,5 +163,13 @@ void POLYBENCH_HEAT_3D::runSeqVariant(VariantID vid)
 
 }
 
+void POLYBENCH_HEAT_3D::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
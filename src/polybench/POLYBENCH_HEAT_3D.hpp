@@ -40,17 +40,21 @@
 #ifndef RAJAPerf_POLYBENCH_HEAT_3D_HPP
 #define RAJAPerf_POLYBENCH_HEAT_3D_HPP
 
-#define POLYBENCH_HEAT_3D_DATA_SETUP \
-  Real_ptr A = m_Ainit; \
-  Real_ptr B = m_Binit; \
+#define POLYBENCH_HEAT_3D_DATA_SETUP_TYPED(Data_type) \
+  Data_type* A = m_Ainit.get<Data_type>(); \
+  Data_type* B = m_Binit.get<Data_type>(); \
   const Index_type N = m_N; \
   const Index_type tsteps = m_tsteps;
 
-#define POLYBENCH_HEAT_3D_DATA_RESET \
+#define POLYBENCH_HEAT_3D_DATA_SETUP POLYBENCH_HEAT_3D_DATA_SETUP_TYPED(Real_type)
+
+#define POLYBENCH_HEAT_3D_DATA_RESET_TYPED(Data_type) \
   m_Ainit = m_A; \
   m_Binit = m_B; \
-  m_A = A; \
-  m_B = B;
+  m_A.get<Data_type>() = A; \
+  m_B.get<Data_type>() = B;
+
+#define POLYBENCH_HEAT_3D_DATA_RESET POLYBENCH_HEAT_3D_DATA_RESET_TYPED(Real_type)
 
 
 #define POLYBENCH_HEAT_3D_BODY1 \
@@ -89,13 +93,15 @@
              Bview(i,j,k);
 
 
-#define POLYBENCH_HEAT_3D_VIEWS_RAJA \
-using VIEW_TYPE = RAJA::View<Real_type, \
+#define POLYBENCH_HEAT_3D_VIEWS_RAJA_TYPED(Data_type) \
+using VIEW_TYPE = RAJA::View<Data_type, \
                              RAJA::Layout<3, Index_type, 2>>; \
 \
   VIEW_TYPE Aview(A, RAJA::Layout<3>(N, N, N)); \
   VIEW_TYPE Bview(B, RAJA::Layout<3>(N, N, N));
 
+#define POLYBENCH_HEAT_3D_VIEWS_RAJA POLYBENCH_HEAT_3D_VIEWS_RAJA_TYPED(Real_type)
+
 
 #include "common/KernelBase.hpp"
 
@@ -126,13 +132,18 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
   Index_type m_N;
   Index_type m_tsteps;
 
-  Real_ptr m_A;
-  Real_ptr m_B;
-  Real_ptr m_Ainit;
-  Real_ptr m_Binit;
+  Precision_ptr m_A;
+  Precision_ptr m_B;
+  Precision_ptr m_Ainit;
+  Precision_ptr m_Binit;
 };
 
 } // end namespace polybench
@@ -19,13 +19,14 @@ namespace polybench
 {
 
 
-void POLYBENCH_JACOBI_1D::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void POLYBENCH_JACOBI_1D::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps= getRunReps();
 
-  POLYBENCH_JACOBI_1D_DATA_SETUP;
+  POLYBENCH_JACOBI_1D_DATA_SETUP_TYPED(Data_type);
 
   auto poly_jacobi1d_lam1 = [=] (Index_type i) {
                               POLYBENCH_JACOBI_1D_BODY1;
@@ -57,7 +58,7 @@ void POLYBENCH_JACOBI_1D::runOpenMPVariant(VariantID vid)
       }
       stopTimer();
 
-      POLYBENCH_JACOBI_1D_DATA_RESET;
+      POLYBENCH_JACOBI_1D_DATA_RESET_TYPED(Data_type);
 
       break;
     }
@@ -83,7 +84,7 @@ void POLYBENCH_JACOBI_1D::runOpenMPVariant(VariantID vid)
       }
       stopTimer();
 
-      POLYBENCH_JACOBI_1D_DATA_RESET;
+      POLYBENCH_JACOBI_1D_DATA_RESET_TYPED(Data_type);
 
       break;
     }
@@ -108,7 +109,7 @@ void POLYBENCH_JACOBI_1D::runOpenMPVariant(VariantID vid)
       }
       stopTimer();
 
-      POLYBENCH_JACOBI_1D_DATA_RESET;
+      POLYBENCH_JACOBI_1D_DATA_RESET_TYPED(Data_type);
 
       break;
     }
@@ -118,6 +119,18 @@ void POLYBENCH_JACOBI_1D::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void POLYBENCH_JACOBI_1D::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
@@ -19,11 +19,12 @@ namespace polybench
 {
 
 
-void POLYBENCH_JACOBI_1D::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void POLYBENCH_JACOBI_1D::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps= getRunReps();
 
-  POLYBENCH_JACOBI_1D_DATA_SETUP;
+  POLYBENCH_JACOBI_1D_DATA_SETUP_TYPED(Data_type);
 
   auto poly_jacobi1d_lam1 = [=] (Index_type i) {
                               POLYBENCH_JACOBI_1D_BODY1;
@@ -53,7 +54,7 @@ void POLYBENCH_JACOBI_1D::runSeqVariant(VariantID vid)
       }
       stopTimer();
 
-      POLYBENCH_JACOBI_1D_DATA_RESET;
+      POLYBENCH_JACOBI_1D_DATA_RESET_TYPED(Data_type);
 
       break;
     }
@@ -79,7 +80,7 @@ void POLYBENCH_JACOBI_1D::runSeqVariant(VariantID vid)
       }
       stopTimer();
 
-      POLYBENCH_JACOBI_1D_DATA_RESET;
+      POLYBENCH_JACOBI_1D_DATA_RESET_TYPED(Data_type);
 
       break;
     }
@@ -104,7 +105,7 @@ void POLYBENCH_JACOBI_1D::runSeqVariant(VariantID vid)
       }
       stopTimer();
 
-      POLYBENCH_JACOBI_1D_DATA_RESET;
+      POLYBENCH_JACOBI_1D_DATA_RESET_TYPED(Data_type);
 
       break;
     }
@@ -118,5 +119,13 @@ void POLYBENCH_JACOBI_1D::runSeqVariant(VariantID vid)
 
 }
 
+void POLYBENCH_JACOBI_1D::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
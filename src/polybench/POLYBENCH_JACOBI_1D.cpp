@@ -11,6 +11,8 @@
 #include "RAJA/RAJA.hpp"
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 
 namespace rajaperf
 {
@@ -67,6 +69,24 @@ POLYBENCH_JACOBI_1D::POLYBENCH_JACOBI_1D(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    m_tsteps * ( (1*data_size + 0*data_size) *
+                                 (m_N-2) +
+                                 (0*data_size + 1*data_size) *
+                                 m_N +
+                                 (1*data_size + 0*data_size) *
+                                 (m_N-2) +
+                                 (0*data_size + 1*data_size) *
+                                 m_N ) );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 POLYBENCH_JACOBI_1D::~POLYBENCH_JACOBI_1D()
@@ -76,10 +96,12 @@ POLYBENCH_JACOBI_1D::~POLYBENCH_JACOBI_1D()
 void POLYBENCH_JACOBI_1D::setUp(VariantID vid)
 {
   (void) vid;
-  allocAndInitData(m_Ainit, m_N, vid);
-  allocAndInitData(m_Binit, m_N, vid);
-  allocAndInitDataConst(m_A, m_N, 0.0, vid);
-  allocAndInitDataConst(m_B, m_N, 0.0, vid);
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitData(m_Ainit, m_N, pid, vid);
+  allocAndInitData(m_Binit, m_N, pid, vid);
+  allocAndInitDataConst(m_A, m_N, 0.0, pid, vid);
+  allocAndInitDataConst(m_B, m_N, 0.0, pid, vid);
 }
 
 void POLYBENCH_JACOBI_1D::updateChecksum(VariantID vid)
@@ -37,13 +37,13 @@ namespace polybench
 
 
 #define POLYBENCH_JACOBI_2D_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(A, m_Ainit, m_N*m_N); \
-  allocAndInitCudaDeviceData(B, m_Binit, m_N*m_N);
+  allocAndInitCudaDeviceData(A, m_Ainit.get<Real_type>(), m_N*m_N); \
+  allocAndInitCudaDeviceData(B, m_Binit.get<Real_type>(), m_N*m_N);
 
 
 #define POLYBENCH_JACOBI_2D_TEARDOWN_CUDA \
-  getCudaDeviceData(m_A, A, m_N*m_N); \
-  getCudaDeviceData(m_B, B, m_N*m_N); \
+  getCudaDeviceData(m_A.get<Real_type>(), A, m_N*m_N); \
+  getCudaDeviceData(m_B.get<Real_type>(), B, m_N*m_N); \
   deallocCudaDeviceData(A); \
   deallocCudaDeviceData(B);
 
@@ -37,13 +37,13 @@ namespace polybench
 
 
 #define POLYBENCH_JACOBI_2D_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(A, m_Ainit, m_N*m_N); \
-  allocAndInitHipDeviceData(B, m_Binit, m_N*m_N);
+  allocAndInitHipDeviceData(A, m_Ainit.get<Real_type>(), m_N*m_N); \
+  allocAndInitHipDeviceData(B, m_Binit.get<Real_type>(), m_N*m_N);
 
 
 #define POLYBENCH_JACOBI_2D_TEARDOWN_HIP \
-  getHipDeviceData(m_A, A, m_N*m_N); \
-  getHipDeviceData(m_B, B, m_N*m_N); \
+  getHipDeviceData(m_A.get<Real_type>(), A, m_N*m_N); \
+  getHipDeviceData(m_B.get<Real_type>(), B, m_N*m_N); \
   deallocHipDeviceData(A); \
   deallocHipDeviceData(B);
 
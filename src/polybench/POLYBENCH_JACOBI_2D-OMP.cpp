@@ -19,13 +19,14 @@ namespace polybench
 {
 
 
-void POLYBENCH_JACOBI_2D::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void POLYBENCH_JACOBI_2D::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps= getRunReps();
 
-  POLYBENCH_JACOBI_2D_DATA_SETUP;
+  POLYBENCH_JACOBI_2D_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -55,7 +56,7 @@ void POLYBENCH_JACOBI_2D::runOpenMPVariant(VariantID vid)
       }
       stopTimer();
 
-      POLYBENCH_JACOBI_2D_DATA_RESET;
+      POLYBENCH_JACOBI_2D_DATA_RESET_TYPED(Data_type);
 
       break;
     }
@@ -93,14 +94,14 @@ void POLYBENCH_JACOBI_2D::runOpenMPVariant(VariantID vid)
       }
       stopTimer();
 
-      POLYBENCH_JACOBI_2D_DATA_RESET;
+      POLYBENCH_JACOBI_2D_DATA_RESET_TYPED(Data_type);
 
       break;
     }
 
     case RAJA_OpenMP : {
 
-      POLYBENCH_JACOBI_2D_VIEWS_RAJA;
+      POLYBENCH_JACOBI_2D_VIEWS_RAJA_TYPED(Data_type);
 
       auto poly_jacobi2d_lam1 = [=](Index_type i, Index_type j) {
                                   POLYBENCH_JACOBI_2D_BODY1_RAJA;
@@ -140,7 +141,7 @@ void POLYBENCH_JACOBI_2D::runOpenMPVariant(VariantID vid)
       }
       stopTimer();
 
-      POLYBENCH_JACOBI_2D_DATA_RESET;
+      POLYBENCH_JACOBI_2D_DATA_RESET_TYPED(Data_type);
 
       break;
     }
@@ -150,6 +151,18 @@ void POLYBENCH_JACOBI_2D::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void POLYBENCH_JACOBI_2D::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
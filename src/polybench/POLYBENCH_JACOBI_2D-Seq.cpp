@@ -19,11 +19,12 @@ namespace polybench
 {
 
 
-void POLYBENCH_JACOBI_2D::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void POLYBENCH_JACOBI_2D::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps= getRunReps();
 
-  POLYBENCH_JACOBI_2D_DATA_SETUP;
+  POLYBENCH_JACOBI_2D_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -50,7 +51,7 @@ void POLYBENCH_JACOBI_2D::runSeqVariant(VariantID vid)
       }
       stopTimer();
 
-      POLYBENCH_JACOBI_2D_DATA_RESET;
+      POLYBENCH_JACOBI_2D_DATA_RESET_TYPED(Data_type);
 
       break;
     }
@@ -88,14 +89,14 @@ void POLYBENCH_JACOBI_2D::runSeqVariant(VariantID vid)
       }
       stopTimer();
 
-      POLYBENCH_JACOBI_2D_DATA_RESET;
+      POLYBENCH_JACOBI_2D_DATA_RESET_TYPED(Data_type);
 
       break;
     }
 
     case RAJA_Seq : {
 
-      POLYBENCH_JACOBI_2D_VIEWS_RAJA;
+      POLYBENCH_JACOBI_2D_VIEWS_RAJA_TYPED(Data_type);
 
       auto poly_jacobi2d_lam1 = [=](Index_type i, Index_type j) {
                                   POLYBENCH_JACOBI_2D_BODY1_RAJA;
@@ -135,7 +136,7 @@ void POLYBENCH_JACOBI_2D::runSeqVariant(VariantID vid)
       }
       stopTimer();
 
-      POLYBENCH_JACOBI_2D_DATA_RESET;
+      POLYBENCH_JACOBI_2D_DATA_RESET_TYPED(Data_type);
 
       break;
     }
@@ -149,5 +150,13 @@ void POLYBENCH_JACOBI_2D::runSeqVariant(VariantID vid)
 
 }
 
+void POLYBENCH_JACOBI_2D::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -11,6 +11,8 @@
 #include "RAJA/RAJA.hpp"
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 
 namespace rajaperf
 {
@@ -69,6 +71,24 @@ POLYBENCH_JACOBI_2D::POLYBENCH_JACOBI_2D(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    m_tsteps * ( (1*data_size + 0*data_size) *
+                                 (m_N-2) * (m_N-2) +
+                                 (0*data_size + 1*data_size) *
+                                 (m_N * m_N - 4) +
+                                 (1*data_size + 0*data_size) *
+                                 (m_N-2) * (m_N-2) +
+                                 (0*data_size + 1*data_size) *
+                                 (m_N * m_N  - 4) ) );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 POLYBENCH_JACOBI_2D::~POLYBENCH_JACOBI_2D()
@@ -78,10 +98,12 @@ POLYBENCH_JACOBI_2D::~POLYBENCH_JACOBI_2D()
 void POLYBENCH_JACOBI_2D::setUp(VariantID vid)
 {
   (void) vid;
-  allocAndInitData(m_Ainit, m_N*m_N, vid);
-  allocAndInitData(m_Binit, m_N*m_N, vid);
-  allocAndInitDataConst(m_A, m_N*m_N, 0.0, vid);
-  allocAndInitDataConst(m_B, m_N*m_N, 0.0, vid);
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitData(m_Ainit, m_N*m_N, pid, vid);
+  allocAndInitData(m_Binit, m_N*m_N, pid, vid);
+  allocAndInitDataConst(m_A, m_N*m_N, 0.0, pid, vid);
+  allocAndInitDataConst(m_B, m_N*m_N, 0.0, pid, vid);
 }
 
 void POLYBENCH_JACOBI_2D::updateChecksum(VariantID vid)
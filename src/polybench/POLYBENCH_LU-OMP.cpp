@@ -0,0 +1,191 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_LU.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+template < typename Data_type >
+void POLYBENCH_LU::runOpenMPVariantPrecision(VariantID vid)
+{
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_LU_DATA_SETUP_TYPED(Data_type);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+
+          #pragma omp for
+          for (Index_type i = 0; i < N; ++i ) {
+            for (Index_type j = 0; j < N; ++j ) {
+              POLYBENCH_LU_BODY1;
+            }
+          }
+
+          for (Index_type k = 0; k < N; ++k ) {
+            #pragma omp for schedule(static)
+            for (Index_type i = k+1; i < N; ++i ) {
+              POLYBENCH_LU_BODY2;
+              for (Index_type j = k+1; j < N; ++j ) {
+                POLYBENCH_LU_BODY3;
+              }
+            }
+          }
+
+        } // end omp parallel region
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto poly_lu_base_lam1 = [=](Index_type i, Index_type j) {
+                                 POLYBENCH_LU_BODY1;
+                               };
+      auto poly_lu_base_lam2 = [=](Index_type k, Index_type i) {
+                                 POLYBENCH_LU_BODY2;
+                               };
+      auto poly_lu_base_lam3 = [=](Index_type k, Index_type i, Index_type j) {
+                                 POLYBENCH_LU_BODY3;
+                               };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+
+          #pragma omp for
+          for (Index_type i = 0; i < N; ++i ) {
+            for (Index_type j = 0; j < N; ++j ) {
+              poly_lu_base_lam1(i, j);
+            }
+          }
+
+          for (Index_type k = 0; k < N; ++k ) {
+            #pragma omp for schedule(static)
+            for (Index_type i = k+1; i < N; ++i ) {
+              poly_lu_base_lam2(k, i);
+              for (Index_type j = k+1; j < N; ++j ) {
+                poly_lu_base_lam3(k, i, j);
+              }
+            }
+          }
+
+        } // end omp parallel region
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      POLYBENCH_LU_VIEWS_RAJA_TYPED(Data_type);
+
+      auto poly_lu_lam1 = [=](Index_type i, Index_type j) {
+                            POLYBENCH_LU_BODY1_RAJA;
+                          };
+
+      using EXEC_POL1 =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<0, RAJA::omp_parallel_for_exec,
+            RAJA::statement::For<1, RAJA::loop_exec,
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >;
+
+      using EXEC_POL2 =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<0, RAJA::omp_parallel_for_exec,
+            RAJA::statement::Lambda<0, RAJA::Segs<0>>,
+            RAJA::statement::For<1, RAJA::loop_exec,
+              RAJA::statement::Lambda<1, RAJA::Segs<0,1>>
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL1>(
+          RAJA::make_tuple( RAJA::RangeSegment{0, N},
+                            RAJA::RangeSegment{0, N} ),
+          poly_lu_lam1
+        );
+
+        for (Index_type k = 0; k < N; ++k ) {
+
+          RAJA::kernel<EXEC_POL2>(
+            RAJA::make_tuple( RAJA::RangeSegment{k+1, N},
+                              RAJA::RangeSegment{k+1, N} ),
+
+            [=](Index_type i) {
+              POLYBENCH_LU_BODY2_RAJA;
+            },
+            [=](Index_type i, Index_type j) {
+              POLYBENCH_LU_BODY3_RAJA;
+            }
+          );
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_LU : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void POLYBENCH_LU::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
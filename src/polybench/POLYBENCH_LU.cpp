@@ -0,0 +1,114 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_LU.hpp"
+
+#include "RAJA/RAJA.hpp"
+#include "common/DataUtils.hpp"
+
+#include <vector>
+
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+//
+// Diagonal dominance makes factorization without pivoting stable.
+//
+template < typename Data_type >
+static void makeDiagonallyDominant(Data_type* A, Index_type N)
+{
+  for (Index_type i = 0; i < N; ++i) {
+    A[i + i*N] += N;
+  }
+}
+
+
+POLYBENCH_LU::POLYBENCH_LU(const RunParams& params)
+  : KernelBase(rajaperf::Polybench_LU, params)
+{
+  Index_type N_default = 1000;
+
+  setDefaultProblemSize( N_default * N_default );
+  setDefaultReps(4);
+
+  m_N = std::sqrt( getTargetProblemSize() ) + 1;
+
+
+  setActualProblemSize( m_N * m_N );
+
+  setItsPerRep( m_N * m_N +
+                m_N * (m_N - 1) / 2 +
+                (m_N - 1) * m_N * (2 * m_N - 1) / 6 );
+  setKernelsPerRep(2);
+  setBytesPerRep( (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_N * m_N +
+                  (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_N * m_N );
+  setFLOPsPerRep( 1 * m_N * (m_N - 1) / 2 +
+                  2 * (m_N - 1) * m_N * (2 * m_N - 1) / 6 );
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Kernel);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (1*data_size + 1*data_size) * m_N * m_N +
+                    (1*data_size + 1*data_size) * m_N * m_N );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
+}
+
+POLYBENCH_LU::~POLYBENCH_LU()
+{
+}
+
+void POLYBENCH_LU::setUp(VariantID vid)
+{
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitData(m_Ainit, m_N * m_N, pid, vid);
+  allocAndInitDataConst(m_A, m_N * m_N, 0.0, pid, vid);
+
+  if ( pid == Precision_Float ) {
+    makeDiagonallyDominant(m_Ainit.get<Float_type>(), m_N);
+  } else {
+    makeDiagonallyDominant(m_Ainit.get<Double_type>(), m_N);
+  }
+}
+
+void POLYBENCH_LU::updateChecksum(VariantID vid)
+{
+  checksum[vid] += calcChecksum(m_A, m_N * m_N, checksum_scale_factor );
+}
+
+void POLYBENCH_LU::tearDown(VariantID vid)
+{
+  (void) vid;
+  deallocData(m_A);
+  deallocData(m_Ainit);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
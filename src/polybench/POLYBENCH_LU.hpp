@@ -0,0 +1,131 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// POLYBENCH_LU kernel reference implementation:
+///
+/// for (Index_type i = 0; i < N; i++) {
+///   for (Index_type j = 0; j < N; j++) {
+///     A[i][j] = Ainit[i][j];
+///   }
+/// }
+///
+/// for (Index_type k = 0; k < N; k++) {
+///   for (Index_type i = k+1; i < N; i++) {
+///     A[i][k] /= A[k][k];
+///     for (Index_type j = k+1; j < N; j++) {
+///       A[i][j] -= A[i][k] * A[k][j];
+///     }
+///   }
+/// }
+///
+/// This is the right-looking form of the Polybench (row-oriented) LU
+/// factorization without pivoting. Every entry receives the same updates
+/// in the same order as in the Polybench loop nest, but all rows below
+/// the pivot are independent for a given k, which is what the parallel
+/// variants exploit. The matrix is restored from Ainit at the start of
+/// each repetition so every rep factors the same (diagonally dominant)
+/// matrix.
+///
+
+
+#ifndef RAJAPerf_POLYBENCH_LU_HPP
+#define RAJAPerf_POLYBENCH_LU_HPP
+
+#define POLYBENCH_LU_DATA_SETUP_TYPED(Data_type) \
+  Data_type* A = m_A.get<Data_type>(); \
+  Data_type* Ainit = m_Ainit.get<Data_type>(); \
+\
+  const Index_type N = m_N;
+
+#define POLYBENCH_LU_DATA_SETUP POLYBENCH_LU_DATA_SETUP_TYPED(Real_type)
+
+
+#define POLYBENCH_LU_BODY1 \
+  A[j + i*N] = Ainit[j + i*N];
+
+#define POLYBENCH_LU_BODY2 \
+  A[k + i*N] /= A[k + k*N];
+
+#define POLYBENCH_LU_BODY3 \
+  A[j + i*N] -= A[k + i*N] * A[j + k*N];
+
+
+#define POLYBENCH_LU_BODY1_RAJA \
+  Aview(i, j) = Ainitview(i, j);
+
+#define POLYBENCH_LU_BODY2_RAJA \
+  Aview(i, k) /= Aview(k, k);
+
+#define POLYBENCH_LU_BODY3_RAJA \
+  Aview(i, j) -= Aview(i, k) * Aview(k, j);
+
+
+#define POLYBENCH_LU_VIEWS_RAJA_TYPED(Data_type) \
+  using VIEW_TYPE = RAJA::View<Data_type, \
+                               RAJA::Layout<2, Index_type, 1>>; \
+\
+  VIEW_TYPE Aview(A, RAJA::Layout<2>(N, N)); \
+  VIEW_TYPE Ainitview(Ainit, RAJA::Layout<2>(N, N));
+
+#define POLYBENCH_LU_VIEWS_RAJA POLYBENCH_LU_VIEWS_RAJA_TYPED(Real_type)
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+
+class RunParams;
+
+namespace polybench
+{
+
+class POLYBENCH_LU : public KernelBase
+{
+public:
+
+  POLYBENCH_LU(const RunParams& params);
+
+  ~POLYBENCH_LU();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  POLYBENCH_LU : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  POLYBENCH_LU : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  POLYBENCH_LU : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Index_type m_N;
+
+  Precision_ptr m_A;
+  Precision_ptr m_Ainit;
+};
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -27,16 +27,16 @@ namespace polybench
   const size_t block_size = 256;
 
 #define POLYBENCH_MVT_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(x1, m_x1, N); \
-  allocAndInitCudaDeviceData(x2, m_x2, N); \
-  allocAndInitCudaDeviceData(y1, m_y1, N); \
-  allocAndInitCudaDeviceData(y2, m_y2, N); \
-  allocAndInitCudaDeviceData(A, m_A, N * N);
+  allocAndInitCudaDeviceData(x1, m_x1.get<Real_type>(), N); \
+  allocAndInitCudaDeviceData(x2, m_x2.get<Real_type>(), N); \
+  allocAndInitCudaDeviceData(y1, m_y1.get<Real_type>(), N); \
+  allocAndInitCudaDeviceData(y2, m_y2.get<Real_type>(), N); \
+  allocAndInitCudaDeviceData(A, m_A.get<Real_type>(), N * N);
 
 
 #define POLYBENCH_MVT_TEARDOWN_CUDA \
-  getCudaDeviceData(m_x1, x1, N); \
-  getCudaDeviceData(m_x2, x2, N); \
+  getCudaDeviceData(m_x1.get<Real_type>(), x1, N); \
+  getCudaDeviceData(m_x2.get<Real_type>(), x2, N); \
   deallocCudaDeviceData(x1); \
   deallocCudaDeviceData(x2); \
   deallocCudaDeviceData(y1); \
@@ -27,16 +27,16 @@ namespace polybench
   const size_t block_size = 256;
 
 #define POLYBENCH_MVT_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(x1, m_x1, N); \
-  allocAndInitHipDeviceData(x2, m_x2, N); \
-  allocAndInitHipDeviceData(y1, m_y1, N); \
-  allocAndInitHipDeviceData(y2, m_y2, N); \
-  allocAndInitHipDeviceData(A, m_A, N * N);
+  allocAndInitHipDeviceData(x1, m_x1.get<Real_type>(), N); \
+  allocAndInitHipDeviceData(x2, m_x2.get<Real_type>(), N); \
+  allocAndInitHipDeviceData(y1, m_y1.get<Real_type>(), N); \
+  allocAndInitHipDeviceData(y2, m_y2.get<Real_type>(), N); \
+  allocAndInitHipDeviceData(A, m_A.get<Real_type>(), N * N);
 
 
 #define POLYBENCH_MVT_TEARDOWN_HIP \
-  getHipDeviceData(m_x1, x1, N); \
-  getHipDeviceData(m_x2, x2, N); \
+  getHipDeviceData(m_x1.get<Real_type>(), x1, N); \
+  getHipDeviceData(m_x2.get<Real_type>(), x2, N); \
   deallocHipDeviceData(x1); \
   deallocHipDeviceData(x2); \
   deallocHipDeviceData(y1); \
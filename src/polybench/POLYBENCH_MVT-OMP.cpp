@@ -19,13 +19,14 @@ namespace polybench
 {
 
 
-void POLYBENCH_MVT::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type >
+void POLYBENCH_MVT::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps= getRunReps();
 
-  POLYBENCH_MVT_DATA_SETUP;
+  POLYBENCH_MVT_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -39,7 +40,7 @@ void POLYBENCH_MVT::runOpenMPVariant(VariantID vid)
 
           #pragma omp for schedule(static) nowait
           for (Index_type i = 0; i < N; ++i ) {
-            POLYBENCH_MVT_BODY1;
+            POLYBENCH_MVT_BODY1_TYPED(Data_type);
             for (Index_type j = 0; j < N; ++j ) {
               POLYBENCH_MVT_BODY2;
             }
@@ -48,7 +49,7 @@ void POLYBENCH_MVT::runOpenMPVariant(VariantID vid)
 
           #pragma omp for schedule(static) nowait
           for (Index_type i = 0; i < N; ++i ) {
-            POLYBENCH_MVT_BODY4;
+            POLYBENCH_MVT_BODY4_TYPED(Data_type);
             for (Index_type j = 0; j < N; ++j ) {
               POLYBENCH_MVT_BODY5;
             }
@@ -66,19 +67,19 @@ void POLYBENCH_MVT::runOpenMPVariant(VariantID vid)
     case Lambda_OpenMP : {
 
       auto poly_mvt_base_lam2 = [=] (Index_type i, Index_type j,
-                                     Real_type &dot) {
+                                     Data_type &dot) {
                                   POLYBENCH_MVT_BODY2;
                                  };
       auto poly_mvt_base_lam3 = [=] (Index_type i,
-                                     Real_type &dot) {
+                                     Data_type &dot) {
                                   POLYBENCH_MVT_BODY3;
                                 };
       auto poly_mvt_base_lam5 = [=] (Index_type i, Index_type j,
-                                     Real_type &dot) {
+                                     Data_type &dot) {
                                   POLYBENCH_MVT_BODY5;
                                 };
       auto poly_mvt_base_lam6 = [=] (Index_type i,
-                                     Real_type &dot) {
+                                     Data_type &dot) {
                                   POLYBENCH_MVT_BODY6;
                                 };
 
@@ -90,7 +91,7 @@ void POLYBENCH_MVT::runOpenMPVariant(VariantID vid)
 
           #pragma omp for schedule(static) nowait
           for (Index_type i = 0; i < N; ++i ) {
-            POLYBENCH_MVT_BODY1;
+            POLYBENCH_MVT_BODY1_TYPED(Data_type);
             for (Index_type j = 0; j < N; ++j ) {
               poly_mvt_base_lam2(i, j, dot);
             }
@@ -99,7 +100,7 @@ void POLYBENCH_MVT::runOpenMPVariant(VariantID vid)
 
           #pragma omp for schedule(static) nowait
           for (Index_type i = 0; i < N; ++i ) {
-            POLYBENCH_MVT_BODY4;
+            POLYBENCH_MVT_BODY4_TYPED(Data_type);
             for (Index_type j = 0; j < N; ++j ) {
               poly_mvt_base_lam5(i, j, dot);
             }
@@ -116,24 +117,24 @@ void POLYBENCH_MVT::runOpenMPVariant(VariantID vid)
 
     case RAJA_OpenMP : {
 
-      POLYBENCH_MVT_VIEWS_RAJA;
+      POLYBENCH_MVT_VIEWS_RAJA_TYPED(Data_type);
 
-      auto poly_mvt_lam1 = [=] (Real_type &dot) {
+      auto poly_mvt_lam1 = [=] (Data_type &dot) {
                                 POLYBENCH_MVT_BODY1_RAJA;
                                };
-      auto poly_mvt_lam2 = [=] (Index_type i, Index_type j, Real_type &dot) {
+      auto poly_mvt_lam2 = [=] (Index_type i, Index_type j, Data_type &dot) {
                                 POLYBENCH_MVT_BODY2_RAJA;
                                };
-      auto poly_mvt_lam3 = [=] (Index_type i, Real_type &dot) {
+      auto poly_mvt_lam3 = [=] (Index_type i, Data_type &dot) {
                                 POLYBENCH_MVT_BODY3_RAJA;
                                };
-      auto poly_mvt_lam4 = [=] (Real_type &dot) {
+      auto poly_mvt_lam4 = [=] (Data_type &dot) {
                                 POLYBENCH_MVT_BODY4_RAJA;
                                };
-      auto poly_mvt_lam5 = [=] (Index_type i, Index_type j, Real_type &dot) {
+      auto poly_mvt_lam5 = [=] (Index_type i, Index_type j, Data_type &dot) {
                                 POLYBENCH_MVT_BODY5_RAJA;
                                };
-      auto poly_mvt_lam6 = [=] (Index_type i, Real_type &dot) {
+      auto poly_mvt_lam6 = [=] (Index_type i, Data_type &dot) {
                                 POLYBENCH_MVT_BODY6_RAJA;
                                };
 
@@ -156,7 +157,7 @@ void POLYBENCH_MVT::runOpenMPVariant(VariantID vid)
           RAJA::kernel_param<EXEC_POL>(
             RAJA::make_tuple(RAJA::RangeSegment{0, N},
                              RAJA::RangeSegment{0, N}),
-            RAJA::tuple<Real_type>{0.0},
+            RAJA::tuple<Data_type>{0.0},
 
             poly_mvt_lam1,
             poly_mvt_lam2,
@@ -167,7 +168,7 @@ void POLYBENCH_MVT::runOpenMPVariant(VariantID vid)
           RAJA::kernel_param<EXEC_POL>(
             RAJA::make_tuple(RAJA::RangeSegment{0, N},
                              RAJA::RangeSegment{0, N}),
-            RAJA::tuple<Real_type>{0.0},
+            RAJA::tuple<Data_type>{0.0},
 
             poly_mvt_lam4,
             poly_mvt_lam5,
@@ -188,6 +189,18 @@ void POLYBENCH_MVT::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void POLYBENCH_MVT::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
@@ -30,16 +30,16 @@ namespace polybench
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(x1, m_x1, N, did, hid); \
-  allocAndInitOpenMPDeviceData(x2, m_x2, N, did, hid); \
-  allocAndInitOpenMPDeviceData(y1, m_y1, N, did, hid); \
-  allocAndInitOpenMPDeviceData(y2, m_y2, N, did, hid); \
-  allocAndInitOpenMPDeviceData(A, m_A, N * N, did, hid);
+  allocAndInitOpenMPDeviceData(x1, m_x1.get<Real_type>(), N, did, hid); \
+  allocAndInitOpenMPDeviceData(x2, m_x2.get<Real_type>(), N, did, hid); \
+  allocAndInitOpenMPDeviceData(y1, m_y1.get<Real_type>(), N, did, hid); \
+  allocAndInitOpenMPDeviceData(y2, m_y2.get<Real_type>(), N, did, hid); \
+  allocAndInitOpenMPDeviceData(A, m_A.get<Real_type>(), N * N, did, hid);
 
 
 #define POLYBENCH_MVT_TEARDOWN_OMP_TARGET \
-  getOpenMPDeviceData(m_x1, x1, N, hid, did); \
-  getOpenMPDeviceData(m_x2, x2, N, hid, did); \
+  getOpenMPDeviceData(m_x1.get<Real_type>(), x1, N, hid, did); \
+  getOpenMPDeviceData(m_x2.get<Real_type>(), x2, N, hid, did); \
   deallocOpenMPDeviceData(x1, did); \
   deallocOpenMPDeviceData(x2, did); \
   deallocOpenMPDeviceData(y1, did); \
@@ -19,11 +19,12 @@ namespace polybench
 {
 
 
-void POLYBENCH_MVT::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void POLYBENCH_MVT::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps= getRunReps();
 
-  POLYBENCH_MVT_DATA_SETUP;
+  POLYBENCH_MVT_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -33,7 +34,7 @@ void POLYBENCH_MVT::runSeqVariant(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         for (Index_type i = 0; i < N; ++i ) {
-          POLYBENCH_MVT_BODY1;
+          POLYBENCH_MVT_BODY1_TYPED(Data_type);
           for (Index_type j = 0; j < N; ++j ) {
             POLYBENCH_MVT_BODY2;
           }
@@ -41,7 +42,7 @@ void POLYBENCH_MVT::runSeqVariant(VariantID vid)
         }
 
         for (Index_type i = 0; i < N; ++i ) {
-          POLYBENCH_MVT_BODY4;
+          POLYBENCH_MVT_BODY4_TYPED(Data_type);
           for (Index_type j = 0; j < N; ++j ) {
             POLYBENCH_MVT_BODY5;
           }
@@ -59,19 +60,19 @@ void POLYBENCH_MVT::runSeqVariant(VariantID vid)
     case Lambda_Seq : {
 
       auto poly_mvt_base_lam2 = [=] (Index_type i, Index_type j,
-                                     Real_type &dot) {
+                                     Data_type &dot) {
                                   POLYBENCH_MVT_BODY2;
                                  };
       auto poly_mvt_base_lam3 = [=] (Index_type i,
-                                     Real_type &dot) {
+                                     Data_type &dot) {
                                   POLYBENCH_MVT_BODY3;
                                 };
       auto poly_mvt_base_lam5 = [=] (Index_type i, Index_type j,
-                                     Real_type &dot) {
+                                     Data_type &dot) {
                                   POLYBENCH_MVT_BODY5;
                                 };
       auto poly_mvt_base_lam6 = [=] (Index_type i,
-                                     Real_type &dot) {
+                                     Data_type &dot) {
                                   POLYBENCH_MVT_BODY6;
                                 };
 
@@ -79,7 +80,7 @@ void POLYBENCH_MVT::runSeqVariant(VariantID vid)
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         for (Index_type i = 0; i < N; ++i ) {
-          POLYBENCH_MVT_BODY1;
+          POLYBENCH_MVT_BODY1_TYPED(Data_type);
           for (Index_type j = 0; j < N; ++j ) {
             poly_mvt_base_lam2(i, j, dot);
           }
@@ -87,7 +88,7 @@ void POLYBENCH_MVT::runSeqVariant(VariantID vid)
         }
 
         for (Index_type i = 0; i < N; ++i ) {
-          POLYBENCH_MVT_BODY4;
+          POLYBENCH_MVT_BODY4_TYPED(Data_type);
           for (Index_type j = 0; j < N; ++j ) {
             poly_mvt_base_lam5(i, j, dot);
           }
@@ -102,24 +103,24 @@ void POLYBENCH_MVT::runSeqVariant(VariantID vid)
 
     case RAJA_Seq : {
 
-      POLYBENCH_MVT_VIEWS_RAJA;
+      POLYBENCH_MVT_VIEWS_RAJA_TYPED(Data_type);
 
-      auto poly_mvt_lam1 = [=] (Real_type &dot) {
+      auto poly_mvt_lam1 = [=] (Data_type &dot) {
                                 POLYBENCH_MVT_BODY1_RAJA;
                                };
-      auto poly_mvt_lam2 = [=] (Index_type i, Index_type j, Real_type &dot) {
+      auto poly_mvt_lam2 = [=] (Index_type i, Index_type j, Data_type &dot) {
                                 POLYBENCH_MVT_BODY2_RAJA;
                                };
-      auto poly_mvt_lam3 = [=] (Index_type i, Real_type &dot) {
+      auto poly_mvt_lam3 = [=] (Index_type i, Data_type &dot) {
                                 POLYBENCH_MVT_BODY3_RAJA;
                                };
-      auto poly_mvt_lam4 = [=] (Real_type &dot) {
+      auto poly_mvt_lam4 = [=] (Data_type &dot) {
                                 POLYBENCH_MVT_BODY4_RAJA;
                                };
-      auto poly_mvt_lam5 = [=] (Index_type i, Index_type j, Real_type &dot) {
+      auto poly_mvt_lam5 = [=] (Index_type i, Index_type j, Data_type &dot) {
                                 POLYBENCH_MVT_BODY5_RAJA;
                                };
-      auto poly_mvt_lam6 = [=] (Index_type i, Real_type &dot) {
+      auto poly_mvt_lam6 = [=] (Index_type i, Data_type &dot) {
                                 POLYBENCH_MVT_BODY6_RAJA;
                                };
 
@@ -142,7 +143,7 @@ void POLYBENCH_MVT::runSeqVariant(VariantID vid)
           RAJA::kernel_param<EXEC_POL>(
             RAJA::make_tuple(RAJA::RangeSegment{0, N},
                              RAJA::RangeSegment{0, N}),
-            RAJA::tuple<Real_type>{0.0},
+            RAJA::tuple<Data_type>{0.0},
 
             poly_mvt_lam1,
             poly_mvt_lam2,
@@ -153,7 +154,7 @@ void POLYBENCH_MVT::runSeqVariant(VariantID vid)
           RAJA::kernel_param<EXEC_POL>(
             RAJA::make_tuple(RAJA::RangeSegment{0, N},
                              RAJA::RangeSegment{0, N}),
-            RAJA::tuple<Real_type>{0.0},
+            RAJA::tuple<Data_type>{0.0},
 
             poly_mvt_lam4,
             poly_mvt_lam5,
@@ -178,5 +179,13 @@ void POLYBENCH_MVT::runSeqVariant(VariantID vid)
 
 }
 
+void POLYBENCH_MVT::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -11,6 +11,8 @@
 #include "RAJA/RAJA.hpp"
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 
 namespace rajaperf
 {
@@ -62,6 +64,20 @@ POLYBENCH_MVT::POLYBENCH_MVT(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (1*data_size + 2*data_size) * m_N +
+                    (0*data_size + 1*data_size) * m_N * m_N +
+                    (1*data_size + 2*data_size) * m_N +
+                    (0*data_size + 1*data_size) * m_N * m_N );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 POLYBENCH_MVT::~POLYBENCH_MVT()
@@ -71,11 +87,13 @@ POLYBENCH_MVT::~POLYBENCH_MVT()
 void POLYBENCH_MVT::setUp(VariantID vid)
 {
   (void) vid;
-  allocAndInitData(m_y1, m_N, vid);
-  allocAndInitData(m_y2, m_N, vid);
-  allocAndInitData(m_A, m_N * m_N, vid);
-  allocAndInitDataConst(m_x1, m_N, 0.0, vid);
-  allocAndInitDataConst(m_x2, m_N, 0.0, vid);
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitData(m_y1, m_N, pid, vid);
+  allocAndInitData(m_y2, m_N, pid, vid);
+  allocAndInitData(m_A, m_N * m_N, pid, vid);
+  allocAndInitDataConst(m_x1, m_N, 0.0, pid, vid);
+  allocAndInitDataConst(m_x2, m_N, 0.0, pid, vid);
 }
 
 void POLYBENCH_MVT::updateChecksum(VariantID vid)
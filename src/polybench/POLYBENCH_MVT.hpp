@@ -24,17 +24,21 @@
 #ifndef RAJAPerf_POLYBENCH_MVT_HPP
 #define RAJAPerf_POLYBENCH_MVT_HPP
 
-#define POLYBENCH_MVT_DATA_SETUP \
-  Real_ptr x1 = m_x1; \
-  Real_ptr x2 = m_x2; \
-  Real_ptr y1 = m_y1; \
-  Real_ptr y2 = m_y2; \
-  Real_ptr A = m_A; \
+#define POLYBENCH_MVT_DATA_SETUP_TYPED(Data_type) \
+  Data_type* x1 = m_x1.get<Data_type>(); \
+  Data_type* x2 = m_x2.get<Data_type>(); \
+  Data_type* y1 = m_y1.get<Data_type>(); \
+  Data_type* y2 = m_y2.get<Data_type>(); \
+  Data_type* A = m_A.get<Data_type>(); \
   const Index_type N = m_N;
 
+#define POLYBENCH_MVT_DATA_SETUP POLYBENCH_MVT_DATA_SETUP_TYPED(Real_type)
 
-#define POLYBENCH_MVT_BODY1 \
-  Real_type dot = 0.0;
+
+#define POLYBENCH_MVT_BODY1_TYPED(Data_type) \
+  Data_type dot = 0.0;
+
+#define POLYBENCH_MVT_BODY1 POLYBENCH_MVT_BODY1_TYPED(Real_type)
 
 #define POLYBENCH_MVT_BODY2 \
   dot += A[j + i*N] * y1[j];
@@ -42,8 +46,10 @@
 #define POLYBENCH_MVT_BODY3 \
   x1[i] += dot;
 
-#define POLYBENCH_MVT_BODY4 \
-  Real_type dot = 0.0;
+#define POLYBENCH_MVT_BODY4_TYPED(Data_type) \
+  Data_type dot = 0.0;
+
+#define POLYBENCH_MVT_BODY4 POLYBENCH_MVT_BODY4_TYPED(Real_type)
 
 #define POLYBENCH_MVT_BODY5 \
   dot += A[i + j*N] * y2[i];
@@ -71,11 +77,11 @@
   x2view(i) += dot;
 
 
-#define POLYBENCH_MVT_VIEWS_RAJA \
-  using VIEW_1 = RAJA::View<Real_type, \
+#define POLYBENCH_MVT_VIEWS_RAJA_TYPED(Data_type) \
+  using VIEW_1 = RAJA::View<Data_type, \
                             RAJA::Layout<1, Index_type, 0>>; \
 \
-  using VIEW_2 = RAJA::View<Real_type, \
+  using VIEW_2 = RAJA::View<Data_type, \
                             RAJA::Layout<2, Index_type, 1>>; \
 \
   VIEW_1 x1view(x1, RAJA::Layout<1>(N)); \
@@ -84,6 +90,8 @@
   VIEW_1 y2view(y2, RAJA::Layout<1>(N)); \
   VIEW_2 Aview(A, RAJA::Layout<2>(N, N));
 
+#define POLYBENCH_MVT_VIEWS_RAJA POLYBENCH_MVT_VIEWS_RAJA_TYPED(Real_type)
+
 
 #include "common/KernelBase.hpp"
 
@@ -114,12 +122,17 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
   Index_type m_N;
-  Real_ptr m_x1;
-  Real_ptr m_x2;
-  Real_ptr m_y1;
-  Real_ptr m_y2;
-  Real_ptr m_A;
+  Precision_ptr m_x1;
+  Precision_ptr m_x2;
+  Precision_ptr m_y1;
+  Precision_ptr m_y2;
+  Precision_ptr m_A;
 };
 
 } // end namespace polybench
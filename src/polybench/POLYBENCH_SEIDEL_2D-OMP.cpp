@@ -0,0 +1,145 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_SEIDEL_2D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+template < typename Data_type >
+void POLYBENCH_SEIDEL_2D::runOpenMPVariantPrecision(VariantID vid)
+{
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_SEIDEL_2D_DATA_SETUP_TYPED(Data_type);
+
+  // hyperplanes d = 2*i + j of the interior points
+  const Index_type dbeg = 3;
+  const Index_type dend = 3 * (N-2) + 1;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          for (Index_type t = 0; t < tsteps; ++t) {
+            for (Index_type d = dbeg; d < dend; ++d ) {
+              POLYBENCH_SEIDEL_2D_PLANE_RANGE;
+              #pragma omp for schedule(static)
+              for (Index_type i = ifirst; i < ilast; ++i ) {
+                const Index_type j = d - 2*i;
+                POLYBENCH_SEIDEL_2D_BODY;
+              }
+            }
+          }
+        } // end omp parallel region
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto poly_seidel2d_base_lam = [=](Index_type i, Index_type j) {
+                                      POLYBENCH_SEIDEL_2D_BODY;
+                                    };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          for (Index_type t = 0; t < tsteps; ++t) {
+            for (Index_type d = dbeg; d < dend; ++d ) {
+              POLYBENCH_SEIDEL_2D_PLANE_RANGE;
+              #pragma omp for schedule(static)
+              for (Index_type i = ifirst; i < ilast; ++i ) {
+                poly_seidel2d_base_lam(i, d - 2*i);
+              }
+            }
+          }
+        } // end omp parallel region
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      POLYBENCH_SEIDEL_2D_VIEWS_RAJA_TYPED(Data_type);
+
+      auto poly_seidel2d_lam = [=](Index_type i, Index_type j) {
+                                 POLYBENCH_SEIDEL_2D_BODY_RAJA;
+                               };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::region<RAJA::omp_parallel_region>( [=]() {
+
+          for (Index_type t = 0; t < tsteps; ++t) {
+            for (Index_type d = dbeg; d < dend; ++d ) {
+              POLYBENCH_SEIDEL_2D_PLANE_RANGE;
+              RAJA::forall<RAJA::omp_for_exec>(
+                RAJA::RangeSegment(ifirst, ilast), [=](Index_type i) {
+                poly_seidel2d_lam(i, d - 2*i);
+              });
+            }
+          }
+
+        }); // end omp parallel region
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_SEIDEL_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void POLYBENCH_SEIDEL_2D::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
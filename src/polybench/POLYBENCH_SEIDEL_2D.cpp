@@ -0,0 +1,98 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_SEIDEL_2D.hpp"
+
+#include "RAJA/RAJA.hpp"
+#include "common/DataUtils.hpp"
+
+#include <vector>
+
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+POLYBENCH_SEIDEL_2D::POLYBENCH_SEIDEL_2D(const RunParams& params)
+  : KernelBase(rajaperf::Polybench_SEIDEL_2D, params)
+{
+  Index_type N_default = 1000;
+
+  setDefaultProblemSize( N_default * N_default );
+  setDefaultReps(10);
+
+  m_N = std::sqrt( getTargetProblemSize() ) + 1;
+  m_tsteps = 20;
+
+
+  setActualProblemSize( (m_N-2) * (m_N-2) );
+
+  setItsPerRep( m_tsteps * (m_N-2) * (m_N-2) );
+  setKernelsPerRep(1);
+  setBytesPerRep( m_tsteps * ( (1*sizeof(Real_type ) + 0*sizeof(Real_type )) *
+                               (m_N-2) * (m_N-2) +
+                               (0*sizeof(Real_type ) + 1*sizeof(Real_type )) *
+                               (m_N * m_N - 4) ) );
+  setFLOPsPerRep( m_tsteps * 9 * (m_N-2) * (m_N-2) );
+
+  checksum_scale_factor = 0.0001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Kernel);
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    m_tsteps * ( (1*data_size + 0*data_size) *
+                                 (m_N-2) * (m_N-2) +
+                                 (0*data_size + 1*data_size) *
+                                 (m_N * m_N - 4) ) );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
+}
+
+POLYBENCH_SEIDEL_2D::~POLYBENCH_SEIDEL_2D()
+{
+}
+
+void POLYBENCH_SEIDEL_2D::setUp(VariantID vid)
+{
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitData(m_A, m_N*m_N, pid, vid);
+}
+
+void POLYBENCH_SEIDEL_2D::updateChecksum(VariantID vid)
+{
+  checksum[vid] += calcChecksum(m_A, m_N*m_N, checksum_scale_factor );
+}
+
+void POLYBENCH_SEIDEL_2D::tearDown(VariantID vid)
+{
+  (void) vid;
+  deallocData(m_A);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
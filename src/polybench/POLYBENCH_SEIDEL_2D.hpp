@@ -0,0 +1,120 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// POLYBENCH_SEIDEL_2D kernel reference implementation:
+///
+/// for (t = 0; t < TSTEPS; t++)
+/// {
+///   for (i = 1; i < N - 1; i++) {
+///     for (j = 1; j < N - 1; j++) {
+///       A[i][j] = (A[i-1][j-1] + A[i-1][j] + A[i-1][j+1] +
+///                  A[i][j-1] + A[i][j] + A[i][j+1] +
+///                  A[i+1][j-1] + A[i+1][j] + A[i+1][j+1]) / 9.0;
+///     }
+///   }
+/// }
+///
+/// A[i][j] reads values already updated on the same sweep at (i-1, j-1),
+/// (i-1, j), (i-1, j+1) and (i, j-1), all of which lie on hyperplanes
+/// d' = 2*i' + j' < 2*i + j. The parallel variants therefore sweep the
+/// hyperplanes d = 2*i + j in order and update each one in parallel,
+/// reproducing the sequential result.
+///
+
+
+#ifndef RAJAPerf_POLYBENCH_SEIDEL_2D_HPP
+#define RAJAPerf_POLYBENCH_SEIDEL_2D_HPP
+
+#define POLYBENCH_SEIDEL_2D_DATA_SETUP_TYPED(Data_type) \
+  Data_type* A = m_A.get<Data_type>(); \
+\
+  const Index_type N = m_N; \
+  const Index_type tsteps = m_tsteps;
+
+#define POLYBENCH_SEIDEL_2D_DATA_SETUP POLYBENCH_SEIDEL_2D_DATA_SETUP_TYPED(Real_type)
+
+
+#define POLYBENCH_SEIDEL_2D_BODY \
+  A[j + i*N] = (A[j-1 + (i-1)*N] + A[j + (i-1)*N] + A[j+1 + (i-1)*N] + \
+                A[j-1 + i*N] + A[j + i*N] + A[j+1 + i*N] + \
+                A[j-1 + (i+1)*N] + A[j + (i+1)*N] + A[j+1 + (i+1)*N]) / 9.0;
+
+#define POLYBENCH_SEIDEL_2D_BODY_RAJA \
+  Aview(i,j) = (Aview(i-1,j-1) + Aview(i-1,j) + Aview(i-1,j+1) + \
+                Aview(i,j-1) + Aview(i,j) + Aview(i,j+1) + \
+                Aview(i+1,j-1) + Aview(i+1,j) + Aview(i+1,j+1)) / 9.0;
+
+// Rows [ifirst, ilast) of interior points on hyperplane d = 2*i + j
+#define POLYBENCH_SEIDEL_2D_PLANE_RANGE \
+  const Index_type ifirst = RAJA_MAX(1, (d - (N-2) + 1) / 2); \
+  const Index_type ilast = RAJA_MIN(N-1, (d-1) / 2 + 1);
+
+
+#define POLYBENCH_SEIDEL_2D_VIEWS_RAJA_TYPED(Data_type) \
+using VIEW_TYPE = RAJA::View<Data_type, \
+                             RAJA::Layout<2, Index_type, 1>>; \
+\
+  VIEW_TYPE Aview(A, RAJA::Layout<2>(N, N));
+
+#define POLYBENCH_SEIDEL_2D_VIEWS_RAJA POLYBENCH_SEIDEL_2D_VIEWS_RAJA_TYPED(Real_type)
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+
+class RunParams;
+
+namespace polybench
+{
+
+class POLYBENCH_SEIDEL_2D : public KernelBase
+{
+public:
+
+  POLYBENCH_SEIDEL_2D(const RunParams& params);
+
+  ~POLYBENCH_SEIDEL_2D();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  POLYBENCH_SEIDEL_2D : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  POLYBENCH_SEIDEL_2D : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  POLYBENCH_SEIDEL_2D : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Index_type m_N;
+  Index_type m_tsteps;
+
+  Precision_ptr m_A;
+};
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,129 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_SYRK.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+template < typename Data_type >
+void POLYBENCH_SYRK::runSeqVariantPrecision(VariantID vid)
+{
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_SYRK_DATA_SETUP_TYPED(Data_type);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < N; ++i ) {
+          for (Index_type j = 0; j <= i; ++j ) {
+            POLYBENCH_SYRK_BODY1;
+          }
+          for (Index_type k = 0; k < M; ++k ) {
+            for (Index_type j = 0; j <= i; ++j ) {
+              POLYBENCH_SYRK_BODY2;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto poly_syrk_base_lam1 = [=](Index_type i, Index_type j) {
+                                   POLYBENCH_SYRK_BODY1;
+                                 };
+      auto poly_syrk_base_lam2 = [=](Index_type i, Index_type j,
+                                     Index_type k) {
+                                   POLYBENCH_SYRK_BODY2;
+                                 };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < N; ++i ) {
+          for (Index_type j = 0; j <= i; ++j ) {
+            poly_syrk_base_lam1(i, j);
+          }
+          for (Index_type k = 0; k < M; ++k ) {
+            for (Index_type j = 0; j <= i; ++j ) {
+              poly_syrk_base_lam2(i, j, k);
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      POLYBENCH_SYRK_VIEWS_RAJA_TYPED(Data_type);
+
+      auto poly_syrk_lam = [=](Index_type i) {
+                             for (Index_type j = 0; j <= i; ++j ) {
+                               POLYBENCH_SYRK_BODY1_RAJA;
+                             }
+                             for (Index_type k = 0; k < M; ++k ) {
+                               for (Index_type j = 0; j <= i; ++j ) {
+                                 POLYBENCH_SYRK_BODY2_RAJA;
+                               }
+                             }
+                           };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment{0, N}, poly_syrk_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  POLYBENCH_SYRK : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void POLYBENCH_SYRK::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
@@ -0,0 +1,100 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_SYRK.hpp"
+
+#include "RAJA/RAJA.hpp"
+#include "common/DataUtils.hpp"
+
+#include <vector>
+
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+POLYBENCH_SYRK::POLYBENCH_SYRK(const RunParams& params)
+  : KernelBase(rajaperf::Polybench_SYRK, params)
+{
+  Index_type N_default = 1000;
+  Index_type M_default = 1200;
+
+  setDefaultProblemSize( N_default * N_default );
+  setDefaultReps(4);
+
+  m_N = std::sqrt( getTargetProblemSize() ) + 1;
+  m_M = M_default;
+
+  m_alpha = 0.62;
+  m_beta = 1.002;
+
+
+  setActualProblemSize( m_N * m_N );
+
+  setItsPerRep( m_N * (m_N + 1) / 2 );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_N * (m_N + 1) / 2 +
+                  (0*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_N * m_M );
+  setFLOPsPerRep((1 +
+                  3 * m_M) * m_N * (m_N + 1) / 2);
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (1*data_size + 1*data_size) * m_N * (m_N + 1) / 2 +
+                    (0*data_size + 1*data_size) * m_N * m_M );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
+}
+
+POLYBENCH_SYRK::~POLYBENCH_SYRK()
+{
+}
+
+void POLYBENCH_SYRK::setUp(VariantID vid)
+{
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitData(m_A, m_N * m_M, pid, vid);
+  allocAndInitData(m_C, m_N * m_N, pid, vid);
+}
+
+void POLYBENCH_SYRK::updateChecksum(VariantID vid)
+{
+  checksum[vid] += calcChecksum(m_C, m_N * m_N, checksum_scale_factor );
+}
+
+void POLYBENCH_SYRK::tearDown(VariantID vid)
+{
+  (void) vid;
+  deallocData(m_A);
+  deallocData(m_C);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
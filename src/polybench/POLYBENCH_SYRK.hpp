@@ -0,0 +1,124 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// POLYBENCH_SYRK kernel reference implementation:
+///
+/// for (Index_type i = 0; i < N; i++) {
+///   for (Index_type j = 0; j <= i; j++) {
+///     C[i][j] *= beta;
+///   }
+///   for (Index_type k = 0; k < M; k++) {
+///     for (Index_type j = 0; j <= i; j++) {
+///       C[i][j] += alpha * A[i][k] * A[j][k];
+///     }
+///   }
+/// }
+///
+/// Only the lower triangle of C is updated. Rows are independent but
+/// carry i+1 entries, so the parallel variants hand out rows cyclically
+/// to balance the triangular iteration space.
+///
+
+
+#ifndef RAJAPerf_POLYBENCH_SYRK_HPP
+#define RAJAPerf_POLYBENCH_SYRK_HPP
+
+#define POLYBENCH_SYRK_DATA_SETUP_TYPED(Data_type) \
+  Data_type* A = m_A.get<Data_type>(); \
+  Data_type* C = m_C.get<Data_type>(); \
+  Data_type alpha = m_alpha; \
+  Data_type beta = m_beta; \
+\
+  const Index_type N = m_N; \
+  const Index_type M = m_M;
+
+#define POLYBENCH_SYRK_DATA_SETUP POLYBENCH_SYRK_DATA_SETUP_TYPED(Real_type)
+
+
+#define POLYBENCH_SYRK_BODY1 \
+  C[j + i*N] *= beta;
+
+#define POLYBENCH_SYRK_BODY2 \
+  C[j + i*N] += alpha * A[k + i*M] * A[k + j*M];
+
+
+#define POLYBENCH_SYRK_BODY1_RAJA \
+  Cview(i, j) *= beta;
+
+#define POLYBENCH_SYRK_BODY2_RAJA \
+  Cview(i, j) += alpha * Aview(i, k) * Aview(j, k);
+
+
+#define POLYBENCH_SYRK_VIEWS_RAJA_TYPED(Data_type) \
+  using VIEW_TYPE = RAJA::View<Data_type, \
+                               RAJA::Layout<2, Index_type, 1>>; \
+\
+  VIEW_TYPE Aview(A, RAJA::Layout<2>(N, M)); \
+  VIEW_TYPE Cview(C, RAJA::Layout<2>(N, N));
+
+#define POLYBENCH_SYRK_VIEWS_RAJA POLYBENCH_SYRK_VIEWS_RAJA_TYPED(Real_type)
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+
+class RunParams;
+
+namespace polybench
+{
+
+class POLYBENCH_SYRK : public KernelBase
+{
+public:
+
+  POLYBENCH_SYRK(const RunParams& params);
+
+  ~POLYBENCH_SYRK();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  POLYBENCH_SYRK : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  POLYBENCH_SYRK : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  POLYBENCH_SYRK : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Index_type m_N;
+  Index_type m_M;
+
+  Real_type m_alpha;
+  Real_type m_beta;
+
+  Precision_ptr m_A;
+  Precision_ptr m_C;
+};
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,200 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_TRISOLV.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+template < typename Data_type >
+void POLYBENCH_TRISOLV::runOpenMPVariantPrecision(VariantID vid)
+{
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_TRISOLV_DATA_SETUP_TYPED(Data_type);
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+
+          #pragma omp for
+          for (Index_type i = 0; i < N; ++i ) {
+            POLYBENCH_TRISOLV_BODY1;
+          }
+
+          for (Index_type jb = 0; jb < N; jb += bsize ) {
+            const Index_type je = (jb + bsize < N) ? jb + bsize : N;
+
+            #pragma omp single
+            for (Index_type i = jb; i < je; ++i ) {
+              for (Index_type j = jb; j < i; ++j ) {
+                POLYBENCH_TRISOLV_BODY2;
+              }
+              POLYBENCH_TRISOLV_BODY3;
+            }
+
+            #pragma omp for
+            for (Index_type i = je; i < N; ++i ) {
+              for (Index_type j = jb; j < je; ++j ) {
+                POLYBENCH_TRISOLV_BODY2;
+              }
+            }
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto poly_trisolv_base_lam1 = [=](Index_type i) {
+                                      POLYBENCH_TRISOLV_BODY1;
+                                    };
+      auto poly_trisolv_base_lam2 = [=](Index_type i, Index_type j) {
+                                      POLYBENCH_TRISOLV_BODY2;
+                                    };
+      auto poly_trisolv_base_lam3 = [=](Index_type i) {
+                                      POLYBENCH_TRISOLV_BODY3;
+                                    };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+
+          #pragma omp for
+          for (Index_type i = 0; i < N; ++i ) {
+            poly_trisolv_base_lam1(i);
+          }
+
+          for (Index_type jb = 0; jb < N; jb += bsize ) {
+            const Index_type je = (jb + bsize < N) ? jb + bsize : N;
+
+            #pragma omp single
+            for (Index_type i = jb; i < je; ++i ) {
+              for (Index_type j = jb; j < i; ++j ) {
+                poly_trisolv_base_lam2(i, j);
+              }
+              poly_trisolv_base_lam3(i);
+            }
+
+            #pragma omp for
+            for (Index_type i = je; i < N; ++i ) {
+              for (Index_type j = jb; j < je; ++j ) {
+                poly_trisolv_base_lam2(i, j);
+              }
+            }
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      POLYBENCH_TRISOLV_VIEWS_RAJA_TYPED(Data_type);
+
+      auto poly_trisolv_lam1 = [=](Index_type i) {
+                                 POLYBENCH_TRISOLV_BODY1_RAJA;
+                               };
+      auto poly_trisolv_lam2 = [=](Index_type i, Index_type j) {
+                                 POLYBENCH_TRISOLV_BODY2_RAJA;
+                               };
+      auto poly_trisolv_lam3 = [=](Index_type i) {
+                                 POLYBENCH_TRISOLV_BODY3_RAJA;
+                               };
+
+      using EXEC_POL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<0, RAJA::omp_parallel_for_exec,
+            RAJA::statement::For<1, RAJA::loop_exec,
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment{0, N}, poly_trisolv_lam1);
+
+        for (Index_type jb = 0; jb < N; jb += bsize ) {
+          const Index_type je = (jb + bsize < N) ? jb + bsize : N;
+
+          for (Index_type i = jb; i < je; ++i ) {
+            RAJA::forall<RAJA::loop_exec>(
+              RAJA::RangeSegment{jb, i}, [=](Index_type j) {
+              poly_trisolv_lam2(i, j);
+            });
+            poly_trisolv_lam3(i);
+          }
+
+          RAJA::kernel<EXEC_POL>(
+            RAJA::make_tuple( RAJA::RangeSegment{je, N},
+                              RAJA::RangeSegment{jb, je} ),
+            poly_trisolv_lam2
+          );
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  POLYBENCH_TRISOLV : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void POLYBENCH_TRISOLV::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runOpenMPVariantPrecision<Float_type>(vid); break;
+    default : runOpenMPVariantPrecision<Double_type>(vid); break;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
@@ -0,0 +1,123 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_TRISOLV.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+
+template < typename Data_type >
+void POLYBENCH_TRISOLV::runSeqVariantPrecision(VariantID vid)
+{
+  const Index_type run_reps= getRunReps();
+
+  POLYBENCH_TRISOLV_DATA_SETUP_TYPED(Data_type);
+  (void) bsize;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < N; ++i ) {
+          POLYBENCH_TRISOLV_BODY1;
+          for (Index_type j = 0; j < i; ++j ) {
+            POLYBENCH_TRISOLV_BODY2;
+          }
+          POLYBENCH_TRISOLV_BODY3;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto poly_trisolv_base_lam1 = [=](Index_type i) {
+                                      POLYBENCH_TRISOLV_BODY1;
+                                    };
+      auto poly_trisolv_base_lam2 = [=](Index_type i, Index_type j) {
+                                      POLYBENCH_TRISOLV_BODY2;
+                                    };
+      auto poly_trisolv_base_lam3 = [=](Index_type i) {
+                                      POLYBENCH_TRISOLV_BODY3;
+                                    };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < N; ++i ) {
+          poly_trisolv_base_lam1(i);
+          for (Index_type j = 0; j < i; ++j ) {
+            poly_trisolv_base_lam2(i, j);
+          }
+          poly_trisolv_base_lam3(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      POLYBENCH_TRISOLV_VIEWS_RAJA_TYPED(Data_type);
+
+      auto poly_trisolv_lam = [=](Index_type i) {
+                                POLYBENCH_TRISOLV_BODY1_RAJA;
+                                for (Index_type j = 0; j < i; ++j ) {
+                                  POLYBENCH_TRISOLV_BODY2_RAJA;
+                                }
+                                POLYBENCH_TRISOLV_BODY3_RAJA;
+                              };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment{0, N}, poly_trisolv_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  POLYBENCH_TRISOLV : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void POLYBENCH_TRISOLV::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
@@ -0,0 +1,120 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "POLYBENCH_TRISOLV.hpp"
+
+#include "RAJA/RAJA.hpp"
+#include "common/DataUtils.hpp"
+
+#include <vector>
+
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+//
+// Unit-dominant diagonal and small off-diagonal entries keep the
+// solution bounded for any N.
+//
+template < typename Data_type >
+static void scaleLowerTriangle(Data_type* L, Index_type N)
+{
+  for (Index_type i = 0; i < N; ++i) {
+    for (Index_type j = 0; j < i; ++j) {
+      L[j + i*N] /= N;
+    }
+    L[i + i*N] += 1.0;
+  }
+}
+
+
+POLYBENCH_TRISOLV::POLYBENCH_TRISOLV(const RunParams& params)
+  : KernelBase(rajaperf::Polybench_TRISOLV, params)
+{
+  Index_type N_default = 2000;
+
+  setDefaultProblemSize( N_default * N_default );
+  setDefaultReps(100);
+
+  m_N = std::sqrt( getTargetProblemSize() ) + 1;
+
+  m_bsize = 64;
+
+
+  setActualProblemSize( m_N * m_N );
+
+  setItsPerRep( m_N * (m_N + 1) / 2 );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_N +
+                  (0*sizeof(Real_type ) + 1*sizeof(Real_type )) * m_N * (m_N + 1) / 2 );
+  setFLOPsPerRep( 2 * m_N * (m_N - 1) / 2 +
+                  1 * m_N );
+
+  checksum_scale_factor = 1.0 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (1*data_size + 1*data_size) * m_N +
+                    (0*data_size + 1*data_size) * m_N * (m_N + 1) / 2 );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
+}
+
+POLYBENCH_TRISOLV::~POLYBENCH_TRISOLV()
+{
+}
+
+void POLYBENCH_TRISOLV::setUp(VariantID vid)
+{
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitData(m_L, m_N * m_N, pid, vid);
+  allocAndInitData(m_b, m_N, pid, vid);
+  allocAndInitDataConst(m_x, m_N, 0.0, pid, vid);
+
+  if ( pid == Precision_Float ) {
+    scaleLowerTriangle(m_L.get<Float_type>(), m_N);
+  } else {
+    scaleLowerTriangle(m_L.get<Double_type>(), m_N);
+  }
+}
+
+void POLYBENCH_TRISOLV::updateChecksum(VariantID vid)
+{
+  checksum[vid] += calcChecksum(m_x, m_N, checksum_scale_factor );
+}
+
+void POLYBENCH_TRISOLV::tearDown(VariantID vid)
+{
+  (void) vid;
+  deallocData(m_L);
+  deallocData(m_x);
+  deallocData(m_b);
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
@@ -0,0 +1,145 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-21, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// POLYBENCH_TRISOLV kernel reference implementation:
+///
+/// for (Index_type i = 0; i < N; i++) {
+///   x[i] = b[i];
+///   for (Index_type j = 0; j < i; j++) {
+///     x[i] -= L[i][j] * x[j];
+///   }
+///   x[i] = x[i] / L[i][i];
+/// }
+///
+/// Blocked variants solve the diagonal block of rows [jb, je) serially,
+/// then subtract its contribution from all trailing rows in parallel:
+///
+/// for (Index_type jb = 0; jb < N; jb += bsize) {
+///   Index_type je = min(jb + bsize, N);
+///   for (Index_type i = jb; i < je; i++) {
+///     for (Index_type j = jb; j < i; j++) {
+///       x[i] -= L[i][j] * x[j];
+///     }
+///     x[i] = x[i] / L[i][i];
+///   }
+///   for (Index_type i = je; i < N; i++) {     // parallel
+///     for (Index_type j = jb; j < je; j++) {
+///       x[i] -= L[i][j] * x[j];
+///     }
+///   }
+/// }
+///
+/// Each x[i] sees the same operations in the same order as in the
+/// reference loop, so the results are identical.
+///
+
+
+#ifndef RAJAPerf_POLYBENCH_TRISOLV_HPP
+#define RAJAPerf_POLYBENCH_TRISOLV_HPP
+
+#define POLYBENCH_TRISOLV_DATA_SETUP_TYPED(Data_type) \
+  Data_type* L = m_L.get<Data_type>(); \
+  Data_type* x = m_x.get<Data_type>(); \
+  Data_type* b = m_b.get<Data_type>(); \
+\
+  const Index_type N = m_N; \
+  const Index_type bsize = m_bsize;
+
+#define POLYBENCH_TRISOLV_DATA_SETUP POLYBENCH_TRISOLV_DATA_SETUP_TYPED(Real_type)
+
+
+#define POLYBENCH_TRISOLV_BODY1 \
+  x[i] = b[i];
+
+#define POLYBENCH_TRISOLV_BODY2 \
+  x[i] -= L[j + i*N] * x[j];
+
+#define POLYBENCH_TRISOLV_BODY3 \
+  x[i] = x[i] / L[i + i*N];
+
+
+#define POLYBENCH_TRISOLV_BODY1_RAJA \
+  xview(i) = bview(i);
+
+#define POLYBENCH_TRISOLV_BODY2_RAJA \
+  xview(i) -= Lview(i, j) * xview(j);
+
+#define POLYBENCH_TRISOLV_BODY3_RAJA \
+  xview(i) = xview(i) / Lview(i, i);
+
+
+#define POLYBENCH_TRISOLV_VIEWS_RAJA_TYPED(Data_type) \
+  using VIEW_1 = RAJA::View<Data_type, \
+                            RAJA::Layout<1, Index_type, 0>>; \
+\
+  using VIEW_2 = RAJA::View<Data_type, \
+                            RAJA::Layout<2, Index_type, 1>>; \
+\
+  VIEW_1 xview(x, RAJA::Layout<1>(N)); \
+  VIEW_1 bview(b, RAJA::Layout<1>(N)); \
+  VIEW_2 Lview(L, RAJA::Layout<2>(N, N));
+
+#define POLYBENCH_TRISOLV_VIEWS_RAJA POLYBENCH_TRISOLV_VIEWS_RAJA_TYPED(Real_type)
+
+
+#include "common/KernelBase.hpp"
+
+namespace rajaperf
+{
+
+class RunParams;
+
+namespace polybench
+{
+
+class POLYBENCH_TRISOLV : public KernelBase
+{
+public:
+
+  POLYBENCH_TRISOLV(const RunParams& params);
+
+  ~POLYBENCH_TRISOLV();
+
+  void setUp(VariantID vid);
+  void updateChecksum(VariantID vid);
+  void tearDown(VariantID vid);
+
+  void runSeqVariant(VariantID vid);
+  void runOpenMPVariant(VariantID vid);
+  void runCudaVariant(VariantID vid)
+  {
+    getCout() << "\n  POLYBENCH_TRISOLV : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid)
+  {
+    getCout() << "\n  POLYBENCH_TRISOLV : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid)
+  {
+    getCout() << "\n  POLYBENCH_TRISOLV : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+private:
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Index_type m_N;
+  Index_type m_bsize;
+
+  Precision_ptr m_L;
+  Precision_ptr m_x;
+  Precision_ptr m_b;
+};
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
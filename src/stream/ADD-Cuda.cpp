@@ -28,12 +28,12 @@ namespace stream
 
 
 #define ADD_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(a, m_a, iend); \
-  allocAndInitCudaDeviceData(b, m_b, iend); \
-  allocAndInitCudaDeviceData(c, m_c, iend);
+  allocAndInitCudaDeviceData(a, m_a.get<Real_type>(), iend); \
+  allocAndInitCudaDeviceData(b, m_b.get<Real_type>(), iend); \
+  allocAndInitCudaDeviceData(c, m_c.get<Real_type>(), iend);
 
 #define ADD_DATA_TEARDOWN_CUDA \
-  getCudaDeviceData(m_c, c, iend); \
+  getCudaDeviceData(m_c.get<Real_type>(), c, iend); \
   deallocCudaDeviceData(a); \
   deallocCudaDeviceData(b); \
   deallocCudaDeviceData(c);
@@ -28,12 +28,12 @@ namespace stream
 
 
 #define ADD_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(a, m_a, iend); \
-  allocAndInitHipDeviceData(b, m_b, iend); \
-  allocAndInitHipDeviceData(c, m_c, iend);
+  allocAndInitHipDeviceData(a, m_a.get<Real_type>(), iend); \
+  allocAndInitHipDeviceData(b, m_b.get<Real_type>(), iend); \
+  allocAndInitHipDeviceData(c, m_c.get<Real_type>(), iend);
 
 #define ADD_DATA_TEARDOWN_HIP \
-  getHipDeviceData(m_c, c, iend); \
+  getHipDeviceData(m_c.get<Real_type>(), c, iend); \
   deallocHipDeviceData(a); \
   deallocHipDeviceData(b); \
   deallocHipDeviceData(c);
@@ -30,12 +30,12 @@ namespace stream
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(a, m_a, iend, did, hid); \
-  allocAndInitOpenMPDeviceData(b, m_b, iend, did, hid); \
-  allocAndInitOpenMPDeviceData(c, m_c, iend, did, hid);
+  allocAndInitOpenMPDeviceData(a, m_a.get<Real_type>(), iend, did, hid); \
+  allocAndInitOpenMPDeviceData(b, m_b.get<Real_type>(), iend, did, hid); \
+  allocAndInitOpenMPDeviceData(c, m_c.get<Real_type>(), iend, did, hid);
 
 #define ADD_DATA_TEARDOWN_OMP_TARGET \
-  getOpenMPDeviceData(m_c, c, iend, hid, did); \
+  getOpenMPDeviceData(m_c.get<Real_type>(), c, iend, hid, did); \
   deallocOpenMPDeviceData(a, did); \
   deallocOpenMPDeviceData(b, did); \
   deallocOpenMPDeviceData(c, did);
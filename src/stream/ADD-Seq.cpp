@@ -18,13 +18,14 @@ namespace stream
 {
 
 
-void ADD::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void ADD::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  ADD_DATA_SETUP;
+  ADD_DATA_SETUP_TYPED(Data_type);
 
   auto add_lam = [=](Index_type i) {
                    ADD_BODY;
@@ -86,5 +87,13 @@ void ADD::runSeqVariant(VariantID vid)
 
 }
 
+void ADD::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace stream
 } // end namespace rajaperf
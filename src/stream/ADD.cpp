@@ -12,6 +12,8 @@
 
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 namespace stream
@@ -52,6 +54,18 @@ ADD::ADD(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (1*data_size + 2*data_size) *
+                    getActualProblemSize() );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 ADD::~ADD()
@@ -60,9 +74,11 @@ ADD::~ADD()
 
 void ADD::setUp(VariantID vid)
 {
-  allocAndInitData(m_a, getActualProblemSize(), vid);
-  allocAndInitData(m_b, getActualProblemSize(), vid);
-  allocAndInitDataConst(m_c, getActualProblemSize(), 0.0, vid);
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitData(m_a, getActualProblemSize(), pid, vid);
+  allocAndInitData(m_b, getActualProblemSize(), pid, vid);
+  allocAndInitDataConst(m_c, getActualProblemSize(), 0.0, pid, vid);
 }
 
 void ADD::updateChecksum(VariantID vid)
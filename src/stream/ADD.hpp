@@ -17,10 +17,12 @@
 #ifndef RAJAPerf_Stream_ADD_HPP
 #define RAJAPerf_Stream_ADD_HPP
 
-#define ADD_DATA_SETUP \
-  Real_ptr a = m_a; \
-  Real_ptr b = m_b; \
-  Real_ptr c = m_c;
+#define ADD_DATA_SETUP_TYPED(Data_type) \
+  Data_type* a = m_a.get<Data_type>(); \
+  Data_type* b = m_b.get<Data_type>(); \
+  Data_type* c = m_c.get<Data_type>();
+
+#define ADD_DATA_SETUP ADD_DATA_SETUP_TYPED(Real_type)
 
 #define ADD_BODY  \
   c[i] = a[i] + b[i];
@@ -54,9 +56,14 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
-  Real_ptr m_a;
-  Real_ptr m_b;
-  Real_ptr m_c;
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_a;
+  Precision_ptr m_b;
+  Precision_ptr m_c;
 
 };
 
@@ -28,11 +28,11 @@ namespace stream
 
 
 #define COPY_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(a, m_a, iend); \
-  allocAndInitCudaDeviceData(c, m_c, iend);
+  allocAndInitCudaDeviceData(a, m_a.get<Real_type>(), iend); \
+  allocAndInitCudaDeviceData(c, m_c.get<Real_type>(), iend);
 
 #define COPY_DATA_TEARDOWN_CUDA \
-  getCudaDeviceData(m_c, c, iend); \
+  getCudaDeviceData(m_c.get<Real_type>(), c, iend); \
   deallocCudaDeviceData(a); \
   deallocCudaDeviceData(c);
 
@@ -28,11 +28,11 @@ namespace stream
 
 
 #define COPY_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(a, m_a, iend); \
-  allocAndInitHipDeviceData(c, m_c, iend);
+  allocAndInitHipDeviceData(a, m_a.get<Real_type>(), iend); \
+  allocAndInitHipDeviceData(c, m_c.get<Real_type>(), iend);
 
 #define COPY_DATA_TEARDOWN_HIP \
-  getHipDeviceData(m_c, c, iend); \
+  getHipDeviceData(m_c.get<Real_type>(), c, iend); \
   deallocHipDeviceData(a); \
   deallocHipDeviceData(c);
 
@@ -18,13 +18,14 @@ namespace stream
 {
 
 
-void COPY::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void COPY::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  COPY_DATA_SETUP;
+  COPY_DATA_SETUP_TYPED(Data_type);
 
   auto copy_lam = [=](Index_type i) {
                     COPY_BODY;
@@ -86,5 +87,13 @@ void COPY::runSeqVariant(VariantID vid)
 
 }
 
+void COPY::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace stream
 } // end namespace rajaperf
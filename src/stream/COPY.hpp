@@ -17,9 +17,11 @@
 #ifndef RAJAPerf_Stream_COPY_HPP
 #define RAJAPerf_Stream_COPY_HPP
 
-#define COPY_DATA_SETUP \
-  Real_ptr a = m_a; \
-  Real_ptr c = m_c;
+#define COPY_DATA_SETUP_TYPED(Data_type) \
+  Data_type* a = m_a.get<Data_type>(); \
+  Data_type* c = m_c.get<Data_type>();
+
+#define COPY_DATA_SETUP COPY_DATA_SETUP_TYPED(Real_type)
 
 #define COPY_BODY  \
   c[i] = a[i] ;
@@ -53,8 +55,13 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
-  Real_ptr m_a;
-  Real_ptr m_c;
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_a;
+  Precision_ptr m_c;
 };
 
 } // end namespace stream
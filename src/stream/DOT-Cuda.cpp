@@ -29,8 +29,8 @@ namespace stream
 
 
 #define DOT_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(a, m_a, iend); \
-  allocAndInitCudaDeviceData(b, m_b, iend);
+  allocAndInitCudaDeviceData(a, m_a.get<Real_type>(), iend); \
+  allocAndInitCudaDeviceData(b, m_b.get<Real_type>(), iend);
 
 #define DOT_DATA_TEARDOWN_CUDA \
   deallocCudaDeviceData(a); \
@@ -29,8 +29,8 @@ namespace stream
 
 
 #define DOT_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(a, m_a, iend); \
-  allocAndInitHipDeviceData(b, m_b, iend);
+  allocAndInitHipDeviceData(a, m_a.get<Real_type>(), iend); \
+  allocAndInitHipDeviceData(b, m_b.get<Real_type>(), iend);
 
 #define DOT_DATA_TEARDOWN_HIP \
   deallocHipDeviceData(a); \
@@ -18,15 +18,16 @@ namespace stream
 {
 
 
-void DOT::runOpenMPVariant(VariantID vid)
-{
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
+template < typename Data_type, typename Accum_type >
+void DOT::runOpenMPVariantPrecision(VariantID vid)
+{
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  DOT_DATA_SETUP;
+  DOT_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -35,11 +36,11 @@ void DOT::runOpenMPVariant(VariantID vid)
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type dot = m_dot_init;
+        Accum_type dot = m_dot_init;
 
         #pragma omp parallel for reduction(+:dot)
         for (Index_type i = ibegin; i < iend; ++i ) {
-          DOT_BODY;
+          DOT_BODY_TYPED(Accum_type);
         }
 
         m_dot += dot;
@@ -52,14 +53,14 @@ void DOT::runOpenMPVariant(VariantID vid)
 
     case Lambda_OpenMP : {
 
-      auto dot_base_lam = [=](Index_type i) -> Real_type {
-                            return a[i] * b[i];
+      auto dot_base_lam = [=](Index_type i) -> Accum_type {
+                            return static_cast<Accum_type>(a[i]) * b[i];
                           };
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type dot = m_dot_init;
+        Accum_type dot = m_dot_init;
 
         #pragma omp parallel for reduction(+:dot)
         for (Index_type i = ibegin; i < iend; ++i ) {
@@ -79,11 +80,11 @@ void DOT::runOpenMPVariant(VariantID vid)
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::ReduceSum<RAJA::omp_reduce, Real_type> dot(m_dot_init);
+        RAJA::ReduceSum<RAJA::omp_reduce, Accum_type> dot(m_dot_init);
 
         RAJA::forall<RAJA::omp_parallel_for_exec>(
           RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
-          DOT_BODY;
+          DOT_BODY_TYPED(Accum_type);
         });
 
         m_dot += dot;
@@ -99,6 +100,25 @@ void DOT::runOpenMPVariant(VariantID vid)
     }
 
   }
+}
+
+#endif  // RAJA_ENABLE_OPENMP && RUN_OPENMP
+
+void DOT::runOpenMPVariant(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  switch ( getRunningPrecision() ) {
+    case Precision_Float :
+      runOpenMPVariantPrecision<Float_type, Float_type>(vid);
+      break;
+    case Precision_Mixed :
+      runOpenMPVariantPrecision<Float_type, Double_type>(vid);
+      break;
+    default :
+      runOpenMPVariantPrecision<Double_type, Double_type>(vid);
+      break;
+  }
 
 #else
   RAJA_UNUSED_VAR(vid);
@@ -30,8 +30,8 @@ namespace stream
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(a, m_a, iend, did, hid); \
-  allocAndInitOpenMPDeviceData(b, m_b, iend, did, hid);
+  allocAndInitOpenMPDeviceData(a, m_a.get<Real_type>(), iend, did, hid); \
+  allocAndInitOpenMPDeviceData(b, m_b.get<Real_type>(), iend, did, hid);
 
 #define DOT_DATA_TEARDOWN_OMP_TARGET \
   deallocOpenMPDeviceData(a, did); \
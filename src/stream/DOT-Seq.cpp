@@ -18,13 +18,14 @@ namespace stream
 {
 
 
-void DOT::runSeqVariant(VariantID vid)
+template < typename Data_type, typename Accum_type >
+void DOT::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  DOT_DATA_SETUP;
+  DOT_DATA_SETUP_TYPED(Data_type);
 
   switch ( vid ) {
 
@@ -33,10 +34,10 @@ void DOT::runSeqVariant(VariantID vid)
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type dot = m_dot_init;
+        Accum_type dot = m_dot_init;
 
         for (Index_type i = ibegin; i < iend; ++i ) {
-          DOT_BODY;
+          DOT_BODY_TYPED(Accum_type);
         }
 
          m_dot += dot;
@@ -50,14 +51,14 @@ void DOT::runSeqVariant(VariantID vid)
 #if defined(RUN_RAJA_SEQ)
     case Lambda_Seq : {
 
-      auto dot_base_lam = [=](Index_type i) -> Real_type {
-                            return a[i] * b[i];
+      auto dot_base_lam = [=](Index_type i) -> Accum_type {
+                            return static_cast<Accum_type>(a[i]) * b[i];
                           };
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type dot = m_dot_init;
+        Accum_type dot = m_dot_init;
 
         for (Index_type i = ibegin; i < iend; ++i ) {
           dot += dot_base_lam(i);
@@ -76,11 +77,11 @@ void DOT::runSeqVariant(VariantID vid)
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::ReduceSum<RAJA::seq_reduce, Real_type> dot(m_dot_init);
+        RAJA::ReduceSum<RAJA::seq_reduce, Accum_type> dot(m_dot_init);
 
         RAJA::forall<RAJA::loop_exec>(
           RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
-          DOT_BODY;
+          DOT_BODY_TYPED(Accum_type);
         });
 
         m_dot += static_cast<Real_type>(dot.get());
@@ -100,5 +101,20 @@ void DOT::runSeqVariant(VariantID vid)
 
 }
 
+void DOT::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float :
+      runSeqVariantPrecision<Float_type, Float_type>(vid);
+      break;
+    case Precision_Mixed :
+      runSeqVariantPrecision<Float_type, Double_type>(vid);
+      break;
+    default :
+      runSeqVariantPrecision<Double_type, Double_type>(vid);
+      break;
+  }
+}
+
 } // end namespace stream
 } // end namespace rajaperf
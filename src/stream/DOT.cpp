@@ -12,6 +12,8 @@
 
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 namespace stream
@@ -52,6 +54,20 @@ DOT::DOT(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double,
+                                       Precision_Mixed };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (1*sizeof(Real_type) + 1*sizeof(Real_type)) +
+                    (0*data_size + 2*data_size) *
+                    getActualProblemSize() );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 DOT::~DOT()
@@ -60,8 +76,10 @@ DOT::~DOT()
 
 void DOT::setUp(VariantID vid)
 {
-  allocAndInitData(m_a, getActualProblemSize(), vid);
-  allocAndInitData(m_b, getActualProblemSize(), vid);
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitData(m_a, getActualProblemSize(), pid, vid);
+  allocAndInitData(m_b, getActualProblemSize(), pid, vid);
 
   m_dot = 0.0;
   m_dot_init = 0.0;
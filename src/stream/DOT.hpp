@@ -17,12 +17,16 @@
 #ifndef RAJAPerf_Stream_DOT_HPP
 #define RAJAPerf_Stream_DOT_HPP
 
-#define DOT_DATA_SETUP \
-  Real_ptr a = m_a; \
-  Real_ptr b = m_b;
+#define DOT_DATA_SETUP_TYPED(Data_type) \
+  Data_type* a = m_a.get<Data_type>(); \
+  Data_type* b = m_b.get<Data_type>();
 
-#define DOT_BODY  \
-  dot += a[i] * b[i] ;
+#define DOT_DATA_SETUP DOT_DATA_SETUP_TYPED(Real_type)
+
+#define DOT_BODY_TYPED(Accum_type)  \
+  dot += static_cast<Accum_type>(a[i]) * b[i] ;
+
+#define DOT_BODY DOT_BODY_TYPED(Real_type)
 
 
 #include "common/KernelBase.hpp"
@@ -53,8 +57,13 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
-  Real_ptr m_a;
-  Real_ptr m_b;
+  template < typename Data_type, typename Accum_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type, typename Accum_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_a;
+  Precision_ptr m_b;
   Real_type m_dot;
   Real_type m_dot_init;
 };
@@ -28,11 +28,11 @@ namespace stream
 
 
 #define MUL_DATA_SETUP_CUDA \
-  allocAndInitCudaDeviceData(b, m_b, iend); \
-  allocAndInitCudaDeviceData(c, m_c, iend);
+  allocAndInitCudaDeviceData(b, m_b.get<Real_type>(), iend); \
+  allocAndInitCudaDeviceData(c, m_c.get<Real_type>(), iend);
 
 #define MUL_DATA_TEARDOWN_CUDA \
-  getCudaDeviceData(m_b, b, iend); \
+  getCudaDeviceData(m_b.get<Real_type>(), b, iend); \
   deallocCudaDeviceData(b); \
   deallocCudaDeviceData(c)
 
@@ -28,11 +28,11 @@ namespace stream
 
 
 #define MUL_DATA_SETUP_HIP \
-  allocAndInitHipDeviceData(b, m_b, iend); \
-  allocAndInitHipDeviceData(c, m_c, iend);
+  allocAndInitHipDeviceData(b, m_b.get<Real_type>(), iend); \
+  allocAndInitHipDeviceData(c, m_c.get<Real_type>(), iend);
 
 #define MUL_DATA_TEARDOWN_HIP \
-  getHipDeviceData(m_b, b, iend); \
+  getHipDeviceData(m_b.get<Real_type>(), b, iend); \
   deallocHipDeviceData(b); \
   deallocHipDeviceData(c)
 
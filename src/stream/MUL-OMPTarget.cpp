@@ -30,11 +30,11 @@ namespace stream
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(b, m_b, iend, did, hid); \
-  allocAndInitOpenMPDeviceData(c, m_c, iend, did, hid);
+  allocAndInitOpenMPDeviceData(b, m_b.get<Real_type>(), iend, did, hid); \
+  allocAndInitOpenMPDeviceData(c, m_c.get<Real_type>(), iend, did, hid);
 
 #define MUL_DATA_TEARDOWN_OMP_TARGET \
-  getOpenMPDeviceData(m_b, b, iend, hid, did); \
+  getOpenMPDeviceData(m_b.get<Real_type>(), b, iend, hid, did); \
   deallocOpenMPDeviceData(b, did); \
   deallocOpenMPDeviceData(c, did);
 
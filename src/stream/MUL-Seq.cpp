@@ -18,13 +18,14 @@ namespace stream
 {
 
 
-void MUL::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void MUL::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  MUL_DATA_SETUP;
+  MUL_DATA_SETUP_TYPED(Data_type);
 
   auto mul_lam = [=](Index_type i) {
                    MUL_BODY;
@@ -86,5 +87,13 @@ void MUL::runSeqVariant(VariantID vid)
 
 }
 
+void MUL::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace stream
 } // end namespace rajaperf
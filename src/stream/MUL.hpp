@@ -17,10 +17,12 @@
 #ifndef RAJAPerf_Stream_MUL_HPP
 #define RAJAPerf_Stream_MUL_HPP
 
-#define MUL_DATA_SETUP \
-  Real_ptr b = m_b; \
-  Real_ptr c = m_c; \
-  Real_type alpha = m_alpha;
+#define MUL_DATA_SETUP_TYPED(Data_type) \
+  Data_type* b = m_b.get<Data_type>(); \
+  Data_type* c = m_c.get<Data_type>(); \
+  Data_type alpha = m_alpha;
+
+#define MUL_DATA_SETUP MUL_DATA_SETUP_TYPED(Real_type)
 
 #define MUL_BODY  \
   b[i] = alpha * c[i] ;
@@ -54,8 +56,13 @@ public:
   void runOpenMPTargetVariant(VariantID vid);
 
 private:
-  Real_ptr m_b;
-  Real_ptr m_c;
+  template < typename Data_type >
+  void runSeqVariantPrecision(VariantID vid);
+  template < typename Data_type >
+  void runOpenMPVariantPrecision(VariantID vid);
+
+  Precision_ptr m_b;
+  Precision_ptr m_c;
   Real_type m_alpha;
 };
 
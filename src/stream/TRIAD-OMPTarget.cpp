@@ -30,12 +30,12 @@ namespace stream
   int hid = omp_get_initial_device(); \
   int did = omp_get_default_device(); \
 \
-  allocAndInitOpenMPDeviceData(a, m_a, iend, did, hid); \
-  allocAndInitOpenMPDeviceData(b, m_b, iend, did, hid); \
-  allocAndInitOpenMPDeviceData(c, m_c, iend, did, hid);
+  allocAndInitOpenMPDeviceData(a, m_a.get<Real_type>(), iend, did, hid); \
+  allocAndInitOpenMPDeviceData(b, m_b.get<Real_type>(), iend, did, hid); \
+  allocAndInitOpenMPDeviceData(c, m_c.get<Real_type>(), iend, did, hid);
 
 #define TRIAD_DATA_TEARDOWN_OMP_TARGET \
-  getOpenMPDeviceData(m_a, a, iend, hid, did); \
+  getOpenMPDeviceData(m_a.get<Real_type>(), a, iend, hid, did); \
   deallocOpenMPDeviceData(a, did); \
   deallocOpenMPDeviceData(b, did); \
   deallocOpenMPDeviceData(c, did);
@@ -18,13 +18,14 @@ namespace stream
 {
 
 
-void TRIAD::runSeqVariant(VariantID vid)
+template < typename Data_type >
+void TRIAD::runSeqVariantPrecision(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  TRIAD_DATA_SETUP;
+  TRIAD_DATA_SETUP_TYPED(Data_type);
 
   auto triad_lam = [=](Index_type i) {
                      TRIAD_BODY;
@@ -86,5 +87,13 @@ void TRIAD::runSeqVariant(VariantID vid)
 
 }
 
+void TRIAD::runSeqVariant(VariantID vid)
+{
+  switch ( getRunningPrecision() ) {
+    case Precision_Float : runSeqVariantPrecision<Float_type>(vid); break;
+    default : runSeqVariantPrecision<Double_type>(vid); break;
+  }
+}
+
 } // end namespace stream
 } // end namespace rajaperf
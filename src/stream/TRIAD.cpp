@@ -12,6 +12,8 @@
 
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 namespace stream
@@ -56,6 +58,18 @@ TRIAD::TRIAD(const RunParams& params)
   setVariantDefined( Base_HIP );
   setVariantDefined( Lambda_HIP );
   setVariantDefined( RAJA_HIP );
+
+  std::vector<PrecisionID> precisions{ Precision_Float, Precision_Double };
+  for (PrecisionID pid : precisions) {
+    const Index_type data_size = getPrecisionDataSize(pid);
+    setBytesPerRep( getPrecisionName(pid),
+                    (1*data_size + 2*data_size) *
+                    getActualProblemSize() );
+  }
+  for (VariantID vid : { Base_Seq, Lambda_Seq, RAJA_Seq,
+                        Base_OpenMP, Lambda_OpenMP, RAJA_OpenMP }) {
+    setVariantPrecisions(vid, precisions);
+  }
 }
 
 TRIAD::~TRIAD()
@@ -64,9 +78,11 @@ TRIAD::~TRIAD()
 
 void TRIAD::setUp(VariantID vid)
 {
-  allocAndInitDataConst(m_a, getActualProblemSize(), 0.0, vid);
-  allocAndInitData(m_b, getActualProblemSize(), vid);
-  allocAndInitData(m_c, getActualProblemSize(), vid);
+  const PrecisionID pid = getRunningPrecision();
+
+  allocAndInitDataConst(m_a, getActualProblemSize(), 0.0, pid, vid);
+  allocAndInitData(m_b, getActualProblemSize(), pid, vid);
+  allocAndInitData(m_c, getActualProblemSize(), pid, vid);
   initData(m_alpha, vid);
 }
 